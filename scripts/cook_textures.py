@@ -0,0 +1,230 @@
+#!/usr/bin/env python3
+
+# A script for decoding the stock PNGs ahead of time into textures.v4t, which the game loads
+# without any decoding or converting: every image is already in the engine's ARGB8888 layout,
+# and tilesheets are already cut into tiles in the order the game cuts them.
+#
+# Usage: cook_textures.py <path to data.zip> <output path to textures.v4t> [--indexed]
+#
+# The format is documented in src/GraphicsResources.cpp. Put textures.v4t next to the rest of
+# the game data (inside data.zip, or pass it to repack_data.py with --extra). Custom level
+# assets keep being loaded from their PNGs.
+
+import argparse
+import struct
+import zipfile
+import zlib
+
+# Must match GraphicsResources::init and lazy_image_files: (name, tile size or 0 if it's not a tilesheet, no alpha).
+images = [
+   ("graphics/tiles.png", 8, False),
+   ("graphics/tiles2.png", 8, False),
+   ("graphics/tiles3.png", 8, False),
+   ("graphics/entcolours.png", 8, False),
+   ("graphics/sprites.png", 32, False),
+   ("graphics/flipsprites.png", 32, False),
+   ("graphics/font.png", 8, False),
+   ("graphics/teleporter.png", 96, False),
+   ("graphics/levelcomplete.png", 0, False),
+   ("graphics/minimap.png", 0, True),
+   ("graphics/covered.png", 0, True),
+   ("graphics/elephant.png", 0, False),
+   ("graphics/gamecomplete.png", 0, False),
+   ("graphics/fliplevelcomplete.png", 0, False),
+   ("graphics/flipgamecomplete.png", 0, False),
+   ("graphics/site.png", 0, False),
+   ("graphics/site2.png", 0, False),
+   ("graphics/site3.png", 0, False),
+   ("graphics/ending.png", 0, False),
+   ("graphics/site4.png", 0, False),
+   ("graphics/minimap.png", 0, False),
+]
+
+FORMAT_ARGB8888 = 0
+FORMAT_INDEXED8 = 1
+
+header_size = 8
+entry_size = 56
+name_size = 40
+# Every image starts on a multiple of this, so that it can be read straight into an aligned buffer
+alignment = 64
+
+# Parse command line arguments.
+
+parser = argparse.ArgumentParser(description = "Cook VVVVVV PNGs into textures.v4t")
+
+parser.add_argument("input_file", type = str, help = "Path to data.zip")
+parser.add_argument("output_file", type = str, help = "Output path where textures.v4t should be stored")
+parser.add_argument("--indexed", action = "store_true", help = "Store images with at most 256 colours as 8-bit indices and a palette")
+
+args = parser.parse_args()
+
+# Decode a PNG into a list of (r, g, b, a) tuples. Only what lodepng would accept from the stock
+# data is handled: no interlacing, 8 bits per channel, or palette/grey at 1-8 bits.
+
+def paeth(a, b, c):
+   p = a + b - c
+   pa = abs(p - a)
+   pb = abs(p - b)
+   pc = abs(p - c)
+   if pa <= pb and pa <= pc:
+      return a
+   if pb <= pc:
+      return b
+   return c
+
+def decode_png(data, name):
+   if data[:8] != b"\x89PNG\r\n\x1a\n":
+      raise Exception("%s is not a PNG" % name)
+
+   pos = 8
+   idat = bytearray()
+   palette = []
+   trns = b""
+   while pos < len(data):
+      length, kind = struct.unpack(">I4s", data[pos:pos + 8])
+      chunk = data[pos + 8:pos + 8 + length]
+      pos += 12 + length
+      if kind == b"IHDR":
+         width, height, depth, colour, _, _, interlace = struct.unpack(">IIBBBBB", chunk)
+      elif kind == b"PLTE":
+         palette = [tuple(chunk[i:i + 3]) for i in range(0, len(chunk), 3)]
+      elif kind == b"tRNS":
+         trns = chunk
+      elif kind == b"IDAT":
+         idat += chunk
+      elif kind == b"IEND":
+         break
+
+   if interlace != 0:
+      raise Exception("%s is interlaced" % name)
+   channels = {0: 1, 2: 3, 3: 1, 4: 2, 6: 4}[colour]
+   if depth != 8 and (colour not in (0, 3) or depth > 8):
+      raise Exception("%s has %i bits per channel" % (name, depth))
+
+   raw = zlib.decompress(bytes(idat))
+   stride = (width * channels * depth + 7) // 8
+   bpp = max(1, channels * depth // 8)
+   rows = []
+   prev = bytearray(stride)
+   for y in range(height):
+      kind = raw[y * (stride + 1)]
+      line = bytearray(raw[y * (stride + 1) + 1:(y + 1) * (stride + 1)])
+      for i in range(stride):
+         a = line[i - bpp] if i >= bpp else 0
+         b = prev[i]
+         c = prev[i - bpp] if i >= bpp else 0
+         if kind == 1:
+            line[i] = (line[i] + a) & 0xFF
+         elif kind == 2:
+            line[i] = (line[i] + b) & 0xFF
+         elif kind == 3:
+            line[i] = (line[i] + (a + b) // 2) & 0xFF
+         elif kind == 4:
+            line[i] = (line[i] + paeth(a, b, c)) & 0xFF
+      rows.append(line)
+      prev = line
+
+   pixels = []
+   for line in rows:
+      for x in range(width):
+         if depth < 8:
+            bit = x * depth
+            value = (line[bit // 8] >> (8 - depth - bit % 8)) & ((1 << depth) - 1)
+         else:
+            value = line[x * channels]
+         if colour == 3:
+            r, g, b = palette[value]
+            pixels.append((r, g, b, trns[value] if value < len(trns) else 255))
+         elif colour == 0:
+            grey = value * 255 // ((1 << depth) - 1)
+            pixels.append((grey, grey, grey, 255))
+         elif colour == 4:
+            pixels.append((value, value, value, line[x * 2 + 1]))
+         elif colour == 2:
+            pixels.append(tuple(line[x * 3:x * 3 + 3]) + (255,))
+         else:
+            pixels.append(tuple(line[x * 4:x * 4 + 4]))
+   return width, height, pixels
+
+# Cut a tilesheet the way PROCESS_TILESHEET does: row by row of tiles, each tile's pixels
+# together. GetSubSurface() blends each tile onto an empty surface, which darkens anything that
+# isn't fully opaque, so do the same here.
+
+def cut(width, height, pixels, tile):
+   out = []
+   for ty in range(height // tile):
+      for tx in range(width // tile):
+         for y in range(tile):
+            start = (ty * tile + y) * width + tx * tile
+            for r, g, b, a in pixels[start:start + tile]:
+               if a == 0:
+                  out.append((0, 0, 0, 0))
+               elif a == 255:
+                  out.append((r, g, b, a))
+               else:
+                  out.append((r * a // 255, g * a // 255, b * a // 255, a))
+   return out
+
+def argb(pixel):
+   r, g, b, a = pixel
+   return (a << 24) | (r << 16) | (g << 8) | b
+
+def encode(pixels, indexed):
+   words = [argb(pixel) for pixel in pixels]
+   if indexed:
+      colours = sorted(set(words))
+      # The game expands the indices in place at the end of the final buffer
+      if len(colours) <= 256 and 3 * len(words) >= 256 * 4:
+         lookup = {colour: i for i, colour in enumerate(colours)}
+         colours += [0] * (256 - len(colours))
+         palette = struct.pack("<256I", *colours)
+         return FORMAT_INDEXED8, palette + bytes(lookup[word] for word in words)
+   return FORMAT_ARGB8888, struct.pack("<%iI" % len(words), *words)
+
+# Cook every image.
+
+print("Cooking textures")
+entries = []
+with zipfile.ZipFile(args.input_file, "r") as z:
+   for name, tile, noalpha in images:
+      width, height, pixels = decode_png(z.read(name), name)
+      if noalpha:
+         pixels = [(r, g, b, 255) for r, g, b, _ in pixels]
+      if tile > 0:
+         if width % tile != 0 or height % tile != 0:
+            raise Exception("%s isn't made of %ix%i tiles" % (name, tile, tile))
+         pixels = cut(width, height, pixels, tile)
+      form, payload = encode(pixels, args.indexed)
+      print(" - %s%s: %ix%i, %s, %i bytes" % (
+         name,
+         " (no alpha)" if noalpha else "",
+         width, height,
+         "indexed" if form == FORMAT_INDEXED8 else "ARGB8888",
+         len(payload)
+      ))
+      entries.append((name, width, height, tile, form, noalpha, payload))
+
+# Build textures.v4t.
+
+print("Creating", args.output_file)
+
+def align(n):
+   return (n + alignment - 1) // alignment * alignment
+
+offset = align(header_size + entry_size * len(entries))
+
+with open(args.output_file, "wb") as f:
+   f.write(b"V4TEX")
+   f.write(struct.pack("<BH", 1, len(entries)))
+
+   for name, width, height, tile, form, noalpha, payload in entries:
+      f.write(struct.pack("<%isHHHBBII" % name_size,
+         name.encode("UTF-8"), width, height, tile, form, noalpha, offset, len(payload)))
+      offset = align(offset + len(payload))
+
+   for _, _, _, _, _, _, payload in entries:
+      f.write(b"\0" * (align(f.tell()) - f.tell()))
+      f.write(payload)
+
+   print(" - textures.v4t:", f.tell(), "bytes")
@@ -0,0 +1,151 @@
+#!/usr/bin/env python3
+
+# A script for extracting the tile data of every main game room from the level sources into a
+# level pack, which the game reads rooms from when built with -DLEVEL_PACK=ON.
+#
+# Usage: pack_levels.py <path to src directory> <output path to levels.vvp>
+#
+# The format is documented in src/LevelPack.h. Put levels.vvp next to the rest of the game data
+# (inside data.zip, or pass it to repack_data.py with --extra).
+
+import argparse
+import os
+import re
+import struct
+
+# Must match LevelPackArea in src/LevelPack.h.
+areas = {
+   "LEVELPACK_OTHERLEVEL": 0,
+   "LEVELPACK_LAB": 1,
+   "LEVELPACK_WARP": 2,
+   "LEVELPACK_SPACESTATION2": 3,
+   "LEVELPACK_FINAL": 4,
+   "LEVELPACK_TOWER": 5,
+}
+tower_blocks = {
+   "LEVELPACK_TOWER_MAP": (0, 40 * 700),
+   "LEVELPACK_TOWER_BACKGROUND": (1, 40 * 120),
+   "LEVELPACK_TOWER_MINITOWER1": (2, 40 * 100),
+   "LEVELPACK_TOWER_MINITOWER2": (3, 40 * 100),
+}
+room_cells = 40 * 30
+
+sources = [
+   "Otherlevel.cpp",
+   "Labclass.cpp",
+   "WarpClass.cpp",
+   "Spacestation2.cpp",
+   "Finalclass.cpp",
+   "Tower.cpp",
+]
+
+case_re = re.compile(r"^\s*case rn\(\s*(-?\d+)\s*,\s*(-?\d+)\s*\):")
+room_re = re.compile(r"^\s*ROOM_CONTENTS\((\w+), t, (\d+), \{\s*$")
+tower_re = re.compile(r"^\s*TOWER_CONTENTS\((\w+), \w+, \{\s*$")
+end_re = re.compile(r"^\s*\}\);\s*$")
+
+# Parse command line arguments.
+
+parser = argparse.ArgumentParser(description = "Pack VVVVVV room tiles into levels.vvp")
+
+parser.add_argument("src_dir", type = str, help = "Path to the src directory")
+parser.add_argument("output_file", type = str, help = "Output path where levels.vvp should be stored")
+
+args = parser.parse_args()
+
+# Collect every room. Keys are (area, room, variant) and must be unique.
+
+def parse_source(path):
+   rooms = []
+   room = None
+   key = None
+   cells = None
+   with open(path, "r") as f:
+      for line in f:
+         if cells is not None:
+            if end_re.match(line):
+               rooms.append((key, cells))
+               cells = None
+            else:
+               cells.extend(int(x) for x in line.replace(",", " ").split())
+            continue
+
+         match = case_re.match(line)
+         if match:
+            room = int(match.group(1)) + int(match.group(2)) * 100
+            continue
+
+         match = room_re.match(line)
+         if match:
+            if room is None:
+               raise Exception("%s: ROOM_CONTENTS outside of a case" % path)
+            key = (areas[match.group(1)], room, int(match.group(2)))
+            cells = []
+            continue
+
+         match = tower_re.match(line)
+         if match:
+            key = (areas["LEVELPACK_TOWER"], tower_blocks[match.group(1)][0], 0)
+            cells = []
+            continue
+   return rooms
+
+print("Parsing level sources")
+rooms = {}
+for source in sources:
+   parsed = parse_source(os.path.join(args.src_dir, source))
+   print(" -", source + ":", len(parsed), "entries")
+   for key, cells in parsed:
+      if key in rooms:
+         raise Exception("duplicate room %s in %s" % (key, source))
+      if key[0] == areas["LEVELPACK_TOWER"]:
+         expected = [size for (room, size) in tower_blocks.values() if room == key[1]][0]
+      else:
+         expected = room_cells
+      if len(cells) != expected:
+         raise Exception("room %s in %s has %i tiles, expected %i" % (key, source, len(cells), expected))
+      rooms[key] = cells
+
+# Run-length encode every room as (run, tile) pairs.
+
+def rle(cells):
+   out = bytearray()
+   i = 0
+   while i < len(cells):
+      run = 1
+      while i + run < len(cells) and cells[i + run] == cells[i] and run < 0xFFFF:
+         run += 1
+      out += struct.pack("<Hh", run, cells[i])
+      i += run
+   return bytes(out)
+
+# Build levels.vvp.
+
+print("Creating", args.output_file)
+keys = sorted(rooms.keys())
+payloads = [rle(rooms[key]) for key in keys]
+
+header_size = 8
+entry_size = 16
+offset = header_size + entry_size * len(keys)
+
+with open(args.output_file, "wb") as f:
+   f.write(b"V4LVL")
+   f.write(struct.pack("<BH", 1, len(keys)))
+
+   for key, payload in zip(keys, payloads):
+      area, room, variant = key
+      f.write(struct.pack("<BBHIII", area, variant, room, len(rooms[key]), offset, len(payload)))
+      offset += len(payload)
+
+   for payload in payloads:
+      f.write(payload)
+
+# Report what moved out of the executable.
+
+raw_size = sum(len(cells) * 2 for cells in rooms.values())
+print(" - entries:", len(keys))
+print(" - tile data compiled in without LEVEL_PACK:", raw_size, "bytes")
+print(" - levels.vvp:", offset, "bytes")
+print(" - resident with LEVEL_PACK: %i bytes of index + %i bytes of room cache" %
+   (entry_size * len(keys), 4 * room_cells * 2))
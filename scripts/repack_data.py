@@ -3,7 +3,7 @@
 # A script for repacking data from a compressed .zip to an uncompressed .psp that's easier to read
 # back from the disk.
 #
-# Usage: repack_data.py <path to data.zip> <output path to data.psp>
+# Usage: repack_data.py <path to data.zip> <output path to data.psp> [--extra <file>...]
 
 import argparse
 import os
@@ -17,6 +17,7 @@ parser = argparse.ArgumentParser(description = "Repack VVVVVV data.zip to data.p
 
 parser.add_argument("input_file", type = str, help = "Path to data.zip")
 parser.add_argument("output_file", type = str, help = "Output path where data.psp should be stored")
+parser.add_argument("--extra", type = str, nargs = "*", default = [], help = "Additional files to store in the root of data.psp (such as levels.vvp)")
 
 wd = "repack_data_wd"
 os.mkdir(wd)
@@ -33,6 +34,10 @@ with zipfile.ZipFile(input_filename, "r") as z:
    os.mkdir(data_dir)
    z.extractall(data_dir)
 
+for extra in args.extra:
+   print("Adding", extra)
+   shutil.copy(extra, data_dir)
+
 # Walk through all the entries and construct a list from them.
 
 print("Creating entry table")
@@ -0,0 +1,115 @@
+#include "Arena.h"
+
+#include <SDL2/SDL.h>
+
+#include "Exit.h"
+#include "Vlogging.h"
+
+/* Enough for anything the arenas' users put in them */
+static const size_t arena_alignment = sizeof(Uint64);
+
+/* In front of every allocation that came from the heap, so that reset() can
+ * find the ones nobody let go of */
+union overflowheader
+{
+    struct
+    {
+        overflowheader* prev;
+        overflowheader* next;
+    } link;
+    Uint64 padding[2];
+};
+
+static size_t align(const size_t bytes)
+{
+    return (bytes + arena_alignment - 1) & ~(arena_alignment - 1);
+}
+
+size_t arenaclass::capacity(void)
+{
+    return size;
+}
+
+bool arenaclass::owns(const void* ptr)
+{
+    return ptr >= (const void*) buffer && ptr < (const void*) (buffer + size);
+}
+
+void* arenaclass::allocate(const size_t bytes)
+{
+    const size_t aligned = align(bytes);
+
+    if (size > 0 && aligned <= size - used)
+    {
+        void* ptr = buffer + used;
+        used += aligned;
+        peak = SDL_max(peak, used);
+        return ptr;
+    }
+
+    if (overflows == 0 && size > 0)
+    {
+        vlog_warn("%s arena is full, allocating %u bytes from the heap", name, (unsigned int) bytes);
+    }
+    overflows++;
+
+    overflowheader* header = (overflowheader*) RAM_mallocTagged(sizeof(overflowheader) + bytes, tag);
+    if (header == NULL)
+    {
+        VVV_exit(1);
+    }
+    header->link.prev = NULL;
+    header->link.next = overflowed;
+    if (overflowed != NULL)
+    {
+        overflowed->link.prev = header;
+    }
+    overflowed = header;
+    return header + 1;
+}
+
+void arenaclass::deallocate(void* ptr, const size_t bytes)
+{
+    if (ptr == NULL)
+    {
+        return;
+    }
+
+    if (!owns(ptr))
+    {
+        overflowheader* header = (overflowheader*) ptr - 1;
+        if (header->link.prev != NULL)
+        {
+            header->link.prev->link.next = header->link.next;
+        }
+        else
+        {
+            overflowed = header->link.next;
+        }
+        if (header->link.next != NULL)
+        {
+            header->link.next->link.prev = header->link.prev;
+        }
+        RAM_free(header);
+        return;
+    }
+
+    /* Only the last allocation can be taken back before a reset */
+    if ((Uint8*) ptr + align(bytes) == buffer + used)
+    {
+        used -= align(bytes);
+    }
+}
+
+void arenaclass::reset(void)
+{
+    while (overflowed != NULL)
+    {
+        overflowheader* next = overflowed->link.next;
+        RAM_free(overflowed);
+        overflowed = next;
+    }
+
+    used = 0;
+    resets++;
+}
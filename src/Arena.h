@@ -0,0 +1,53 @@
+#ifndef ARENA_H
+#define ARENA_H
+
+#include <SDL2/SDL_stdinc.h>
+#include <stddef.h>
+
+#include "RAM.h"
+
+/* A block of memory that's handed out by bumping a pointer and let go of all
+ * at once with reset(). Once it's full, allocations fall back to the heap,
+ * and reset() frees whatever of those is left too. */
+class arenaclass
+{
+public:
+    /* constexpr, so that it's usable before any other global's constructor
+     * gets to allocate from it */
+    constexpr arenaclass(Uint8* buffer_, size_t size_, const char* name_, enum RAM_Tag tag_)
+    : used(0)
+    , peak(0)
+    , overflows(0)
+    , resets(0)
+    , buffer(buffer_)
+    , size(size_)
+    , name(name_)
+    , tag(tag_)
+    , overflowed(NULL)
+    {
+    }
+
+    void* allocate(size_t bytes);
+    void deallocate(void* ptr, size_t bytes);
+
+    void reset(void);
+
+    size_t capacity(void);
+
+    size_t used;
+    size_t peak;
+    /* Allocations that didn't fit and came from the heap */
+    Uint32 overflows;
+    Uint32 resets;
+
+private:
+    bool owns(const void* ptr);
+
+    Uint8* buffer;
+    size_t size;
+    const char* name;
+    enum RAM_Tag tag;
+    union overflowheader* overflowed;
+};
+
+#endif /* ARENA_H */
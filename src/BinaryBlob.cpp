@@ -7,6 +7,7 @@
 
 #include "Exit.h"
 #include "FileSystemUtils.h"
+#include "RAM.h"
 #include "UtilityClass.h"
 #include "Vlogging.h"
 
@@ -14,9 +15,12 @@ binaryBlob::binaryBlob(void)
 {
 #ifdef VVV_COMPILEMUSIC
     numberofHeaders = 0;
+    SDL_zeroa(m_memblocks);
 #endif
     SDL_zeroa(m_headers);
-    SDL_zeroa(m_memblocks);
+    SDL_zeroa(m_offsets);
+    SDL_zeroa(m_hashes);
+    m_filename[0] = '\0';
 }
 
 #ifdef VVV_COMPILEMUSIC
@@ -32,7 +36,7 @@ void binaryBlob::AddFileToBinaryBlob(const char* _path)
         size = ftell(file);
         fseek(file, 0, SEEK_SET);
 
-        memblock = (char*) RAM_malloc(size);
+        memblock = (char*) RAM_mallocTagged(size, RAM_TAG_AUDIO);
         if (memblock == NULL)
         {
             VVV_exit(1);
@@ -80,29 +84,57 @@ void binaryBlob::writeBinaryBlob(const char* _name)
 }
 #endif
 
+/* FNV-1a */
+static uint32_t hashname(const char* name)
+{
+    uint32_t hash = 2166136261u;
+    for (; *name != '\0'; ++name)
+    {
+        hash = (hash ^ (uint8_t) *name) * 16777619u;
+    }
+    return hash;
+}
+
 bool binaryBlob::unPackBinary(const char* name)
 {
-    return FILESYSTEM_loadBinaryBlob(this, name);
+    clear();
+
+    if (!FILESYSTEM_loadBinaryBlob(this, name))
+    {
+        return false;
+    }
+
+    for (size_t i = 0; i < SDL_arraysize(m_headers); i += 1)
+    {
+        m_hashes[i] = hashname(m_headers[i].name);
+    }
+    return true;
 }
 
 void binaryBlob::clear(void)
 {
-    for (size_t i = 0; i < SDL_arraysize(m_headers); i += 1)
+#ifdef VVV_COMPILEMUSIC
+    for (size_t i = 0; i < SDL_arraysize(m_memblocks); i += 1)
     {
-        if (m_memblocks[i] != NULL)
-        {
-            SDL_free(m_memblocks[i]);
-        }
+        RAM_free(m_memblocks[i]);
     }
     SDL_zeroa(m_memblocks);
+#endif
     SDL_zeroa(m_headers);
+    SDL_zeroa(m_offsets);
+    SDL_zeroa(m_hashes);
+    m_filename[0] = '\0';
 }
 
 int binaryBlob::getIndex(const char* _name)
 {
+    const uint32_t hash = hashname(_name);
+
     for (size_t i = 0; i < SDL_arraysize(m_headers); i += 1)
     {
-        if (SDL_strcmp(_name, m_headers[i].name) == 0 && m_headers[i].valid)
+        if (m_hashes[i] == hash
+        && m_headers[i].valid
+        && SDL_strcmp(_name, m_headers[i].name) == 0)
         {
             return i;
         }
@@ -120,14 +152,24 @@ int binaryBlob::getSize(int _index)
     return m_headers[_index].size;
 }
 
-char* binaryBlob::getAddress(int _index)
+int binaryBlob::getOffset(int _index)
+{
+    if (!INBOUNDS_ARR(_index, m_offsets))
+    {
+        vlog_error("getOffset() out-of-bounds!");
+        return 0;
+    }
+    return m_offsets[_index];
+}
+
+SDL_RWops* binaryBlob::openTrack(int _index)
 {
-    if (!INBOUNDS_ARR(_index, m_memblocks))
+    if (!INBOUNDS_ARR(_index, m_headers) || !m_headers[_index].valid)
     {
-        vlog_error("getAddress() out-of-bounds!");
+        vlog_error("openTrack() out-of-bounds!");
         return NULL;
     }
-    return m_memblocks[_index];
+    return FILESYSTEM_openAssetRange(m_filename, m_offsets[_index], m_headers[_index].size);
 }
 
 bool binaryBlob::nextExtra(size_t* start)
@@ -4,6 +4,8 @@
 #include <stddef.h>
 #include <stdint.h>
 
+struct SDL_RWops;
+
 /* Laaaazyyyyyyy -flibit */
 // #define VVV_COMPILEMUSIC
 
@@ -33,6 +35,8 @@ struct resourceheader
     uint8_t valid;
 };
 
+/* Only the headers of a blob stay in memory, tracks are read from the
+ * file as they're needed, through openTrack() */
 class binaryBlob
 {
 public:
@@ -50,9 +54,11 @@ public:
 
     int getSize(int _index);
 
+    int getOffset(int _index);
+
     bool nextExtra(size_t* start);
 
-    char* getAddress(int _index);
+    SDL_RWops* openTrack(int _index);
 
     void clear(void);
 
@@ -60,9 +66,12 @@ public:
 
 #ifdef VVV_COMPILEMUSIC
     int numberofHeaders;
+    char* m_memblocks[max_headers];
 #endif
     resourceheader m_headers[max_headers];
-    char* m_memblocks[max_headers];
+    int32_t m_offsets[max_headers];
+    uint32_t m_hashes[max_headers];
+    char m_filename[64];
 };
 
 
@@ -25,10 +25,8 @@ void blockclass::clear(void)
     g = 0;
     b = 0;
 
-    /* std::strings get initialized automatically, but this is */
-    /* in case this function gets called again after construction */
-    script.clear();
-    prompt.clear();
+    script = "";
+    prompt = "";
 }
 
 void blockclass::rectset(const int xi, const int yi, const int wi, const int hi)
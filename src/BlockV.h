@@ -2,7 +2,6 @@
 #define BLOCKV_H
 
 #include <SDL2/SDL.h>
-#include <string>
 
 class blockclass
 {
@@ -19,7 +18,9 @@ public:
     int type;
     int trigger;
     int xp, yp, wp, hp;
-    std::string script, prompt;
+    //Interned in entityclass::blocknames, so never freed
+    const char* script;
+    const char* prompt;
     int r, g, b;
 };
 
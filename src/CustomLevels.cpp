@@ -57,7 +57,10 @@ RoomProperty::RoomProperty(void)
     directmode=0;
 }
 
-customlevelclass::customlevelclass(void)
+/* One decoded room per column, so that row-by-row scans (saving the level)
+ * don't have to decode the same rooms over and over again. */
+customlevelclass::customlevelclass(void) :
+    contents(SCREEN_WIDTH_TILES * maxwidth, SCREEN_HEIGHT_TILES * maxheight, maxwidth)
 {
     reset();
 }
@@ -314,7 +317,7 @@ void customlevelclass::reset(void)
         }
     }
 
-    SDL_zeroa(contents);
+    contents.clear();
 
     script.clearcustom();
 
@@ -333,6 +336,8 @@ const int* customlevelclass::loadlevel( int rxi, int ryi )
 
     static int result[1200];
 
+    const Uint64 start = SDL_GetPerformanceCounter();
+
     for (int j = 0; j < 30; j++)
     {
         for (int i = 0; i < 40; i++)
@@ -341,6 +346,13 @@ const int* customlevelclass::loadlevel( int rxi, int ryi )
         }
     }
 
+    vlog_debug("Room %i,%i decoded in %i us, tiles take up %u bytes (%u uncompressed)",
+        rxi, ryi,
+        (int) ((SDL_GetPerformanceCounter() - start) * 1000000 / SDL_GetPerformanceFrequency()),
+        (unsigned int) contents.compressedsize(),
+        (unsigned int) (contents.numcells() * sizeof(int))
+    );
+
     return result;
 }
 
@@ -731,12 +743,12 @@ void customlevelclass::settile(
 ) {
     const int idx = gettileidx(rx, ry, x, y);
 
-    if (!INBOUNDS_ARR(idx, contents))
+    if (idx < 0 || idx >= (int) contents.numcells())
     {
         return;
     }
 
-    contents[idx] = t;
+    contents.set(idx % VMULT(1), idx / VMULT(1), t);
 }
 
 int customlevelclass::gettile(
@@ -747,12 +759,12 @@ int customlevelclass::gettile(
 ) {
     const int idx = gettileidx(rx, ry, x, y);
 
-    if (!INBOUNDS_ARR(idx, contents))
+    if (idx < 0 || idx >= (int) contents.numcells())
     {
         return 0;
     }
 
-    return contents[idx];
+    return contents.get(idx % VMULT(1), idx / VMULT(1));
 }
 
 int customlevelclass::getabstile(const int x, const int y)
@@ -771,12 +783,12 @@ int customlevelclass::getabstile(const int x, const int y)
 
     idx = x + yoff;
 
-    if (!INBOUNDS_ARR(idx, contents))
+    if (idx < 0 || idx >= (int) contents.numcells())
     {
         return 0;
     }
 
-    return contents[idx];
+    return contents.get(idx % VMULT(1), idx / VMULT(1));
 }
 
 
@@ -1050,12 +1062,7 @@ bool customlevelclass::load(std::string& _path)
 
             while (next_split_s(buffer, sizeof(buffer), &start, pText, ','))
             {
-                const int idx = x + maxwidth*40*y;
-
-                if (INBOUNDS_ARR(idx, contents))
-                {
-                    contents[idx] = help.Int(buffer);
-                }
+                contents.set(x, y, help.Int(buffer));
 
                 ++x;
 
@@ -1250,12 +1257,19 @@ next:
         }
     }
 
+    script.compilecustom();
+
 #ifndef NO_EDITOR
     ed.gethooks();
 #endif
 
     version=2;
 
+    vlog_debug("Level tiles take up %u bytes (%u uncompressed)",
+        (unsigned int) contents.compressedsize(),
+        (unsigned int) (contents.numcells() * sizeof(int))
+    );
+
     return true;
 
 fail:
@@ -1483,7 +1497,14 @@ void customlevelclass::generatecustomminimap(void)
         map.custommmysize=180-(map.custommmyoff*2);
     }
 
-    FillRect(graphics.images[12], graphics.getRGB(0, 0, 0));
+    /* Drawn into, so it has to stay loaded */
+    SDL_Surface* minimap = graphics.grphx.pinimage(12);
+    if (minimap == NULL)
+    {
+        return;
+    }
+
+    FillRect(minimap, graphics.getRGB(0, 0, 0));
 
     int tm=0;
     int temp=0;
@@ -1507,7 +1528,7 @@ void customlevelclass::generatecustomminimap(void)
                         if(temp>=1)
                         {
                             //Fill in this pixel
-                            FillRect(graphics.images[12], (i2*48)+i, (j2*36)+j, 1, 1, graphics.getRGB(tm, tm, tm));
+                            FillRect(minimap, (i2*48)+i, (j2*36)+j, 1, 1, graphics.getRGB(tm, tm, tm));
                         }
                     }
                 }
@@ -1533,7 +1554,7 @@ void customlevelclass::generatecustomminimap(void)
                         if(temp>=1)
                         {
                             //Fill in this pixel
-                            FillRect(graphics.images[12], (i2*24)+i, (j2*18)+j, 1, 1, graphics.getRGB(tm, tm, tm));
+                            FillRect(minimap, (i2*24)+i, (j2*18)+j, 1, 1, graphics.getRGB(tm, tm, tm));
                         }
                     }
                 }
@@ -1558,7 +1579,7 @@ void customlevelclass::generatecustomminimap(void)
                         if(temp>=1)
                         {
                             //Fill in this pixel
-                            FillRect(graphics.images[12], (i2*12)+i, (j2*9)+j, 1, 1, graphics.getRGB(tm, tm, tm));
+                            FillRect(minimap, (i2*12)+i, (j2*9)+j, 1, 1, graphics.getRGB(tm, tm, tm));
                         }
                     }
                 }
@@ -7,6 +7,8 @@
 #include <string>
 #include <vector>
 
+#include "TileStore.h"
+
 class CustomEntity
 {
 public:
@@ -133,7 +135,7 @@ public:
 
     static const int maxwidth = 20, maxheight = 20; //Special; the physical max the engine allows
     static const int numrooms = maxwidth * maxheight;
-    int contents[40 * 30 * numrooms];
+    tilestoreclass contents;
     int numtrinkets(void);
     int numcrewmates(void);
     RoomProperty roomproperties[numrooms]; //Maxwidth*maxheight
@@ -167,6 +167,9 @@ void editorclass::removehookfromscript(const std::string& t)
             script.customscripts.erase(script.customscripts.begin() + i);
         }
     }
+
+    /* Also called before a changed hook gets added back */
+    script.uncachecustom(t);
 }
 
 void editorclass::removehook(const std::string& t)
@@ -68,6 +68,11 @@ void entclass::clear(void)
     realcol = 0;
     lerpoldxp = 0;
     lerpoldyp = 0;
+
+    contactgeneration = 0;
+    SDL_zero(contactrect);
+    contactfloor = false;
+    contactroof = false;
 }
 
 bool entclass::outside(void)
@@ -55,6 +55,11 @@ public:
 
     Uint32 realcol;
     int lerpoldxp, lerpoldyp;
+
+    //Floor/roof contact cache, see entityclass::updatecontacts()
+    Uint32 contactgeneration;
+    SDL_Rect contactrect;
+    bool contactfloor, contactroof;
 };
 
 #endif /* ENT_H */
@@ -85,6 +85,12 @@ void entityclass::init(void)
     SDL_memset(customcollect, false, sizeof(customcollect));
 
     k = 0;
+
+    contactgeneration = 1;
+    contactprobes = 0;
+    contacthits = 0;
+
+    blockindexdirty = true;
 }
 
 void entityclass::resetallflags(void)
@@ -762,7 +768,7 @@ void entityclass::generateswnwave( int t )
     }
 }
 
-void entityclass::createblock( int t, int xp, int yp, int w, int h, int trig /*= 0*/, const std::string& script /*= ""*/, bool custom /*= false*/)
+void entityclass::createblock( int t, int xp, int yp, int w, int h, int trig /*= 0*/, const char* script /*= ""*/, bool custom /*= false*/)
 {
     k = blocks.size();
 
@@ -810,7 +816,7 @@ void entityclass::createblock( int t, int xp, int yp, int w, int h, int trig /*=
         block.hp = h;
         block.rectset(xp, yp, w, h);
         block.trigger = trig;
-        block.script = script;
+        block.script = blocknames.intern(script);
         break;
     case DAMAGE: //Damage
         block.type = DAMAGE;
@@ -844,225 +850,225 @@ void entityclass::createblock( int t, int xp, int yp, int w, int h, int trig /*=
         switch(trig)
         {
         case 0: //testing zone
-            block.prompt = "Press %s to explode";
-            block.script = "intro";
+            block.prompt = blocknames.intern("Press %s to explode");
+            block.script = blocknames.intern("intro");
             block.setblockcolour("orange");
             trig=1;
             break;
         case 1:
-            block.prompt = "Press %s to talk to Violet";
-            block.script = "talkpurple";
+            block.prompt = blocknames.intern("Press %s to talk to Violet");
+            block.script = blocknames.intern("talkpurple");
             block.setblockcolour("purple");
             trig=0;
             break;
         case 2:
-            block.prompt = "Press %s to talk to Vitellary";
-            block.script = "talkyellow";
+            block.prompt = blocknames.intern("Press %s to talk to Vitellary");
+            block.script = blocknames.intern("talkyellow");
             block.setblockcolour("yellow");
             trig=0;
             break;
         case 3:
-            block.prompt = "Press %s to talk to Vermilion";
-            block.script = "talkred";
+            block.prompt = blocknames.intern("Press %s to talk to Vermilion");
+            block.script = blocknames.intern("talkred");
             block.setblockcolour("red");
             trig=0;
             break;
         case 4:
-            block.prompt = "Press %s to talk to Verdigris";
-            block.script = "talkgreen";
+            block.prompt = blocknames.intern("Press %s to talk to Verdigris");
+            block.script = blocknames.intern("talkgreen");
             block.setblockcolour("green");
             trig=0;
             break;
         case 5:
-            block.prompt = "Press %s to talk to Victoria";
-            block.script = "talkblue";
+            block.prompt = blocknames.intern("Press %s to talk to Victoria");
+            block.script = blocknames.intern("talkblue");
             block.setblockcolour("blue");
             trig=0;
             break;
         case 6:
-            block.prompt = "Press %s to activate terminal";
-            block.script = "terminal_station_1";
+            block.prompt = blocknames.intern("Press %s to activate terminal");
+            block.script = blocknames.intern("terminal_station_1");
             block.setblockcolour("orange");
             trig=0;
             break;
         case 7:
-            block.prompt = "Press %s to activate terminal";
-            block.script = "terminal_outside_1";
+            block.prompt = blocknames.intern("Press %s to activate terminal");
+            block.script = blocknames.intern("terminal_outside_1");
             block.setblockcolour("orange");
             trig=0;
             break;
         case 8:
-            block.prompt = "Press %s to activate terminal";
-            block.script = "terminal_outside_2";
+            block.prompt = blocknames.intern("Press %s to activate terminal");
+            block.script = blocknames.intern("terminal_outside_2");
             block.setblockcolour("orange");
             trig=0;
             break;
         case 9:
-            block.prompt = "Press %s to activate terminal";
-            block.script = "terminal_outside_3";
+            block.prompt = blocknames.intern("Press %s to activate terminal");
+            block.script = blocknames.intern("terminal_outside_3");
             block.setblockcolour("orange");
             trig=0;
             break;
         case 10:
-            block.prompt = "Press %s to activate terminal";
-            block.script = "terminal_outside_4";
+            block.prompt = blocknames.intern("Press %s to activate terminal");
+            block.script = blocknames.intern("terminal_outside_4");
             block.setblockcolour("orange");
             trig=0;
             break;
         case 11:
-            block.prompt = "Press %s to activate terminal";
-            block.script = "terminal_outside_5";
+            block.prompt = blocknames.intern("Press %s to activate terminal");
+            block.script = blocknames.intern("terminal_outside_5");
             block.setblockcolour("orange");
             trig=0;
             break;
         case 12:
-            block.prompt = "Press %s to activate terminal";
-            block.script = "terminal_outside_6";
+            block.prompt = blocknames.intern("Press %s to activate terminal");
+            block.script = blocknames.intern("terminal_outside_6");
             block.setblockcolour("orange");
             trig=0;
             break;
         case 13:
-            block.prompt = "Press %s to activate terminal";
-            block.script = "terminal_finallevel";
+            block.prompt = blocknames.intern("Press %s to activate terminal");
+            block.script = blocknames.intern("terminal_finallevel");
             block.setblockcolour("orange");
             trig=0;
             break;
         case 14:
-            block.prompt = "Press %s to activate terminal";
-            block.script = "terminal_station_2";
+            block.prompt = blocknames.intern("Press %s to activate terminal");
+            block.script = blocknames.intern("terminal_station_2");
             block.setblockcolour("orange");
             trig=0;
             break;
         case 15:
-            block.prompt = "Press %s to activate terminal";
-            block.script = "terminal_station_3";
+            block.prompt = blocknames.intern("Press %s to activate terminal");
+            block.script = blocknames.intern("terminal_station_3");
             block.setblockcolour("orange");
             trig=0;
             break;
         case 16:
-            block.prompt = "Press %s to activate terminal";
-            block.script = "terminal_station_4";
+            block.prompt = blocknames.intern("Press %s to activate terminal");
+            block.script = blocknames.intern("terminal_station_4");
             block.setblockcolour("orange");
             trig=0;
             break;
         case 17:
-            block.prompt = "Press %s to activate terminal";
-            block.script = "terminal_warp_1";
+            block.prompt = blocknames.intern("Press %s to activate terminal");
+            block.script = blocknames.intern("terminal_warp_1");
             block.setblockcolour("orange");
             trig=0;
             break;
         case 18:
-            block.prompt = "Press %s to activate terminal";
-            block.script = "terminal_warp_2";
+            block.prompt = blocknames.intern("Press %s to activate terminal");
+            block.script = blocknames.intern("terminal_warp_2");
             block.setblockcolour("orange");
             trig=0;
             break;
         case 19:
-            block.prompt = "Press %s to activate terminal";
-            block.script = "terminal_lab_1";
+            block.prompt = blocknames.intern("Press %s to activate terminal");
+            block.script = blocknames.intern("terminal_lab_1");
             block.setblockcolour("orange");
             trig=0;
             break;
         case 20:
-            block.prompt = "Press %s to activate terminal";
-            block.script = "terminal_lab_2";
+            block.prompt = blocknames.intern("Press %s to activate terminal");
+            block.script = blocknames.intern("terminal_lab_2");
             block.setblockcolour("orange");
             trig=0;
             break;
         case 21:
-            block.prompt = "Press %s to activate terminal";
-            block.script = "terminal_secretlab";
+            block.prompt = blocknames.intern("Press %s to activate terminal");
+            block.script = blocknames.intern("terminal_secretlab");
             block.setblockcolour("orange");
             trig=0;
             break;
         case 22:
-            block.prompt = "Press %s to activate terminal";
-            block.script = "terminal_shipcomputer";
+            block.prompt = blocknames.intern("Press %s to activate terminal");
+            block.script = blocknames.intern("terminal_shipcomputer");
             block.setblockcolour("orange");
             trig=0;
             break;
         case 23:
-            block.prompt = "Press %s to activate terminals";
-            block.script = "terminal_radio";
+            block.prompt = blocknames.intern("Press %s to activate terminals");
+            block.script = blocknames.intern("terminal_radio");
             block.setblockcolour("orange");
             trig=0;
             break;
         case 24:
-            block.prompt = "Press %s to activate terminal";
-            block.script = "terminal_jukebox";
+            block.prompt = blocknames.intern("Press %s to activate terminal");
+            block.script = blocknames.intern("terminal_jukebox");
             block.setblockcolour("orange");
             trig=0;
             break;
         case 25:
-            block.prompt = "Passion for Exploring";
-            block.script = "terminal_juke1";
+            block.prompt = blocknames.intern("Passion for Exploring");
+            block.script = blocknames.intern("terminal_juke1");
             block.setblockcolour("orange");
             trig=0;
             break;
         case 26:
-            block.prompt = "Pushing Onwards";
-            block.script = "terminal_juke2";
+            block.prompt = blocknames.intern("Pushing Onwards");
+            block.script = blocknames.intern("terminal_juke2");
             block.setblockcolour("orange");
             trig=0;
             break;
         case 27:
-            block.prompt = "Positive Force";
-            block.script = "terminal_juke3";
+            block.prompt = blocknames.intern("Positive Force");
+            block.script = blocknames.intern("terminal_juke3");
             block.setblockcolour("orange");
             trig=0;
             break;
         case 28:
-            block.prompt = "Presenting VVVVVV";
-            block.script = "terminal_juke4";
+            block.prompt = blocknames.intern("Presenting VVVVVV");
+            block.script = blocknames.intern("terminal_juke4");
             block.setblockcolour("orange");
             trig=0;
             break;
         case 29:
-            block.prompt = "Potential for Anything";
-            block.script = "terminal_juke5";
+            block.prompt = blocknames.intern("Potential for Anything");
+            block.script = blocknames.intern("terminal_juke5");
             block.setblockcolour("orange");
             trig=0;
             break;
         case 30:
-            block.prompt = "Predestined Fate";
-            block.script = "terminal_juke6";
+            block.prompt = blocknames.intern("Predestined Fate");
+            block.script = blocknames.intern("terminal_juke6");
             block.setblockcolour("orange");
             trig=0;
             break;
         case 31:
-            block.prompt = "Pipe Dream";
-            block.script = "terminal_juke7";
+            block.prompt = blocknames.intern("Pipe Dream");
+            block.script = blocknames.intern("terminal_juke7");
             block.setblockcolour("orange");
             trig=0;
             break;
         case 32:
-            block.prompt = "Popular Potpourri";
-            block.script = "terminal_juke8";
+            block.prompt = blocknames.intern("Popular Potpourri");
+            block.script = blocknames.intern("terminal_juke8");
             block.setblockcolour("orange");
             trig=0;
             break;
         case 33:
-            block.prompt = "Pressure Cooker";
-            block.script = "terminal_juke9";
+            block.prompt = blocknames.intern("Pressure Cooker");
+            block.script = blocknames.intern("terminal_juke9");
             block.setblockcolour("orange");
             trig=0;
             break;
         case 34:
-            block.prompt = "ecroF evitisoP";
-            block.script = "terminal_juke10";
+            block.prompt = blocknames.intern("ecroF evitisoP");
+            block.script = blocknames.intern("terminal_juke10");
             block.setblockcolour("orange");
             trig=0;
             break;
         case 35:
             if (custom)
             {
-                block.prompt = "Press %s to interact";
+                block.prompt = blocknames.intern("Press %s to interact");
             }
             else
             {
-                block.prompt = "Press %s to activate terminal";
+                block.prompt = blocknames.intern("Press %s to activate terminal");
             }
-            block.script = "custom_"+customscript;
+            block.script = blocknames.intern("custom_", customscript.c_str());
             block.setblockcolour("orange");
             trig=0;
             break;
@@ -1072,7 +1078,7 @@ void entityclass::createblock( int t, int xp, int yp, int w, int h, int trig /*=
 
     if (customactivitytext != "")
     {
-        block.prompt = customactivitytext;
+        block.prompt = blocknames.intern(customactivitytext.c_str());
         customactivitytext = "";
     }
 
@@ -1086,6 +1092,9 @@ void entityclass::createblock( int t, int xp, int yp, int w, int h, int trig /*=
     {
         blocks.push_back(block);
     }
+
+    blockindexdirty = true;
+    invalidatecontacts();
 }
 
 /* Disable entity, and return true if entity was successfully disabled */
@@ -1113,7 +1122,17 @@ bool entityclass::disableentity(int t)
 
 void entityclass::removeallblocks(void)
 {
-    blocks.clear();
+    /* Gives their room arena memory back, clear() would keep it */
+    roomvector<blockclass>().swap(blocks);
+    for (int t = 0; t < NUM_BLOCK_TYPES; t++)
+    {
+        for (size_t c = 0; c < SDL_arraysize(blockgrid[t]); c++)
+        {
+            roomvector<int>().swap(blockgrid[t][c]);
+        }
+    }
+    blockindexdirty = true;
+    invalidatecontacts();
 }
 
 void entityclass::disableblock( int t )
@@ -1129,6 +1148,9 @@ void entityclass::disableblock( int t )
 
     blocks[t].rect.w = blocks[t].wp;
     blocks[t].rect.h = blocks[t].hp;
+
+    blockindexdirty = true;
+    invalidatecontacts();
 }
 
 void entityclass::moveblockto(int x1, int y1, int x2, int y2, int w, int h)
@@ -1144,6 +1166,8 @@ void entityclass::moveblockto(int x1, int y1, int x2, int y2, int w, int h)
             blocks[i].hp = h;
 
             blocks[i].rectset(blocks[i].xp, blocks[i].yp, blocks[i].wp, blocks[i].hp);
+            blockindexdirty = true;
+            invalidatecontacts();
             break;
         }
     }
@@ -4009,12 +4033,9 @@ bool entityclass::checkdamage(bool scm /*= false*/)
             temprect.w = entities[i].w;
             temprect.h = entities[i].h;
 
-            for (size_t j=0; j<blocks.size(); j++)
+            if (firstblockat(DAMAGE, temprect) > -1)
             {
-                if (blocks[j].type == DAMAGE && help.intersects(blocks[j].rect, temprect))
-                {
-                    return true;
-                }
+                return true;
             }
         }
     }
@@ -4036,13 +4057,11 @@ int entityclass::checktrigger(int* block_idx)
             temprect.w = entities[i].w;
             temprect.h = entities[i].h;
 
-            for (size_t j=0; j<blocks.size(); j++)
+            const int j = firstblockat(TRIGGER, temprect);
+            if (j > -1)
             {
-                if (blocks[j].type == TRIGGER && help.intersects(blocks[j].rect, temprect))
-                {
-                    *block_idx = j;
-                    return blocks[j].trigger;
-                }
+                *block_idx = j;
+                return blocks[j].trigger;
             }
         }
     }
@@ -4062,16 +4081,102 @@ int entityclass::checkactivity(void)
             temprect.w = entities[i].w;
             temprect.h = entities[i].h;
 
-            for (size_t j=0; j<blocks.size(); j++)
+            const int j = firstblockat(ACTIVITY, temprect);
+            if (j > -1)
+            {
+                return j;
+            }
+        }
+    }
+    return -1;
+}
+
+void entityclass::updateblockindex(void)
+{
+    if (!blockindexdirty)
+    {
+        return;
+    }
+
+    for (int t = 0; t < NUM_BLOCK_TYPES; t++)
+    {
+        for (size_t c = 0; c < SDL_arraysize(blockgrid[t]); c++)
+        {
+            blockgrid[t][c].clear();
+        }
+    }
+
+    for (size_t i = 0; i < blocks.size(); i++)
+    {
+        const blockclass& block = blocks[i];
+        if (block.type < 0 || block.type >= NUM_BLOCK_TYPES
+        || block.rect.w <= 0 || block.rect.h <= 0)
+        {
+            /* Disabled blocks never intersect anything */
+            continue;
+        }
+
+        const int x1 = clamp(block.rect.x / blockgrid_cellsize, 0, blockgrid_cols - 1);
+        const int x2 = clamp((block.rect.x + block.rect.w - 1) / blockgrid_cellsize, 0, blockgrid_cols - 1);
+        const int y1 = clamp(block.rect.y / blockgrid_cellsize, 0, blockgrid_rows - 1);
+        const int y2 = clamp((block.rect.y + block.rect.h - 1) / blockgrid_cellsize, 0, blockgrid_rows - 1);
+
+        for (int y = y1; y <= y2; y++)
+        {
+            for (int x = x1; x <= x2; x++)
             {
-                if (blocks[j].type == ACTIVITY && help.intersects(blocks[j].rect, temprect))
+                blockgrid[block.type][x + y * blockgrid_cols].push_back(i);
+            }
+        }
+    }
+
+    blockindexdirty = false;
+}
+
+/* Returns the lowest index of a block of this type (and trigger, unless
+ * -1) that intersects rect, or -1. Same result as checking every block in
+ * order, but only looks at the grid cells rect overlaps. */
+int entityclass::firstblockat(int type, const SDL_Rect& rect, int trigger /*= -1*/)
+{
+    if (type < 0 || type >= NUM_BLOCK_TYPES || rect.w <= 0 || rect.h <= 0)
+    {
+        return -1;
+    }
+
+    updateblockindex();
+
+    /* Cells outside the room are clamped to the edge, same as the blocks */
+    const int x1 = clamp(rect.x / blockgrid_cellsize, 0, blockgrid_cols - 1);
+    const int x2 = clamp((rect.x + rect.w - 1) / blockgrid_cellsize, 0, blockgrid_cols - 1);
+    const int y1 = clamp(rect.y / blockgrid_cellsize, 0, blockgrid_rows - 1);
+    const int y2 = clamp((rect.y + rect.h - 1) / blockgrid_cellsize, 0, blockgrid_rows - 1);
+
+    int result = -1;
+    for (int y = y1; y <= y2; y++)
+    {
+        for (int x = x1; x <= x2; x++)
+        {
+            const roomvector<int>& cell = blockgrid[type][x + y * blockgrid_cols];
+
+            /* Each cell is sorted, so the first hit is the lowest index */
+            for (size_t k = 0; k < cell.size(); k++)
+            {
+                const int j = cell[k];
+                if (result > -1 && j >= result)
+                {
+                    break;
+                }
+                if ((trigger == -1 || blocks[j].trigger == trigger)
+                && help.intersects(blocks[j].rect, rect))
                 {
-                    return j;
+                    result = j;
+                    break;
                 }
             }
         }
     }
-    return -1;
+
+    return result;
 }
 
 int entityclass::getgridpoint( int t )
@@ -4082,37 +4187,31 @@ int entityclass::getgridpoint( int t )
 bool entityclass::checkplatform(const SDL_Rect& temprect, int* px, int* py)
 {
     //Return true if rectset intersects a moving platform, setups px & py to the platform x & y
-    for (size_t i = 0; i < blocks.size(); i++)
+    const int i = firstblockat(BLOCK, temprect);
+    if (i > -1)
     {
-        if (blocks[i].type == BLOCK && help.intersects(blocks[i].rect, temprect))
-        {
-            *px = blocks[i].xp;
-            *py = blocks[i].yp;
-            return true;
-        }
+        *px = blocks[i].xp;
+        *py = blocks[i].yp;
+        return true;
     }
     return false;
 }
 
 bool entityclass::checkblocks(const SDL_Rect& temprect, const float dx, const float dy, const float dr, const bool skipdirblocks)
 {
-    for (size_t i = 0; i < blocks.size(); i++)
+    if (!skipdirblocks)
     {
-        if(!skipdirblocks && blocks[i].type == DIRECTIONAL)
-        {
-            if (dy > 0 && blocks[i].trigger == 0) if (help.intersects(blocks[i].rect, temprect)) return true;
-            if (dy <= 0 && blocks[i].trigger == 1) if (help.intersects(blocks[i].rect, temprect)) return true;
-            if (dx > 0 && blocks[i].trigger == 2) if (help.intersects(blocks[i].rect, temprect)) return true;
-            if (dx <= 0 && blocks[i].trigger == 3) if (help.intersects(blocks[i].rect, temprect)) return true;
-        }
-        if (blocks[i].type == BLOCK && help.intersects(blocks[i].rect, temprect))
-        {
-            return true;
-        }
-        if (blocks[i].type == SAFE && (dr)==1 && help.intersects(blocks[i].rect, temprect))
-        {
-            return true;
-        }
+        //Directional blocks only stop you going one way
+        if (firstblockat(DIRECTIONAL, temprect, dy > 0 ? 0 : 1) > -1) return true;
+        if (firstblockat(DIRECTIONAL, temprect, dx > 0 ? 2 : 3) > -1) return true;
+    }
+    if (firstblockat(BLOCK, temprect) > -1)
+    {
+        return true;
+    }
+    if ((dr)==1 && firstblockat(SAFE, temprect) > -1)
+    {
+        return true;
     }
     return false;
 }
@@ -4375,14 +4474,8 @@ bool entityclass::entitycollidefloor( int t )
         return false;
     }
 
-    SDL_Rect temprect;
-    temprect.x = entities[t].xp + entities[t].cx;
-    temprect.y = entities[t].yp + entities[t].cy + 1;
-    temprect.w = entities[t].w;
-    temprect.h = entities[t].h;
-
-    if (checkwall(temprect)) return true;
-    return false;
+    updatecontacts(t);
+    return entities[t].contactfloor;
 }
 
 bool entityclass::entitycollideroof( int t )
@@ -4393,14 +4486,57 @@ bool entityclass::entitycollideroof( int t )
         return false;
     }
 
+    updatecontacts(t);
+    return entities[t].contactroof;
+}
+
+void entityclass::updatecontacts(int t)
+{
+    /* gamerenderfixed() and gamelogic() both ask for the same floor and roof
+     * contacts every tick, so only probe the walls again if the entity has
+     * moved or the room has changed underneath it since the last probe. */
+    if (!INBOUNDS_VEC(t, entities))
+    {
+        vlog_error("updatecontacts() out-of-bounds!");
+        return;
+    }
+
+    entclass& entity = entities[t];
+
     SDL_Rect temprect;
-    temprect.x = entities[t].xp + entities[t].cx;
-    temprect.y = entities[t].yp + entities[t].cy - 1;
-    temprect.w = entities[t].w;
-    temprect.h = entities[t].h;
+    temprect.x = entity.xp + entity.cx;
+    temprect.y = entity.yp + entity.cy + 1;
+    temprect.w = entity.w;
+    temprect.h = entity.h;
+
+    contactprobes++;
+
+    if (entity.contactgeneration == contactgeneration
+    && entity.contactrect.x == temprect.x
+    && entity.contactrect.y == temprect.y
+    && entity.contactrect.w == temprect.w
+    && entity.contactrect.h == temprect.h)
+    {
+        contacthits++;
+        return;
+    }
 
-    if (checkwall(temprect)) return true;
-    return false;
+    entity.contactgeneration = contactgeneration;
+    entity.contactrect = temprect;
+    entity.contactfloor = checkwall(temprect);
+
+    temprect.y -= 2;
+    entity.contactroof = checkwall(temprect);
+}
+
+void entityclass::invalidatecontacts(void)
+{
+    contactgeneration++;
+    if (contactgeneration == 0)
+    {
+        /* 0 is what cleared entities start with, never treat it as valid */
+        contactgeneration = 1;
+    }
 }
 
 bool entityclass::testwallsx( int t, int tx, int ty, const bool skipdirblocks )
@@ -4711,7 +4847,7 @@ void entityclass::entitycollisioncheck(void)
     if (activetrigger > -1 && INBOUNDS_VEC(block_idx, blocks))
     {
         // Load the block's script if its gamestate is out of range
-        if (blocks[block_idx].script != "" && (activetrigger < 300 || activetrigger > 336))
+        if (blocks[block_idx].script[0] != '\0' && (activetrigger < 300 || activetrigger > 336))
         {
             game.startscript = true;
             game.newscript = blocks[block_idx].script;
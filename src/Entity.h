@@ -9,6 +9,8 @@
 #include "Ent.h"
 #include "BlockV.h"
 #include "Game.h"
+#include "RoomArena.h"
+#include "StringPool.h"
 
 enum
 {
@@ -17,7 +19,8 @@ enum
     DAMAGE = 2,
     DIRECTIONAL = 3,
     SAFE = 4,
-    ACTIVITY = 5
+    ACTIVITY = 5,
+    NUM_BLOCK_TYPES
 };
 
 enum
@@ -64,7 +67,7 @@ public:
 
     void generateswnwave(int t);
 
-    void createblock(int t, int xp, int yp, int w, int h, int trig = 0, const std::string& script = "", bool custom = false);
+    void createblock(int t, int xp, int yp, int w, int h, int trig = 0, const char* script = "", bool custom = false);
 
     bool disableentity(int t);
 
@@ -153,6 +156,10 @@ public:
 
     bool entitycollideroof(int t);
 
+    void updatecontacts(int t);
+
+    void invalidatecontacts(void);
+
     bool testwallsx(int t, int tx, int ty, const bool skipdirblocks);
 
     bool testwallsy(int t, float tx, float ty);
@@ -178,7 +185,25 @@ public:
     int k;
 
 
-    std::vector<blockclass> blocks;
+    roomvector<blockclass> blocks;
+
+    //Block indices by type, bucketed by the cells of a coarse grid over
+    //the room. Rebuilt on the first lookup after the blocks change.
+    void updateblockindex(void);
+    int firstblockat(int type, const SDL_Rect& rect, int trigger = -1);
+
+    static const int blockgrid_cellsize = 32;
+    static const int blockgrid_cols = 10;
+    static const int blockgrid_rows = 8;
+    roomvector<int> blockgrid[NUM_BLOCK_TYPES][blockgrid_cols * blockgrid_rows];
+    bool blockindexdirty;
+
+    stringpoolclass blocknames;
+
+    //Bumped whenever blocks or tiles change, or a new logic tick starts
+    Uint32 contactgeneration;
+    Uint32 contactprobes, contacthits;
+
     bool flags[100];
     bool collect[100];
     bool customcollect[100];
@@ -49,16 +49,24 @@ static char levelDir[MAX_PATH] = {'\0'};
 static char assetDir[MAX_PATH] = {'\0'};
 static char virtualMountPath[MAX_PATH] = {'\0'};
 
+/* data.psp or data.zip, and how long loading from it has taken */
+static char dataArchive[MAX_PATH] = {'\0'};
+static Uint64 loadTicks = 0;
+static Uint32 loadFiles = 0;
+static Uint64 loadBytes = 0;
+/* Files may be loaded from job threads */
+static SDL_SpinLock loadStatsLock = 0;
+
 static int PLATFORM_getOSDirectory(char* output, const size_t output_size);
 
 static void* bridged_malloc(PHYSFS_uint64 size)
 {
-    return RAM_malloc(size);
+    return RAM_mallocTagged(size, RAM_TAG_PHYSFS);
 }
 
 static void* bridged_realloc(void* ptr, PHYSFS_uint64 size)
 {
-    return RAM_realloc(ptr, size);
+    return RAM_reallocTagged(ptr, size, RAM_TAG_PHYSFS);
 }
 
 static const PHYSFS_Allocator allocator = {
@@ -75,6 +83,7 @@ int FILESYSTEM_init(char *argvZero, char* baseDir, char *assetsPath)
     int retval;
     const char* pathSep = PHYSFS_getDirSeparator();
     char* basePath;
+    bool mounted;
 
     PHYSFS_setAllocator(&allocator);
 
@@ -155,18 +164,28 @@ int FILESYSTEM_init(char *argvZero, char* baseDir, char *assetsPath)
     }
 
     /* Mount the stock content last */
+    mounted = false;
     if (assetsPath)
     {
         SDL_strlcpy(output, assetsPath, sizeof(output));
     }
     else
     {
+        /* data.psp is data.zip repacked without compression, so no inflating */
         SDL_snprintf(output, sizeof(output), "%s%s",
             basePath,
-            "data.zip"
+            "data.psp"
         );
+        mounted = PHYSFS_mount(output, NULL, 1);
+        if (!mounted)
+        {
+            SDL_snprintf(output, sizeof(output), "%s%s",
+                basePath,
+                "data.zip"
+            );
+        }
     }
-    if (!PHYSFS_mount(output, NULL, 1))
+    if (!mounted && !PHYSFS_mount(output, NULL, 1))
     {
         vlog_error("Error: data.zip missing!");
         vlog_error("You do not have data.zip!");
@@ -184,6 +203,8 @@ int FILESYSTEM_init(char *argvZero, char* baseDir, char *assetsPath)
         retval = 0;
         goto end;
     }
+    SDL_strlcpy(dataArchive, output, sizeof(dataArchive));
+    vlog_info("Data archive: %s", dataArchive);
 
     SDL_snprintf(output, sizeof(output), "%s%s", basePath, "gamecontrollerdb.txt");
     if (SDL_GameControllerAddMappingsFromFile(output) < 0)
@@ -645,6 +666,15 @@ static void getMountedPath(
     SDL_strlcpy(buffer, path, buffer_size);
 }
 
+bool FILESYSTEM_assetExists(const char* filename)
+{
+    char path[MAX_PATH];
+
+    getMountedPath(path, sizeof(path), filename);
+
+    return PHYSFS_exists(path);
+}
+
 bool FILESYSTEM_isAssetMounted(const char* filename)
 {
     const char* realDir;
@@ -729,6 +759,7 @@ void FILESYSTEM_loadFileToMemory(
     PHYSFS_File *handle;
     PHYSFS_sint64 length;
     PHYSFS_sint64 success;
+    const Uint64 start = SDL_GetPerformanceCounter();
 
     vlog_info("Loading file %s to memory", name);
 
@@ -770,12 +801,19 @@ void FILESYSTEM_loadFileToMemory(
             VVV_exit(1);
         }
     }
+    /* Archives without compression make this one seek and one read */
     success = PHYSFS_readBytes(handle, *mem, length);
     if (success == -1)
     {
         FILESYSTEM_freeMemory(mem);
     }
     PHYSFS_close(handle);
+
+    SDL_AtomicLock(&loadStatsLock);
+    loadTicks += SDL_GetPerformanceCounter() - start;
+    loadFiles++;
+    loadBytes += length;
+    SDL_AtomicUnlock(&loadStatsLock);
     return;
 
 fail:
@@ -802,12 +840,195 @@ void FILESYSTEM_loadAssetToMemory(
     FILESYSTEM_loadFileToMemory(path, mem, len, addnull);
 }
 
+void FILESYSTEM_logLoadTime(void)
+{
+    vlog_info(
+        "Loaded %u files, %u KB in %u ms with %s mounted",
+        loadFiles,
+        (unsigned int) (loadBytes / 1024),
+        (unsigned int) (loadTicks * 1000 / SDL_GetPerformanceFrequency()),
+        dataArchive
+    );
+}
+
+bool FILESYSTEM_loadAssetRange(
+    const char* name,
+    const size_t offset,
+    void* buffer,
+    const size_t length
+) {
+    char path[MAX_PATH];
+    PHYSFS_File* handle;
+    bool success;
+
+    getMountedPath(path, sizeof(path), name);
+
+    handle = PHYSFS_openRead(path);
+    if (handle == NULL)
+    {
+        vlog_error("- Handle is NULL: %s", PHYSFS_getErrorByCode(PHYSFS_getLastErrorCode()));
+        return false;
+    }
+
+    success = PHYSFS_seek(handle, offset) != 0
+        && PHYSFS_readBytes(handle, buffer, length) == (PHYSFS_sint64) length;
+
+    PHYSFS_close(handle);
+    return success;
+}
+
 void FILESYSTEM_freeMemory(unsigned char **mem)
 {
     SDL_free(*mem);
     *mem = NULL;
 }
 
+/* A read-only window onto part of a file */
+struct assetwindow
+{
+    PHYSFS_File* handle;
+    Sint64 start;
+    Sint64 size;
+    Sint64 pos;
+};
+
+static Sint64 SDLCALL assetwindow_size(SDL_RWops* context)
+{
+    return ((assetwindow*) context->hidden.unknown.data1)->size;
+}
+
+static Sint64 SDLCALL assetwindow_seek(SDL_RWops* context, Sint64 offset, int whence)
+{
+    assetwindow* window = (assetwindow*) context->hidden.unknown.data1;
+    Sint64 pos;
+
+    switch (whence)
+    {
+    case RW_SEEK_SET:
+        pos = offset;
+        break;
+    case RW_SEEK_CUR:
+        pos = window->pos + offset;
+        break;
+    case RW_SEEK_END:
+        pos = window->size + offset;
+        break;
+    default:
+        return SDL_SetError("Unknown value for 'whence'");
+    }
+
+    if (pos < 0 || pos > window->size)
+    {
+        return SDL_SetError("Seeking outside of the asset");
+    }
+
+    window->pos = pos;
+    return pos;
+}
+
+static size_t SDLCALL assetwindow_read(SDL_RWops* context, void* ptr, size_t size, size_t maxnum)
+{
+    assetwindow* window = (assetwindow*) context->hidden.unknown.data1;
+    PHYSFS_sint64 got;
+    size_t num;
+
+    if (size == 0)
+    {
+        return 0;
+    }
+
+    num = SDL_min(maxnum, (size_t) ((window->size - window->pos) / size));
+    if (num == 0)
+    {
+        return 0;
+    }
+
+    /* The handle is only ever moved by this window */
+    if (PHYSFS_tell(window->handle) != window->start + window->pos
+    && !PHYSFS_seek(window->handle, window->start + window->pos))
+    {
+        return 0;
+    }
+
+    got = PHYSFS_readBytes(window->handle, ptr, num * size);
+    if (got <= 0)
+    {
+        return 0;
+    }
+
+    window->pos += got;
+    return got / size;
+}
+
+static size_t SDLCALL assetwindow_write(SDL_RWops* context, const void* ptr, size_t size, size_t num)
+{
+    UNUSED(context);
+    UNUSED(ptr);
+    UNUSED(size);
+    UNUSED(num);
+    SDL_SetError("Assets are read-only");
+    return 0;
+}
+
+static int SDLCALL assetwindow_close(SDL_RWops* context)
+{
+    assetwindow* window = (assetwindow*) context->hidden.unknown.data1;
+
+    PHYSFS_close(window->handle);
+    RAM_free(window);
+    SDL_FreeRW(context);
+    return 0;
+}
+
+SDL_RWops* FILESYSTEM_openAssetRange(const char* name, const size_t offset, const size_t length)
+{
+    char path[MAX_PATH];
+    PHYSFS_File* handle;
+    PHYSFS_sint64 filesize;
+    assetwindow* window;
+    SDL_RWops* rw;
+
+    getMountedPath(path, sizeof(path), name);
+
+    handle = PHYSFS_openRead(path);
+    if (handle == NULL)
+    {
+        vlog_error("Unable to open %s: %s", name, PHYSFS_getErrorByCode(PHYSFS_getLastErrorCode()));
+        return NULL;
+    }
+
+    filesize = PHYSFS_fileLength(handle);
+    if (filesize < 0
+    || (PHYSFS_uint64) offset > (PHYSFS_uint64) filesize
+    || (length > 0 && (PHYSFS_uint64) (offset + length) > (PHYSFS_uint64) filesize))
+    {
+        vlog_error("%s has nothing at %u..%u", name, (unsigned int) offset, (unsigned int) (offset + length));
+        PHYSFS_close(handle);
+        return NULL;
+    }
+
+    window = (assetwindow*) RAM_malloc(sizeof(assetwindow));
+    rw = SDL_AllocRW();
+    if (window == NULL || rw == NULL)
+    {
+        VVV_exit(1);
+    }
+
+    window->handle = handle;
+    window->start = offset;
+    window->size = length > 0 ? (Sint64) length : filesize - (Sint64) offset;
+    window->pos = 0;
+
+    rw->size = assetwindow_size;
+    rw->seek = assetwindow_seek;
+    rw->read = assetwindow_read;
+    rw->write = assetwindow_write;
+    rw->close = assetwindow_close;
+    rw->type = SDL_RWOPS_UNKNOWN;
+    rw->hidden.unknown.data1 = window;
+    return rw;
+}
+
 bool FILESYSTEM_loadBinaryBlob(binaryBlob* blob, const char* filename)
 {
     PHYSFS_sint64 size;
@@ -844,7 +1065,6 @@ bool FILESYSTEM_loadBinaryBlob(binaryBlob* blob, const char* filename)
     for (i = 0; i < SDL_arraysize(blob->m_headers); ++i)
     {
         resourceheader* header = &blob->m_headers[i];
-        char** memblock = &blob->m_memblocks[i];
 
         /* Name can be stupid, just needs to be terminated */
         static const size_t last_char = sizeof(header->name) - 1;
@@ -863,13 +1083,9 @@ bool FILESYSTEM_loadBinaryBlob(binaryBlob* blob, const char* filename)
             goto fail; /* Bogus size value */
         }
 
-        PHYSFS_seek(handle, offset);
-        *memblock = (char*) RAM_malloc(header->size);
-        if (*memblock == NULL)
-        {
-            VVV_exit(1); /* Oh god we're out of memory, just bail */
-        }
-        PHYSFS_readBytes(handle, *memblock, header->size);
+        /* start_UNUSED was never filled in, the data just follows the
+         * headers in order. Nothing gets read here, see openTrack(). */
+        blob->m_offsets[i] = offset;
         offset += header->size;
         valid += 1;
 
@@ -885,7 +1101,13 @@ fail:
         return false;
     }
 
-    vlog_debug("The complete reloaded file size: %lli", size);
+    SDL_strlcpy(blob->m_filename, filename, sizeof(blob->m_filename));
+
+    vlog_debug("%s: %lli bytes, %u bytes of headers kept in memory",
+        filename,
+        size,
+        (unsigned int) sizeof(blob->m_headers)
+    );
 
     for (i = 0; i < SDL_arraysize(blob->m_headers); ++i)
     {
@@ -896,14 +1118,46 @@ fail:
             continue;
         }
 
-        vlog_debug("%s unpacked", header->name);
+        vlog_debug("%s indexed", header->name);
     }
 
     return true;
 }
 
+bool FILESYSTEM_saveFile(const char* name, const void* data, size_t length)
+{
+    PHYSFS_File* handle = PHYSFS_openWrite(name);
+    if (handle == NULL)
+    {
+        return false;
+    }
+    const bool success = PHYSFS_writeBytes(handle, data, length) == (PHYSFS_sint64) length;
+    PHYSFS_close(handle);
+    return success;
+}
+
+bool FILESYSTEM_appendFile(const char* name, const void* data, size_t length)
+{
+    PHYSFS_File* handle = PHYSFS_openAppend(name);
+    if (handle == NULL)
+    {
+        return false;
+    }
+    const bool success = PHYSFS_writeBytes(handle, data, length) == (PHYSFS_sint64) length;
+    PHYSFS_close(handle);
+    return success;
+}
+
 bool FILESYSTEM_saveTiXml2Document(const char *name, tinyxml2::XMLDocument& doc, bool sync /*= true*/)
 {
+#ifdef HEADLESS
+    /* A run nobody is playing mustn't write over the player's saves */
+    UNUSED(name);
+    UNUSED(doc);
+    UNUSED(sync);
+    return true;
+#endif
+
     /* XMLDocument.SaveFile doesn't account for Unicode paths, PHYSFS does */
     tinyxml2::XMLPrinter printer;
     doc.Print(&printer);
@@ -3,6 +3,7 @@
 
 /* Forward declaration */
 class binaryBlob;
+struct SDL_RWops;
 
 #include <stddef.h>
 
@@ -22,6 +23,7 @@ void FILESYSTEM_loadZip(const char* filename);
 bool FILESYSTEM_mountAssets(const char *path);
 void FILESYSTEM_unmountAssets(void);
 bool FILESYSTEM_isAssetMounted(const char* filename);
+bool FILESYSTEM_assetExists(const char* filename);
 
 void FILESYSTEM_loadFileToMemory(const char *name, unsigned char **mem,
                                  size_t *len, bool addnull);
@@ -31,10 +33,26 @@ void FILESYSTEM_loadAssetToMemory(
     size_t* len,
     const bool addnull
 );
+bool FILESYSTEM_loadAssetRange(
+    const char* name,
+    size_t offset,
+    void* buffer,
+    size_t length
+);
 void FILESYSTEM_freeMemory(unsigned char **mem);
 
+/* How long FILESYSTEM_loadFileToMemory() has taken so far, to compare
+ * data.psp with data.zip */
+void FILESYSTEM_logLoadTime(void);
+
+/* length 0 is the rest of the file */
+SDL_RWops* FILESYSTEM_openAssetRange(const char* name, size_t offset, size_t length);
+
 bool FILESYSTEM_loadBinaryBlob(binaryBlob* blob, const char* filename);
 
+bool FILESYSTEM_saveFile(const char* name, const void* data, size_t length);
+bool FILESYSTEM_appendFile(const char* name, const void* data, size_t length);
+
 bool FILESYSTEM_saveTiXml2Document(const char *name, tinyxml2::XMLDocument& doc, bool sync = true);
 bool FILESYSTEM_loadTiXml2Document(const char *name, tinyxml2::XMLDocument& doc);
 
@@ -2,13 +2,20 @@
 
 #include "Game.h"
 #include "Entity.h"
+#include "LevelPack.h"
 #include "MakeAndPlay.h"
+#include "Map.h"
+
+int finalclass::roomindex(int rx, int ry)
+{
+    return rx + (ry * 100);
+}
 
 const short* finalclass::loadlevel(int rx, int ry)
 {
     int t;
 
-    t = rx + (ry * 100);
+    t = roomindex(rx, ry);
     const short* result;
     warpx = false;
     warpy = false;
@@ -19,7 +26,7 @@ const short* finalclass::loadlevel(int rx, int ry)
     case rn(50,52):
     {
 
-        static const short contents[] = {
+        ROOM_CONTENTS(LEVELPACK_FINAL, t, 0, {
         98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,220,0,0,0,0,0,0,0,218,98,98,98,
         98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,220,0,0,0,0,0,0,0,218,98,98,98,
         259,259,259,259,259,259,259,259,259,259,259,259,259,259,259,259,259,259,259,259,259,259,259,259,259,259,259,259,260,0,0,0,0,0,0,0,258,259,259,259,
@@ -50,7 +57,7 @@ const short* finalclass::loadlevel(int rx, int ry)
         98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,220,0,0,0,0,0,0,0,218,98,98,98,98,98,98,98,98,98,98,98,
         98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,220,0,0,0,0,0,0,0,218,98,98,98,98,98,98,98,98,98,98,98,
         98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,220,0,0,0,0,0,0,0,218,98,98,98,98,98,98,98,98,98,98,98,
-        };
+        });
 
         obj.createentity(163, 32, 12, 168);  // (vertical gravity line)
         obj.createentity(99, 32, 12, 168);  // (vertical gravity line)
@@ -67,7 +74,7 @@ const short* finalclass::loadlevel(int rx, int ry)
     case rn(50,51):
     {
 
-        static const short contents[] = {
+        ROOM_CONTENTS(LEVELPACK_FINAL, t, 0, {
         0,0,0,218,98,98,220,0,0,0,0,0,0,0,218,98,98,220,0,0,0,0,0,0,0,218,98,98,220,0,0,0,0,0,0,0,218,98,220,740,
         0,0,0,258,259,259,260,0,0,0,0,0,0,0,258,259,259,260,0,0,0,0,0,0,0,258,259,259,260,0,0,0,0,0,0,0,218,98,220,740,
         0,0,0,7,7,7,7,0,0,0,0,0,0,0,7,7,7,7,0,0,0,0,0,0,0,7,7,7,7,0,0,0,0,0,0,0,218,98,220,740,
@@ -98,7 +105,7 @@ const short* finalclass::loadlevel(int rx, int ry)
         0,0,0,178,179,179,180,0,0,0,0,0,0,0,178,179,179,180,0,0,0,0,0,0,0,178,179,179,180,0,0,0,0,0,0,0,218,98,220,740,
         0,0,0,218,98,98,220,0,0,0,0,0,0,0,218,98,98,220,0,0,0,0,0,0,0,218,98,98,220,0,0,0,0,0,0,0,218,98,220,740,
         0,0,0,218,98,98,220,0,0,0,0,0,0,0,218,98,98,220,0,0,0,0,0,0,0,218,98,98,220,0,0,0,0,0,0,0,218,98,220,740,
-        };
+        });
 
         obj.createentity(-8, 116, 11, 40);  // (horizontal gravity line)
         obj.createentity(48, 116, 11, 184);  // (horizontal gravity line)
@@ -116,7 +123,7 @@ const short* finalclass::loadlevel(int rx, int ry)
     case rn(49,51):
     {
 
-        static const short contents[] = {
+        ROOM_CONTENTS(LEVELPACK_FINAL, t, 0, {
         0,0,0,0,0,0,0,0,0,0,50,218,98,98,220,49,0,0,0,0,0,0,0,0,50,218,98,98,220,49,0,0,0,0,0,0,0,0,0,0,
         0,0,0,0,0,0,0,0,0,0,50,258,259,259,260,49,0,0,0,0,0,0,0,0,50,258,259,259,260,49,0,0,0,0,0,0,0,0,0,0,
         0,0,0,0,0,0,0,0,0,0,0,7,7,7,7,0,0,0,0,0,0,0,0,0,0,7,7,7,7,0,0,0,0,0,0,0,0,0,0,0,
@@ -147,7 +154,7 @@ const short* finalclass::loadlevel(int rx, int ry)
         0,0,0,0,0,0,0,0,0,0,50,178,179,179,180,49,0,0,0,0,0,0,0,0,50,178,179,179,180,49,0,0,0,0,0,0,0,0,0,0,
         0,0,0,0,0,0,0,0,0,0,50,218,98,98,220,49,0,0,0,0,0,0,0,0,50,218,98,98,220,49,0,0,0,0,0,0,0,0,0,0,
         0,0,0,0,0,0,0,0,0,0,50,218,98,98,220,49,0,0,0,0,0,0,0,0,50,218,98,98,220,49,0,0,0,0,0,0,0,0,0,0,
-        };
+        });
 
         obj.createentity(-8, 116, 11, 40);  // (horizontal gravity line)
         obj.createentity(288, 116, 11, 32);  // (horizontal gravity line)
@@ -163,7 +170,7 @@ const short* finalclass::loadlevel(int rx, int ry)
     case rn(48,51):
     {
 
-        static const short contents[] = {
+        ROOM_CONTENTS(LEVELPACK_FINAL, t, 0, {
         0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
         0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
         0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
@@ -194,7 +201,7 @@ const short* finalclass::loadlevel(int rx, int ry)
         0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
         0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
         0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-        };
+        });
 
         obj.createentity(-8, 116, 11, 40);  // (horizontal gravity line)
         obj.createentity(48, 116, 11, 224);  // (horizontal gravity line)
@@ -213,7 +220,7 @@ const short* finalclass::loadlevel(int rx, int ry)
     case rn(47,51):
     {
 
-        static const short contents[] = {
+        ROOM_CONTENTS(LEVELPACK_FINAL, t, 0, {
         0,0,0,0,0,0,0,0,0,0,0,0,218,220,0,0,0,0,0,0,218,220,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
         0,0,0,0,0,0,0,0,0,0,0,0,258,260,0,0,0,0,0,0,258,260,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
         0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
@@ -244,7 +251,7 @@ const short* finalclass::loadlevel(int rx, int ry)
         0,0,0,0,0,0,0,0,0,0,0,0,218,220,0,0,0,0,0,0,218,220,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
         0,0,0,0,0,0,0,0,0,0,0,0,218,220,0,0,0,0,0,0,218,220,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
         0,0,0,0,0,0,0,0,0,0,0,0,218,220,0,0,0,0,0,0,218,220,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-        };
+        });
 
         obj.createentity(-8, 148, 11, 104);  // (horizontal gravity line)
         obj.createentity(-8, 84, 11, 80);  // (horizontal gravity line)
@@ -261,7 +268,7 @@ const short* finalclass::loadlevel(int rx, int ry)
     case rn(46,51):
     {
 
-        static const short contents[] = {
+        ROOM_CONTENTS(LEVELPACK_FINAL, t, 0, {
         0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
         0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
         0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
@@ -292,7 +299,7 @@ const short* finalclass::loadlevel(int rx, int ry)
         0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
         0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
         0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-        };
+        });
 
         obj.createentity(-8, 84, 11, 328);  // (horizontal gravity line)
         obj.createentity(-8, 148, 11, 328);  // (horizontal gravity line)
@@ -311,7 +318,7 @@ const short* finalclass::loadlevel(int rx, int ry)
     case rn(45,51):
     {
 
-        static const short contents[] = {
+        ROOM_CONTENTS(LEVELPACK_FINAL, t, 0, {
         0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,218,220,0,0,0,0,0,0,218,220,0,0,0,0,0,0,0,0,0,0,0,0,
         0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,258,260,0,0,0,0,0,0,258,260,0,0,0,0,0,0,0,0,0,0,0,0,
         0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
@@ -342,7 +349,7 @@ const short* finalclass::loadlevel(int rx, int ry)
         0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,218,220,0,0,0,0,0,0,218,220,0,0,0,0,0,0,0,0,0,0,0,0,
         0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,218,220,0,0,0,0,0,0,218,220,0,0,0,0,0,0,0,0,0,0,0,0,
         0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,218,220,0,0,0,0,0,0,218,220,0,0,0,0,0,0,0,0,0,0,0,0,
-        };
+        });
 
         obj.createentity(248, 84, 11, 72);  // (horizontal gravity line)
         obj.createentity(224, 148, 11, 96);  // (horizontal gravity line)
@@ -359,7 +366,7 @@ const short* finalclass::loadlevel(int rx, int ry)
     case rn(44,51):
     {
 
-        static const short contents[] = {
+        ROOM_CONTENTS(LEVELPACK_FINAL, t, 0, {
         0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
         0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
         0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
@@ -390,7 +397,7 @@ const short* finalclass::loadlevel(int rx, int ry)
         0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
         0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
         0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-        };
+        });
 
         obj.createentity(64+32-8, 32-16, 1, 0, 7, 0, -48, 320, 312);  // Enemy, bounded
         obj.createentity(96+32-8, 32-16, 1, 0, 7, 0, -56, 320, 320);  // Enemy, bounded
@@ -415,7 +422,7 @@ const short* finalclass::loadlevel(int rx, int ry)
     case rn(43,51):
     {
 
-        static const short contents[] = {
+        ROOM_CONTENTS(LEVELPACK_FINAL, t, 0, {
         0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,218,98,220,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
         0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,258,259,260,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
         0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,7,7,7,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
@@ -446,7 +453,7 @@ const short* finalclass::loadlevel(int rx, int ry)
         0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,178,179,180,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
         0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,218,98,220,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
         0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,218,98,220,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-        };
+        });
 
         obj.createentity(155, 24, 12, 184);  // (vertical gravity line)
         obj.createentity(120, 152, 1, 1, 8, 0, -56, 320, 296);  // Enemy, bounded
@@ -469,7 +476,7 @@ const short* finalclass::loadlevel(int rx, int ry)
     case rn(42,51):
     {
 
-        static const short contents[] = {
+        ROOM_CONTENTS(LEVELPACK_FINAL, t, 0, {
         740,740,740,740,740,740,740,740,740,740,740,740,740,740,740,740,740,218,98,220,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
         740,740,740,740,740,740,740,740,740,740,740,740,740,740,740,740,740,218,98,220,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
         179,179,179,179,179,179,179,179,179,179,179,179,179,179,179,179,179,140,98,220,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
@@ -500,7 +507,7 @@ const short* finalclass::loadlevel(int rx, int ry)
         740,740,740,740,740,740,740,740,740,740,740,740,740,740,740,740,740,218,98,220,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
         740,740,740,740,740,740,740,740,740,740,740,740,740,740,740,740,740,218,98,220,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
         740,740,740,740,740,740,740,740,740,740,740,740,740,740,740,740,740,218,98,220,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-        };
+        });
 
         obj.createentity(168, 72, 10, 0, 51420);  // (savepoint)
         obj.createentity(24, 60, 11, 120);  // (horizontal gravity line)
@@ -516,7 +523,7 @@ const short* finalclass::loadlevel(int rx, int ry)
     case rn(41,51):
     {
 
-        static const short contents[] = {
+        ROOM_CONTENTS(LEVELPACK_FINAL, t, 0, {
         740,740,218,98,220,258,259,259,259,259,259,259,259,259,259,259,259,259,259,259,259,259,259,259,259,259,259,259,260,218,220,218,98,220,740,740,740,740,740,740,
         740,740,218,98,220,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,218,220,218,98,220,740,740,740,740,740,740,
         740,740,218,98,220,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,218,220,218,98,220,740,740,740,740,740,740,
@@ -547,7 +554,7 @@ const short* finalclass::loadlevel(int rx, int ry)
         740,740,218,98,220,0,0,0,0,0,218,220,0,0,0,0,0,0,0,0,0,0,0,218,98,220,740,740,740,740,740,740,740,740,740,740,740,740,740,740,
         740,740,218,98,220,0,0,0,0,0,218,220,178,179,179,179,179,179,179,179,179,179,180,218,98,220,740,740,740,740,740,740,740,740,740,740,740,740,740,740,
         740,740,218,98,220,0,0,0,0,0,218,220,218,98,98,98,98,98,98,98,98,98,220,218,98,220,740,740,740,740,740,740,740,740,740,740,740,740,740,740,
-        };
+        });
 
         obj.createentity(280, 120, 10, 1, 51410);  // (savepoint)
         obj.createentity(40, 28, 11, 192);  // (horizontal gravity line)
@@ -565,7 +572,7 @@ const short* finalclass::loadlevel(int rx, int ry)
     case rn(41,52):
     {
 
-        static const short contents[] = {
+        ROOM_CONTENTS(LEVELPACK_FINAL, t, 0, {
         740,740,218,98,220,0,0,0,0,0,218,98,220,740,740,740,740,740,740,740,740,740,740,740,740,740,740,740,740,740,740,740,740,740,740,740,740,740,740,740,
         179,179,140,98,220,0,0,0,0,0,218,98,139,179,179,179,179,179,179,179,179,179,179,179,179,179,179,179,179,179,179,179,179,179,179,179,179,179,179,179,
         98,98,98,98,220,0,0,0,0,0,218,98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,
@@ -596,7 +603,7 @@ const short* finalclass::loadlevel(int rx, int ry)
         740,740,218,98,220,0,0,0,0,0,218,98,220,740,740,740,740,740,740,740,740,740,740,740,740,740,740,740,740,740,740,740,740,740,740,740,740,740,740,740,
         740,740,218,98,220,0,0,0,0,0,218,98,220,740,740,740,740,740,740,740,740,740,740,740,740,740,740,740,740,740,740,740,740,740,740,740,740,740,740,740,
         740,740,218,98,220,0,0,0,0,0,218,98,220,740,740,740,740,740,740,740,740,740,740,740,740,740,740,740,740,740,740,740,740,740,740,740,740,740,740,740,
-        };
+        });
 
         obj.createentity(264, 168, 10, 1, 52410);  // (savepoint)
         obj.createentity(152, 112, 20, 1);  // (terminal)
@@ -623,7 +630,7 @@ const short* finalclass::loadlevel(int rx, int ry)
     case rn(42,52):
     {
 
-        static const short contents[] = {
+        ROOM_CONTENTS(LEVELPACK_FINAL, t, 0, {
         740,740,740,740,740,740,740,740,740,740,740,740,740,740,740,740,740,740,740,740,740,740,740,740,740,740,740,740,740,740,740,740,740,740,740,740,740,740,740,740,
         740,740,740,740,740,740,740,740,740,740,740,740,740,740,740,740,740,740,740,740,740,740,740,740,740,740,740,740,740,740,740,740,740,740,740,740,740,740,740,740,
         740,740,740,740,740,740,740,740,740,740,740,740,740,740,740,740,740,740,740,740,740,740,740,740,740,740,740,740,740,740,740,740,740,740,740,740,740,740,740,740,
@@ -654,7 +661,7 @@ const short* finalclass::loadlevel(int rx, int ry)
         740,740,740,740,740,740,740,740,740,740,218,98,220,218,98,99,259,259,259,259,259,259,259,259,100,98,220,218,98,220,740,740,740,740,740,740,740,740,740,740,
         740,740,740,740,740,740,740,740,740,740,218,98,220,218,98,220,740,740,740,740,740,740,740,740,218,98,220,218,98,220,740,740,740,740,740,740,740,740,740,740,
         740,740,740,740,740,740,740,740,740,740,218,98,220,218,98,220,740,740,740,740,740,740,740,740,218,98,220,218,98,220,740,740,740,740,740,740,740,740,740,740,
-        };
+        });
         roomname = "Party Time!";
         result = contents;
         break;
@@ -664,7 +671,7 @@ const short* finalclass::loadlevel(int rx, int ry)
     case rn(43,52):
     {
 
-        static const short contents[] = {
+        ROOM_CONTENTS(LEVELPACK_FINAL, t, 0, {
         218,98,98,220,218,98,98,220,218,98,98,220,218,98,98,220,218,98,98,220,218,98,98,220,218,98,98,220,218,98,98,220,218,98,98,220,218,98,98,220,
         218,98,98,220,218,98,98,220,218,98,98,220,218,98,98,220,218,98,98,220,218,98,98,220,258,259,259,260,218,98,98,220,218,98,98,220,218,98,98,220,
         218,98,98,220,218,98,98,220,218,98,98,220,258,259,259,260,218,98,98,220,258,259,259,260,0,0,0,0,258,259,259,260,218,98,98,220,218,98,98,220,
@@ -695,7 +702,7 @@ const short* finalclass::loadlevel(int rx, int ry)
         218,98,98,220,218,98,98,220,218,98,98,220,218,98,98,220,178,179,179,180,218,98,98,220,218,98,98,220,218,98,98,220,218,98,98,220,218,98,98,220,
         218,98,98,220,218,98,98,220,218,98,98,220,218,98,98,220,218,98,98,220,218,98,98,220,218,98,98,220,218,98,98,220,218,98,98,220,218,98,98,220,
         218,98,98,220,218,98,98,220,218,98,98,220,218,98,98,220,218,98,98,220,218,98,98,220,218,98,98,220,218,98,98,220,218,98,98,220,218,98,98,220,
-        };
+        });
 
         obj.createentity(264, 176, 10, 1, 52430);  // (savepoint)
         obj.createentity(96, 180, 11, 96);  // (horizontal gravity line)
@@ -712,7 +719,7 @@ const short* finalclass::loadlevel(int rx, int ry)
     case rn(44,52):
     {
 
-        static const short contents[] = {
+        ROOM_CONTENTS(LEVELPACK_FINAL, t, 0, {
         0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,218,98,98,220,218,98,98,98,98,98,98,98,
         0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,218,98,98,220,218,98,98,98,98,98,98,98,
         0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,258,259,259,260,258,259,259,259,259,259,259,259,
@@ -743,7 +750,7 @@ const short* finalclass::loadlevel(int rx, int ry)
         98,98,98,98,98,98,220,218,220,218,98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,220,218,98,98,
         98,98,98,98,98,98,220,218,220,218,98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,220,218,98,98,
         98,98,98,98,98,98,220,218,220,218,98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,220,218,98,98,
-        };
+        });
 
         obj.createentity(64, 112, 2, 11, 4);  //Big Threadmill, <<<<<<
         obj.createentity(128, 112, 2, 11, 4);  //Big Threadmill, <<<<<<
@@ -768,7 +775,7 @@ const short* finalclass::loadlevel(int rx, int ry)
     case rn(45,52):
     {
 
-        static const short contents[] = {
+        ROOM_CONTENTS(LEVELPACK_FINAL, t, 0, {
         98,98,98,98,98,98,98,220,218,98,220,740,740,740,740,740,740,218,98,220,0,0,0,0,0,0,218,98,98,98,220,218,98,220,740,740,740,740,740,740,
         98,98,98,98,98,98,98,220,218,98,220,740,740,740,740,740,740,218,98,220,0,0,0,0,0,0,218,98,98,98,220,218,98,220,740,740,740,740,740,740,
         259,259,259,259,259,259,259,260,218,98,220,740,740,740,740,740,740,218,98,220,0,0,0,0,0,0,258,259,259,259,260,218,98,139,179,179,179,179,179,179,
@@ -799,7 +806,7 @@ const short* finalclass::loadlevel(int rx, int ry)
         740,218,98,220,218,98,220,740,740,218,98,220,218,98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,220,218,98,220,740,740,740,740,740,740,740,
         740,218,98,220,218,98,220,740,740,218,98,220,218,98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,220,218,98,220,740,740,740,740,740,740,740,
         740,218,98,220,218,98,220,740,740,218,98,220,218,98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,220,218,98,220,740,740,740,740,740,740,740,
-        };
+        });
 
         obj.createentity(40, 176, 10, 1, 52450);  // (savepoint)
         obj.createentity(80, 156, 11, 176);  // (horizontal gravity line)
@@ -813,7 +820,7 @@ const short* finalclass::loadlevel(int rx, int ry)
     case rn(47,52):
     {
 
-        static const short contents[] = {
+        ROOM_CONTENTS(LEVELPACK_FINAL, t, 0, {
         740,218,98,220,218,98,98,98,98,98,98,98,98,220,0,0,0,0,0,0,218,98,220,740,740,740,740,740,740,740,740,740,740,740,740,740,740,740,740,740,
         740,218,98,220,258,259,259,259,259,259,259,259,259,260,0,0,0,0,0,0,218,98,139,179,179,179,179,179,179,179,179,179,179,179,179,179,179,179,179,179,
         740,218,98,220,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,218,98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,
@@ -844,7 +851,7 @@ const short* finalclass::loadlevel(int rx, int ry)
         740,218,98,220,178,179,179,179,179,179,179,179,180,218,220,178,179,179,179,179,179,179,179,179,179,179,179,180,218,98,220,740,740,740,740,740,740,740,740,740,
         740,218,98,220,218,98,98,98,98,98,98,98,220,218,220,218,98,98,98,98,98,98,98,98,98,98,98,220,218,98,220,740,740,740,740,740,740,740,740,740,
         740,218,98,220,218,98,98,98,98,98,98,98,220,218,220,218,98,98,98,98,98,98,98,98,98,98,98,220,218,98,220,740,740,740,740,740,740,740,740,740,
-        };
+        });
 
         obj.createentity(68-4, 56,  2, 11, 4);  //Big Threadmill, <<<<<<
         obj.createentity(132-4, 56,  2, 9, 4);  //Threadmill, <<<
@@ -860,7 +867,7 @@ const short* finalclass::loadlevel(int rx, int ry)
     case rn(48,52):
     {
 
-        static const short contents[] = {
+        ROOM_CONTENTS(LEVELPACK_FINAL, t, 0, {
         98,98,220,218,98,98,98,98,98,98,98,98,98,220,218,98,220,218,98,98,98,98,98,98,98,98,98,98,220,218,98,98,98,98,98,98,98,98,98,98,
         98,98,220,258,259,259,259,259,259,259,259,259,259,260,218,98,220,258,259,259,259,259,259,259,259,259,259,259,260,218,98,98,98,98,98,98,98,98,98,98,
         259,259,260,7,7,7,7,7,7,7,7,7,7,7,258,259,260,7,7,7,7,7,7,7,7,7,7,7,7,258,259,259,259,259,259,259,259,259,259,259,
@@ -891,7 +898,7 @@ const short* finalclass::loadlevel(int rx, int ry)
         179,179,179,179,179,179,179,179,179,180,6,6,6,6,6,6,6,6,6,6,6,6,178,179,180,6,6,6,6,6,6,6,6,6,6,6,6,178,179,179,
         98,98,98,98,98,98,98,98,98,220,178,179,179,179,179,179,179,179,179,179,179,180,218,98,220,178,179,179,179,179,179,179,179,179,179,179,180,218,98,98,
         98,98,98,98,98,98,98,98,98,220,218,98,98,98,98,98,98,98,98,98,98,220,218,98,220,218,98,98,98,98,98,98,98,98,98,98,220,218,98,98,
-        };
+        });
 
         obj.createentity(16, 112, 10, 1, 52480);  // (savepoint)
         obj.createentity(67, 24, 12, 96);  // (vertical gravity line)
@@ -908,7 +915,7 @@ const short* finalclass::loadlevel(int rx, int ry)
     case rn(50,53):
     {
 
-        static const short contents[] = {
+        ROOM_CONTENTS(LEVELPACK_FINAL, t, 0, {
         98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,220,0,0,0,0,0,0,0,218,220,218,98,220,740,740,740,740,740,740,740,
         98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,220,0,0,0,0,0,0,0,218,220,218,98,139,179,179,179,179,179,179,179,
         98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,220,0,0,0,0,0,0,0,218,220,218,98,98,98,98,98,98,98,98,98,
@@ -939,7 +946,7 @@ const short* finalclass::loadlevel(int rx, int ry)
         98,220,0,0,0,218,98,98,98,98,220,218,98,98,98,98,98,220,218,98,220,740,740,740,740,740,740,740,740,740,218,98,220,218,98,98,98,98,98,98,
         98,220,0,0,0,218,98,98,98,98,220,218,98,98,98,98,98,220,218,98,220,740,740,740,740,740,740,740,740,740,218,98,220,218,98,98,98,98,98,98,
         98,220,0,0,0,218,98,98,98,98,220,218,98,98,98,98,98,220,218,98,220,740,740,740,740,740,740,740,740,740,218,98,220,218,98,98,98,98,98,98,
-        };
+        });
 
         obj.createentity(192, 56, 10, 1, 53500);  // (savepoint)
         obj.createentity(288, 104, 10, 0, 53501);  // (savepoint)
@@ -961,7 +968,7 @@ const short* finalclass::loadlevel(int rx, int ry)
     case rn(50,54):
     {
 
-        static const short contents[] = {
+        ROOM_CONTENTS(LEVELPACK_FINAL, t, 0, {
         98,220,0,0,0,218,98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,
         98,220,0,0,0,258,259,259,259,259,259,259,259,259,259,259,259,259,259,259,259,259,259,259,259,259,259,259,259,259,259,259,259,259,259,259,259,259,100,98,
         98,220,0,0,0,740,740,7,7,7,7,7,7,7,740,740,740,740,7,7,7,7,7,7,740,740,740,740,7,7,7,7,7,7,7,7,7,7,218,98,
@@ -992,7 +999,7 @@ const short* finalclass::loadlevel(int rx, int ry)
         259,259,259,259,259,259,259,259,259,259,259,259,259,259,259,259,259,259,259,259,259,259,259,259,259,259,259,259,259,259,259,259,259,259,259,259,259,259,259,259,
         740,740,740,740,740,740,740,740,740,740,740,740,740,740,740,740,740,740,740,740,740,740,740,740,740,740,740,740,740,740,740,740,740,740,740,740,740,740,740,740,
         740,740,740,740,740,740,740,740,740,740,740,740,740,740,740,740,740,740,740,740,740,740,740,740,740,740,740,740,740,740,740,740,740,740,740,740,740,740,740,740,
-        };
+        });
 
         obj.createentity(24, 88, 10, 1, 54500);  // (savepoint)
         obj.createentity(280, 184, 10, 1, 54501);  // (savepoint)
@@ -1012,7 +1019,7 @@ const short* finalclass::loadlevel(int rx, int ry)
     case rn(52,53):
     {
 
-        static const short contents[] = {
+        ROOM_CONTENTS(LEVELPACK_FINAL, t, 0, {
         740,740,740,740,740,740,740,740,740,740,740,740,740,740,740,740,740,740,740,740,740,740,740,740,740,740,740,740,740,740,740,740,740,740,740,740,740,740,740,740,
         740,740,740,740,740,740,740,740,740,740,740,740,740,740,740,740,740,740,740,740,740,740,740,740,740,740,740,740,740,740,740,740,740,740,740,740,740,740,740,740,
         740,740,740,740,740,740,740,740,740,740,740,740,740,740,740,740,740,740,740,740,740,740,740,740,740,740,740,740,740,740,740,740,740,740,740,740,740,740,740,740,
@@ -1043,7 +1050,7 @@ const short* finalclass::loadlevel(int rx, int ry)
         740,740,740,740,740,740,740,740,740,740,740,740,740,740,740,740,740,740,740,740,740,740,740,740,740,740,740,740,740,740,740,740,740,740,740,740,740,740,740,740,
         740,740,740,740,740,740,740,740,740,740,740,740,740,740,740,740,740,740,740,740,740,740,740,740,740,740,740,740,740,740,740,740,740,740,740,740,740,740,740,740,
         740,740,740,740,740,740,740,740,740,740,740,740,740,740,740,740,740,740,740,740,740,740,740,740,740,740,740,740,740,740,740,740,740,740,740,740,740,740,740,740,
-        };
+        });
 
         obj.createentity(16, 48, 10, 1, 53520);  // (savepoint)
         obj.createentity(96, 144, 3);  //Disappearing Platform
@@ -1061,7 +1068,7 @@ const short* finalclass::loadlevel(int rx, int ry)
     case rn(53,53):
     {
 
-        static const short contents[] = {
+        ROOM_CONTENTS(LEVELPACK_FINAL, t, 0, {
         740,740,740,740,740,740,740,740,740,740,740,740,740,740,740,740,740,740,740,740,740,740,740,740,740,740,740,740,740,740,740,740,740,740,740,740,740,740,740,740,
         740,740,740,740,740,740,740,740,740,740,740,740,740,740,740,740,740,740,740,740,740,740,740,740,740,740,740,740,740,740,740,7,740,740,740,740,740,740,740,740,
         740,740,740,740,740,740,7,740,740,740,740,740,740,740,740,740,740,740,740,740,740,740,740,740,740,740,740,740,740,740,7,0,7,740,740,740,740,740,740,740,
@@ -1092,7 +1099,7 @@ const short* finalclass::loadlevel(int rx, int ry)
         740,740,740,740,740,740,740,740,740,740,740,740,740,740,740,740,740,740,740,740,740,740,740,740,6,740,740,740,740,740,740,740,740,740,740,740,740,740,740,740,
         740,740,740,740,740,740,740,740,740,740,740,740,740,740,740,740,740,740,740,740,740,740,740,740,740,740,740,740,740,740,740,740,740,740,740,740,740,740,740,740,
         740,740,740,740,740,740,740,740,740,740,740,740,740,740,740,740,740,740,740,740,740,740,740,740,740,740,740,740,740,740,740,740,740,740,740,740,740,740,740,740,
-        };
+        });
 
         obj.createentity(0, 80, 3);  //Disappearing Platform
         obj.createentity(288, 88, 3);  //Disappearing Platform
@@ -1112,7 +1119,7 @@ const short* finalclass::loadlevel(int rx, int ry)
     case rn(54,53):
     {
 
-        static const short contents[] = {
+        ROOM_CONTENTS(LEVELPACK_FINAL, t, 0, {
         740,740,740,740,740,740,740,740,740,740,740,740,740,740,740,740,0,0,0,0,0,0,0,0,740,740,740,740,740,740,740,740,740,740,740,740,740,740,740,740,
         740,740,740,740,740,740,740,740,740,740,740,740,740,740,740,740,0,0,0,0,0,0,0,0,740,740,740,740,740,740,740,740,740,740,740,740,740,740,740,740,
         740,740,740,740,740,740,740,740,740,740,740,740,740,740,740,740,0,0,0,0,0,0,0,0,740,740,740,740,740,740,740,740,740,740,740,740,740,740,740,740,
@@ -1143,7 +1150,7 @@ const short* finalclass::loadlevel(int rx, int ry)
         740,740,740,740,740,740,740,740,740,740,740,740,740,740,740,740,740,740,740,740,740,740,740,740,740,740,740,740,740,740,740,740,740,740,740,740,740,740,740,740,
         740,740,740,740,740,740,740,740,740,740,740,740,740,740,740,740,740,740,740,740,740,740,740,740,740,740,740,740,740,740,740,740,740,740,740,740,740,740,740,740,
         740,740,740,740,740,740,740,740,740,740,740,740,740,740,740,740,740,740,740,740,740,740,740,740,740,740,740,740,740,740,740,740,740,740,740,740,740,740,740,740,
-        };
+        });
 
         obj.createentity(0, 88, 3);  //Disappearing Platform
         obj.createentity(32, 88, 3);  //Disappearing Platform
@@ -1159,7 +1166,7 @@ const short* finalclass::loadlevel(int rx, int ry)
     case rn(54,52):
     {
 
-        static const short contents[] = {
+        ROOM_CONTENTS(LEVELPACK_FINAL, t, 0, {
         740,740,740,740,740,740,740,740,740,740,740,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,740,740,740,740,740,740,740,740,740,740,740,
         740,740,740,740,740,740,740,740,740,740,740,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,740,740,740,740,740,740,740,740,740,740,740,
         740,740,740,740,740,740,740,740,740,740,740,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,740,740,740,740,740,740,740,740,740,740,740,
@@ -1190,7 +1197,7 @@ const short* finalclass::loadlevel(int rx, int ry)
         740,740,740,740,740,740,740,740,740,740,740,740,740,740,740,740,0,0,0,0,0,0,0,0,740,740,740,740,740,740,740,740,740,740,740,740,740,740,740,740,
         740,740,740,740,740,740,740,740,740,740,740,740,740,740,740,740,0,0,0,0,0,0,0,0,740,740,740,740,740,740,740,740,740,740,740,740,740,740,740,740,
         740,740,740,740,740,740,740,740,740,740,740,740,740,740,740,740,0,0,0,0,0,0,0,0,740,740,740,740,740,740,740,740,740,740,740,740,740,740,740,740,
-        };
+        });
         roomname = "VV";
         result = contents;
         break;
@@ -1200,7 +1207,7 @@ const short* finalclass::loadlevel(int rx, int ry)
     case rn(54,51):
     {
 
-        static const short contents[] = {
+        ROOM_CONTENTS(LEVELPACK_FINAL, t, 0, {
         740,740,740,740,740,740,740,740,740,740,740,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,740,740,740,740,740,740,740,740,740,740,740,
         740,740,740,740,740,740,740,740,740,740,740,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,740,740,740,740,740,740,740,740,740,740,740,
         740,740,740,740,740,740,740,740,740,740,740,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,740,740,740,740,740,740,740,740,740,740,740,
@@ -1231,7 +1238,7 @@ const short* finalclass::loadlevel(int rx, int ry)
         740,740,740,740,740,740,740,740,740,740,740,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,740,740,740,740,740,740,740,740,740,740,740,
         740,740,740,740,740,740,740,740,740,740,740,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,740,740,740,740,740,740,740,740,740,740,740,
         740,740,740,740,740,740,740,740,740,740,740,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,740,740,740,740,740,740,740,740,740,740,740,
-        };
+        });
         roomname = "VVV";
         result = contents;
         break;
@@ -1241,7 +1248,7 @@ const short* finalclass::loadlevel(int rx, int ry)
     case rn(54,50):
     {
 
-        static const short contents[] = {
+        ROOM_CONTENTS(LEVELPACK_FINAL, t, 0, {
         740,740,740,740,740,740,740,740,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,740,740,740,740,740,740,740,740,
         740,740,740,740,740,740,740,740,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,740,740,740,740,740,740,740,740,
         740,740,740,740,740,740,740,740,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,740,740,740,740,740,740,740,740,
@@ -1272,7 +1279,7 @@ const short* finalclass::loadlevel(int rx, int ry)
         740,740,740,740,740,740,740,740,740,740,740,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,740,740,740,740,740,740,740,740,740,740,740,
         740,740,740,740,740,740,740,740,740,740,740,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,740,740,740,740,740,740,740,740,740,740,740,
         740,740,740,740,740,740,740,740,740,740,740,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,740,740,740,740,740,740,740,740,740,740,740,
-        };
+        });
         roomname = "VVVV";
         result = contents;
         break;
@@ -1281,7 +1288,7 @@ const short* finalclass::loadlevel(int rx, int ry)
     case rn(54,49):
     {
 
-        static const short contents[] = {
+        ROOM_CONTENTS(LEVELPACK_FINAL, t, 0, {
         740,740,740,740,740,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,740,740,740,740,740,
         740,740,740,740,740,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,740,740,740,740,740,
         740,740,740,740,740,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,740,740,740,740,740,
@@ -1312,7 +1319,7 @@ const short* finalclass::loadlevel(int rx, int ry)
         740,740,740,740,740,740,740,740,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,740,740,740,740,740,740,740,740,
         740,740,740,740,740,740,740,740,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,740,740,740,740,740,740,740,740,
         740,740,740,740,740,740,740,740,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,740,740,740,740,740,740,740,740,
-        };
+        });
 
         roomname = "VVVVV";
         result = contents;
@@ -1322,7 +1329,7 @@ const short* finalclass::loadlevel(int rx, int ry)
     case rn(54,48):
     {
 
-        static const short contents[] = {
+        ROOM_CONTENTS(LEVELPACK_FINAL, t, 0, {
         0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
         0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
         0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
@@ -1353,7 +1360,7 @@ const short* finalclass::loadlevel(int rx, int ry)
         740,740,740,740,740,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,740,740,740,740,740,
         740,740,740,740,740,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,740,740,740,740,740,
         740,740,740,740,740,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,740,740,740,740,740,
-        };
+        });
 
         obj.createblock(0, 0, 0, 5, 240);
         obj.createblock(0, 315, 0, 5, 240);
@@ -1376,7 +1383,7 @@ const short* finalclass::loadlevel(int rx, int ry)
     case rn(46,54):
     {
 
-        static const short contents[] = {
+        ROOM_CONTENTS(LEVELPACK_FINAL, t, 0, {
         98,98,220,218,98,98,98,98,98,98,98,98,98,98,98,98,98,220,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
         98,98,220,218,98,98,98,98,98,98,98,98,98,98,98,98,98,220,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
         98,98,220,258,259,259,259,259,259,259,259,259,259,259,259,259,259,260,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
@@ -1407,7 +1414,7 @@ const short* finalclass::loadlevel(int rx, int ry)
         98,98,220,218,98,98,98,98,98,98,98,98,98,98,98,98,98,220,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
         98,98,220,218,98,98,98,98,98,98,98,98,98,98,98,98,98,220,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
         98,98,220,218,98,98,98,98,98,98,98,98,98,98,98,98,98,220,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-        };
+        });
 
         warpy = true;
         roomname = "Temporary Fault...";
@@ -1418,7 +1425,7 @@ const short* finalclass::loadlevel(int rx, int ry)
     case rn(47,54):
     {
 
-        static const short contents[] = {
+        ROOM_CONTENTS(LEVELPACK_FINAL, t, 0, {
         0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
         0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
         0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
@@ -1449,7 +1456,7 @@ const short* finalclass::loadlevel(int rx, int ry)
         0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
         0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
         0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-        };
+        });
         warpy = true;
         roomname = "Do Not Adjust the V-hold";
         result = contents;
@@ -1459,7 +1466,7 @@ const short* finalclass::loadlevel(int rx, int ry)
     case rn(48,54):
     {
 
-        static const short contents[] = {
+        ROOM_CONTENTS(LEVELPACK_FINAL, t, 0, {
         0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,218,98,220,740,740,740,740,740,740,740,740,740,740,740,740,740,740,740,740,740,740,740,740,740,
         0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,218,98,139,179,179,179,179,179,179,179,179,179,179,179,179,179,179,179,179,179,179,179,179,179,
         0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,218,98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,
@@ -1490,7 +1497,7 @@ const short* finalclass::loadlevel(int rx, int ry)
         0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,178,179,180,218,98,220,218,98,220,218,98,220,218,98,220,218,98,220,740,740,740,740,740,740,
         0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,218,98,220,218,98,220,218,98,220,218,98,220,218,98,220,218,98,220,740,740,740,740,740,740,
         0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,218,98,220,218,98,220,218,98,220,218,98,220,218,98,220,218,98,220,740,740,740,740,740,740,
-        };
+        });
 
         obj.createentity(264, 32, 10, 0, 54480);  // (savepoint)
 
@@ -1507,7 +1514,7 @@ const short* finalclass::loadlevel(int rx, int ry)
     case rn(49,54):
     {
 
-        static const short contents[] = {
+        ROOM_CONTENTS(LEVELPACK_FINAL, t, 0, {
         98,98,98,98,98,220,0,0,218,220,0,0,218,98,220,0,0,0,0,218,220,0,0,0,0,218,98,220,0,0,218,220,0,0,218,98,220,740,740,740,
         98,98,98,98,98,220,0,0,218,220,0,0,218,98,220,0,0,0,0,218,220,0,0,0,0,218,98,220,0,0,218,220,0,0,218,98,220,740,740,740,
         98,98,98,98,98,220,0,0,218,220,0,0,218,98,220,0,0,0,0,218,220,0,0,0,0,258,259,260,0,0,218,220,0,0,218,98,220,740,740,740,
@@ -1538,7 +1545,7 @@ const short* finalclass::loadlevel(int rx, int ry)
         740,740,740,218,98,220,0,0,218,220,0,0,218,98,220,0,0,0,0,218,220,0,0,0,0,218,98,220,0,0,218,220,0,0,218,98,98,98,98,98,
         740,740,740,218,98,220,0,0,218,220,0,0,218,98,220,0,0,0,0,218,220,0,0,0,0,218,98,220,0,0,218,220,0,0,218,98,98,98,98,98,
         740,740,740,218,98,220,0,0,218,220,0,0,218,98,220,0,0,0,0,218,220,0,0,0,0,218,98,220,0,0,218,220,0,0,218,98,98,98,98,98,
-        };
+        });
 
         obj.createentity(120, 116, 11, 80);  // (horizontal gravity line)
         warpy = true;
@@ -1552,7 +1559,7 @@ const short* finalclass::loadlevel(int rx, int ry)
     case rn(108,109):
     {
 
-        static const short contents[] = {
+        ROOM_CONTENTS(LEVELPACK_FINAL, t, 0, {
         12,12,12,12,13,23,23,23,23,23,23,14,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,
         12,12,12,12,21,7,7,9,7,7,7,20,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,
         12,12,12,12,21,28,28,0,28,28,28,20,13,23,23,23,23,23,23,23,23,23,23,23,23,23,23,23,23,23,23,23,14,12,12,12,12,12,12,12,
@@ -1583,7 +1590,7 @@ const short* finalclass::loadlevel(int rx, int ry)
         12,12,12,12,12,12,12,15,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,16,12,
         12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,
         12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,
-        };
+        });
 
         obj.createentity(40, 80, 10, 1, 50500);  // (savepoint)
 
@@ -1595,7 +1602,7 @@ const short* finalclass::loadlevel(int rx, int ry)
     case rn(110,104):
     {
 
-        static const short contents[] = {
+        ROOM_CONTENTS(LEVELPACK_FINAL, t, 0, {
         12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,
         12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,
         12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,
@@ -1626,7 +1633,7 @@ const short* finalclass::loadlevel(int rx, int ry)
         12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,
         12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,
         12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,
-        };
+        });
 
         obj.createentity(16, 112, 10, 1, 50520);  // (savepoint)
         roomname = "Seeing Red";
@@ -1646,7 +1653,7 @@ const short* finalclass::loadlevel(int rx, int ry)
     case rn(111,104):
     {
 
-        static const short contents[] = {
+        ROOM_CONTENTS(LEVELPACK_FINAL, t, 0, {
         12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,
         12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,
         12,12,13,23,23,23,23,23,23,23,23,23,23,23,23,23,23,23,23,23,23,23,23,23,23,23,23,23,23,23,23,23,23,23,23,23,23,14,12,12,
@@ -1677,7 +1684,7 @@ const short* finalclass::loadlevel(int rx, int ry)
         12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,
         12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,
         12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,
-        };
+        });
 
         obj.createentity(128-16, 80-32, 14); //Teleporter!
         roomname = "Building Apport";
@@ -1694,7 +1701,7 @@ const short* finalclass::loadlevel(int rx, int ry)
     case rn(53,48):
     {
 
-        static const short contents[] = {
+        ROOM_CONTENTS(LEVELPACK_FINAL, t, 0, {
         98,98,98,98,98,98,98,98,98,98,98,98,98,98,220,0,0,0,0,0,0,0,0,0,0,218,98,98,98,98,98,98,98,98,98,98,98,98,98,98,
         98,98,98,98,98,98,98,98,98,98,98,98,98,98,220,0,178,179,179,179,179,180,178,180,0,218,98,98,98,98,98,98,98,98,98,98,98,98,98,98,
         259,259,259,259,259,259,259,259,259,259,259,259,259,259,260,0,258,259,259,259,259,260,218,220,0,258,259,259,259,259,259,259,259,259,259,259,259,259,259,259,
@@ -1725,7 +1732,7 @@ const short* finalclass::loadlevel(int rx, int ry)
         0,0,0,0,0,0,258,259,259,260,0,0,0,0,218,98,98,220,0,0,0,0,258,259,260,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
         179,179,179,179,179,179,179,179,179,180,0,0,0,0,218,98,98,220,0,0,0,0,178,179,179,179,179,179,179,179,179,179,179,179,179,179,179,179,179,179,
         98,98,98,98,98,98,98,98,98,220,0,0,0,0,218,98,98,220,0,0,0,0,218,98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,
-        };
+        });
 
         roomname = "Whee Sports";
         warpx = true;
@@ -1736,7 +1743,7 @@ const short* finalclass::loadlevel(int rx, int ry)
     case rn(53,49):
     {
 
-        static const short contents[] = {
+        ROOM_CONTENTS(LEVELPACK_FINAL, t, 0, {
         98,98,98,98,98,98,98,98,98,220,0,0,0,0,218,98,98,220,0,0,0,0,218,98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,
         259,259,259,259,259,259,259,100,98,220,0,0,0,0,218,98,98,220,0,0,0,0,218,98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,
         219,219,219,219,219,219,219,218,98,220,0,0,0,0,218,98,98,220,0,0,0,0,258,259,259,259,259,259,259,259,259,259,259,259,259,259,259,259,259,259,
@@ -1767,7 +1774,7 @@ const short* finalclass::loadlevel(int rx, int ry)
         0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
         0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
         0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-        };
+        });
 
         roomname = "Whizz Down The Shaft";
         warpx = true;
@@ -1777,7 +1784,7 @@ const short* finalclass::loadlevel(int rx, int ry)
 
     case rn(53, 50):
     {
-        static const short contents[] = {
+        ROOM_CONTENTS(LEVELPACK_FINAL, t, 0, {
         0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
         0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
         0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
@@ -1808,7 +1815,7 @@ const short* finalclass::loadlevel(int rx, int ry)
         0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
         0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
         0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-        };
+        });
 
 
         //obj.createentity(-8, 84-32, 11, 328);  // (horizontal gravity line)
@@ -1825,7 +1832,7 @@ const short* finalclass::loadlevel(int rx, int ry)
     case rn(53,51):
     {
 
-        static const short contents[] = {
+        ROOM_CONTENTS(LEVELPACK_FINAL, t, 0, {
         0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
         0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
         0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
@@ -1856,7 +1863,7 @@ const short* finalclass::loadlevel(int rx, int ry)
         219,218,98,220,0,0,0,0,218,98,220,219,219,219,219,219,219,219,219,219,219,219,219,219,219,219,219,219,219,219,219,219,219,219,219,219,219,219,219,219,
         219,218,98,220,0,0,0,0,218,98,220,219,219,219,219,219,219,219,219,219,219,219,219,219,219,219,219,219,219,219,219,219,219,219,219,219,219,219,219,219,
         219,218,98,220,0,0,0,0,218,98,220,219,219,219,219,219,219,219,219,219,219,219,219,219,219,219,219,219,219,219,219,219,219,219,219,219,219,219,219,219,
-        };
+        });
 
         obj.createentity(264, 176, 10, 1, 51530);  // (savepoint)
 
@@ -1896,7 +1903,7 @@ const short* finalclass::loadlevel(int rx, int ry)
     case rn(53,52):
     {
 
-        static const short contents[] = {
+        ROOM_CONTENTS(LEVELPACK_FINAL, t, 0, {
         219,218,98,220,0,0,0,0,218,98,220,219,219,219,219,219,219,219,219,219,219,219,219,219,219,219,219,219,219,219,219,219,219,219,219,219,219,219,219,219,
         219,218,98,220,0,0,0,0,218,98,139,179,179,179,179,179,179,179,179,179,179,179,179,179,179,179,179,179,179,179,179,179,179,179,179,179,179,179,179,179,
         219,218,98,220,0,0,0,0,218,98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,
@@ -1927,7 +1934,7 @@ const short* finalclass::loadlevel(int rx, int ry)
         219,219,219,219,219,219,219,219,218,98,220,219,219,219,219,219,219,219,219,219,219,219,219,219,219,219,219,219,219,219,219,219,219,219,219,219,219,219,219,219,
         219,219,219,219,219,219,219,219,218,98,220,219,219,219,219,219,219,219,219,219,219,219,219,219,219,219,219,219,219,219,219,219,219,219,219,219,219,219,219,219,
         219,219,219,219,219,219,219,219,218,98,220,219,219,219,219,219,219,219,219,219,219,219,219,219,219,219,219,219,219,219,219,219,219,219,219,219,219,219,219,219,
-        };
+        });
 
         obj.createentity((22 * 8)+4, (9 * 8) + 4, 14); //Teleporter!
 
@@ -1942,7 +1949,7 @@ const short* finalclass::loadlevel(int rx, int ry)
     case rn(41,56):
     {
 
-        static const short contents[] = {
+        ROOM_CONTENTS(LEVELPACK_FINAL, t, 0, {
         259,259,259,259,259,259,259,259,259,260,218,98,220,0,218,98,98,220,0,218,98,98,98,220,0,218,98,98,98,98,220,0,218,98,220,219,219,219,219,219,
         0,0,0,0,0,0,0,0,0,0,218,98,220,0,218,98,98,220,0,218,98,98,98,220,0,218,98,98,98,98,220,0,218,98,220,219,219,219,219,219,
         179,179,179,179,179,179,180,178,180,0,218,98,220,0,218,98,98,220,0,218,98,98,98,220,0,218,98,98,98,98,220,0,218,98,220,219,219,219,219,219,
@@ -1973,7 +1980,7 @@ const short* finalclass::loadlevel(int rx, int ry)
         219,219,219,219,219,219,219,219,219,219,218,98,220,0,218,98,98,220,0,218,98,98,98,220,0,218,98,98,98,98,220,0,218,98,220,219,219,219,219,219,
         219,219,219,219,219,219,219,219,219,219,218,98,220,0,218,98,98,220,0,218,98,98,98,220,0,218,98,98,98,98,220,0,218,98,220,219,219,219,219,219,
         219,219,219,219,219,219,219,219,219,219,218,98,220,0,218,98,98,220,0,218,98,98,98,220,0,218,98,98,98,98,220,0,218,98,220,219,219,219,219,219,
-        };
+        });
 
         //obj.createentity(164, 96, 10, 1, 56410);  // (savepoint)
 
@@ -1987,7 +1994,7 @@ const short* finalclass::loadlevel(int rx, int ry)
     case rn(42,56):
     {
 
-        static const short contents[] = {
+        ROOM_CONTENTS(LEVELPACK_FINAL, t, 0, {
         219,219,219,219,219,218,98,220,218,98,220,219,219,219,219,219,219,219,219,219,219,219,219,219,219,219,219,219,219,219,219,218,98,220,218,98,220,219,219,219,
         219,219,219,219,219,218,98,220,218,98,220,219,219,219,219,219,219,219,219,219,219,219,219,219,219,219,219,219,219,219,219,218,98,220,218,98,220,219,219,219,
         219,219,219,219,219,218,98,220,218,98,220,219,219,219,219,219,219,219,219,219,219,219,219,219,219,219,219,219,219,219,219,218,98,220,218,98,220,219,219,219,
@@ -2018,7 +2025,7 @@ const short* finalclass::loadlevel(int rx, int ry)
         219,218,98,220,218,98,99,259,259,259,259,259,259,259,259,259,259,259,259,259,259,259,259,259,259,259,259,259,259,259,259,259,259,259,259,259,259,259,259,259,
         219,218,98,220,218,98,220,219,219,219,219,219,219,219,219,219,219,219,219,219,219,219,219,219,219,219,219,219,219,219,219,219,219,219,219,219,219,219,219,219,
         219,218,98,220,218,98,220,219,219,219,219,219,219,219,219,219,219,219,219,219,219,219,219,219,219,219,219,219,219,219,219,219,219,219,219,219,219,219,219,219,
-        };
+        });
 
         if(!game.nodeathmode)
         {
@@ -2035,7 +2042,7 @@ const short* finalclass::loadlevel(int rx, int ry)
     case rn(43,56):
     {
 
-        static const short contents[] = {
+        ROOM_CONTENTS(LEVELPACK_FINAL, t, 0, {
         219,218,98,220,218,98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,
         219,218,98,220,258,259,259,259,259,259,259,259,259,259,259,259,259,259,259,259,259,259,259,259,259,259,259,259,259,259,259,259,259,259,259,259,259,259,259,259,
         219,218,98,220,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
@@ -2066,7 +2073,7 @@ const short* finalclass::loadlevel(int rx, int ry)
         259,259,259,259,259,259,259,259,259,259,259,259,259,259,259,259,259,259,259,259,259,259,259,259,259,259,259,259,259,259,259,259,259,259,259,259,259,259,259,259,
         219,219,219,219,219,219,219,219,219,219,219,219,219,219,219,219,219,219,219,219,219,219,219,219,219,219,219,219,219,219,219,219,219,219,219,219,219,219,219,219,
         219,219,219,219,219,219,219,219,219,219,219,219,219,219,219,219,219,219,219,219,219,219,219,219,219,219,219,219,219,219,219,219,219,219,219,219,219,219,219,219,
-        };
+        });
 
         if(!game.nodeathmode)
         {
@@ -2085,7 +2092,7 @@ const short* finalclass::loadlevel(int rx, int ry)
     case rn(44,56):
     {
 
-        static const short contents[] = {
+        ROOM_CONTENTS(LEVELPACK_FINAL, t, 0, {
         98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,
         259,259,259,259,259,259,259,259,259,259,259,259,259,259,259,259,259,259,259,259,259,259,259,259,259,259,259,259,259,259,259,259,259,259,259,259,259,259,259,259,
         0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
@@ -2116,7 +2123,7 @@ const short* finalclass::loadlevel(int rx, int ry)
         259,259,259,259,259,259,259,259,259,259,259,259,259,100,98,220,218,98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,
         219,219,219,219,219,219,219,219,219,219,219,219,219,218,98,220,218,98,99,259,259,259,259,259,259,259,259,259,259,259,259,259,259,259,259,259,259,259,259,259,
         219,219,219,219,219,219,219,219,219,219,219,219,219,218,98,220,218,98,220,219,219,219,219,219,219,219,219,219,219,219,219,219,219,219,219,219,219,219,219,219,
-        };
+        });
 
         obj.createentity(144, 40, 10, 1, 56440);  // (savepoint)
 
@@ -2135,7 +2142,7 @@ const short* finalclass::loadlevel(int rx, int ry)
     case rn(45,56):
     {
 
-        static const short contents[] = {
+        ROOM_CONTENTS(LEVELPACK_FINAL, t, 0, {
         98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,220,218,98,220,219,219,219,219,219,
         259,259,259,259,259,259,259,259,259,259,259,259,259,259,259,259,259,259,259,259,259,259,259,259,259,259,259,259,259,259,259,260,218,98,220,219,219,219,219,219,
         0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,218,98,220,219,219,219,219,219,
@@ -2166,7 +2173,7 @@ const short* finalclass::loadlevel(int rx, int ry)
         98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,
         259,259,259,259,259,259,259,259,259,259,259,259,259,259,259,259,259,259,259,259,259,259,259,259,259,259,259,259,259,259,259,259,259,259,259,259,259,259,259,259,
         219,219,219,219,219,219,219,219,219,219,219,219,219,219,219,219,219,219,219,219,219,219,219,219,219,219,219,219,219,219,219,219,219,219,219,219,219,219,219,219,
-        };
+        });
 
         obj.createentity(104, 152, 1, 0, 3);  // Enemy
         obj.createentity(200, 152, 1, 0, 3);  // Enemy
@@ -2181,7 +2188,7 @@ const short* finalclass::loadlevel(int rx, int ry)
     case rn(46,56):
     {
 
-        static const short contents[] = {
+        ROOM_CONTENTS(LEVELPACK_FINAL, t, 0, {
         219,219,219,219,219,219,219,219,219,219,219,219,219,219,219,219,219,218,98,220,218,98,220,219,219,219,219,219,219,219,219,219,219,219,219,219,219,219,219,219,
         219,219,219,219,219,219,219,219,219,219,219,219,219,219,219,219,219,218,98,220,218,98,220,219,219,219,219,219,219,219,219,219,219,219,219,219,219,219,219,219,
         219,219,219,219,219,219,219,219,219,219,219,219,219,219,219,219,219,218,98,220,218,98,220,219,219,219,219,219,219,219,219,219,219,219,219,219,219,219,219,219,
@@ -2212,7 +2219,7 @@ const short* finalclass::loadlevel(int rx, int ry)
         98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,
         259,259,259,259,259,259,259,259,259,259,259,259,259,259,259,259,259,259,259,259,259,259,259,259,259,259,259,259,259,259,259,259,259,259,259,259,259,259,259,259,
         219,219,219,219,219,219,219,219,219,219,219,219,219,219,219,219,219,219,219,219,219,219,219,219,219,219,219,219,219,219,219,219,219,219,219,219,219,219,219,219,
-        };
+        });
 
         obj.createentity(56, 192, 10, 1, 56460);  // (savepoint)
 
@@ -2230,7 +2237,7 @@ const short* finalclass::loadlevel(int rx, int ry)
     case rn(47,56):
     {
 
-        static const short contents[] = {
+        ROOM_CONTENTS(LEVELPACK_FINAL, t, 0, {
         219,219,219,218,98,220,218,98,139,179,179,179,179,179,179,179,179,179,179,179,179,179,179,179,179,179,179,179,179,179,179,179,179,179,179,179,179,179,179,179,
         219,219,219,218,98,220,218,98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,
         219,219,219,218,98,220,258,259,259,259,259,259,259,259,259,259,259,259,259,259,259,259,259,259,259,259,259,259,259,259,259,259,259,259,259,259,259,259,259,259,
@@ -2261,7 +2268,7 @@ const short* finalclass::loadlevel(int rx, int ry)
         98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,220,6,6,6,6,218,98,98,220,218,98,220,219,219,219,219,219,219,219,219,219,219,219,
         259,259,259,259,259,259,259,259,259,259,259,259,259,259,259,100,98,220,178,179,179,180,218,98,98,220,218,98,220,219,219,219,219,219,219,219,219,219,219,219,
         219,219,219,219,219,219,219,219,219,219,219,219,219,219,219,218,98,220,218,98,98,220,218,98,98,220,218,98,220,219,219,219,219,219,219,219,219,219,219,219,
-        };
+        });
 
         obj.createentity(144, 64, 2, 0, 2, 144, 64, 176, 216);  // Platform, bounded
 
@@ -2274,7 +2281,7 @@ const short* finalclass::loadlevel(int rx, int ry)
     case rn(48,56):
     {
 
-        static const short contents[] = {
+        ROOM_CONTENTS(LEVELPACK_FINAL, t, 0, {
         179,179,179,179,179,179,179,179,179,179,179,179,179,179,179,179,179,179,179,179,179,179,179,140,98,220,218,98,220,219,219,219,219,219,219,219,219,219,219,219,
         98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,220,218,98,220,219,219,219,219,219,219,219,219,219,219,219,
         259,259,259,259,259,259,259,259,259,259,259,259,259,259,259,259,259,259,259,259,259,259,259,259,259,260,218,98,220,219,219,219,219,219,219,219,219,219,219,219,
@@ -2305,7 +2312,7 @@ const short* finalclass::loadlevel(int rx, int ry)
         219,219,219,218,98,220,218,98,220,219,219,219,219,219,219,219,219,219,219,219,219,219,219,219,219,219,219,219,219,219,219,219,219,219,219,219,219,219,219,219,
         219,219,219,218,98,220,218,98,220,219,219,219,219,219,219,219,219,219,219,219,219,219,219,219,219,219,219,219,219,219,219,219,219,219,219,219,219,219,219,219,
         219,219,219,218,98,220,218,98,220,219,219,219,219,219,219,219,219,219,219,219,219,219,219,219,219,219,219,219,219,219,219,219,219,219,219,219,219,219,219,219,
-        };
+        });
 
         warpy = true;
         roomname = "Don't Be Afraid";
@@ -2316,7 +2323,7 @@ const short* finalclass::loadlevel(int rx, int ry)
     case rn(49,56):
     {
 
-        static const short contents[] = {
+        ROOM_CONTENTS(LEVELPACK_FINAL, t, 0, {
         219,219,219,219,219,219,219,219,219,219,219,219,219,219,219,219,219,219,219,219,219,219,219,219,219,219,219,219,219,219,219,219,219,219,219,219,219,219,219,219,
         219,219,219,219,219,219,219,219,219,219,219,219,219,219,219,219,219,219,219,219,219,219,219,219,219,219,219,219,219,219,219,219,219,219,219,219,219,219,219,219,
         219,219,219,219,219,219,219,219,219,219,219,219,219,219,219,219,219,219,219,219,219,219,219,219,219,219,219,219,219,219,219,219,219,219,219,219,219,219,219,219,
@@ -2347,7 +2354,7 @@ const short* finalclass::loadlevel(int rx, int ry)
         219,219,219,219,219,219,219,219,219,219,219,219,219,219,219,219,219,219,219,219,219,219,219,219,219,219,219,219,219,219,219,219,219,219,219,219,219,219,219,219,
         219,219,219,219,219,219,219,219,219,219,219,219,219,219,219,219,219,219,219,219,219,219,219,219,219,219,219,219,219,219,219,219,219,219,219,219,219,219,219,219,
         219,219,219,219,219,219,219,219,219,219,219,219,219,219,219,219,219,219,219,219,219,219,219,219,219,219,219,219,219,219,219,219,219,219,219,219,219,219,219,219,
-        };
+        });
 
         obj.createentity(152, 176, 10, 1, 56490);  // (savepoint)
         if(!game.nodeathmode)
@@ -2363,7 +2370,7 @@ const short* finalclass::loadlevel(int rx, int ry)
     case rn(50,56):
     {
 
-        static const short contents[] = {
+        ROOM_CONTENTS(LEVELPACK_FINAL, t, 0, {
         219,219,218,98,220,218,98,220,219,219,219,219,219,219,219,219,219,219,219,219,219,219,219,219,219,219,219,219,219,219,219,219,219,219,219,219,219,219,219,219,
         219,219,218,98,220,218,98,220,219,219,219,219,219,219,219,219,219,219,219,219,219,219,219,219,219,219,219,219,219,219,219,219,219,219,219,219,219,219,219,219,
         219,219,218,98,220,218,98,220,219,219,219,219,219,219,219,219,219,219,219,219,219,219,219,219,219,219,219,219,219,219,219,219,219,219,219,219,219,219,219,219,
@@ -2394,7 +2401,7 @@ const short* finalclass::loadlevel(int rx, int ry)
         219,219,219,219,219,219,218,98,220,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,218,98,98,220,218,98,
         219,219,219,219,219,219,218,98,220,178,179,179,179,179,179,179,179,179,179,179,179,179,179,179,179,179,179,179,179,179,179,179,179,180,218,98,98,220,218,98,
         219,219,219,219,219,219,218,98,220,218,98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,220,218,98,98,220,218,98,
-        };
+        });
 
         obj.createentity(88, 200, 2, 1, 4, 88, 128, 216, 208);  // Platform, bounded
         obj.createentity(136, 136, 2, 0, 4, 88, 128, 216, 208);  // Platform, bounded
@@ -2409,7 +2416,7 @@ const short* finalclass::loadlevel(int rx, int ry)
     case rn(51,56):
     {
 
-        static const short contents[] = {
+        ROOM_CONTENTS(LEVELPACK_FINAL, t, 0, {
         219,219,219,219,219,219,219,219,219,219,219,218,98,220,218,98,98,220,218,98,98,220,218,98,220,219,219,219,219,219,219,219,219,219,219,219,219,219,219,219,
         219,219,219,219,219,219,219,219,219,219,219,218,98,220,218,98,98,220,218,98,98,220,218,98,220,219,219,219,219,219,219,219,219,219,219,219,219,219,219,219,
         219,219,219,219,219,219,219,219,219,219,219,218,98,220,218,98,98,220,218,98,98,220,218,98,220,219,219,219,219,219,219,219,219,219,219,219,219,219,219,219,
@@ -2440,7 +2447,7 @@ const short* finalclass::loadlevel(int rx, int ry)
         219,219,219,219,219,219,219,219,219,219,219,219,219,219,219,219,219,219,219,219,219,219,219,219,219,219,219,219,219,219,219,219,219,219,219,219,219,219,219,219,
         219,219,219,219,219,219,219,219,219,219,219,219,219,219,219,219,219,219,219,219,219,219,219,219,219,219,219,219,219,219,219,219,219,219,219,219,219,219,219,219,
         219,219,219,219,219,219,219,219,219,219,219,219,219,219,219,219,219,219,219,219,219,219,219,219,219,219,219,219,219,219,219,219,219,219,219,219,219,219,219,219,
-        };
+        });
 
         obj.createentity(192, 136, 10, 1, 56510);  // (savepoint)
         if(!game.nodeathmode)
@@ -2456,7 +2463,7 @@ const short* finalclass::loadlevel(int rx, int ry)
     case rn(52,56):
     {
 
-        static const short contents[] = {
+        ROOM_CONTENTS(LEVELPACK_FINAL, t, 0, {
         219,218,98,220,258,259,259,259,259,259,259,259,259,259,259,259,259,259,259,259,259,259,259,259,259,259,259,259,259,259,259,259,259,259,259,260,218,98,220,219,
         219,218,98,220,7,7,7,7,7,178,180,7,7,7,7,7,7,7,178,180,7,7,7,7,178,179,179,180,7,7,7,7,7,7,7,7,218,98,220,219,
         219,218,98,220,0,0,0,0,0,218,220,0,0,0,0,0,0,0,218,220,0,0,0,0,218,98,98,220,0,0,0,0,0,0,0,0,218,98,220,219,
@@ -2487,7 +2494,7 @@ const short* finalclass::loadlevel(int rx, int ry)
         219,218,98,220,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,218,98,220,219,
         219,218,98,220,178,179,179,179,179,179,179,179,179,179,179,179,179,179,179,179,179,179,179,179,179,179,179,179,179,179,179,179,179,179,179,180,218,98,220,219,
         219,218,98,220,218,98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,220,218,98,220,219,
-        };
+        });
 
         obj.createentity(48, 200, 2, 1, 6, 48, 48, 272, 208);  // Platform, bounded
         obj.createentity(80, 200, 2, 1, 6, 48, 48, 272, 208);  // Platform, bounded
@@ -2506,7 +2513,7 @@ const short* finalclass::loadlevel(int rx, int ry)
     case rn(53,56):
     {
 
-        static const short contents[] = {
+        ROOM_CONTENTS(LEVELPACK_FINAL, t, 0, {
         219,219,219,219,219,219,219,219,219,219,219,219,219,219,219,219,219,219,219,219,219,219,219,219,219,219,219,219,219,218,98,220,218,98,220,219,219,219,219,219,
         219,219,219,219,219,219,219,219,219,219,219,219,219,219,219,219,219,219,219,219,219,219,219,219,219,219,219,219,219,218,98,220,218,98,220,219,219,219,219,219,
         219,219,219,219,219,219,219,219,219,219,219,219,219,219,219,219,219,219,219,219,219,219,219,219,219,219,219,219,219,218,98,220,218,98,220,219,219,219,219,219,
@@ -2537,7 +2544,7 @@ const short* finalclass::loadlevel(int rx, int ry)
         219,219,219,219,219,218,98,220,218,98,99,259,259,259,259,259,259,259,259,259,259,259,259,259,259,259,259,259,259,259,259,259,259,259,259,259,259,259,259,259,
         219,219,219,219,219,218,98,220,218,98,220,219,219,219,219,219,219,219,219,219,219,219,219,219,219,219,219,219,219,219,219,219,219,219,219,219,219,219,219,219,
         219,219,219,219,219,218,98,220,218,98,220,219,219,219,219,219,219,219,219,219,219,219,219,219,219,219,219,219,219,219,219,219,219,219,219,219,219,219,219,219,
-        };
+        });
 
         obj.createentity(72, 72, 10, 1, 56530);  // (savepoint)
 
@@ -2550,7 +2557,7 @@ const short* finalclass::loadlevel(int rx, int ry)
     case rn(54,56):
     {
 
-        static const short contents[] = {
+        ROOM_CONTENTS(LEVELPACK_FINAL, t, 0, {
         219,219,219,219,219,219,219,219,219,219,219,219,219,218,98,220,218,98,220,219,219,219,219,219,219,219,219,219,219,219,218,98,220,218,98,220,219,219,219,219,
         219,219,219,219,219,219,219,219,219,219,219,219,219,218,98,220,218,98,220,219,219,219,219,219,219,219,219,219,219,219,218,98,220,218,98,220,219,219,219,219,
         219,219,219,219,219,219,219,219,219,219,219,219,219,218,98,220,218,98,220,219,219,219,219,219,219,219,219,219,219,219,218,98,220,218,98,220,219,219,219,219,
@@ -2581,7 +2588,7 @@ const short* finalclass::loadlevel(int rx, int ry)
         259,259,259,259,259,259,259,259,259,259,259,259,259,259,259,259,259,259,259,259,259,259,259,259,259,259,259,259,259,259,259,259,259,259,259,259,259,259,259,259,
         219,219,219,219,219,219,219,219,219,219,219,219,219,219,219,219,219,219,219,219,219,219,219,219,219,219,219,219,219,219,219,219,219,219,219,219,219,219,219,219,
         219,219,219,219,219,219,219,219,219,219,219,219,219,219,219,219,219,219,219,219,219,219,219,219,219,219,219,219,219,219,219,219,219,219,219,219,219,219,219,219,
-        };
+        });
 
         obj.createentity((18 * 8) + 4, (10 * 8) + 4, 14); //Teleporter!
 
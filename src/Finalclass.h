@@ -6,6 +6,8 @@ class finalclass
 public:
     const short* loadlevel(int rx, int ry);
 
+    static int roomindex(int rx, int ry);
+
     const char* roomname;
     bool warpx, warpy;
 };
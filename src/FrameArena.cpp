@@ -0,0 +1,201 @@
+#include "FrameArena.h"
+
+#include <stdarg.h>
+
+#include "Exit.h"
+#include "RAM.h"
+#include "Vlogging.h"
+
+#ifndef FRAME_ARENA_KB
+#define FRAME_ARENA_KB 64
+#endif
+
+#if FRAME_ARENA_KB > 0
+alignas(Uint64) static Uint8 arena_bytes[FRAME_ARENA_KB * 1024];
+arenaclass framearena(arena_bytes, sizeof(arena_bytes), "Frame", RAM_TAG_GRAPHICS);
+#else
+arenaclass framearena(NULL, 0, "Frame", RAM_TAG_GRAPHICS);
+#endif
+
+/* Making an SDL_Surface allocates as well, so the surfaces themselves are
+ * kept from frame to frame and only get their pixels from the arena */
+struct scratchsurface
+{
+    SDL_Surface* surface;
+    bool inuse;
+};
+
+static scratchsurface scratch[16];
+static int surfaces_in_use = 0;
+
+/* How many frames the heap allocation counts are logged for at a time */
+static const int report_frames = 300;
+
+static bool counting = false;
+static unsigned int last_count = 0;
+static unsigned int heap_allocations = 0;
+static unsigned int report_total = 0;
+static unsigned int report_max = 0;
+static int report_frame = 0;
+
+static bool matches(const SDL_Surface* surface, const SDL_Surface* like, const int w, const int h)
+{
+    return surface != NULL
+        && surface->w == w
+        && surface->h == h
+        && surface->format->format == like->format->format;
+}
+
+static SDL_Surface* makesurface(SDL_Surface* like, void* pixels, const int w, const int h)
+{
+    SDL_Surface* surface = SDL_CreateRGBSurfaceWithFormatFrom(
+        pixels,
+        w,
+        h,
+        like->format->BitsPerPixel,
+        w * like->format->BytesPerPixel,
+        like->format->format
+    );
+
+    if (surface == NULL)
+    {
+        vlog_error("Unable to create scratch surface: %s", SDL_GetError());
+        VVV_exit(1);
+    }
+
+    return surface;
+}
+
+SDL_Surface* FRAME_createSurface(SDL_Surface* like, const int w, const int h)
+{
+    void* pixels = framearena.allocate(w * h * like->format->BytesPerPixel);
+    scratchsurface* slot = NULL;
+    SDL_Surface* surface;
+    SDL_BlendMode blend_mode;
+
+    for (size_t i = 0; i < SDL_arraysize(scratch); i++)
+    {
+        if (scratch[i].inuse)
+        {
+            continue;
+        }
+        if (matches(scratch[i].surface, like, w, h))
+        {
+            slot = &scratch[i];
+            break;
+        }
+        if (slot == NULL)
+        {
+            /* Gets remade if nothing else fits */
+            slot = &scratch[i];
+        }
+    }
+
+    if (slot == NULL)
+    {
+        /* Freed again by FRAME_freeSurface() */
+        surface = makesurface(like, pixels, w, h);
+    }
+    else
+    {
+        if (!matches(slot->surface, like, w, h))
+        {
+            SDL_FreeSurface(slot->surface);
+            slot->surface = makesurface(like, pixels, w, h);
+        }
+        slot->inuse = true;
+        surface = slot->surface;
+    }
+
+    surface->pixels = pixels;
+    SDL_GetSurfaceBlendMode(like, &blend_mode);
+    SDL_SetSurfaceBlendMode(surface, blend_mode);
+    surfaces_in_use++;
+
+    return surface;
+}
+
+void FRAME_freeSurface(SDL_Surface* surface)
+{
+    framearena.deallocate(surface->pixels, surface->h * surface->pitch);
+    surface->pixels = NULL;
+    surfaces_in_use--;
+
+    for (size_t i = 0; i < SDL_arraysize(scratch); i++)
+    {
+        if (scratch[i].surface == surface)
+        {
+            scratch[i].inuse = false;
+            return;
+        }
+    }
+
+    SDL_FreeSurface(surface);
+}
+
+char* FRAME_sprintf(const char* format, ...)
+{
+    va_list args;
+    int length;
+    char* buffer;
+
+    va_start(args, format);
+    length = SDL_vsnprintf(NULL, 0, format, args);
+    va_end(args);
+
+    if (length < 0)
+    {
+        length = 0;
+    }
+
+    buffer = (char*) framearena.allocate(length + 1);
+    buffer[0] = '\0';
+
+    va_start(args, format);
+    SDL_vsnprintf(buffer, length + 1, format, args);
+    va_end(args);
+
+    return buffer;
+}
+
+void FRAME_end(void)
+{
+    const unsigned int count = RAM_allocationCount();
+
+    SDL_assert(surfaces_in_use == 0 && "Scratch surface outlived its frame!");
+    framearena.reset();
+
+    /* Everything before the first frame is loading */
+    heap_allocations = counting ? count - last_count : 0;
+    last_count = count;
+    counting = true;
+
+    report_total += heap_allocations;
+    report_max = SDL_max(report_max, heap_allocations);
+    report_frame++;
+
+    if (report_frame < report_frames)
+    {
+        return;
+    }
+
+    if (report_total > 0)
+    {
+        vlog_debug(
+            "%u heap allocations in the last %d frames, at most %u in one. Frame arena peaked at %u KB.",
+            report_total,
+            report_frames,
+            report_max,
+            (unsigned int) (framearena.peak / 1024)
+        );
+    }
+
+    report_total = 0;
+    report_max = 0;
+    report_frame = 0;
+}
+
+unsigned int FRAME_heapAllocations(void)
+{
+    return heap_allocations;
+}
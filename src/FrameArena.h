@@ -0,0 +1,29 @@
+#ifndef FRAMEARENA_H
+#define FRAMEARENA_H
+
+#include <SDL2/SDL.h>
+
+#include "Arena.h"
+
+/* Scratch memory for whatever drawing a frame needs for a moment, all of it
+ * let go of at once by FRAME_end(). */
+extern arenaclass framearena;
+
+/* A surface like the given one but w by h, with its pixels (which aren't
+ * cleared) in the frame arena. Free them in the reverse order they were made
+ * in, before the frame ends. */
+SDL_Surface* FRAME_createSurface(SDL_Surface* like, int w, int h);
+
+void FRAME_freeSurface(SDL_Surface* surface);
+
+/* The string lasts until the end of the frame */
+SDL_PRINTF_VARARG_FUNC(1) char* FRAME_sprintf(const char* format, ...);
+
+/* Resets the arena, call once the frame has been drawn */
+void FRAME_end(void);
+
+/* Heap allocations made during the last frame, only counted with
+ * RAM_TRACKING */
+unsigned int FRAME_heapAllocations(void);
+
+#endif /* FRAMEARENA_H */
@@ -0,0 +1,200 @@
+#include "FrameProfiler.h"
+
+#include <string>
+
+#include "FileSystemUtils.h"
+#include "Graphics.h"
+#include "GraphicsUtil.h"
+#include "Vlogging.h"
+
+frameprofilerclass::frameprofilerclass(void)
+{
+    SDL_zeroa(frames);
+    current = 0;
+    framecount = 0;
+    depth = 0;
+    dropped = 0;
+    clockticks = 0;
+    overlay = false;
+}
+
+int frameprofilerclass::begin(const char* name)
+{
+    frameclass& frame = frames[current];
+    const Uint64 now = SDL_GetPerformanceCounter();
+
+    if (frame.start == 0)
+    {
+        frame.start = now;
+    }
+
+    depth++;
+
+    if (frame.count >= max_zones)
+    {
+        dropped++;
+        return -1;
+    }
+
+    zoneclass& zone = frame.zones[frame.count];
+    zone.name = name;
+    zone.start = now - frame.start;
+    zone.ticks = 0;
+    zone.depth = depth - 1;
+    return frame.count++;
+}
+
+void frameprofilerclass::end(const int zone)
+{
+    depth--;
+
+    if (zone < 0)
+    {
+        return;
+    }
+
+    frameclass& frame = frames[current];
+    frame.zones[zone].ticks = SDL_GetPerformanceCounter() - frame.start - frame.zones[zone].start;
+}
+
+void frameprofilerclass::endframe(void)
+{
+    const Uint64 now = SDL_GetPerformanceCounter();
+
+    if (clockticks == 0)
+    {
+        for (int i = 0; i < 1000; i++)
+        {
+            SDL_GetPerformanceCounter();
+        }
+        clockticks = SDL_max((SDL_GetPerformanceCounter() - now) / 1000, 1);
+    }
+
+    SDL_assert(depth == 0 && "Profiler zone left open at the end of a frame!");
+
+    if (frames[current].start == 0)
+    {
+        frames[current].start = now;
+    }
+    frames[current].ticks = now - frames[current].start;
+    framecount++;
+
+    current = (current + 1) % history;
+    frames[current].start = now;
+    frames[current].count = 0;
+}
+
+static float toms(const Uint64 ticks)
+{
+    return ticks * 1000.0f / SDL_GetPerformanceFrequency();
+}
+
+void frameprofilerclass::drawoverlay(void)
+{
+    PROFILE_ZONE("profiler overlay");
+
+    if (framecount == 0)
+    {
+        return;
+    }
+
+    /* The one before the one that's being drawn */
+    const frameclass& frame = frames[(current + history - 1) % history];
+    const int max_lines = 27;
+    char line[48];
+    int lines = 0;
+
+    FillRect(graphics.backBuffer, 0, 0, 272, 8 * 29 + 4, 0, 0, 0);
+
+    SDL_snprintf(
+        line,
+        sizeof(line),
+        "frame %5.2f ms, profiler %.2f%%",
+        toms(frame.ticks),
+        frame.ticks > 0 ? 200.0f * frame.count * clockticks / frame.ticks : 0.0f
+    );
+    graphics.Print(2, 2, line, 255, 255, 255);
+
+    for (int i = 0; i < frame.count && lines < max_lines; i++)
+    {
+        const zoneclass& zone = frame.zones[i];
+
+        if (zone.depth > 3)
+        {
+            continue;
+        }
+
+        SDL_snprintf(
+            line,
+            sizeof(line),
+            "%*s%-*s %5.2f",
+            zone.depth * 2,
+            "",
+            26 - zone.depth * 2,
+            zone.name,
+            toms(zone.ticks)
+        );
+        graphics.Print(2, 12 + lines * 8, line, 196, 196, 255 - zone.depth * 40);
+        lines++;
+    }
+
+    if (dropped > 0)
+    {
+        SDL_snprintf(line, sizeof(line), "%u zones didn't fit", dropped);
+        graphics.Print(2, 12 + max_lines * 8, line, 255, 96, 96);
+    }
+}
+
+bool frameprofilerclass::dump(const char* filename)
+{
+    /* Not the one that's still going */
+    const Uint32 kept = SDL_min(framecount, (Uint32) history - 1);
+    const double frequency = SDL_GetPerformanceFrequency();
+    std::string out = "{\"displayTimeUnit\": \"ms\", \"traceEvents\": [\n";
+    char event[160];
+    bool first = true;
+
+    for (Uint32 f = 0; f < kept; f++)
+    {
+        /* Oldest first */
+        const frameclass& frame = frames[(current + history - kept + f) % history];
+        const double start = frame.start * 1000000.0 / frequency;
+
+        SDL_snprintf(
+            event,
+            sizeof(event),
+            "%s{\"name\": \"frame\", \"ph\": \"X\", \"pid\": 1, \"tid\": 1, \"ts\": %.3f, \"dur\": %.3f}",
+            first ? "" : ",\n",
+            start,
+            frame.ticks * 1000000.0 / frequency
+        );
+        out += event;
+        first = false;
+
+        for (int i = 0; i < frame.count; i++)
+        {
+            const zoneclass& zone = frame.zones[i];
+
+            SDL_snprintf(
+                event,
+                sizeof(event),
+                ",\n{\"name\": \"%s\", \"ph\": \"X\", \"pid\": 1, \"tid\": 1, \"ts\": %.3f, \"dur\": %.3f}",
+                zone.name,
+                start + zone.start * 1000000.0 / frequency,
+                zone.ticks * 1000000.0 / frequency
+            );
+            out += event;
+        }
+    }
+
+    out += "\n]}\n";
+
+    if (!FILESYSTEM_saveFile(filename, out.c_str(), out.length()))
+    {
+        vlog_error("Unable to write frame profile to %s", filename);
+        return false;
+    }
+
+    vlog_info("Wrote %u frames of profile to %s", kept, filename);
+    return true;
+}
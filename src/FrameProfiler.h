@@ -0,0 +1,92 @@
+#ifndef FRAMEPROFILER_H
+#define FRAMEPROFILER_H
+
+#ifdef FRAME_PROFILER
+
+#include <SDL2/SDL.h>
+
+/* Times nested zones of every frame: the gamestate functions, the GPU batch,
+ * the screen flip and the bigger drawing steps. The last frames are kept to
+ * be written out as a Chrome trace (chrome://tracing or Perfetto), and the
+ * last one can be shown on top of the game. Only built with FRAME_PROFILER,
+ * and zones are only opened on the main thread, so none of it needs a lock. */
+class frameprofilerclass
+{
+public:
+    frameprofilerclass(void);
+
+    /* Returns what to pass to end(), or -1 if the frame's full */
+    int begin(const char* name);
+    void end(int zone);
+
+    void endframe(void);
+
+    void drawoverlay(void);
+
+    bool dump(const char* filename);
+
+    bool overlay;
+
+    static const int max_zones = 96;
+    static const int history = 60;
+
+private:
+    struct zoneclass
+    {
+        /* Not copied, has to be a literal */
+        const char* name;
+        Uint32 start;
+        Uint32 ticks;
+        Uint16 depth;
+    };
+
+    struct frameclass
+    {
+        Uint64 start;
+        Uint32 ticks;
+        int count;
+        zoneclass zones[max_zones];
+    };
+
+    frameclass frames[history];
+    int current;
+    Uint32 framecount;
+    int depth;
+    Uint32 dropped;
+
+    /* What reading the clock costs, to tell how much the zones cost */
+    Uint64 clockticks;
+};
+
+extern frameprofilerclass frameprofiler;
+
+class profilezone
+{
+public:
+    explicit profilezone(const char* name)
+    : zone(frameprofiler.begin(name))
+    {
+    }
+
+    ~profilezone(void)
+    {
+        frameprofiler.end(zone);
+    }
+
+private:
+    const int zone;
+};
+
+#define PROFILE_ZONE_NAME2(line) profilezone_##line
+#define PROFILE_ZONE_NAME(line) PROFILE_ZONE_NAME2(line)
+
+/* Times the rest of the scope */
+#define PROFILE_ZONE(name) const profilezone PROFILE_ZONE_NAME(__LINE__)(name)
+
+#else
+
+#define PROFILE_ZONE(name)
+
+#endif /* FRAME_PROFILER */
+
+#endif /* FRAMEPROFILER_H */
@@ -8,6 +8,7 @@
 #include <utility>
 
 #include "Exit.h"
+#include "FrameProfiler.h"
 #include "Screen.h"
 #include "VRAM.h"
 #include "Vlogging.h"
@@ -325,6 +326,7 @@ gpu::Framebuffer gpu::createFramebuffer(unsigned int w, unsigned int h)
 
 void gpu::start()
 {
+    PROFILE_ZONE("gpu::start");
     assert(!inBatch, "attempt to start() while already in a batch");
     inBatch = true;
     sceGuStart(GU_DIRECT, drawList);
@@ -348,6 +350,7 @@ gpu::Framebuffer &gpu::display()
 
 void gpu::end()
 {
+    PROFILE_ZONE("gpu::end");
     assert(inBatch, "attempt to end() while not in a batch");
     inBatch = false;
     sceGuFinish();
@@ -26,6 +26,7 @@
 #include "UtilityClass.h"
 #include "Vlogging.h"
 #include "XMLUtils.h"
+#include "Xoshiro.h"
 
 static bool GetButtonFromString(const char *pText, SDL_GameControllerButton *button)
 {
@@ -366,6 +367,8 @@ void Game::init(void)
     disableaudiopause = false;
     disabletemporaryaudiopause = true;
     inputdelay = false;
+
+    rngseed = 0;
 }
 
 void Game::lifesequence(void)
@@ -2123,6 +2126,7 @@ void Game::updatestate(void)
 
         case 3000:
             //Activating a teleporter (long version for level complete)
+            graphics.grphx.prefetchimage(graphics.flipmode ? 5 : 0);
             state++;
             statedelay = 30;
             flashlight = 5;
@@ -2585,6 +2589,7 @@ void Game::updatestate(void)
 
         case 3500:
             music.fadeout();
+            graphics.grphx.prefetchimage(graphics.flipmode ? 6 : 4);
             state++;
             statedelay = 120;
             break;
@@ -5717,7 +5722,7 @@ void Game::loadtele(void)
 std::string Game::unrescued(void)
 {
     //Randomly return the name of an unrescued crewmate
-    if (fRandom() * 100 > 50)
+    if (xoshiro_logicrand() * 100 > 50)
     {
         if (!crewstats[5]) return "Victoria";
         if (!crewstats[2]) return "Vitellary";
@@ -5726,7 +5731,7 @@ std::string Game::unrescued(void)
     }
     else
     {
-        if (fRandom() * 100 > 50)
+        if (xoshiro_logicrand() * 100 > 50)
         {
             if (!crewstats[2]) return "Vitellary";
             if (!crewstats[4]) return "Verdigris";
@@ -482,6 +482,9 @@ public:
     bool disableaudiopause;
     bool disabletemporaryaudiopause;
     bool inputdelay;
+
+    /* What a new game seeds the RNG with, 0 for whatever the clock says */
+    Uint32 rngseed;
 };
 
 #ifndef GAME_DEFINITION
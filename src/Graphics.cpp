@@ -8,7 +8,10 @@
 #include "Entity.h"
 #include "Exit.h"
 #include "FileSystemUtils.h"
+#include "FrameArena.h"
+#include "FrameProfiler.h"
 #include "GraphicsUtil.h"
+#include "Jobs.h"
 #include "Map.h"
 #include "Music.h"
 #include "Screen.h"
@@ -147,6 +150,8 @@ void Graphics::init(void)
 
     kludgeswnlinewidth = false;
 
+    font_loaded = false;
+
 #ifndef NO_CUSTOM_LEVELS
     tiles1_mounted = false;
     tiles2_mounted = false;
@@ -308,30 +313,20 @@ void Graphics::updatetitlecolours(void)
     }
 
 #define PROCESS_TILESHEET_RENAME(tilesheet, vector, tile_square, extra_code) \
-    PROCESS_TILESHEET_CHECK_ERROR(tilesheet, tile_square) \
-    \
-    else \
+    if (!grphx.cut_##tilesheet.empty()) \
     { \
-        int j; \
-        for (j = 0; j < grphx.im_##tilesheet->h / tile_square; ++j) \
+        /* Already cut up by the job that loaded it */ \
+        size_t k; \
+        for (k = 0; k < grphx.cut_##tilesheet.size(); ++k) \
         { \
-            int i; \
-            for (i = 0; i < grphx.im_##tilesheet->w / tile_square; ++i) \
-            { \
-                SDL_Surface* temp = GetSubSurface( \
-                    grphx.im_##tilesheet, \
-                    i * tile_square, j * tile_square, \
-                    tile_square, tile_square \
-                ); \
-                vector.push_back(temp); \
-                \
-                extra_code \
-            } \
+            SDL_Surface* temp = grphx.cut_##tilesheet[k]; \
+            vector.push_back(temp); \
+            \
+            extra_code \
         } \
-        \
-        SDL_FreeSurface(grphx.im_##tilesheet); \
-        grphx.im_##tilesheet = NULL; \
-    }
+        grphx.cut_##tilesheet.clear(); \
+    } \
+    else PROCESS_TILESHEET_CHECK_ERROR(tilesheet, tile_square)
 
 #define PROCESS_TILESHEET(tilesheet, tile_square, extra_code) \
     PROCESS_TILESHEET_RENAME(tilesheet, tilesheet, tile_square, extra_code)
@@ -344,26 +339,9 @@ bool Graphics::Makebfont(void)
         flipbfont.push_back(TempFlipped);
     })
 
-    unsigned char* charmap;
-    size_t length;
-    FILESYSTEM_loadAssetToMemory("graphics/font.txt", &charmap, &length, false);
-    if (charmap != NULL)
-    {
-        unsigned char* current = charmap;
-        unsigned char* end = charmap + length;
-        int pos = 0;
-        while (current != end)
-        {
-            int codepoint = utf8::unchecked::next(current);
-            font_positions[codepoint] = pos;
-            ++pos;
-        }
-        FILESYSTEM_freeMemory(&charmap);
-    }
-    else
-    {
-        font_positions.clear();
-    }
+    /* Empty if there's no font.txt */
+    font_positions.swap(grphx.font_positions);
+    grphx.font_positions.clear();
 
     return true;
 }
@@ -410,12 +388,12 @@ bool Graphics::MakeSpriteArray(void)
 #undef PROCESS_TILESHEET_CHECK_ERROR
 
 
-void Graphics::map_tab(int opt, const std::string& text, bool selected /*= false*/)
+void Graphics::map_tab(int opt, const char* text, bool selected /*= false*/)
 {
     int x = opt*80 + 40 - len(text)/2;
     if (selected)
     {
-        Print(x-8, 220, "[" + text + "]", 196, 196, 255 - help.glow);
+        Print(x-8, 220, FRAME_sprintf("[%s]", text), 196, 196, 255 - help.glow);
     }
     else
     {
@@ -423,7 +401,7 @@ void Graphics::map_tab(int opt, const std::string& text, bool selected /*= false
     }
 }
 
-void Graphics::map_option(int opt, int num_opts, const std::string& text, bool selected /*= false*/)
+void Graphics::map_option(int opt, int num_opts, const char* text, bool selected /*= false*/)
 {
     int x = 80 + opt*32;
     int y = 136; // start from middle of menu
@@ -443,12 +421,12 @@ void Graphics::map_option(int opt, int num_opts, const std::string& text, bool s
 
     if (selected)
     {
-        std::string text_upper(text);
-        for (size_t i = 0; i < text_upper.length(); i++)
+        char* text_upper = FRAME_sprintf("[ %s ]", text);
+        for (size_t i = 0; text_upper[i] != '\0'; i++)
         {
             text_upper[i] = SDL_toupper(text_upper[i]);
         }
-        Print(x - 16, y, "[ " + text_upper + " ]", 196, 196, 255 - help.glow);
+        Print(x - 16, y, text_upper, 196, 196, 255 - help.glow);
     }
     else
     {
@@ -465,33 +443,21 @@ static void print_char(
     colourTransform& ct
 ) {
     SDL_Rect font_rect = {x, y, 8*scale, 8*scale};
-    SDL_Surface* surface;
 
     if (scale > 1)
     {
-        surface = ScaleSurface(font, 8 * scale, 8 * scale);
-        if (surface == NULL)
-        {
-            return;
-        }
+        BlitSurfaceColouredScaled(font, buffer, &font_rect, ct);
     }
     else
     {
-        surface = font;
-    }
-
-    BlitSurfaceColoured(surface, NULL, buffer, &font_rect, ct);
-
-    if (scale > 1)
-    {
-        SDL_FreeSurface(surface);
+        BlitSurfaceColoured(font, NULL, buffer, &font_rect, ct);
     }
 }
 
 void Graphics::do_print(
     const int x,
     const int y,
-    const std::string& text,
+    const char* text,
     int r,
     int g,
     int b,
@@ -501,7 +467,7 @@ void Graphics::do_print(
     std::vector<SDL_Surface*>& font = flipmode ? flipbfont : bfont;
 
     int position = 0;
-    std::string::const_iterator iter = text.begin();
+    const char* iter = text;
 
     r = clamp(r, 0, 255);
     g = clamp(g, 0, 255);
@@ -510,7 +476,7 @@ void Graphics::do_print(
 
     ct.colour = getRGBA(r, g, b, a);
 
-    while (iter != text.end())
+    while (*iter != '\0')
     {
         const uint32_t character = utf8::unchecked::next(iter);
         const int idx = font_idx(character);
@@ -525,10 +491,19 @@ void Graphics::do_print(
 }
 
 void Graphics::Print( int _x, int _y, const std::string& _s, int r, int g, int b, bool cen /*= false*/ ) {
+    return PrintAlpha(_x,_y,_s.c_str(),r,g,b,255,cen);
+}
+
+void Graphics::Print( int _x, int _y, const char* _s, int r, int g, int b, bool cen /*= false*/ ) {
     return PrintAlpha(_x,_y,_s,r,g,b,255,cen);
 }
 
 void Graphics::PrintAlpha( int _x, int _y, const std::string& _s, int r, int g, int b, int a, bool cen /*= false*/ )
+{
+    return PrintAlpha(_x,_y,_s.c_str(),r,g,b,a,cen);
+}
+
+void Graphics::PrintAlpha( int _x, int _y, const char* _s, int r, int g, int b, int a, bool cen /*= false*/ )
 {
     if (cen)
         _x = ((160 ) - ((len(_s)) / 2));
@@ -669,7 +644,7 @@ void Graphics::bigprint(  int _x, int _y, const std::string& _s, int r, int g, i
         _x = VVV_max(160 - (int((len(_s)/ 2.0)*sc)), 0 );
     }
 
-    return do_print(_x, _y, _s, r, g, b, 255, sc);
+    return do_print(_x, _y, _s.c_str(), r, g, b, 255, sc);
 }
 
 void Graphics::bigbprint(int x, int y, const std::string& s, int r, int g, int b, bool cen, int sc)
@@ -695,10 +670,15 @@ void Graphics::bigbprint(int x, int y, const std::string& s, int r, int g, int b
 }
 
 int Graphics::len(const std::string& t)
+{
+    return len(t.c_str());
+}
+
+int Graphics::len(const char* t)
 {
     int bfontpos = 0;
-    std::string::const_iterator iter = t.begin();
-    while (iter != t.end()) {
+    const char* iter = t;
+    while (*iter != '\0') {
         int cur = utf8::unchecked::next(iter);
         bfontpos += bfontlen(cur);
     }
@@ -936,6 +916,8 @@ void Graphics::drawtowertile3( int x, int y, int t, TowerBG& bg_obj )
 
 void Graphics::drawgui(void)
 {
+    PROFILE_ZONE("drawgui");
+
     int text_sign;
     int crew_yp;
     int crew_sprite;
@@ -1083,7 +1065,8 @@ void Graphics::updatetextboxes(void)
 
 void Graphics::drawimagecol( int t, int xp, int yp, bool cent/*= false*/ )
 {
-    if (!INBOUNDS_VEC(t, images))
+    SDL_Surface* image = grphx.getimage(t);
+    if (image == NULL)
     {
         return;
     }
@@ -1092,29 +1075,30 @@ void Graphics::drawimagecol( int t, int xp, int yp, bool cent/*= false*/ )
     point tpoint;
     if (cent)
     {
-        tpoint.x = 160 - int(images[t]->w / 2);
+        tpoint.x = 160 - int(image->w / 2);
         tpoint.y = yp;
         trect.x = tpoint.x ;
         trect.y = tpoint.y;
-        trect.w = images[t]->w;
-        trect.h= images[t]->h;
-        BlitSurfaceColoured(images[t], NULL, backBuffer, &trect, ct);
+        trect.w = image->w;
+        trect.h= image->h;
+        BlitSurfaceColoured(image, NULL, backBuffer, &trect, ct);
 
     }
     else
     {
         trect.x = xp;
         trect.y = yp;
-        trect.w = images[t]->w;
-        trect.h = images[t]->h;
-        BlitSurfaceColoured(images[t], NULL, backBuffer, &trect, ct);
+        trect.w = image->w;
+        trect.h = image->h;
+        BlitSurfaceColoured(image, NULL, backBuffer, &trect, ct);
 
     }
 }
 
 void Graphics::drawimage( int t, int xp, int yp, bool cent/*=false*/ )
 {
-    if (!INBOUNDS_VEC(t, images))
+    SDL_Surface* image = grphx.getimage(t);
+    if (image == NULL)
     {
         return;
     }
@@ -1122,27 +1106,28 @@ void Graphics::drawimage( int t, int xp, int yp, bool cent/*=false*/ )
     SDL_Rect trect;
     if (cent)
     {
-        trect.x = 160 - int(images[t]->w / 2);
+        trect.x = 160 - int(image->w / 2);
         trect.y = yp;
-        trect.w = images[t]->w;
-        trect.h = images[t]->h;
-        BlitSurfaceStandard(images[t], NULL, backBuffer, &trect);
+        trect.w = image->w;
+        trect.h = image->h;
+        BlitSurfaceStandard(image, NULL, backBuffer, &trect);
     }
     else
     {
 
         trect.x = xp;
         trect.y = yp;
-        trect.w = images[t]->w;
-        trect.h= images[t]->h;
+        trect.w = image->w;
+        trect.h= image->h;
 
-        BlitSurfaceStandard(images[t], NULL, backBuffer, &trect);
+        BlitSurfaceStandard(image, NULL, backBuffer, &trect);
     }
 }
 
 void Graphics::drawpartimage( int t, int xp, int yp, int wp, int hp)
 {
-  if (!INBOUNDS_VEC(t, images))
+  SDL_Surface* image = grphx.getimage(t);
+  if (image == NULL)
   {
     return;
   }
@@ -1161,7 +1146,7 @@ void Graphics::drawpartimage( int t, int xp, int yp, int wp, int hp)
   trect2.w = wp;
   trect2.h= hp;
 
-  BlitSurfaceStandard(images[t], &trect2, backBuffer, &trect);
+  BlitSurfaceStandard(image, &trect2, backBuffer, &trect);
 }
 
 void Graphics::cutscenebars(void)
@@ -1789,6 +1774,8 @@ void Graphics::drawtrophytext(void)
 
 void Graphics::drawentities(void)
 {
+    PROFILE_ZONE("drawentities");
+
     const int yoff = map.towermode ? lerp(map.oldypos, map.ypos) : 0;
 
     if (!map.custommode)
@@ -2152,10 +2139,8 @@ void Graphics::drawentity(const int i, const int yoff)
 
         tpoint.x = xp; tpoint.y = yp - yoff;
         setcolreal(obj.entities[i].realcol);
-        setRect(drawRect, xp, yp - yoff, sprites_rect.x * 6, sprites_rect.y * 6);
-        SDL_Surface* TempSurface = ScaleSurface( spritesvec[obj.entities[i].drawframe], 6 * sprites_rect.w,6* sprites_rect.h );
-        BlitSurfaceColoured(TempSurface, NULL , backBuffer,  &drawRect, ct );
-        SDL_FreeSurface(TempSurface);
+        setRect(drawRect, xp, yp - yoff, sprites_rect.w * 6, sprites_rect.h * 6);
+        BlitSurfaceColouredScaled(spritesvec[obj.entities[i].drawframe], backBuffer, &drawRect, ct);
 
 
 
@@ -2166,6 +2151,8 @@ void Graphics::drawentity(const int i, const int yoff)
 
 void Graphics::drawbackground( int t )
 {
+    PROFILE_ZONE("drawbackground");
+
     int temp = 0;
 
     switch(t)
@@ -2627,6 +2614,8 @@ void Graphics::updatebackground(int t)
 
 void Graphics::drawmap(void)
 {
+    PROFILE_ZONE("drawmap");
+
     if (!foregrounddrawn)
     {
         ClearSurface(foregroundBuffer);
@@ -2671,6 +2660,8 @@ void Graphics::drawmap(void)
 
 void Graphics::drawfinalmap(void)
 {
+    PROFILE_ZONE("drawfinalmap");
+
     if (!foregrounddrawn) {
         ClearSurface(foregroundBuffer);
         if(map.tileset==0){
@@ -2696,6 +2687,8 @@ void Graphics::drawfinalmap(void)
 
 void Graphics::drawtowermap(void)
 {
+    PROFILE_ZONE("drawtowermap");
+
     int temp;
     int yoff = lerp(map.oldypos, map.ypos);
     for (int j = 0; j < 31; j++)
@@ -2721,6 +2714,8 @@ void Graphics::drawtowerspikes(void)
 
 void Graphics::drawtowerbackground(const TowerBG& bg_obj)
 {
+    PROFILE_ZONE("drawtowerbackground");
+
     ClearSurface(backBuffer);
     SDL_BlitSurface(bg_obj.buffer, NULL, bg_obj.buffer_lerp, NULL);
     ScrollSurface(bg_obj.buffer_lerp, 0, lerp(0, -bg_obj.bscroll));
@@ -2982,6 +2977,8 @@ void Graphics::setcol( int t )
 
 void Graphics::menuoffrender(void)
 {
+    PROFILE_ZONE("menuoffrender");
+
     const int usethisoffset = lerp(oldmenuoffset, menuoffset);
     SDL_Rect offsetRect = {0, usethisoffset, backBuffer.Width, backBuffer.Height};
 
@@ -3123,6 +3120,8 @@ void Graphics::updatescreenshake(void)
 
 void Graphics::render(void)
 {
+    PROFILE_ZONE("render");
+
     if (screenbuffer == NULL)
     {
         return;
@@ -3133,6 +3132,8 @@ void Graphics::render(void)
 
 void Graphics::renderwithscreeneffects(void)
 {
+    PROFILE_ZONE("renderwithscreeneffects");
+
     if (game.flashlight > 0 && !game.noflashingmode)
     {
         flashlight();
@@ -3150,6 +3151,8 @@ void Graphics::renderwithscreeneffects(void)
 
 void Graphics::renderfixedpre(void)
 {
+    PROFILE_ZONE("renderfixedpre");
+
     if (game.screenshake > 0)
     {
         updatescreenshake();
@@ -3163,6 +3166,8 @@ void Graphics::renderfixedpre(void)
 
 void Graphics::renderfixedpost(void)
 {
+    PROFILE_ZONE("renderfixedpost");
+
     /* Screen effects timers */
     if (game.flashlight > 0)
     {
@@ -3189,7 +3194,7 @@ void Graphics::bigrprint(int x, int y, const std::string& t, int r, int g, int b
         x *=  (sc);
     }
 
-    return do_print(x, y, t, r, g, b, 255, sc);
+    return do_print(x, y, t.c_str(), r, g, b, 255, sc);
 }
 
 void Graphics::bigbrprint(int x, int y, const std::string& s, int r, int g, int b, bool cen, float sc)
@@ -3359,40 +3364,53 @@ bool Graphics::onscreen(int t)
 
 bool Graphics::reloadresources(void)
 {
-    grphx.destroy();
-    grphx.init();
+    startresources();
+    return finishresources();
+}
 
+void Graphics::startresources(void)
+{
+    /* The old tiles may point into grphx's pixels, so they go first */
     destroy();
+    grphx.destroy();
 
-    vlog_info("GFX | Initializing arrays");
-    MAYBE_FAIL(MakeTileArray());
-    MAYBE_FAIL(MakeSpriteArray());
-    MAYBE_FAIL(maketelearray());
-    MAYBE_FAIL(Makebfont());
-
-    vlog_info("GFX | Clearing images");
-    images.clear();
-
-    vlog_info("GFX | Creating images");
-    images.push_back(grphx.im_image0);
-    images.push_back(grphx.im_image1);
-    images.push_back(grphx.im_image2);
-    images.push_back(grphx.im_image3);
-    images.push_back(grphx.im_image4);
-    images.push_back(grphx.im_image5);
-    images.push_back(grphx.im_image6);
-
-    images.push_back(grphx.im_image7);
-    images.push_back(grphx.im_image8);
-    images.push_back(grphx.im_image9);
-    images.push_back(grphx.im_image10);
-    images.push_back(grphx.im_image11);
-    images.push_back(grphx.im_image12);
+    vlog_info("GFX | Loading images");
+    grphx.init();
+    font_loaded = false;
 
     // I wonder why graphics are responsible for loading music.
+#ifndef HEADLESS
     vlog_info("GFX | Initializing music");
     music.destroy();
     music.init();
+#endif
+}
+
+bool Graphics::loadfont(void)
+{
+    if (font_loaded)
+    {
+        return true;
+    }
+
+    JOB_waitFor(grphx.font_job);
+    font_loaded = true;
+
+    vlog_info("GFX | Initializing font");
+    return Makebfont();
+}
+
+bool Graphics::finishresources(void)
+{
+    MAYBE_FAIL(loadfont());
+
+    JOB_wait();
+    JOB_logTimeline();
+
+    vlog_info("GFX | Initializing arrays");
+    MAYBE_FAIL(MakeTileArray());
+    MAYBE_FAIL(MakeSpriteArray());
+    MAYBE_FAIL(maketelearray());
 
 #ifndef NO_CUSTOM_LEVELS
     vlog_info("GFX | Checking assets");
@@ -131,16 +131,21 @@ public:
 
     void printcrewnamedark(int x, int y, int t);
 
-    void map_tab(int opt, const std::string& text, bool selected = false);
+    void map_tab(int opt, const char* text, bool selected = false);
 
-    void map_option(int opt, int num_opts, const std::string& text, bool selected = false);
+    void map_option(int opt, int num_opts, const char* text, bool selected = false);
 
-    void do_print(int x, int y, const std::string& text, int r, int g, int b, int a, int scale);
+    void do_print(int x, int y, const char* text, int r, int g, int b, int a, int scale);
 
     void Print(int _x, int _y, const std::string& _s, int r, int g, int b, bool cen = false);
 
+    /* Doesn't make a std::string out of a literal every frame */
+    void Print(int _x, int _y, const char* _s, int r, int g, int b, bool cen = false);
+
     void PrintAlpha(int _x, int _y, const std::string& _s, int r, int g, int b, int a, bool cen = false);
 
+    void PrintAlpha(int _x, int _y, const char* _s, int r, int g, int b, int a, bool cen = false);
+
     bool next_wrap(size_t* start, size_t* len, const char* str, int maxwidth);
 
     bool next_wrap_s(char buffer[], size_t buffer_size, size_t* start, const char* str, int maxwidth);
@@ -152,6 +157,7 @@ public:
     void bprintalpha(int x, int y, const std::string& t, int r, int g, int b, int a, bool cen = false);
 
     int len(const std::string& t);
+    int len(const char* t);
     void bigprint( int _x, int _y, const std::string& _s, int r, int g, int b, bool cen = false, int sc = 2 );
     void bigbprint(int x, int y, const std::string& s, int r, int g, int b, bool cen = false, int sc = 2);
     void drawspritesetcol(int x, int y, int t, int c);
@@ -222,6 +228,14 @@ public:
     bool onscreen(int t);
 
     bool reloadresources(void);
+
+    /* reloadresources() in steps, so that loading can go on in the
+     * background. The font can be used once loadfont() is done, the rest
+     * once finishresources() is. */
+    void startresources(void);
+    bool loadfont(void);
+    bool finishresources(void);
+    bool font_loaded;
 #ifndef NO_CUSTOM_LEVELS
     bool tiles1_mounted;
     bool tiles2_mounted;
@@ -246,8 +260,6 @@ public:
     int m;
 
     // TODO: These definitely don't need to be vectors.
-    std::vector <SDL_Surface*> images;
-
     std::vector <SDL_Surface*> tele;
     std::vector <SDL_Surface*> tiles;
     std::vector <SDL_Surface*> tiles2;
@@ -1,6 +1,13 @@
 #include "GraphicsResources.h"
 
+#include <stdint.h>
+#include <utf8/unchecked.h>
+
+#include "Exit.h"
 #include "FileSystemUtils.h"
+#include "GraphicsUtil.h"
+#include "Jobs.h"
+#include "RAM.h"
 #include "Vlogging.h"
 
 #include <pspkernel.h>
@@ -91,30 +98,617 @@ static SDL_Surface* LoadImage(const char *filename, bool noBlend = true, bool no
     }
 }
 
+/* textures.v4t holds the stock images already decoded, made by
+ * scripts/cook_textures.py. File layout (little endian):
+ *   char     magic[5]     "V4TEX"
+ *   uint8_t  version
+ *   uint16_t count
+ *   cookedentry entries[count]
+ *   pixel data of each entry, at offsets that are multiples of 64
+ *
+ * Pixels are ARGB8888 words. Tilesheets are stored one tile after another,
+ * in the order PROCESS_TILESHEET cuts them, so every tile is a surface of
+ * its own without copying. Indexed images are a palette of 256 words
+ * followed by a byte per pixel. */
+#ifndef IMAGE_BUDGET_KB
+#define IMAGE_BUDGET_KB 640
+#endif
+
+static const Uint32 lazy_image_budget = IMAGE_BUDGET_KB * 1024;
+/* About ten seconds */
+static const Uint32 lazy_image_idle_frames = 300;
+
+/* In the order of the numbers drawimage() takes */
+static const struct
+{
+    const char* filename;
+    bool noBlend;
+    bool noAlpha;
+}
+lazy_image_files[GraphicsResources::num_lazy_images] = {
+    {"graphics/levelcomplete.png", false, false},
+    {"graphics/minimap.png", true, true},
+    {"graphics/covered.png", true, true},
+    {"graphics/elephant.png", true, false},
+    {"graphics/gamecomplete.png", false, false},
+    {"graphics/fliplevelcomplete.png", false, false},
+    {"graphics/flipgamecomplete.png", false, false},
+    {"graphics/site.png", false, false},
+    {"graphics/site2.png", true, false},
+    {"graphics/site3.png", true, false},
+    {"graphics/ending.png", true, false},
+    {"graphics/site4.png", true, false},
+    {"graphics/minimap.png", true, false},
+};
+
+static const char cooked_filename[] = "textures.v4t";
+static const char cooked_magic[5] = {'V', '4', 'T', 'E', 'X'};
+static const Uint8 cooked_version = 1;
+static const size_t cooked_header_size = 8;
+static const uintptr_t cooked_alignment = 64;
+
+enum
+{
+    COOKED_ARGB8888 = 0,
+    COOKED_INDEXED8 = 1
+};
+
+struct cookedentry
+{
+    char name[40];
+    Uint16 width;
+    Uint16 height;
+    /* 0 if it's not a tilesheet */
+    Uint16 tile;
+    Uint8 format;
+    Uint8 noalpha;
+    Uint32 offset;
+    Uint32 size;
+};
+SDL_COMPILE_TIME_ASSERT(cookedentry, sizeof(cookedentry) == 56);
+
+/* Kept until destroy(), lazily loaded images need it too. Jobs only ever
+ * read it. */
+static std::vector<cookedentry> cooked_entries;
+
+static void LoadManifest(void)
+{
+    unsigned char header[cooked_header_size];
+    Uint16 count;
+
+    if (!FILESYSTEM_assetExists(cooked_filename))
+    {
+        return;
+    }
+
+    if (!FILESYSTEM_loadAssetRange(cooked_filename, 0, header, sizeof(header))
+    || SDL_memcmp(header, cooked_magic, sizeof(cooked_magic)) != 0
+    || header[5] != cooked_version)
+    {
+        vlog_error("%s is not a version %i texture file", cooked_filename, cooked_version);
+        return;
+    }
+
+    SDL_memcpy(&count, &header[6], sizeof(count));
+    count = SDL_SwapLE16(count);
+
+    cooked_entries.resize(count);
+    if (count == 0 || !FILESYSTEM_loadAssetRange(
+        cooked_filename,
+        sizeof(header),
+        &cooked_entries[0],
+        count * sizeof(cookedentry)
+    )) {
+        cooked_entries.clear();
+        return;
+    }
+
+    for (size_t i = 0; i < cooked_entries.size(); ++i)
+    {
+        cookedentry* entry = &cooked_entries[i];
+        entry->name[sizeof(entry->name) - 1] = '\0';
+        entry->width = SDL_SwapLE16(entry->width);
+        entry->height = SDL_SwapLE16(entry->height);
+        entry->tile = SDL_SwapLE16(entry->tile);
+        entry->offset = SDL_SwapLE32(entry->offset);
+        entry->size = SDL_SwapLE32(entry->size);
+    }
+}
+
+static const cookedentry* FindCooked(
+    const char* filename,
+    const bool noAlpha,
+    const int tile_square
+) {
+    for (size_t i = 0; i < cooked_entries.size(); ++i)
+    {
+        const cookedentry* entry = &cooked_entries[i];
+        if (SDL_strcmp(entry->name, filename) == 0
+        && entry->noalpha == noAlpha
+        && entry->tile == tile_square)
+        {
+            return entry;
+        }
+    }
+
+    return NULL;
+}
+
+static SDL_Surface* CreateCookedSurface(Uint32* pixels, const int width, const int height, const bool noBlend)
+{
+    SDL_Surface* surface = SDL_CreateRGBSurfaceWithFormatFrom(
+        pixels,
+        width,
+        height,
+        32,
+        width * 4,
+        SDL_PIXELFORMAT_ARGB8888
+    );
+    if (surface == NULL)
+    {
+        VVV_exit(1);
+    }
+    if (noBlend)
+    {
+        SDL_SetSurfaceBlendMode(surface, SDL_BLENDMODE_BLEND);
+    }
+    return surface;
+}
+
+/* Reads the image with one read into the buffer it stays in. Either sets
+ * image, or cuts it into tiles if tile_square isn't 0. The buffer is put in
+ * pixels, to be freed once the surfaces are gone. */
+static bool LoadCooked(
+    const char* filename,
+    const bool noBlend,
+    const bool noAlpha,
+    const int tile_square,
+    SDL_Surface** image,
+    std::vector<SDL_Surface*>* tiles,
+    void** pixels_out
+) {
+    /* Custom level assets are always PNGs */
+    if (FILESYSTEM_isAssetMounted(filename))
+    {
+        return false;
+    }
+
+    const cookedentry* entry = FindCooked(filename, noAlpha, tile_square);
+    if (entry == NULL)
+    {
+        return false;
+    }
+
+    const Uint32 num_pixels = entry->width * entry->height;
+    const Uint32 bytes = num_pixels * sizeof(Uint32);
+    const bool indexed = entry->format == COOKED_INDEXED8;
+
+    if (num_pixels == 0
+    || (entry->format == COOKED_ARGB8888 && entry->size != bytes)
+    || (indexed && (entry->size != 256 * sizeof(Uint32) + num_pixels || entry->size > bytes))
+    || (entry->format != COOKED_ARGB8888 && !indexed)
+    || (tile_square > 0 && (entry->width % tile_square != 0 || entry->height % tile_square != 0)))
+    {
+        vlog_error("%s in %s is corrupt", filename, cooked_filename);
+        return false;
+    }
+
+    void* base = RAM_mallocTagged(bytes + cooked_alignment - 1, RAM_TAG_GRAPHICS);
+    if (base == NULL)
+    {
+        VVV_exit(1);
+    }
+    Uint32* pixels = (Uint32*) (((uintptr_t) base + cooked_alignment - 1) & ~(cooked_alignment - 1));
+
+    /* Indices go at the end, so that they can be expanded in place */
+    Uint8* dest = (Uint8*) pixels + bytes - entry->size;
+
+    if (!FILESYSTEM_loadAssetRange(cooked_filename, entry->offset, dest, entry->size))
+    {
+        vlog_error("Unable to read %s from %s", filename, cooked_filename);
+        RAM_free(base);
+        return false;
+    }
+
+    if (indexed)
+    {
+        Uint32 palette[256];
+        const Uint8* indices = dest + sizeof(palette);
+
+        SDL_memcpy(palette, dest, sizeof(palette));
+        for (size_t i = 0; i < SDL_arraysize(palette); ++i)
+        {
+            palette[i] = SDL_SwapLE32(palette[i]);
+        }
+
+        /* Every pixel is written before the index it came from */
+        for (Uint32 i = 0; i < num_pixels; ++i)
+        {
+            pixels[i] = palette[indices[i]];
+        }
+    }
+    else if (SDL_BYTEORDER == SDL_BIG_ENDIAN)
+    {
+        for (Uint32 i = 0; i < num_pixels; ++i)
+        {
+            pixels[i] = SDL_SwapLE32(pixels[i]);
+        }
+    }
+
+    if (tile_square == 0)
+    {
+        *image = CreateCookedSurface(pixels, entry->width, entry->height, noBlend);
+    }
+    else
+    {
+        const Uint32 tile_pixels = tile_square * tile_square;
+        for (Uint32 i = 0; i < num_pixels; i += tile_pixels)
+        {
+            tiles->push_back(CreateCookedSurface(&pixels[i], tile_square, tile_square, noBlend));
+        }
+    }
+
+    *pixels_out = base;
+    return true;
+}
+
+/* Cuts a tilesheet the same way textures.v4t has it. Leaves it alone if
+ * it doesn't divide into tiles, for PROCESS_TILESHEET to complain about. */
+static void CutTilesheet(SDL_Surface** image, const int tile_square, std::vector<SDL_Surface*>* tiles)
+{
+    if (*image == NULL
+    || (*image)->w % tile_square != 0
+    || (*image)->h % tile_square != 0)
+    {
+        return;
+    }
+
+    for (int j = 0; j < (*image)->h / tile_square; ++j)
+    {
+        for (int i = 0; i < (*image)->w / tile_square; ++i)
+        {
+            tiles->push_back(GetSubSurface(
+                *image,
+                i * tile_square, j * tile_square,
+                tile_square, tile_square
+            ));
+        }
+    }
+
+    SDL_FreeSurface(*image);
+    *image = NULL;
+}
+
+struct imagejob
+{
+    const char* filename;
+    bool noBlend;
+    bool noAlpha;
+    /* 0 if it's not a tilesheet */
+    int tile_square;
+    SDL_Surface** image;
+    std::vector<SDL_Surface*>* tiles;
+
+    /* Filled in by the job */
+    void* pixels;
+    bool cooked;
+};
+
+static imagejob image_jobs[8];
+static int num_image_jobs = 0;
+
+static void LoadImageJob(void* userdata)
+{
+    imagejob* job = (imagejob*) userdata;
+
+    if (LoadCooked(
+        job->filename,
+        job->noBlend,
+        job->noAlpha,
+        job->tile_square,
+        job->image,
+        job->tiles,
+        &job->pixels
+    )) {
+        job->cooked = true;
+        return;
+    }
+
+    *job->image = LoadImage(job->filename, job->noBlend, job->noAlpha);
+    if (job->tile_square > 0)
+    {
+        CutTilesheet(job->image, job->tile_square, job->tiles);
+    }
+}
+
+static void LoadFontMapJob(void* userdata)
+{
+    std::map<int, int>* font_positions = (std::map<int, int>*) userdata;
+    unsigned char* charmap;
+    size_t length;
+
+    FILESYSTEM_loadAssetToMemory("graphics/font.txt", &charmap, &length, false);
+    if (charmap != NULL)
+    {
+        unsigned char* current = charmap;
+        unsigned char* end = charmap + length;
+        int pos = 0;
+        while (current != end)
+        {
+            int codepoint = utf8::unchecked::next(current);
+            (*font_positions)[codepoint] = pos;
+            ++pos;
+        }
+        FILESYSTEM_freeMemory(&charmap);
+    }
+}
+
+void GraphicsResources::AddImage(
+    const char* filename,
+    SDL_Surface** image,
+    const bool noBlend /*= true*/,
+    const bool noAlpha /*= false*/,
+    const int tile_square /*= 0*/,
+    std::vector<SDL_Surface*>* tiles /*= NULL*/
+) {
+    SDL_assert(num_image_jobs < (int) SDL_arraysize(image_jobs));
+
+    imagejob* job = &image_jobs[num_image_jobs++];
+    job->filename = filename;
+    job->noBlend = noBlend;
+    job->noAlpha = noAlpha;
+    job->tile_square = tile_square;
+    job->image = image;
+    job->tiles = tiles;
+    job->pixels = NULL;
+    job->cooked = false;
+
+    *image = NULL;
+    JOB_add(filename, LoadImageJob, NULL, job);
+}
+
+void GraphicsResources::ImagesLoaded(void* userdata)
+{
+    GraphicsResources* self = (GraphicsResources*) userdata;
+
+    self->num_cooked = 0;
+    self->num_images = num_image_jobs;
+    for (int i = 0; i < num_image_jobs; ++i)
+    {
+        if (image_jobs[i].cooked)
+        {
+            self->cooked_pixels.push_back(image_jobs[i].pixels);
+            ++self->num_cooked;
+        }
+    }
+
+    num_image_jobs = 0;
+}
+
 void GraphicsResources::init(void)
 {
-    im_tiles =        LoadImage("graphics/tiles.png");
-    im_tiles2 =        LoadImage("graphics/tiles2.png");
-    im_tiles3 =        LoadImage("graphics/tiles3.png");
-    im_entcolours =        LoadImage("graphics/entcolours.png");
-    im_sprites =        LoadImage("graphics/sprites.png");
-    im_flipsprites =    LoadImage("graphics/flipsprites.png");
-    im_bfont =        LoadImage("graphics/font.png");
-    im_teleporter =        LoadImage("graphics/teleporter.png");
-
-    im_image0 =        LoadImage("graphics/levelcomplete.png", false);
-    im_image1 =        LoadImage("graphics/minimap.png", true, true);
-    im_image2 =        LoadImage("graphics/covered.png", true, true);
-    im_image3 =        LoadImage("graphics/elephant.png");
-    im_image4 =        LoadImage("graphics/gamecomplete.png", false);
-    im_image5 =        LoadImage("graphics/fliplevelcomplete.png", false);
-    im_image6 =        LoadImage("graphics/flipgamecomplete.png", false);
-    im_image7 =        LoadImage("graphics/site.png", false);
-    im_image8 =        LoadImage("graphics/site2.png");
-    im_image9 =        LoadImage("graphics/site3.png");
-    im_image10 =        LoadImage("graphics/ending.png");
-    im_image11 =        LoadImage("graphics/site4.png");
-    im_image12 =        LoadImage("graphics/minimap.png");
+    LoadManifest();
+
+    /* Every image is a job of its own. The font goes first, so that there's
+     * something to show progress with while the rest load. */
+    num_image_jobs = 0;
+    font_positions.clear();
+    AddImage("graphics/font.png", &im_bfont, true, false, 8, &cut_bfont);
+    font_job = JOB_add("graphics/font.txt", LoadFontMapJob, NULL, &font_positions);
+
+    AddImage("graphics/tiles.png", &im_tiles, true, false, 8, &cut_tiles);
+    AddImage("graphics/tiles2.png", &im_tiles2, true, false, 8, &cut_tiles2);
+    AddImage("graphics/tiles3.png", &im_tiles3, true, false, 8, &cut_tiles3);
+    AddImage("graphics/entcolours.png", &im_entcolours, true, false, 8, &cut_entcolours);
+    AddImage("graphics/sprites.png", &im_sprites, true, false, 32, &cut_sprites);
+    AddImage("graphics/flipsprites.png", &im_flipsprites, true, false, 32, &cut_flipsprites);
+    AddImage("graphics/teleporter.png", &im_teleporter, true, false, 96, &cut_teleporter);
+
+    JOB_add("images", NULL, ImagesLoaded, this);
+
+    for (int i = 0; i < num_lazy_images; ++i)
+    {
+        lazyimage* image = &lazy_images[i];
+        SDL_zerop(image);
+        image->filename = lazy_image_files[i].filename;
+        image->noBlend = lazy_image_files[i].noBlend;
+        image->noAlpha = lazy_image_files[i].noAlpha;
+        image->owner = this;
+    }
+    lazy_bytes = 0;
+    lazy_clock = 0;
+}
+
+static void LoadLazyImageJob(void* userdata)
+{
+    lazyimage* image = (lazyimage*) userdata;
+
+    if (!LoadCooked(
+        image->filename,
+        image->noBlend,
+        image->noAlpha,
+        0,
+        &image->job_surface,
+        NULL,
+        &image->job_pixels
+    )) {
+        image->job_surface = LoadImage(image->filename, image->noBlend, image->noAlpha);
+    }
+}
+
+void GraphicsResources::PrefetchFinished(void* userdata)
+{
+    lazyimage* image = (lazyimage*) userdata;
+
+    image->finish_pending = false;
+    image->owner->AdoptImage(image);
+}
+
+/* Takes what the prefetch job loaded, unless getimage() already has */
+void GraphicsResources::AdoptImage(lazyimage* image)
+{
+    if (!image->loading)
+    {
+        return;
+    }
+    image->loading = false;
+
+    image->surface = image->job_surface;
+    image->pixels = image->job_pixels;
+    image->job_surface = NULL;
+    image->job_pixels = NULL;
+
+    if (image->surface == NULL)
+    {
+        image->failed = true;
+        return;
+    }
+
+    image->bytes = image->surface->pitch * image->surface->h;
+    MakeRoom(image->bytes, image);
+    lazy_bytes += image->bytes;
+    image->lastused = lazy_clock;
+    image->drawn = false;
+
+    vlog_debug("GFX | Loaded %s, %u KB of images resident", image->filename, lazy_bytes / 1024);
+}
+
+void GraphicsResources::UnloadImage(lazyimage* image)
+{
+    if (image->surface == NULL)
+    {
+        return;
+    }
+
+    SDL_FreeSurface(image->surface);
+    RAM_free(image->pixels);
+    lazy_bytes -= image->bytes;
+
+    image->surface = NULL;
+    image->pixels = NULL;
+    image->bytes = 0;
+
+    vlog_debug("GFX | Let go of %s, %u KB of images resident", image->filename, lazy_bytes / 1024);
+}
+
+/* Lets go of the least recently drawn images until bytes more fit */
+void GraphicsResources::MakeRoom(const Uint32 bytes, const lazyimage* keep)
+{
+    while (lazy_bytes + bytes > lazy_image_budget)
+    {
+        lazyimage* oldest = NULL;
+
+        for (int i = 0; i < num_lazy_images; ++i)
+        {
+            lazyimage* image = &lazy_images[i];
+            if (image != keep
+            && image->surface != NULL
+            && !image->pinned
+            && (oldest == NULL || image->lastused < oldest->lastused))
+            {
+                oldest = image;
+            }
+        }
+
+        if (oldest == NULL)
+        {
+            /* Go over, rather than not draw it */
+            return;
+        }
+        UnloadImage(oldest);
+    }
+}
+
+SDL_Surface* GraphicsResources::getimage(const int t)
+{
+    if (t < 0 || t >= num_lazy_images)
+    {
+        return NULL;
+    }
+    lazyimage* image = &lazy_images[t];
+
+    if (image->loading)
+    {
+        JOB_waitFor(image->job);
+        AdoptImage(image);
+    }
+
+    if (image->surface == NULL && !image->failed)
+    {
+        /* Not prefetched, so this frame takes the hit */
+        image->loading = true;
+        LoadLazyImageJob(image);
+        AdoptImage(image);
+    }
+
+    image->lastused = lazy_clock;
+    image->drawn = true;
+    return image->surface;
+}
+
+void GraphicsResources::prefetchimage(const int t)
+{
+    if (t < 0 || t >= num_lazy_images)
+    {
+        return;
+    }
+    lazyimage* image = &lazy_images[t];
+
+    if (image->surface != NULL
+    || image->loading
+    || image->finish_pending
+    || image->failed)
+    {
+        return;
+    }
+
+    image->loading = true;
+    image->finish_pending = true;
+    image->job = JOB_add(image->filename, LoadLazyImageJob, PrefetchFinished, image);
+}
+
+SDL_Surface* GraphicsResources::pinimage(const int t)
+{
+    SDL_Surface* surface = getimage(t);
+
+    if (surface != NULL)
+    {
+        lazy_images[t].pinned = true;
+    }
+    return surface;
+}
+
+int GraphicsResources::findimage(const char* name)
+{
+    char filename[64];
+
+    SDL_snprintf(filename, sizeof(filename), "graphics/%s.png", name);
+    for (int i = 0; i < num_lazy_images; ++i)
+    {
+        if (SDL_strcmp(lazy_images[i].filename, filename) == 0)
+        {
+            return i;
+        }
+    }
+    return -1;
+}
+
+void GraphicsResources::updateimages(void)
+{
+    ++lazy_clock;
+
+    /* Prefetched images wait until they've been drawn */
+    for (int i = 0; i < num_lazy_images; ++i)
+    {
+        lazyimage* image = &lazy_images[i];
+        if (image->surface != NULL
+        && image->drawn
+        && !image->pinned
+        && lazy_clock - image->lastused > lazy_image_idle_frames)
+        {
+            UnloadImage(image);
+        }
+    }
 }
 
 
@@ -132,19 +726,48 @@ void GraphicsResources::destroy(void)
     CLEAR(im_flipsprites);
     CLEAR(im_bfont);
     CLEAR(im_teleporter);
-
-    CLEAR(im_image0);
-    CLEAR(im_image1);
-    CLEAR(im_image2);
-    CLEAR(im_image3);
-    CLEAR(im_image4);
-    CLEAR(im_image5);
-    CLEAR(im_image6);
-    CLEAR(im_image7);
-    CLEAR(im_image8);
-    CLEAR(im_image9);
-    CLEAR(im_image10);
-    CLEAR(im_image11);
-    CLEAR(im_image12);
 #undef CLEAR
+
+    /* Prefetch jobs write into lazy_images */
+    for (int i = 0; i < num_lazy_images; ++i)
+    {
+        if (lazy_images[i].finish_pending)
+        {
+            JOB_wait();
+            break;
+        }
+    }
+    for (int i = 0; i < num_lazy_images; ++i)
+    {
+        UnloadImage(&lazy_images[i]);
+        lazy_images[i].pinned = false;
+        lazy_images[i].failed = false;
+    }
+    cooked_entries.clear();
+
+#define CLEAR_CUT(tiles) \
+    for (size_t i = 0; i < tiles.size(); ++i) \
+    { \
+        SDL_FreeSurface(tiles[i]); \
+    } \
+    tiles.clear();
+
+    /* Only still here if the game never got to take them */
+    CLEAR_CUT(cut_tiles);
+    CLEAR_CUT(cut_tiles2);
+    CLEAR_CUT(cut_tiles3);
+    CLEAR_CUT(cut_entcolours);
+    CLEAR_CUT(cut_sprites);
+    CLEAR_CUT(cut_flipsprites);
+    CLEAR_CUT(cut_bfont);
+    CLEAR_CUT(cut_teleporter);
+#undef CLEAR_CUT
+
+    /* The surfaces made from these are gone by now, or are about to be
+     * freed without touching their pixels */
+    for (size_t i = 0; i < cooked_pixels.size(); ++i)
+    {
+        RAM_free(cooked_pixels[i]);
+    }
+    cooked_pixels.clear();
 }
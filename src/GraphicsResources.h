@@ -2,10 +2,39 @@
 #define GRAPHICSRESOURCES_H
 
 #include <SDL2/SDL.h>
+#include <map>
+#include <vector>
+
+/* A full-screen image, like the level complete banner or the credits */
+struct lazyimage
+{
+    const char* filename;
+    bool noBlend;
+    bool noAlpha;
+    class GraphicsResources* owner;
+
+    SDL_Surface* surface;
+    /* From textures.v4t, the surface doesn't own it */
+    void* pixels;
+    Uint32 bytes;
+    Uint32 lastused;
+    bool drawn;
+    bool pinned;
+    bool failed;
+
+    /* While a prefetch job has it */
+    bool loading;
+    bool finish_pending;
+    int job;
+    SDL_Surface* job_surface;
+    void* job_pixels;
+};
 
 class GraphicsResources
 {
 public:
+    /* Queues a job per image, see Jobs.h. Nothing here can be used until
+     * they've all finished, except the font after font_job has run. */
     void init(void);
     void destroy(void);
 
@@ -17,19 +46,60 @@ public:
     SDL_Surface* im_flipsprites;
     SDL_Surface* im_bfont;
     SDL_Surface* im_teleporter;
-    SDL_Surface* im_image0;
-    SDL_Surface* im_image1;
-    SDL_Surface* im_image2;
-    SDL_Surface* im_image3;
-    SDL_Surface* im_image4;
-    SDL_Surface* im_image5;
-    SDL_Surface* im_image6;
-    SDL_Surface* im_image7;
-    SDL_Surface* im_image8;
-    SDL_Surface* im_image9;
-    SDL_Surface* im_image10;
-    SDL_Surface* im_image11;
-    SDL_Surface* im_image12;
+
+    /* The images drawimage() and friends take. They're only loaded once
+     * they're drawn or prefetched, and let go of once they haven't been
+     * drawn in a while or others need the room, see IMAGE_BUDGET_KB. */
+    static const int num_lazy_images = 13;
+    SDL_Surface* getimage(int t);
+    void prefetchimage(int t);
+    /* For images that get drawn on, they're kept until destroy() */
+    SDL_Surface* pinimage(int t);
+    /* By the name of the PNG without its extension, -1 if there's none */
+    int findimage(const char* name);
+    /* Once a frame */
+    void updateimages(void);
+
+    /* Tilesheets cut up as they were loaded, in the order PROCESS_TILESHEET
+     * takes them. Empty if the sheet didn't divide into tiles. */
+    std::vector<SDL_Surface*> cut_tiles;
+    std::vector<SDL_Surface*> cut_tiles2;
+    std::vector<SDL_Surface*> cut_tiles3;
+    std::vector<SDL_Surface*> cut_entcolours;
+    std::vector<SDL_Surface*> cut_sprites;
+    std::vector<SDL_Surface*> cut_flipsprites;
+    std::vector<SDL_Surface*> cut_bfont;
+    std::vector<SDL_Surface*> cut_teleporter;
+
+    std::map<int, int> font_positions;
+    int font_job;
+
+    /* How many images came from textures.v4t instead of PNGs */
+    int num_cooked;
+    int num_images;
+
+private:
+    lazyimage lazy_images[num_lazy_images];
+    Uint32 lazy_bytes;
+    Uint32 lazy_clock;
+
+    static void PrefetchFinished(void* userdata);
+    void AdoptImage(lazyimage* image);
+    void UnloadImage(lazyimage* image);
+    void MakeRoom(Uint32 bytes, const lazyimage* keep);
+
+    void AddImage(
+        const char* filename,
+        SDL_Surface** image,
+        bool noBlend = true,
+        bool noAlpha = false,
+        int tile_square = 0,
+        std::vector<SDL_Surface*>* tiles = NULL
+    );
+    static void ImagesLoaded(void* userdata);
+
+    /* The surfaces from textures.v4t don't own their pixels */
+    std::vector<void*> cooked_pixels;
 };
 
 #endif /* GRAPHICSRESOURCES_H */
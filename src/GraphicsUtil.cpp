@@ -4,6 +4,7 @@
 #include <stddef.h>
 #include <stdlib.h>
 
+#include "FrameArena.h"
 #include "Graphics.h"
 #include "Maths.h"
 
@@ -197,18 +198,12 @@ void BlitSurfaceStandard( SDL_Surface* _src, SDL_Rect* _srcRect, SDL_Surface* _d
     SDL_BlitSurface( _src, _srcRect, _dest, _destRect );
 }
 
-void BlitSurfaceColoured(
-    SDL_Surface* _src,
-    SDL_Rect* _srcRect,
-    SDL_Surface* _dest,
-    SDL_Rect* _destRect,
-    colourTransform& ct
-) {
-    SDL_Rect *tempRect = _destRect;
-
+/* Fills a frame arena surface, free it with FRAME_freeSurface() */
+static SDL_Surface* ColourSurface(SDL_Surface* _src, colourTransform& ct)
+{
     const SDL_PixelFormat& fmt = *(_src->format);
 
-    SDL_Surface* tempsurface =  RecreateSurface(_src);
+    SDL_Surface* tempsurface = FRAME_createSurface(_src, _src->w, _src->h);
 
     for(int x = 0; x < tempsurface->w; x++)
     {
@@ -225,8 +220,36 @@ void BlitSurfaceColoured(
         }
     }
 
+    return tempsurface;
+}
+
+void BlitSurfaceColoured(
+    SDL_Surface* _src,
+    SDL_Rect* _srcRect,
+    SDL_Surface* _dest,
+    SDL_Rect* _destRect,
+    colourTransform& ct
+) {
+    SDL_Rect *tempRect = _destRect;
+
+    SDL_Surface* tempsurface = ColourSurface(_src, ct);
+
     SDL_BlitSurface(tempsurface, _srcRect, _dest, tempRect);
-    SDL_FreeSurface(tempsurface);
+    FRAME_freeSurface(tempsurface);
+}
+
+void BlitSurfaceColouredScaled(
+    SDL_Surface* _src,
+    SDL_Surface* _dest,
+    SDL_Rect* _destRect,
+    colourTransform& ct
+) {
+    /* Only the alpha of _src is used, so colouring it before scaling it up
+     * comes out the same, without a scaled copy */
+    SDL_Surface* tempsurface = ColourSurface(_src, ct);
+
+    SDL_BlitScaled(tempsurface, NULL, _dest, _destRect);
+    FRAME_freeSurface(tempsurface);
 }
 
 void BlitSurfaceTinted(
@@ -240,7 +263,7 @@ void BlitSurfaceTinted(
 
     const SDL_PixelFormat& fmt = *(_src->format);
 
-    SDL_Surface* tempsurface =  RecreateSurface(_src);
+    SDL_Surface* tempsurface = FRAME_createSurface(_src, _src->w, _src->h);
 
     for (int x = 0; x < tempsurface->w; x++) {
         for (int y = 0; y < tempsurface->h; y++) {
@@ -287,7 +310,7 @@ void BlitSurfaceTinted(
     }
 
     SDL_BlitSurface(tempsurface, _srcRect, _dest, tempRect);
-    SDL_FreeSurface(tempsurface);
+    FRAME_freeSurface(tempsurface);
 }
 
 
@@ -315,9 +338,11 @@ void UpdateFilter(void)
     }
 }
 
-SDL_Surface* ApplyFilter( SDL_Surface* _src )
+void ApplyFilter( SDL_Surface* _src, SDL_Surface* _dest )
 {
-    SDL_Surface* _ret = RecreateSurface(_src);
+    SDL_BlendMode blend_mode;
+    SDL_GetSurfaceBlendMode(_src, &blend_mode);
+    SDL_SetSurfaceBlendMode(_dest, blend_mode);
 
     int redOffset = rand() % 4;
 
@@ -364,11 +389,10 @@ SDL_Surface* ApplyFilter( SDL_Surface* _src )
             blue = VVV_max(blue - ( distX +distY), 0);
 
             Uint32 finalPixel = ((red<<16) + (green<<8) + (blue<<0)) | (pixel &_src->format->Amask);
-            DrawPixel(_ret,x,y,  finalPixel);
+            DrawPixel(_dest,x,y,  finalPixel);
 
         }
     }
-    return _ret;
 }
 
 void FillRect( SDL_Surface* _surface, const int _x, const int _y, const int _w, const int _h, const int r, int g, int b )
@@ -413,79 +437,49 @@ void ClearSurface(SDL_Surface* surface)
 
 void ScrollSurface( SDL_Surface* _src, int _pX, int _pY )
 {
-    SDL_Surface* part1 = NULL;
+    // Moved in place, only one of _pX and _pY is ever nonzero
+    Uint8* pixels = (Uint8*) _src->pixels;
+    const int pitch = _src->pitch;
+    const int bpp = _src->format->BytesPerPixel;
 
-    SDL_Rect rect1;
-    SDL_Rect rect2;
-    //scrolling up;
+    //scrolling up, what's left at the bottom is cleared
     if(_pY < 0)
     {
-        setRect(rect2, 0, 0, _src->w,  _src->h - _pY);
-
-        part1 = GetSubSurface(_src, rect2.x, rect2.y, rect2.w, rect2.h);
-
-        SDL_Rect destrect1;
+        const int rows = VVV_min(-_pY, _src->h);
 
-        SDL_SetSurfaceBlendMode(part1, SDL_BLENDMODE_NONE);
-
-        setRect(destrect1, 0,  _pY, _pX, _src->h);
-
-        SDL_BlitSurface (part1, NULL, _src, &destrect1);
+        SDL_memmove(pixels, pixels + rows * pitch, (_src->h - rows) * pitch);
+        SDL_memset(pixels + (_src->h - rows) * pitch, 0, rows * pitch);
     }
 
     else if(_pY > 0)
     {
+        const int rows = VVV_min(_pY, _src->h);
 
-        setRect(rect1, 0, 0, _src->w, _src->h - _pY);
-
-        part1 = GetSubSurface(_src, rect1.x, rect1.y, rect1.w, rect1.h);
-
-        SDL_Rect destrect1;
-
-        SDL_SetSurfaceBlendMode(part1, SDL_BLENDMODE_NONE);
-
-        setRect(destrect1, _pX, _pY, _src->w, _src->h - _pY);
-
-        SDL_BlitSurface (part1, NULL, _src, &destrect1);
-
+        SDL_memmove(pixels + rows * pitch, pixels, (_src->h - rows) * pitch);
     }
 
-    //Right
-    else if(_pX <= 0)
+    //Left, what's left at the right is cleared
+    else if(_pX < 0)
     {
-        setRect(rect2, 0, 0, _src->w - _pX,  _src->h );
-
-        part1 = GetSubSurface(_src, rect2.x, rect2.y, rect2.w, rect2.h);
-
-        SDL_Rect destrect1;
-
-        SDL_SetSurfaceBlendMode(part1, SDL_BLENDMODE_NONE);
+        const int cols = VVV_min(-_pX, _src->w);
 
-        setRect(destrect1, _pX,  0, _src->w - _pX, _src->h);
-
-        SDL_BlitSurface (part1, NULL, _src, &destrect1);
+        for (int y = 0; y < _src->h; y++)
+        {
+            Uint8* row = pixels + y * pitch;
+            SDL_memmove(row, row + cols * bpp, (_src->w - cols) * bpp);
+            SDL_memset(row + (_src->w - cols) * bpp, 0, cols * bpp);
+        }
     }
 
+    //Also left
     else if(_pX > 0)
     {
+        const int cols = VVV_min(_pX, _src->w);
 
-        setRect(rect1, _pX, 0, _src->w - _pX, _src->h );
-
-        part1 = GetSubSurface(_src, rect1.x, rect1.y, rect1.w, rect1.h);
-
-        SDL_Rect destrect1;
-
-        SDL_SetSurfaceBlendMode(part1, SDL_BLENDMODE_NONE);
-
-        setRect(destrect1, 0, 0, _src->w - _pX, _src->h);
-
-        SDL_BlitSurface (part1, NULL, _src, &destrect1);
-
-    }
-    //Cleanup temp surface
-    if (part1)
-    {
-        SDL_FreeSurface(part1);
+        for (int y = 0; y < _src->h; y++)
+        {
+            Uint8* row = pixels + y * pitch;
+            SDL_memmove(row, row + cols * bpp, (_src->w - cols) * bpp);
+        }
     }
-
 }
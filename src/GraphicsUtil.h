@@ -21,6 +21,8 @@ void BlitSurfaceStandard( SDL_Surface* _src, SDL_Rect* _srcRect, SDL_Surface* _d
 
 void BlitSurfaceColoured( SDL_Surface* _src, SDL_Rect* _srcRect, SDL_Surface* _dest, SDL_Rect* _destRect, colourTransform& ct );
 
+void BlitSurfaceColouredScaled( SDL_Surface* _src, SDL_Surface* _dest, SDL_Rect* _destRect, colourTransform& ct );
+
 void BlitSurfaceTinted( SDL_Surface* _src, SDL_Rect* _srcRect, SDL_Surface* _dest, SDL_Rect* _destRect, colourTransform& ct );
 
 void FillRect( SDL_Surface* surface, const int x, const int y, const int w, const int h, const int r, int g, int b );
@@ -41,6 +43,6 @@ void ScrollSurface(SDL_Surface* _src, int pX, int py);
 
 SDL_Surface * FlipSurfaceVerticle(SDL_Surface* _src);
 void UpdateFilter(void);
-SDL_Surface* ApplyFilter( SDL_Surface* _src );
+void ApplyFilter( SDL_Surface* _src, SDL_Surface* _dest );
 
 #endif /* GRAPHICSUTIL_H */
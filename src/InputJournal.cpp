@@ -0,0 +1,335 @@
+#include "InputJournal.h"
+
+#include "FileSystemUtils.h"
+#include "Game.h"
+#include "Vlogging.h"
+
+static const char* const journalfile = "input.vvj";
+
+static const Uint8 journal_magic[4] = {'V', 'V', 'V', 'J'};
+static const Uint8 journal_version = 1;
+
+/* What follows a change's poll count, 0 for the end of the journal */
+enum
+{
+    CHANGED_BUTTONS = 1 << 0,
+    CHANGED_KEYS = 1 << 1,
+    CHANGED_XVEL = 1 << 2,
+    CHANGED_YVEL = 1 << 3
+};
+
+static void put16(std::vector<Uint8>& out, const Uint16 value)
+{
+    out.push_back(value & 0xFF);
+    out.push_back(value >> 8);
+}
+
+static void put32(std::vector<Uint8>& out, const Uint32 value)
+{
+    put16(out, value & 0xFFFF);
+    put16(out, value >> 16);
+}
+
+/* Seven bits a byte, most polls since the last change fit in one */
+static void putcount(std::vector<Uint8>& out, Uint32 value)
+{
+    while (value >= 0x80)
+    {
+        out.push_back((value & 0x7F) | 0x80);
+        value >>= 7;
+    }
+    out.push_back(value);
+}
+
+journalclass::journalclass(void)
+{
+    startmode = 0;
+    seed = 0;
+    inputdelay = false;
+
+    recording = false;
+    poll = 0;
+    lastchange = 0;
+    SDL_zero(last);
+    written = 0;
+
+    data = NULL;
+    length = 0;
+    pos = 0;
+    nextchange = 0;
+    SDL_zero(next);
+    ending = false;
+    ended = true;
+}
+
+void journalclass::writeheader(void)
+{
+    std::vector<Uint8> header(journal_magic, journal_magic + sizeof(journal_magic));
+
+    header.push_back(journal_version);
+    header.push_back(inputdelay ? 1 : 0);
+    put16(header, startmode);
+    put32(header, seed);
+
+    if (!FILESYSTEM_saveFile(journalfile, &header[0], header.size()))
+    {
+        vlog_error("Unable to write input journal to %s", journalfile);
+        recording = false;
+        return;
+    }
+    written = header.size();
+}
+
+void journalclass::writechange(const journalstate& state, const bool end)
+{
+    Uint8 changed = 0;
+
+    if (!end)
+    {
+        changed |= state.buttons != last.buttons ? CHANGED_BUTTONS : 0;
+        changed |= state.keys != last.keys ? CHANGED_KEYS : 0;
+        changed |= state.xvel != last.xvel ? CHANGED_XVEL : 0;
+        changed |= state.yvel != last.yvel ? CHANGED_YVEL : 0;
+
+        if (changed == 0)
+        {
+            return;
+        }
+    }
+
+    putcount(pending, poll - lastchange);
+    pending.push_back(changed);
+    if (changed & CHANGED_BUTTONS)
+    {
+        put16(pending, state.buttons);
+    }
+    if (changed & CHANGED_KEYS)
+    {
+        put16(pending, state.keys);
+    }
+    if (changed & CHANGED_XVEL)
+    {
+        put16(pending, state.xvel);
+    }
+    if (changed & CHANGED_YVEL)
+    {
+        put16(pending, state.yvel);
+    }
+
+    lastchange = poll;
+    last = state;
+}
+
+void journalclass::flush(void)
+{
+    if (pending.empty())
+    {
+        return;
+    }
+
+    /* Only what's new, so this stays quick however long the game goes on */
+    if (!FILESYSTEM_appendFile(journalfile, &pending[0], pending.size()))
+    {
+        vlog_error("Unable to write input journal to %s", journalfile);
+        recording = false;
+    }
+    written += pending.size();
+    pending.clear();
+}
+
+void journalclass::beginrecording(const int mode)
+{
+    endrecording();
+
+    startmode = mode;
+    inputdelay = game.inputdelay;
+    recording = true;
+    poll = 0;
+    lastchange = 0;
+    SDL_zero(last);
+    pending.clear();
+
+    writeheader();
+    if (recording)
+    {
+        vlog_info("Recording input of game mode %i with seed %u to %s", mode, seed, journalfile);
+    }
+}
+
+void journalclass::record(const journalstate& state)
+{
+    if (!recording)
+    {
+        return;
+    }
+
+    writechange(state, false);
+    poll++;
+
+    if (poll % flush_polls == 0)
+    {
+        flush();
+    }
+}
+
+void journalclass::endrecording(void)
+{
+    if (!recording)
+    {
+        return;
+    }
+
+    writechange(last, true);
+    flush();
+    recording = false;
+
+    vlog_info("Recorded %u polls of input in %u bytes", poll, written);
+}
+
+bool journalclass::readchange(void)
+{
+    Uint32 count = 0;
+    int shift = 0;
+    Uint8 byte;
+    Uint8 changed;
+
+    /* Cut short, the last change it has is as far as it goes */
+    if (pos >= length)
+    {
+        nextchange = lastchange + 1;
+        ending = true;
+        return true;
+    }
+
+    do
+    {
+        if (pos >= length || shift > 28)
+        {
+            return false;
+        }
+        byte = data[pos++];
+        count |= (Uint32) (byte & 0x7F) << shift;
+        shift += 7;
+    }
+    while (byte & 0x80);
+
+    if (pos >= length)
+    {
+        return false;
+    }
+    changed = data[pos++];
+
+    /* Two bytes for every field that changed */
+    const int fields = !!(changed & CHANGED_BUTTONS)
+    + !!(changed & CHANGED_KEYS)
+    + !!(changed & CHANGED_XVEL)
+    + !!(changed & CHANGED_YVEL);
+    if (length - pos < (size_t) fields * 2)
+    {
+        return false;
+    }
+
+    if (changed & CHANGED_BUTTONS)
+    {
+        next.buttons = data[pos] | (data[pos + 1] << 8);
+        pos += 2;
+    }
+    if (changed & CHANGED_KEYS)
+    {
+        next.keys = data[pos] | (data[pos + 1] << 8);
+        pos += 2;
+    }
+    if (changed & CHANGED_XVEL)
+    {
+        next.xvel = (Sint16) (data[pos] | (data[pos + 1] << 8));
+        pos += 2;
+    }
+    if (changed & CHANGED_YVEL)
+    {
+        next.yvel = (Sint16) (data[pos] | (data[pos + 1] << 8));
+        pos += 2;
+    }
+
+    nextchange = lastchange + count;
+    lastchange = nextchange;
+    ending = changed == 0;
+    return true;
+}
+
+bool journalclass::beginreplay(void)
+{
+    FILESYSTEM_freeMemory(&data);
+    FILESYSTEM_loadFileToMemory(journalfile, &data, &length, false);
+    if (data == NULL)
+    {
+        vlog_error("Unable to read input journal %s", journalfile);
+        return false;
+    }
+
+    if (length < 12
+    || SDL_memcmp(data, journal_magic, sizeof(journal_magic)) != 0
+    || data[4] != journal_version)
+    {
+        vlog_error("%s isn't an input journal this version can replay", journalfile);
+        FILESYSTEM_freeMemory(&data);
+        return false;
+    }
+
+    inputdelay = data[5] & 1;
+    startmode = data[6] | (data[7] << 8);
+    seed = data[8] | (data[9] << 8) | (data[10] << 16) | ((Uint32) data[11] << 24);
+
+    pos = 12;
+    poll = 0;
+    lastchange = 0;
+    SDL_zero(last);
+    SDL_zero(next);
+    ended = false;
+
+    if (!readchange())
+    {
+        vlog_error("%s is damaged", journalfile);
+        ended = true;
+        return false;
+    }
+
+    vlog_info("Replaying input of game mode %i with seed %u from %s", startmode, seed, journalfile);
+    return true;
+}
+
+bool journalclass::replay(journalstate* state)
+{
+    if (!ended && poll == nextchange)
+    {
+        if (ending)
+        {
+            ended = true;
+            vlog_info("Input journal ended after %u polls", poll);
+            FILESYSTEM_freeMemory(&data);
+        }
+        else
+        {
+            last = next;
+            if (!readchange())
+            {
+                vlog_warn("%s is damaged after %u polls", journalfile, poll);
+                nextchange = poll + 1;
+                ending = true;
+            }
+        }
+    }
+
+    if (ended)
+    {
+        return false;
+    }
+
+    *state = last;
+    poll++;
+    return true;
+}
+
+bool journalclass::finished(void)
+{
+    return ended;
+}
@@ -0,0 +1,73 @@
+#ifndef INPUTJOURNAL_H
+#define INPUTJOURNAL_H
+
+#if defined(RECORD_INPUT) || defined(REPLAY_INPUT)
+
+#include <SDL2/SDL.h>
+#include <vector>
+
+/* Everything KeyPoll::Poll() hands the game, one bit a button or key */
+struct journalstate
+{
+    Uint16 buttons;
+    Uint16 keys;
+    Sint16 xvel;
+    Sint16 yvel;
+};
+
+/* Keeps what KeyPoll::Poll() reads, from the moment a game is started with
+ * script.startgamemode(), as changes from one poll to the next. It's written
+ * to the save directory as the game goes, and a REPLAY_INPUT build starts the
+ * same game with the same seed and polls it back instead of the pad. Poll()
+ * runs once a tick, so replaying it poll for poll is replaying it tick for
+ * tick. */
+class journalclass
+{
+public:
+    journalclass(void);
+
+    /* Call once the game's been started, hardreset() has set seed */
+    void beginrecording(int mode);
+    void record(const journalstate& state);
+    void endrecording(void);
+
+    bool beginreplay(void);
+    /* Returns false once the journal's run out */
+    bool replay(journalstate* state);
+    bool finished(void);
+
+    int startmode;
+    Uint32 seed;
+    bool inputdelay;
+
+private:
+    void writeheader(void);
+    void writechange(const journalstate& state, bool end);
+    void flush(void);
+    bool readchange(void);
+
+    /* Written out every flush_polls polls */
+    static const Uint32 flush_polls = 300;
+
+    bool recording;
+    Uint32 poll;
+    Uint32 lastchange;
+    journalstate last;
+    std::vector<Uint8> pending;
+    Uint32 written;
+
+    unsigned char* data;
+    size_t length;
+    size_t pos;
+    Uint32 nextchange;
+    journalstate next;
+    /* The next change is the end of the journal */
+    bool ending;
+    bool ended;
+};
+
+extern journalclass journal;
+
+#endif /* defined(RECORD_INPUT) || defined(REPLAY_INPUT) */
+
+#endif /* INPUTJOURNAL_H */
@@ -0,0 +1,371 @@
+#include "Jobs.h"
+
+#include <SDL2/SDL.h>
+
+#include "Vlogging.h"
+
+/* A tiny job system for loading. Jobs are kept in one array per batch and
+ * started in order, so that which jobs are done is always easy to tell and
+ * their finish callbacks can be handed out in order too. Everything is
+ * behind one lock; jobs are whole files, so it's never contended for long.
+ */
+
+#define MAX_JOBS 128
+#define MAX_WORKERS 7
+
+enum
+{
+    JOB_QUEUED,
+    JOB_RUNNING,
+    JOB_DONE,
+    JOB_FINISHED
+};
+
+struct Job
+{
+    const char* name;
+    JOB_Func run;
+    JOB_Func finish;
+    void* userdata;
+    int state;
+    /* 0 is the main thread */
+    int thread;
+    Uint64 start;
+    Uint64 end;
+};
+
+static struct Job jobs[MAX_JOBS];
+static int num_jobs = 0;
+/* The first job that hasn't started */
+static int next_job = 0;
+/* The first job that hasn't been handed back */
+static int next_finish = 0;
+static Uint64 batch_start = 0;
+
+static SDL_mutex* lock = NULL;
+static SDL_cond* work_cond = NULL;
+static SDL_cond* done_cond = NULL;
+static SDL_Thread* workers[MAX_WORKERS];
+static int num_workers = 0;
+static int quitting = 0;
+
+/* Call with the lock held, it's let go of while the job runs */
+static void runjob(struct Job* job, const int thread)
+{
+    Uint64 end;
+
+    job->state = JOB_RUNNING;
+    job->thread = thread;
+    job->start = SDL_GetPerformanceCounter();
+    SDL_UnlockMutex(lock);
+
+    if (job->run != NULL)
+    {
+        job->run(job->userdata);
+    }
+    end = SDL_GetPerformanceCounter();
+
+    SDL_LockMutex(lock);
+    job->end = end;
+    job->state = JOB_DONE;
+    SDL_CondBroadcast(done_cond);
+}
+
+/* Same here. Finish callbacks may add more jobs. */
+static void handback(void)
+{
+    while (next_finish < num_jobs && jobs[next_finish].state == JOB_DONE)
+    {
+        struct Job* job = &jobs[next_finish++];
+
+        job->state = JOB_FINISHED;
+        if (job->finish != NULL)
+        {
+            SDL_UnlockMutex(lock);
+            job->finish(job->userdata);
+            SDL_LockMutex(lock);
+        }
+    }
+}
+
+static int SDLCALL worker(void* data)
+{
+    const int thread = (int) (intptr_t) data;
+
+    SDL_LockMutex(lock);
+    while (!quitting)
+    {
+        if (next_job < num_jobs)
+        {
+            runjob(&jobs[next_job++], thread);
+        }
+        else
+        {
+            SDL_CondWait(work_cond, lock);
+        }
+    }
+    SDL_UnlockMutex(lock);
+
+    return 0;
+}
+
+void JOB_init(void)
+{
+    const int wanted = SDL_min(SDL_GetCPUCount() - 1, MAX_WORKERS);
+    int i;
+
+    lock = SDL_CreateMutex();
+    work_cond = SDL_CreateCond();
+    done_cond = SDL_CreateCond();
+    if (lock == NULL || work_cond == NULL || done_cond == NULL)
+    {
+        vlog_error("Unable to create the job lock: %s", SDL_GetError());
+        return;
+    }
+
+    for (i = 0; i < wanted; i++)
+    {
+        workers[num_workers] = SDL_CreateThread(worker, "Jobs", (void*) (intptr_t) (num_workers + 1));
+        if (workers[num_workers] == NULL)
+        {
+            vlog_error("Unable to start a job thread: %s", SDL_GetError());
+            break;
+        }
+        num_workers++;
+    }
+
+    vlog_info("Running jobs on %i threads", num_workers + 1);
+}
+
+void JOB_quit(void)
+{
+    int i;
+
+    SDL_LockMutex(lock);
+    quitting = 1;
+    SDL_CondBroadcast(work_cond);
+    SDL_UnlockMutex(lock);
+
+    /* Anything still queued is dropped, but running jobs get to finish */
+    for (i = 0; i < num_workers; i++)
+    {
+        SDL_WaitThread(workers[i], NULL);
+    }
+    num_workers = 0;
+
+    SDL_DestroyCond(done_cond);
+    SDL_DestroyCond(work_cond);
+    SDL_DestroyMutex(lock);
+    done_cond = NULL;
+    work_cond = NULL;
+    lock = NULL;
+}
+
+int JOB_add(const char* name, JOB_Func run, JOB_Func finish, void* userdata)
+{
+    struct Job* job;
+    int index;
+
+    SDL_LockMutex(lock);
+
+    if (next_finish == num_jobs)
+    {
+        /* Everything's been handed back, start a new batch */
+        num_jobs = 0;
+        next_job = 0;
+        next_finish = 0;
+        batch_start = SDL_GetPerformanceCounter();
+    }
+
+    if (num_jobs == MAX_JOBS)
+    {
+        SDL_UnlockMutex(lock);
+        vlog_error("Too many jobs, running %s right away", name);
+        SDL_assert(0 && "Too many jobs!");
+        if (run != NULL)
+        {
+            run(userdata);
+        }
+        if (finish != NULL)
+        {
+            finish(userdata);
+        }
+        return -1;
+    }
+
+    index = num_jobs;
+    job = &jobs[index];
+    SDL_zerop(job);
+    job->name = name;
+    job->run = run;
+    job->finish = finish;
+    job->userdata = userdata;
+    job->state = JOB_QUEUED;
+    num_jobs++;
+
+    SDL_CondSignal(work_cond);
+    SDL_UnlockMutex(lock);
+
+    return index;
+}
+
+int JOB_pump(const Uint32 budget_ms)
+{
+    const Uint32 start = SDL_GetTicks();
+    int ran = 0;
+    int finished;
+
+    SDL_LockMutex(lock);
+    while (1)
+    {
+        handback();
+
+        if (next_finish == num_jobs
+        || num_workers > 0
+        || (ran && SDL_GetTicks() - start >= budget_ms))
+        {
+            break;
+        }
+
+        /* Nothing else is running them, and they're all done up to here */
+        runjob(&jobs[next_job++], 0);
+        ran = 1;
+    }
+    finished = next_finish == num_jobs;
+    SDL_UnlockMutex(lock);
+
+    return finished;
+}
+
+static int hasrun(const int job)
+{
+    int i;
+
+    for (i = 0; i <= job && i < num_jobs; i++)
+    {
+        if (jobs[i].state < JOB_DONE)
+        {
+            return 0;
+        }
+    }
+    return 1;
+}
+
+void JOB_waitFor(const int job)
+{
+    SDL_LockMutex(lock);
+    while (!hasrun(job))
+    {
+        handback();
+
+        /* Help out instead of sitting there */
+        if (next_job < num_jobs)
+        {
+            runjob(&jobs[next_job++], 0);
+        }
+        else
+        {
+            SDL_CondWait(done_cond, lock);
+        }
+    }
+    handback();
+    SDL_UnlockMutex(lock);
+}
+
+void JOB_wait(void)
+{
+    SDL_LockMutex(lock);
+    while (next_finish < num_jobs)
+    {
+        handback();
+
+        if (next_finish == num_jobs)
+        {
+            break;
+        }
+        else if (next_job < num_jobs)
+        {
+            runjob(&jobs[next_job++], 0);
+        }
+        else
+        {
+            SDL_CondWait(done_cond, lock);
+        }
+    }
+    SDL_UnlockMutex(lock);
+}
+
+int JOB_percent(void)
+{
+    int percent = 100;
+
+    SDL_LockMutex(lock);
+    if (num_jobs > 0)
+    {
+        percent = next_finish * 100 / num_jobs;
+    }
+    SDL_UnlockMutex(lock);
+
+    return percent;
+}
+
+static Uint32 microseconds(const Uint64 ticks)
+{
+    return (Uint32) (ticks * 1000000 / SDL_GetPerformanceFrequency());
+}
+
+void JOB_logTimeline(void)
+{
+    Uint64 last_end = batch_start;
+    Uint64 busy = 0;
+    Uint32 length;
+    int i;
+
+    SDL_LockMutex(lock);
+
+    for (i = 0; i < num_jobs; i++)
+    {
+        if (jobs[i].state >= JOB_DONE)
+        {
+            last_end = SDL_max(last_end, jobs[i].end);
+            busy += jobs[i].end - jobs[i].start;
+        }
+    }
+    length = microseconds(last_end - batch_start);
+
+    vlog_info(
+        "JOB | %i jobs on %i threads took %u us, %u us of work",
+        num_jobs,
+        num_workers + 1,
+        length,
+        microseconds(busy)
+    );
+
+    for (i = 0; i < num_jobs; i++)
+    {
+        /* One column per 1/32 of the batch, drawn with the thread number */
+        char bar[33];
+        const struct Job* job = &jobs[i];
+        const Uint32 start = microseconds(job->start - batch_start);
+        const Uint32 end = microseconds(job->end - batch_start);
+        int col;
+
+        if (job->state < JOB_DONE)
+        {
+            vlog_info("JOB | %-32s %s", "", job->name);
+            continue;
+        }
+
+        for (col = 0; col < 32; col++)
+        {
+            const Uint32 t = length * col / 32;
+            const Uint32 t_end = length * (col + 1) / 32;
+            bar[col] = (end >= t && start <= t_end) ? '0' + job->thread : '.';
+        }
+        bar[32] = '\0';
+
+        vlog_info("JOB | %s %s: %u-%u us", bar, job->name, start, end);
+    }
+
+    SDL_UnlockMutex(lock);
+}
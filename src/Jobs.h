@@ -0,0 +1,45 @@
+#ifndef JOBS_H
+#define JOBS_H
+
+#include <SDL2/SDL_stdinc.h>
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+/* May run on any thread, so it mustn't touch anything but its own data */
+typedef void (*JOB_Func)(void* userdata);
+
+/* Starts a worker per core besides the main one. With only one core there
+ * are no workers, and JOB_pump() and JOB_wait() run the jobs instead. */
+void JOB_init(void);
+
+void JOB_quit(void);
+
+/* Jobs start in the order they're added. finish runs on the main thread,
+ * once the job and every job added before it have run, so it's where the
+ * results get handed over. Either may be NULL. Returns the job's number in
+ * the current batch, which starts over once every job has finished. */
+int JOB_add(const char* name, JOB_Func run, JOB_Func finish, void* userdata);
+
+/* Runs the finish of every job that's ready. Without workers, also runs
+ * jobs for up to budget_ms, at least one. Returns 1 once all are finished. */
+int JOB_pump(Uint32 budget_ms);
+
+/* Waits until every job up to and including job has run */
+void JOB_waitFor(int job);
+
+/* Waits until every job has finished */
+void JOB_wait(void);
+
+int JOB_percent(void);
+
+/* Logs when each job of the batch ran and on which thread */
+void JOB_logTimeline(void);
+
+#ifdef __cplusplus
+} /* extern "C" */
+#endif
+
+#endif /* JOBS_H */
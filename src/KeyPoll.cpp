@@ -11,6 +11,8 @@
 #include "Game.h"
 #include "GlitchrunnerMode.h"
 #include "Graphics.h"
+#include "InputJournal.h"
+#include "Maths.h"
 #include "Music.h"
 #include "Vlogging.h"
 
@@ -119,8 +121,97 @@ static int changemousestate(
     return timeout;
 }
 
+#if defined(RECORD_INPUT) || defined(REPLAY_INPUT)
+/* Which bit of a journalstate each of them is */
+static const SDL_GameControllerButton journalbuttons[] = {
+    SDL_CONTROLLER_BUTTON_A,
+    SDL_CONTROLLER_BUTTON_B,
+    SDL_CONTROLLER_BUTTON_X,
+    SDL_CONTROLLER_BUTTON_Y,
+    SDL_CONTROLLER_BUTTON_GUIDE,
+    SDL_CONTROLLER_BUTTON_START,
+    SDL_CONTROLLER_BUTTON_DPAD_RIGHT,
+    SDL_CONTROLLER_BUTTON_DPAD_DOWN,
+    SDL_CONTROLLER_BUTTON_DPAD_LEFT,
+    SDL_CONTROLLER_BUTTON_DPAD_UP
+};
+
+static const SDL_Keycode journalkeys[] = {
+    KEYBOARD_UP,
+    KEYBOARD_DOWN,
+    KEYBOARD_LEFT,
+    KEYBOARD_RIGHT,
+    KEYBOARD_ENTER,
+    KEYBOARD_SPACE,
+    KEYBOARD_w,
+    KEYBOARD_s,
+    KEYBOARD_a,
+    KEYBOARD_d,
+    KEYBOARD_e,
+    KEYBOARD_m,
+    KEYBOARD_n,
+    KEYBOARD_v,
+    KEYBOARD_z,
+    KEYBOARD_BACKSPACE
+};
+
+void KeyPoll::getjournalstate(journalstate* state)
+{
+    SDL_zerop(state);
+
+    for (size_t i = 0; i < SDL_arraysize(journalbuttons); i++)
+    {
+        if (buttonmap[journalbuttons[i]])
+        {
+            state->buttons |= 1 << i;
+        }
+    }
+    for (size_t i = 0; i < SDL_arraysize(journalkeys); i++)
+    {
+        if (keymap[journalkeys[i]])
+        {
+            state->keys |= 1 << i;
+        }
+    }
+    state->xvel = clamp(xVel, -32768, 32767);
+    state->yvel = clamp(yVel, -32768, 32767);
+}
+
+void KeyPoll::setjournalstate(const journalstate& state)
+{
+    for (size_t i = 0; i < SDL_arraysize(journalbuttons); i++)
+    {
+        buttonmap[journalbuttons[i]] = (state.buttons & (1 << i)) != 0;
+    }
+    for (size_t i = 0; i < SDL_arraysize(journalkeys); i++)
+    {
+        keymap[journalkeys[i]] = (state.keys & (1 << i)) != 0;
+    }
+    xVel = state.xvel;
+    yVel = state.yvel;
+}
+#endif
+
 void KeyPoll::Poll(void)
 {
+#ifdef REPLAY_INPUT
+    {
+        journalstate state;
+
+        /* The pad only gets a say once the journal's run out */
+        if (journal.replay(&state))
+        {
+            setjournalstate(state);
+            return;
+        }
+    }
+#endif
+
+#ifdef HEADLESS
+    /* There's nobody holding the pad */
+    return;
+#endif
+
     SceCtrlData pad = {0};
 
     if (sceCtrlPeekBufferPositive(&pad, 1)) {
@@ -134,7 +225,32 @@ void KeyPoll::Poll(void)
         buttonmap[SDL_CONTROLLER_BUTTON_DPAD_DOWN] = (pad.Buttons & PSP_CTRL_DOWN) != 0;
         buttonmap[SDL_CONTROLLER_BUTTON_DPAD_LEFT] = (pad.Buttons & PSP_CTRL_LEFT) != 0;
         buttonmap[SDL_CONTROLLER_BUTTON_DPAD_UP] = (pad.Buttons & PSP_CTRL_UP) != 0;
+
+#if defined(SCRIPT_PROFILER) || defined(FRAME_PROFILER)
+        /* L isn't bound to anything, and every face button is. While it's
+         * held the face buttons go to the profilers instead of the game. */
+        const bool profilerheld = (pad.Buttons & PSP_CTRL_LTRIGGER) != 0;
+        for (
+            SDL_GameControllerButton button = SDL_CONTROLLER_BUTTON_A;
+            button <= SDL_CONTROLLER_BUTTON_Y;
+            button = (SDL_GameControllerButton) (button + 1)
+        ) {
+            profilermap[button] = profilerheld && buttonmap[button];
+            if (profilerheld)
+            {
+                buttonmap[button] = false;
+            }
+        }
+#endif
     }
+
+#ifdef RECORD_INPUT
+    {
+        journalstate state;
+        getjournalstate(&state);
+        journal.record(state);
+    }
+#endif
 }
 
 bool KeyPoll::isDown(SDL_Keycode key)
@@ -174,6 +290,13 @@ bool KeyPoll::controllerButtonDown(void)
     return false;
 }
 
+#if defined(SCRIPT_PROFILER) || defined(FRAME_PROFILER)
+bool KeyPoll::isProfilerDown(SDL_GameControllerButton button)
+{
+    return profilermap[button];
+}
+#endif
+
 bool KeyPoll::controllerWantsLeft(bool includeVert)
 {
     return (    buttonmap[SDL_CONTROLLER_BUTTON_DPAD_LEFT] ||
@@ -29,6 +29,8 @@ enum Kybrd
     KEYBOARD_BACKSPACE = SDLK_BACKSPACE
 };
 
+struct journalstate;
+
 class KeyPoll
 {
 public:
@@ -58,6 +60,11 @@ public:
     bool controllerWantsLeft(bool includeVert);
     bool controllerWantsRight(bool includeVert);
 
+#if defined(SCRIPT_PROFILER) || defined(FRAME_PROFILER)
+    /* A face button pressed while L is held, which the game never sees */
+    bool isProfilerDown(SDL_GameControllerButton button);
+#endif
+
     int leftbutton, rightbutton, middlebutton;
     int mx, my;
 
@@ -70,8 +77,16 @@ public:
 private:
     // std::map<SDL_JoystickID, SDL_GameController*> controllers;
     std::map<SDL_GameControllerButton, bool> buttonmap;
+#if defined(SCRIPT_PROFILER) || defined(FRAME_PROFILER)
+    std::map<SDL_GameControllerButton, bool> profilermap;
+#endif
     int xVel, yVel;
     Uint32 wasFullscreen;
+
+#if defined(RECORD_INPUT) || defined(REPLAY_INPUT)
+    void getjournalstate(journalstate* state);
+    void setjournalstate(const journalstate& state);
+#endif
 };
 
 #ifndef KEY_DEFINITION
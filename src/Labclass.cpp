@@ -2,12 +2,12 @@
 
 #include "Game.h"
 #include "Entity.h"
+#include "LevelPack.h"
 #include "MakeAndPlay.h"
+#include "Map.h"
 
-const short* labclass::loadlevel(int rx, int ry)
+int labclass::roomindex(int rx, int ry)
 {
-    int t;
-
     rx=rx-100;
     ry=ry-100;
     if(ry<5)
@@ -21,7 +21,14 @@ const short* labclass::loadlevel(int rx, int ry)
         ry+=50-16; //lab
     }
 
-    t = rx + (ry * 100);
+    return rx + (ry * 100);
+}
+
+const short* labclass::loadlevel(int rx, int ry)
+{
+    int t;
+
+    t = roomindex(rx, ry);
     const short* result;
     rcol = 0;
     roomname = "";
@@ -33,7 +40,7 @@ const short* labclass::loadlevel(int rx, int ry)
     case rn(50,50):
     {
 
-        static const short contents[] = {
+        ROOM_CONTENTS(LEVELPACK_LAB, t, 0, {
         283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,
         283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,
         283,283,283,283,283,283,283,283,284,444,444,444,444,444,444,444,444,444,285,283,284,444,444,444,444,444,444,444,444,444,444,444,444,285,283,283,283,283,283,283,
@@ -64,7 +71,7 @@ const short* labclass::loadlevel(int rx, int ry)
         283,283,324,364,364,364,364,364,364,364,364,364,364,364,364,364,364,364,364,364,364,364,364,364,325,283,405,0,0,0,0,0,0,403,283,283,283,283,283,283,
         283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,405,0,0,0,0,0,0,403,283,283,283,283,283,283,
         283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,405,0,0,0,0,0,0,403,283,283,283,283,283,283,
-        };
+        });
 
         obj.createentity(232, 24, 10, 0, 250500);  // (savepoint)
 
@@ -82,7 +89,7 @@ const short* labclass::loadlevel(int rx, int ry)
     case rn(50,51):
     {
 
-        static const short contents[] = {
+        ROOM_CONTENTS(LEVELPACK_LAB, t, 0, {
         280,280,280,280,280,280,280,280,280,280,280,280,280,280,280,280,280,280,280,280,280,280,280,280,280,280,402,0,0,0,0,0,0,400,280,280,280,280,280,280,
         280,280,280,280,280,280,280,280,280,280,280,280,280,280,280,280,280,280,280,280,280,280,280,280,280,280,402,0,0,0,0,0,0,400,280,280,280,280,280,280,
         280,280,280,280,280,280,280,280,280,280,280,280,280,280,280,280,280,280,280,280,280,280,280,280,281,441,442,0,0,0,0,0,0,440,441,441,441,441,282,280,
@@ -113,7 +120,7 @@ const short* labclass::loadlevel(int rx, int ry)
         280,280,280,280,280,280,280,280,280,280,280,280,280,321,361,361,361,361,361,361,361,361,361,361,361,361,361,361,361,361,361,361,361,361,361,361,361,361,322,280,
         280,280,280,280,280,280,280,280,280,280,280,280,280,280,280,280,280,280,280,280,280,280,280,280,280,280,280,280,280,280,280,280,280,280,280,280,280,280,280,280,
         280,280,280,280,280,280,280,280,280,280,280,280,280,280,280,280,280,280,280,280,280,280,280,280,280,280,280,280,280,280,280,280,280,280,280,280,280,280,280,280,
-        };
+        });
 
         obj.createentity(112, 180, 11, 192);  // (horizontal gravity line)
         rcol = 0;
@@ -126,7 +133,7 @@ const short* labclass::loadlevel(int rx, int ry)
     case rn(49,51):
     {
 
-        static const short contents[] = {
+        ROOM_CONTENTS(LEVELPACK_LAB, t, 0, {
         292,292,292,292,292,292,292,292,292,292,292,292,292,292,292,292,292,292,292,292,292,292,292,292,292,292,292,292,292,292,292,292,292,292,292,292,292,292,292,292,
         292,292,292,292,292,292,292,292,292,292,292,292,292,292,292,292,292,292,292,292,292,292,292,292,292,292,292,292,292,292,292,292,292,292,292,292,292,292,292,292,
         292,292,292,292,292,292,292,292,292,292,292,292,292,292,292,292,292,292,292,292,292,292,292,292,292,292,292,292,292,292,292,292,292,292,292,292,292,292,292,292,
@@ -157,7 +164,7 @@ const short* labclass::loadlevel(int rx, int ry)
         292,292,292,292,292,292,292,292,292,292,292,292,292,292,292,292,292,292,292,292,292,292,292,292,292,292,292,414,0,0,0,0,0,0,0,412,292,292,292,292,
         292,292,292,292,292,292,292,292,292,292,292,292,292,292,292,292,292,292,292,292,292,292,292,292,292,292,292,414,0,0,0,0,0,0,0,412,292,292,292,292,
         292,292,292,292,292,292,292,292,292,292,292,292,292,292,292,292,292,292,292,292,292,292,292,292,292,292,292,414,0,0,0,0,0,0,0,412,292,292,292,292,
-        };
+        });
 
         obj.createentity(96, 124, 11, 120);  // (horizontal gravity line)
         obj.createentity(248, 48, 10, 0, 251490);  // (savepoint)
@@ -171,7 +178,7 @@ const short* labclass::loadlevel(int rx, int ry)
     case rn(49,52):
     {
 
-        static const short contents[] = {
+        ROOM_CONTENTS(LEVELPACK_LAB, t, 0, {
         286,286,286,286,286,286,286,286,286,286,286,286,286,286,286,286,286,286,286,286,286,286,286,286,286,286,286,408,0,0,0,0,0,0,0,406,286,286,286,286,
         286,287,447,447,447,447,447,447,447,447,288,286,286,287,447,447,447,447,447,447,447,447,288,286,286,287,447,448,0,0,0,0,0,0,0,406,286,286,286,286,
         286,408,68,68,68,68,68,68,68,68,406,286,286,408,68,68,68,68,68,68,68,68,406,286,286,408,68,68,0,0,0,0,0,0,0,406,286,286,286,286,
@@ -202,7 +209,7 @@ const short* labclass::loadlevel(int rx, int ry)
         286,286,286,286,286,286,286,327,367,367,367,367,367,367,367,367,328,286,286,327,367,367,367,367,367,367,367,367,328,286,286,286,286,286,286,286,286,286,286,286,
         286,286,286,286,286,286,286,286,286,286,286,286,286,286,286,286,286,286,286,286,286,286,286,286,286,286,286,286,286,286,286,286,286,286,286,286,286,286,286,286,
         286,286,286,286,286,286,286,286,286,286,286,286,286,286,286,286,286,286,286,286,286,286,286,286,286,286,286,286,286,286,286,286,286,286,286,286,286,286,286,286,
-        };
+        });
 
         obj.createentity(248, 136, 10, 1, 252490);  // (savepoint)
         obj.createentity(16, 68, 11, 64);  // (horizontal gravity line)
@@ -219,7 +226,7 @@ const short* labclass::loadlevel(int rx, int ry)
     case rn(48,52):
     {
 
-        static const short contents[] = {
+        ROOM_CONTENTS(LEVELPACK_LAB, t, 0, {
         289,289,289,289,289,289,289,289,289,289,289,289,289,289,289,289,289,289,289,289,289,289,289,289,289,289,289,289,289,289,289,289,289,289,289,289,289,289,289,289,
         289,289,289,289,289,290,450,450,450,450,450,450,450,450,450,450,450,450,450,291,289,289,289,290,450,450,450,450,450,450,450,450,450,450,450,450,450,291,289,289,
         289,289,289,289,289,411,70,70,70,70,70,70,70,70,70,70,70,70,70,409,289,289,289,411,70,70,70,70,70,70,70,70,70,70,70,70,70,409,289,289,
@@ -250,7 +257,7 @@ const short* labclass::loadlevel(int rx, int ry)
         289,411,0,0,0,0,0,0,0,0,0,409,289,289,289,289,289,289,330,370,370,370,370,370,331,289,289,289,289,289,289,289,289,289,289,289,289,289,289,289,
         289,411,0,0,0,0,0,0,0,0,0,409,289,289,289,289,289,289,289,289,289,289,289,289,289,289,289,289,289,289,289,289,289,289,289,289,289,289,289,289,
         289,411,0,0,0,0,0,0,0,0,0,409,289,289,289,289,289,289,289,289,289,289,289,289,289,289,289,289,289,289,289,289,289,289,289,289,289,289,289,289,
-        };
+        });
 
         obj.createentity(280, 136, 10, 1, 252480);  // (savepoint)
         obj.createentity(48, 52, 11, 104);  // (horizontal gravity line)
@@ -267,7 +274,7 @@ const short* labclass::loadlevel(int rx, int ry)
     case rn(48,53):
     {
 
-        static const short contents[] = {
+        ROOM_CONTENTS(LEVELPACK_LAB, t, 0, {
         295,417,0,0,0,0,0,0,0,0,0,415,295,295,295,295,295,295,295,295,295,295,295,295,295,295,295,295,295,295,295,295,295,295,295,295,295,295,295,295,
         295,417,0,0,0,0,0,0,0,0,0,415,295,295,295,295,295,295,295,295,295,295,295,295,295,295,295,295,295,295,295,295,295,295,295,295,295,295,295,295,
         295,417,0,0,0,0,0,0,0,0,0,415,295,295,295,295,295,295,295,295,295,295,295,295,295,295,295,295,295,295,295,295,295,295,295,295,295,295,295,295,
@@ -298,7 +305,7 @@ const short* labclass::loadlevel(int rx, int ry)
         295,295,295,295,295,295,295,295,295,295,295,295,295,295,295,295,295,295,295,295,295,295,295,295,295,295,295,295,295,295,295,295,295,295,295,295,295,295,295,295,
         295,295,295,295,295,295,295,295,295,295,295,295,295,295,295,295,295,295,295,295,295,295,295,295,295,295,295,295,295,295,295,295,295,295,295,295,295,295,295,295,
         295,295,295,295,295,295,295,295,295,295,295,295,295,295,295,295,295,295,295,295,295,295,295,295,295,295,295,295,295,295,295,295,295,295,295,295,295,295,295,295,
-        };
+        });
 
         obj.createentity(32, 128, 10, 1, 253480);  // (savepoint)
         obj.createentity(187, 88, 12, 56);  // (vertical gravity line)
@@ -313,7 +320,7 @@ const short* labclass::loadlevel(int rx, int ry)
     case rn(49,53):
     {
 
-        static const short contents[] = {
+        ROOM_CONTENTS(LEVELPACK_LAB, t, 0, {
         283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,
         283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,
         283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,
@@ -344,7 +351,7 @@ const short* labclass::loadlevel(int rx, int ry)
         283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,
         283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,
         283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,
-        };
+        });
 
         obj.createentity(43, 88, 12, 56);  // (vertical gravity line)
         obj.createentity(123, 88, 12, 56);  // (vertical gravity line)
@@ -363,7 +370,7 @@ const short* labclass::loadlevel(int rx, int ry)
     case rn(50,53):
     {
 
-        static const short contents[] = {
+        ROOM_CONTENTS(LEVELPACK_LAB, t, 0, {
         289,289,289,289,289,289,289,289,411,0,0,0,0,0,409,289,289,289,289,289,289,289,289,289,289,289,289,289,289,289,289,289,289,289,289,289,289,289,289,289,
         289,289,289,289,289,289,289,289,411,0,0,0,0,0,409,289,289,289,289,289,289,289,289,289,289,289,289,289,289,289,289,289,289,289,289,289,289,289,289,289,
         289,289,289,289,289,289,289,289,411,0,0,0,0,0,449,450,450,450,450,450,450,450,450,450,450,450,450,450,450,450,450,450,291,289,289,289,289,289,289,289,
@@ -394,7 +401,7 @@ const short* labclass::loadlevel(int rx, int ry)
         289,289,289,289,289,289,289,289,289,289,289,289,289,289,289,289,289,289,289,289,289,289,289,289,289,289,289,289,289,289,289,411,69,69,69,69,69,69,69,69,
         289,289,289,289,289,289,289,289,289,289,289,289,289,289,289,289,289,289,289,289,289,289,289,289,289,289,289,289,289,289,289,330,370,370,370,370,370,370,370,370,
         289,289,289,289,289,289,289,289,289,289,289,289,289,289,289,289,289,289,289,289,289,289,289,289,289,289,289,289,289,289,289,289,289,289,289,289,289,289,289,289,
-        };
+        });
 
         obj.createentity(96, 192, 10, 1, 253500);  // (savepoint)
         obj.createentity(163, 32, 12, 168);  // (vertical gravity line)
@@ -408,7 +415,7 @@ const short* labclass::loadlevel(int rx, int ry)
     case rn(51,53):
     {
 
-        static const short contents[] = {
+        ROOM_CONTENTS(LEVELPACK_LAB, t, 0, {
         286,286,286,286,286,286,286,286,286,286,286,286,286,286,286,286,287,447,447,447,447,447,447,447,447,447,447,447,447,447,447,447,447,447,447,447,447,447,447,447,
         286,286,286,286,286,286,286,286,286,286,286,286,286,286,286,286,408,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,
         286,286,286,286,286,286,286,286,286,286,286,286,286,286,286,286,408,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
@@ -439,7 +446,7 @@ const short* labclass::loadlevel(int rx, int ry)
         67,67,67,67,67,67,67,67,67,67,67,67,67,67,67,67,67,67,67,67,67,67,67,406,286,286,286,286,286,286,286,286,286,286,286,286,286,286,286,286,
         367,367,367,367,367,367,367,367,367,367,367,367,367,367,367,367,367,367,367,367,367,367,367,328,286,286,286,286,286,286,286,286,286,286,286,286,286,286,286,286,
         286,286,286,286,286,286,286,286,286,286,286,286,286,286,286,286,286,286,286,286,286,286,286,286,286,286,286,286,286,286,286,286,286,286,286,286,286,286,286,286,
-        };
+        });
 
         obj.createentity(264, 104, 10, 1, 253510);  // (savepoint)
         obj.createentity(131, 120, 12, 96);  // (vertical gravity line)
@@ -454,7 +461,7 @@ const short* labclass::loadlevel(int rx, int ry)
     case rn(52,53):
     {
 
-        static const short contents[] = {
+        ROOM_CONTENTS(LEVELPACK_LAB, t, 0, {
         453,453,453,453,453,453,294,414,0,0,0,0,0,0,412,292,292,292,292,292,292,292,292,292,292,292,292,292,292,292,292,292,292,292,292,292,292,292,292,292,
         72,72,0,0,0,0,412,414,0,0,0,0,0,0,412,292,292,292,292,292,292,292,292,292,292,292,292,292,292,292,292,292,292,292,292,292,292,292,292,292,
         0,0,0,0,0,0,412,414,0,0,0,0,0,0,412,292,292,292,292,292,292,292,292,292,292,292,292,292,292,292,292,292,292,292,292,292,292,292,292,292,
@@ -485,7 +492,7 @@ const short* labclass::loadlevel(int rx, int ry)
         292,292,292,292,292,292,292,292,292,292,292,292,292,333,373,373,373,373,373,334,292,292,292,333,373,373,373,373,373,334,292,292,292,292,292,292,292,292,292,292,
         292,292,292,292,292,292,292,292,292,292,292,292,292,292,292,292,292,292,292,292,292,292,292,292,292,292,292,292,292,292,292,292,292,292,292,292,292,292,292,292,
         292,292,292,292,292,292,292,292,292,292,292,292,292,292,292,292,292,292,292,292,292,292,292,292,292,292,292,292,292,292,292,292,292,292,292,292,292,292,292,292,
-        };
+        });
 
         obj.createentity(24, 184, 10, 1, 253520);  // (savepoint)
         obj.createentity(64, 164, 11, 200);  // (horizontal gravity line)
@@ -498,7 +505,7 @@ const short* labclass::loadlevel(int rx, int ry)
     case rn(52,52):
     {
 
-        static const short contents[] = {
+        ROOM_CONTENTS(LEVELPACK_LAB, t, 0, {
         286,286,286,286,286,286,286,286,286,286,286,286,286,286,286,286,286,286,286,286,286,286,286,286,286,286,286,286,286,286,286,286,286,286,286,286,286,286,286,286,
         447,447,447,447,447,447,447,447,447,447,447,447,447,447,447,447,447,447,447,447,447,447,447,447,447,447,447,447,447,447,447,447,447,447,288,286,286,286,286,286,
         68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,406,286,286,286,286,286,
@@ -529,7 +536,7 @@ const short* labclass::loadlevel(int rx, int ry)
         286,286,286,286,286,286,286,408,0,0,0,0,0,0,366,367,367,367,367,367,367,367,367,367,367,367,367,367,367,367,367,367,367,367,328,286,286,286,286,286,
         286,286,286,286,286,286,286,408,0,0,0,0,0,0,406,286,286,286,286,286,286,286,286,286,286,286,286,286,286,286,286,286,286,286,286,286,286,286,286,286,
         286,286,286,286,286,286,286,408,0,0,0,0,0,0,406,286,286,286,286,286,286,286,286,286,286,286,286,286,286,286,286,286,286,286,286,286,286,286,286,286,
-        };
+        });
 
         obj.createentity(195, 24, 12, 80);  // (vertical gravity line)
         obj.createentity(195, 128, 12, 80);  // (vertical gravity line)
@@ -544,7 +551,7 @@ const short* labclass::loadlevel(int rx, int ry)
     case rn(51,52):
     {
 
-        static const short contents[] = {
+        ROOM_CONTENTS(LEVELPACK_LAB, t, 0, {
         280,402,51,0,0,0,0,0,0,0,0,0,0,0,0,0,0,52,400,280,280,280,280,280,280,280,280,280,280,280,280,280,280,280,280,280,280,280,280,280,
         280,402,51,0,0,0,0,0,0,0,0,0,0,0,0,0,0,52,400,280,280,280,280,280,280,280,280,280,280,281,441,441,441,441,441,441,441,441,441,441,
         280,402,51,0,0,0,0,0,0,0,0,0,0,0,0,0,0,52,400,280,280,280,280,280,280,280,280,280,281,442,64,64,64,64,64,64,64,64,64,64,
@@ -575,7 +582,7 @@ const short* labclass::loadlevel(int rx, int ry)
         280,321,362,63,63,63,63,63,63,63,63,63,63,63,63,63,63,63,63,63,63,63,63,63,63,63,63,63,63,63,63,360,322,280,280,280,280,280,280,280,
         280,280,321,361,361,361,361,361,361,361,361,361,361,361,361,361,361,361,361,361,361,361,361,361,361,361,361,361,361,361,361,322,280,280,280,280,280,280,280,280,
         280,280,280,280,280,280,280,280,280,280,280,280,280,280,280,280,280,280,280,280,280,280,280,280,280,280,280,280,280,280,280,280,280,280,280,280,280,280,280,280,
-        };
+        });
 
         obj.createentity(24, 188, 11, 224);  // (horizontal gravity line)
         obj.createentity(280, 96, 10, 1, 252510);  // (savepoint)
@@ -593,7 +600,7 @@ const short* labclass::loadlevel(int rx, int ry)
     case rn(51,51):
     {
 
-        static const short contents[] = {
+        ROOM_CONTENTS(LEVELPACK_LAB, t, 0, {
         292,292,293,453,453,453,453,453,453,453,453,453,453,453,453,453,453,294,292,292,414,59,0,0,0,0,0,0,0,0,0,0,0,0,0,0,60,412,292,292,
         292,293,454,72,72,72,72,72,72,72,72,72,72,72,72,72,72,452,294,292,414,59,0,0,0,0,0,0,0,0,0,0,0,0,0,0,60,412,292,292,
         292,414,59,0,0,0,0,0,0,0,0,0,0,0,0,0,0,60,412,292,414,59,0,0,0,0,0,0,0,0,0,0,0,0,0,0,60,412,292,292,
@@ -624,7 +631,7 @@ const short* labclass::loadlevel(int rx, int ry)
         292,414,59,0,0,0,0,0,0,0,0,0,0,0,0,0,0,60,412,292,292,333,373,373,373,373,373,373,373,373,373,373,373,373,373,373,334,292,292,292,
         292,414,59,0,0,0,0,0,0,0,0,0,0,0,0,0,0,60,412,292,292,292,292,292,292,292,292,292,292,292,292,292,292,292,292,292,292,292,292,292,
         292,414,59,0,0,0,0,0,0,0,0,0,0,0,0,0,0,60,412,292,292,292,292,292,292,292,292,292,292,292,292,292,292,292,292,292,292,292,292,292,
-        };
+        });
 
         obj.createentity(24, 44, 11, 112);  // (horizontal gravity line)
         obj.createentity(176, 180, 11, 112);  // (horizontal gravity line)
@@ -637,7 +644,7 @@ const short* labclass::loadlevel(int rx, int ry)
     case rn(51,50):
     {
 
-        static const short contents[] = {
+        ROOM_CONTENTS(LEVELPACK_LAB, t, 0, {
         283,283,283,284,444,444,444,444,444,444,444,444,444,444,444,444,444,444,444,444,444,444,444,444,444,444,444,444,444,444,444,444,444,444,444,444,444,444,444,444,
         283,283,284,445,66,66,66,66,66,66,66,66,66,66,66,66,66,66,66,66,66,66,66,66,66,66,66,66,66,66,66,66,66,66,66,66,66,66,66,66,
         283,283,405,53,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
@@ -668,7 +675,7 @@ const short* labclass::loadlevel(int rx, int ry)
         283,283,324,365,65,65,65,65,65,65,65,65,65,65,65,65,65,65,363,325,405,53,0,0,0,0,0,0,0,0,0,0,0,0,0,0,54,403,283,283,
         283,283,283,324,364,364,364,364,364,364,364,364,364,364,364,364,364,364,325,283,405,53,0,0,0,0,0,0,0,0,0,0,0,0,0,0,54,403,283,283,
         283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,405,53,0,0,0,0,0,0,0,0,0,0,0,0,0,0,54,403,283,283,
-        };
+        });
 
         obj.createentity(32, 28, 11, 296);  // (horizontal gravity line)
         obj.createentity(32, 196, 11, 112);  // (horizontal gravity line)
@@ -683,7 +690,7 @@ const short* labclass::loadlevel(int rx, int ry)
     case rn(52,50):
     {
 
-        static const short contents[] = {
+        ROOM_CONTENTS(LEVELPACK_LAB, t, 0, {
         447,447,447,447,447,447,447,447,447,447,447,447,447,447,447,447,447,447,447,447,447,447,447,447,447,447,447,447,447,447,447,447,447,447,447,447,447,447,447,447,
         68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,
         0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
@@ -714,7 +721,7 @@ const short* labclass::loadlevel(int rx, int ry)
         286,286,286,286,286,286,286,286,408,55,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
         286,286,286,286,286,286,286,286,408,55,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
         286,286,286,286,286,286,286,286,408,55,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-        };
+        });
 
         obj.createentity(-8, 28, 11, 336);  // (horizontal gravity line)
         obj.createentity(32, 72, 10, 1, 250520);  // (savepoint)
@@ -728,7 +735,7 @@ const short* labclass::loadlevel(int rx, int ry)
     case rn(52,51):
     {
 
-        static const short contents[] = {
+        ROOM_CONTENTS(LEVELPACK_LAB, t, 0, {
         280,280,280,280,280,280,280,280,402,51,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
         280,280,280,280,280,280,280,280,402,51,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
         280,280,280,280,280,280,280,280,402,51,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
@@ -759,7 +766,7 @@ const short* labclass::loadlevel(int rx, int ry)
         280,280,280,280,280,280,280,280,280,280,280,280,280,280,280,280,280,280,280,280,280,280,280,280,280,280,280,280,280,280,280,280,280,280,280,280,280,280,280,280,
         280,280,280,280,280,280,280,280,280,280,280,280,280,280,280,280,280,280,280,280,280,280,280,280,280,280,280,280,280,280,280,280,280,280,280,280,280,280,280,280,
         280,280,280,280,280,280,280,280,280,280,280,280,280,280,280,280,280,280,280,280,280,280,280,280,280,280,280,280,280,280,280,280,280,280,280,280,280,280,280,280,
-        };
+        });
 
         obj.createentity(80, 180, 11, 248);  // (horizontal gravity line)
         rcol=0;
@@ -771,7 +778,7 @@ const short* labclass::loadlevel(int rx, int ry)
     case rn(53,51):
     {
 
-        static const short contents[] = {
+        ROOM_CONTENTS(LEVELPACK_LAB, t, 0, {
         0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,60,412,292,414,59,0,0,0,0,0,0,0,0,0,0,
         0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,60,412,292,414,59,0,0,0,0,0,0,0,0,0,0,
         0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,60,412,292,414,59,0,0,0,0,0,0,0,0,0,0,
@@ -802,7 +809,7 @@ const short* labclass::loadlevel(int rx, int ry)
         292,292,292,292,292,292,292,292,292,292,292,292,292,292,292,292,292,292,292,292,292,292,292,292,292,292,292,292,292,292,292,292,292,292,292,292,292,292,292,292,
         292,292,292,292,292,292,292,292,292,292,292,292,292,292,292,292,292,292,292,292,292,292,292,292,292,292,292,292,292,292,292,292,292,292,292,292,292,292,292,292,
         292,292,292,292,292,292,292,292,292,292,292,292,292,292,292,292,292,292,292,292,292,292,292,292,292,292,292,292,292,292,292,292,292,292,292,292,292,292,292,292,
-        };
+        });
 
         obj.createentity(-8, 180, 11, 208);  // (horizontal gravity line)
         obj.createentity(240, 180, 11, 88);  // (horizontal gravity line)
@@ -816,7 +823,7 @@ const short* labclass::loadlevel(int rx, int ry)
     case rn(53,50):
     {
 
-        static const short contents[] = {
+        ROOM_CONTENTS(LEVELPACK_LAB, t, 0, {
         456,456,456,456,456,456,456,456,456,456,456,456,456,456,456,456,456,456,456,456,456,456,456,456,456,456,456,456,456,456,456,456,456,456,456,456,456,456,456,456,
         74,74,74,74,74,74,74,74,74,74,74,74,74,74,74,74,74,74,74,74,74,74,74,74,74,74,74,74,74,74,74,74,74,74,74,74,74,74,74,74,
         0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
@@ -847,7 +854,7 @@ const short* labclass::loadlevel(int rx, int ry)
         0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,62,415,295,417,61,0,0,0,0,0,0,0,0,0,0,
         0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,62,415,295,417,61,0,0,0,0,0,0,0,0,0,0,
         0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,62,415,295,417,61,0,0,0,0,0,0,0,0,0,0,
-        };
+        });
 
         obj.createentity(-8, 28, 11, 336);  // (horizontal gravity line)
         rcol=5;
@@ -860,7 +867,7 @@ const short* labclass::loadlevel(int rx, int ry)
     case rn(54,50):
     {
 
-        static const short contents[] = {
+        ROOM_CONTENTS(LEVELPACK_LAB, t, 0, {
         444,444,444,444,444,444,444,444,444,285,283,283,283,284,444,444,444,444,444,444,444,444,444,444,444,444,285,283,283,283,284,444,444,444,444,444,444,444,444,444,
         66,66,66,66,66,66,66,66,66,443,285,283,284,445,66,66,66,66,66,66,66,66,66,66,66,66,443,285,283,284,445,66,66,66,66,66,66,66,66,66,
         0,0,0,0,0,0,0,0,0,54,403,283,405,53,0,0,0,0,0,0,0,0,0,0,0,0,54,403,283,405,53,0,0,0,0,0,0,0,0,0,
@@ -891,7 +898,7 @@ const short* labclass::loadlevel(int rx, int ry)
         0,0,0,0,0,0,0,0,0,54,403,283,405,53,0,0,0,0,0,0,0,0,0,0,0,0,54,403,283,405,53,0,0,0,0,0,0,0,0,0,
         0,0,0,0,0,0,0,0,0,54,403,283,405,53,0,0,0,0,0,0,0,0,0,0,0,0,54,403,283,405,53,0,0,0,0,0,0,0,0,0,
         0,0,0,0,0,0,0,0,0,54,403,283,405,53,0,0,0,0,0,0,0,0,0,0,0,0,54,403,283,405,53,0,0,0,0,0,0,0,0,0,
-        };
+        });
 
         obj.createentity(-8, 28, 11, 80);  // (horizontal gravity line)
         obj.createentity(112, 28, 11, 96);  // (horizontal gravity line)
@@ -907,7 +914,7 @@ const short* labclass::loadlevel(int rx, int ry)
     case rn(54,51):
     {
 
-        static const short contents[] = {
+        ROOM_CONTENTS(LEVELPACK_LAB, t, 0, {
         0,0,0,0,0,0,0,0,0,56,406,286,408,55,0,0,0,0,0,0,0,0,0,0,0,0,56,406,286,408,55,0,0,0,0,0,0,0,0,0,
         0,0,0,0,0,0,0,0,0,56,406,286,408,55,0,0,0,0,0,0,0,0,0,0,0,0,56,406,286,408,55,0,0,0,0,0,0,0,0,0,
         0,0,0,0,0,0,0,0,0,56,406,286,408,55,0,0,0,0,0,0,0,0,0,0,0,0,56,446,399,448,55,0,0,0,0,0,0,0,0,0,
@@ -938,7 +945,7 @@ const short* labclass::loadlevel(int rx, int ry)
         286,286,286,286,286,286,286,286,286,286,286,286,286,286,286,286,286,286,286,286,286,286,286,286,286,286,286,286,286,286,286,286,286,286,286,286,286,286,286,286,
         286,286,286,286,286,286,286,286,286,286,286,286,286,286,286,286,286,286,286,286,286,286,286,286,286,286,286,286,286,286,286,286,286,286,286,286,286,286,286,286,
         286,286,286,286,286,286,286,286,286,286,286,286,286,286,286,286,286,286,286,286,286,286,286,286,286,286,286,286,286,286,286,286,286,286,286,286,286,286,286,286,
-        };
+        });
 
         obj.createentity(-8, 180, 11, 80);  // (horizontal gravity line)
         obj.createentity(112, 180, 11, 96);  // (horizontal gravity line)
@@ -953,7 +960,7 @@ const short* labclass::loadlevel(int rx, int ry)
     case rn(55,50):
     {
 
-        static const short contents[] = {
+        ROOM_CONTENTS(LEVELPACK_LAB, t, 0, {
         450,450,450,450,291,289,411,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,58,409,289,
         70,70,70,70,409,289,411,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,58,409,289,
         0,0,0,0,409,289,411,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,58,409,289,
@@ -984,7 +991,7 @@ const short* labclass::loadlevel(int rx, int ry)
         0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,58,409,411,0,0,0,0,0,0,409,289,289,289,
         0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,58,409,411,0,0,0,0,0,0,409,289,289,289,
         0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,58,409,411,0,0,0,0,0,0,409,289,289,289,
-        };
+        });
 
         obj.createentity(-8, 28, 11, 40);  // (horizontal gravity line)
 
@@ -997,7 +1004,7 @@ const short* labclass::loadlevel(int rx, int ry)
     case rn(55,49):
     {
 
-        static const short contents[] = {
+        ROOM_CONTENTS(LEVELPACK_LAB, t, 0, {
         295,295,295,295,295,295,295,295,295,295,295,295,295,295,295,295,295,295,295,295,295,295,295,295,295,295,295,295,295,295,295,295,295,295,295,295,295,295,295,295,
         295,296,456,456,456,456,456,456,456,456,456,456,297,295,295,295,295,295,295,295,295,295,295,295,295,295,295,295,295,295,295,295,295,295,295,295,295,295,295,295,
         295,417,0,0,0,0,0,0,0,0,0,62,415,295,295,295,295,295,295,295,295,295,295,295,295,295,295,295,295,295,295,295,295,295,295,295,295,295,295,295,
@@ -1028,7 +1035,7 @@ const short* labclass::loadlevel(int rx, int ry)
         295,295,295,295,295,295,417,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,62,415,295,
         295,295,295,295,295,295,417,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,62,415,295,
         295,295,295,295,295,295,417,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,62,415,295,
-        };
+        });
 
 
         obj.createentity(160, 176, 10, 0, 249550);  // (savepoint)
@@ -1049,7 +1056,7 @@ const short* labclass::loadlevel(int rx, int ry)
     case rn(55,51):
     {
 
-        static const short contents[] = {
+        ROOM_CONTENTS(LEVELPACK_LAB, t, 0, {
         0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,52,400,402,0,0,0,0,0,0,400,280,280,280,
         0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,52,400,402,0,0,0,0,0,0,400,280,280,280,
         0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,52,400,402,0,0,0,0,0,0,400,280,280,280,
@@ -1080,7 +1087,7 @@ const short* labclass::loadlevel(int rx, int ry)
         280,280,280,280,280,280,280,280,280,280,280,280,280,280,280,280,280,280,280,280,280,280,280,280,280,280,280,280,280,402,0,0,0,0,0,0,400,280,280,280,
         280,280,280,280,280,280,280,280,280,280,280,280,280,280,280,280,280,280,280,280,280,280,280,280,280,280,280,280,280,402,0,0,0,0,0,0,400,280,280,280,
         280,280,280,280,280,280,280,280,280,280,280,280,280,280,280,280,280,280,280,280,280,280,280,280,280,280,280,280,280,402,0,0,0,0,0,0,400,280,280,280,
-        };
+        });
 
         obj.createentity(-8, 180, 11, 224);  // (horizontal gravity line)
 
@@ -1094,7 +1101,7 @@ const short* labclass::loadlevel(int rx, int ry)
     case rn(55,52):
     {
 
-        static const short contents[] = {
+        ROOM_CONTENTS(LEVELPACK_LAB, t, 0, {
         292,292,292,292,292,292,292,292,292,292,292,292,292,292,292,292,292,292,292,292,292,292,292,292,292,292,292,292,292,414,0,0,0,0,0,0,412,292,292,292,
         292,292,292,292,292,292,292,292,292,292,292,292,292,292,292,292,292,292,292,292,292,292,292,292,292,292,292,292,292,414,0,0,0,0,0,0,412,292,292,292,
         292,292,292,292,292,292,292,292,292,292,292,292,292,292,292,292,292,292,292,292,292,292,292,292,292,292,292,292,292,414,0,0,0,0,0,0,412,292,292,292,
@@ -1125,7 +1132,7 @@ const short* labclass::loadlevel(int rx, int ry)
         292,292,292,292,292,292,292,292,292,292,292,292,292,292,292,292,292,414,59,0,0,0,0,0,0,0,60,412,292,414,0,0,0,0,0,0,412,292,292,292,
         292,292,292,292,292,292,292,292,292,292,292,292,292,292,292,292,292,414,59,0,0,0,0,0,0,0,60,412,292,414,0,0,0,0,0,0,412,292,292,292,
         292,292,292,292,292,292,292,292,292,292,292,292,292,292,292,292,292,414,59,0,0,0,0,0,0,0,60,412,292,414,0,0,0,0,0,0,412,292,292,292,
-        };
+        });
 
         obj.createentity(32, 64, 9, 10);  // (shiny trinket)
         obj.createentity(120, 72, 10, 1, 252550);  // (savepoint)
@@ -1139,7 +1146,7 @@ const short* labclass::loadlevel(int rx, int ry)
     case rn(55,53):
     {
 
-        static const short contents[] = {
+        ROOM_CONTENTS(LEVELPACK_LAB, t, 0, {
         283,283,283,283,283,283,283,283,283,284,444,444,444,444,444,444,444,445,53,0,0,0,0,0,0,0,54,403,283,405,0,0,0,0,0,0,403,283,283,283,
         283,283,283,283,283,283,283,283,284,445,66,66,66,66,66,66,66,66,0,0,0,0,0,0,0,0,54,403,283,405,0,0,0,0,0,0,403,283,283,283,
         283,283,283,283,283,283,283,283,405,53,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,54,403,283,405,0,0,0,0,0,0,403,283,283,283,
@@ -1170,7 +1177,7 @@ const short* labclass::loadlevel(int rx, int ry)
         283,283,283,283,283,283,283,283,324,365,65,65,65,65,65,65,65,65,0,0,0,0,0,0,0,0,54,403,283,405,0,0,0,0,0,0,403,283,283,283,
         283,283,283,283,283,283,283,283,283,324,364,364,364,364,364,364,364,365,53,0,0,0,0,0,0,0,54,403,283,405,0,0,0,0,0,0,403,283,283,283,
         283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,405,53,0,0,0,0,0,0,0,54,403,283,405,0,0,0,0,0,0,403,283,283,283,
-        };
+        });
 
         obj.createentity(272, 144, 10, 1, 253550);  // (savepoint)
         obj.createentity(152, 116, 11, 56);  // (horizontal gravity line)
@@ -1186,7 +1193,7 @@ const short* labclass::loadlevel(int rx, int ry)
     case rn(55,54):
     {
 
-        static const short contents[] = {
+        ROOM_CONTENTS(LEVELPACK_LAB, t, 0, {
         295,295,295,295,295,295,295,295,295,295,295,295,295,295,295,295,295,417,61,0,0,0,0,0,0,0,62,415,295,417,0,0,0,0,0,0,415,295,295,295,
         295,295,295,295,295,295,295,295,295,295,295,295,295,295,295,295,295,417,61,0,0,0,0,0,0,0,62,415,295,417,0,0,0,0,0,0,415,295,295,295,
         295,295,295,295,295,295,295,295,295,295,295,295,295,295,295,295,295,417,61,0,0,0,0,0,0,0,62,415,295,417,0,0,0,0,0,0,415,295,295,295,
@@ -1217,7 +1224,7 @@ const short* labclass::loadlevel(int rx, int ry)
         295,295,295,295,295,295,295,295,295,295,295,295,295,295,295,295,295,295,295,295,295,295,295,295,295,295,295,295,295,295,295,295,295,295,295,295,295,295,295,295,
         295,295,295,295,295,295,295,295,295,295,295,295,295,295,295,295,295,295,295,295,295,295,295,295,295,295,295,295,295,295,295,295,295,295,295,295,295,295,295,295,
         295,295,295,295,295,295,295,295,295,295,295,295,295,295,295,295,295,295,295,295,295,295,295,295,295,295,295,295,295,295,295,295,295,295,295,295,295,295,295,295,
-        };
+        });
 
         obj.createentity(216, 144, 10, 1, 254550);  // (savepoint)
         obj.createentity(-8, 60, 11, 136);  // (horizontal gravity line)
@@ -1232,7 +1239,7 @@ const short* labclass::loadlevel(int rx, int ry)
     case rn(54,54):
     {
 
-        static const short contents[] = {
+        ROOM_CONTENTS(LEVELPACK_LAB, t, 0, {
         0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,406,286,286,286,286,286,286,286,286,286,286,286,
         0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,406,286,286,286,286,286,286,286,286,286,286,286,
         0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,446,288,286,286,286,286,286,286,286,286,286,286,
@@ -1263,7 +1270,7 @@ const short* labclass::loadlevel(int rx, int ry)
         0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,406,286,286,286,286,286,286,286,286,286,286,286,
         0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,406,286,286,286,286,286,286,286,286,286,286,286,
         0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,406,286,286,286,286,286,286,286,286,286,286,286,
-        };
+        });
 
         obj.createentity(-8, 60, 11, 336);  // (horizontal gravity line)
         obj.createentity(-8, 172, 11, 336);  // (horizontal gravity line)
@@ -1278,7 +1285,7 @@ const short* labclass::loadlevel(int rx, int ry)
     case rn(53,54):
     {
 
-        static const short contents[] = {
+        ROOM_CONTENTS(LEVELPACK_LAB, t, 0, {
         0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
         0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
         0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
@@ -1309,7 +1316,7 @@ const short* labclass::loadlevel(int rx, int ry)
         0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
         0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
         0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-        };
+        });
 
         obj.createentity(-8, 60, 11, 120);  // (horizontal gravity line)
         obj.createentity(-8, 172, 11, 40);  // (horizontal gravity line)
@@ -1330,7 +1337,7 @@ const short* labclass::loadlevel(int rx, int ry)
     case rn(52,54):
     {
 
-        static const short contents[] = {
+        ROOM_CONTENTS(LEVELPACK_LAB, t, 0, {
         0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
         0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
         0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
@@ -1361,7 +1368,7 @@ const short* labclass::loadlevel(int rx, int ry)
         0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
         0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
         0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-        };
+        });
 
         obj.createentity(-8, 60, 11, 336);  // (horizontal gravity line)
         obj.createentity(-8, 172, 11, 336);  // (horizontal gravity line)
@@ -1379,7 +1386,7 @@ const short* labclass::loadlevel(int rx, int ry)
     case rn(51,54):
     {
 
-        static const short contents[] = {
+        ROOM_CONTENTS(LEVELPACK_LAB, t, 0, {
         0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
         0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
         0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
@@ -1410,7 +1417,7 @@ const short* labclass::loadlevel(int rx, int ry)
         0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
         0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
         0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-        };
+        });
 
         obj.createentity(176, 60, 11, 152);  // (horizontal gravity line)
         obj.createentity(176, 172, 11, 152);  // (horizontal gravity line)
@@ -1428,7 +1435,7 @@ const short* labclass::loadlevel(int rx, int ry)
     case rn(50,54):
     {
 
-        static const short contents[] = {
+        ROOM_CONTENTS(LEVELPACK_LAB, t, 0, {
         0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
         0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
         0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
@@ -1459,7 +1466,7 @@ const short* labclass::loadlevel(int rx, int ry)
         0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
         0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
         0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-        };
+        });
 
         obj.createentity(-8, 84, 11, 336);  // (horizontal gravity line)
         obj.createentity(-8, 148, 11, 336);  // (horizontal gravity line)
@@ -1478,7 +1485,7 @@ const short* labclass::loadlevel(int rx, int ry)
     case rn(49,54):
     {
 
-        static const short contents[] = {
+        ROOM_CONTENTS(LEVELPACK_LAB, t, 0, {
         286,286,286,286,286,408,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
         286,286,286,286,287,448,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,310,352,368,0,0,0,0,0,0,0,
         286,286,286,286,408,55,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,56,406,408,0,0,0,0,0,0,0,
@@ -1509,7 +1516,7 @@ const short* labclass::loadlevel(int rx, int ry)
         286,286,286,286,408,55,0,0,0,0,0,0,56,430,55,0,0,0,0,0,0,56,430,55,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
         286,286,286,286,408,55,0,0,0,0,0,0,56,430,55,0,0,0,0,0,0,56,430,55,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
         286,286,286,286,408,55,0,0,0,0,0,0,56,430,55,0,0,0,0,0,0,56,430,55,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-        };
+        });
 
         obj.createentity(264, 84, 11, 64);  // (horizontal gravity line)
         obj.createentity(240+4, 96, 10, 0, 254490);  // (savepoint)
@@ -1526,7 +1533,7 @@ const short* labclass::loadlevel(int rx, int ry)
     case rn(49,55):
     {
 
-        static const short contents[] = {
+        ROOM_CONTENTS(LEVELPACK_LAB, t, 0, {
         292,292,292,292,414,59,0,0,0,0,0,0,60,427,59,0,0,0,0,0,0,60,427,59,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
         292,292,292,292,414,59,0,0,0,0,0,0,60,427,59,0,0,0,0,0,0,60,427,59,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
         292,292,292,292,414,59,0,0,0,0,0,0,60,427,59,0,0,0,0,0,0,60,427,59,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
@@ -1557,7 +1564,7 @@ const short* labclass::loadlevel(int rx, int ry)
         292,292,292,292,292,292,292,292,292,292,292,292,292,292,292,292,292,292,292,292,292,292,292,292,292,292,292,292,292,292,292,292,292,292,292,292,292,292,292,292,
         292,292,292,292,292,292,292,292,292,292,292,292,292,292,292,292,292,292,292,292,292,292,292,292,292,292,292,292,292,292,292,292,292,292,292,292,292,292,292,292,
         292,292,292,292,292,292,292,292,292,292,292,292,292,292,292,292,292,292,292,292,292,292,292,292,292,292,292,292,292,292,292,292,292,292,292,292,292,292,292,292,
-        };
+        });
 
         obj.createentity(48, 156, 11, 200);  // (horizontal gravity line)
         obj.createentity(216, 56, 10, 0, 255490);  // (savepoint)
@@ -1571,7 +1578,7 @@ const short* labclass::loadlevel(int rx, int ry)
     case rn(50,55):
     {
 
-        static const short contents[] = {
+        ROOM_CONTENTS(LEVELPACK_LAB, t, 0, {
         0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
         0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
         0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
@@ -1602,7 +1609,7 @@ const short* labclass::loadlevel(int rx, int ry)
         283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,
         283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,
         283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,
-        };
+        });
 
         obj.createentity(131, 48, 12, 152);  // (vertical gravity line)
         obj.createentity(179, 48, 12, 152);  // (vertical gravity line)
@@ -1618,7 +1625,7 @@ const short* labclass::loadlevel(int rx, int ry)
     case rn(51,55):
     {
 
-        static const short contents[] = {
+        ROOM_CONTENTS(LEVELPACK_LAB, t, 0, {
         0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
         0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
         0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
@@ -1649,7 +1656,7 @@ const short* labclass::loadlevel(int rx, int ry)
         295,295,295,295,295,295,295,295,295,295,295,295,295,295,295,295,295,295,295,295,295,295,295,295,295,295,295,295,295,295,295,295,295,295,295,295,295,295,295,295,
         295,295,295,295,295,295,295,295,295,295,295,295,295,295,295,295,295,295,295,295,295,295,295,295,295,295,295,295,295,295,295,295,295,295,295,295,295,295,295,295,
         295,295,295,295,295,295,295,295,295,295,295,295,295,295,295,295,295,295,295,295,295,295,295,295,295,295,295,295,295,295,295,295,295,295,295,295,295,295,295,295,
-        };
+        });
 
         obj.createentity(91, 168, 12, 32);  // (vertical gravity line)
         obj.createentity(139, 80, 12, 120);  // (vertical gravity line)
@@ -1672,7 +1679,7 @@ const short* labclass::loadlevel(int rx, int ry)
     case rn(52,55):
     {
 
-        static const short contents[] = {
+        ROOM_CONTENTS(LEVELPACK_LAB, t, 0, {
         0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
         0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
         0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
@@ -1703,7 +1710,7 @@ const short* labclass::loadlevel(int rx, int ry)
         280,280,280,280,280,280,280,280,280,280,280,280,280,280,280,280,402,51,0,0,0,0,0,52,400,280,280,280,280,280,280,280,280,280,280,280,280,280,280,280,
         280,280,280,280,280,280,280,280,280,280,280,280,280,280,280,280,402,51,0,0,0,0,0,52,400,280,280,280,280,280,280,280,280,280,280,280,280,280,280,280,
         280,280,280,280,280,280,280,280,280,280,280,280,280,280,280,280,402,51,0,0,0,0,0,52,400,280,280,280,280,280,280,280,280,280,280,280,280,280,280,280,
-        };
+        });
 
         obj.createentity(16, 184, 10, 1, 255520);  // (savepoint)
         obj.createentity(131, 88, 12, 96);  // (vertical gravity line)
@@ -1720,7 +1727,7 @@ const short* labclass::loadlevel(int rx, int ry)
     case rn(52,56):
     {
 
-        static const short contents[] = {
+        ROOM_CONTENTS(LEVELPACK_LAB, t, 0, {
         289,289,289,289,289,289,289,289,289,289,289,289,289,289,289,289,411,57,0,0,0,0,0,58,409,289,289,289,289,289,289,289,289,289,289,289,289,289,289,289,
         289,289,289,289,289,289,289,289,289,289,289,289,289,289,289,289,411,57,0,0,0,0,0,58,409,289,289,289,289,289,289,289,289,289,289,289,289,289,289,289,
         289,289,289,289,289,289,289,289,289,289,289,289,289,289,289,289,411,57,0,0,0,0,0,58,409,289,289,289,289,289,289,289,289,289,289,289,289,289,289,289,
@@ -1751,7 +1758,7 @@ const short* labclass::loadlevel(int rx, int ry)
         289,289,289,289,289,289,289,289,289,289,289,289,289,289,289,289,411,57,0,0,0,0,0,58,409,289,289,289,289,289,289,289,289,289,289,289,289,289,289,289,
         289,289,289,289,289,289,289,289,289,289,289,289,289,289,289,289,411,57,0,0,0,0,0,58,409,289,289,289,289,289,289,289,289,289,289,289,289,289,289,289,
         289,289,289,289,289,289,289,289,289,289,289,289,289,289,289,289,411,57,0,0,0,0,0,58,409,289,289,289,289,289,289,289,289,289,289,289,289,289,289,289,
-        };
+        });
         rcol=3;
 
         roomname = "AAAAAA";
@@ -1762,7 +1769,7 @@ const short* labclass::loadlevel(int rx, int ry)
     case rn(52,57):
     {
 
-        static const short contents[] = {
+        ROOM_CONTENTS(LEVELPACK_LAB, t, 0, {
         286,286,286,286,286,286,286,286,286,286,286,286,286,286,286,286,408,55,0,0,0,0,0,56,406,286,286,286,286,286,286,286,286,286,286,286,286,286,286,286,
         286,286,286,286,286,286,286,286,286,286,286,286,286,286,286,286,408,55,0,0,0,0,0,56,406,286,286,286,286,286,286,286,286,286,286,286,286,286,286,286,
         286,286,286,286,286,286,287,447,447,447,288,286,286,286,286,286,408,55,0,0,0,0,0,56,406,286,286,286,286,286,287,447,447,447,288,286,286,286,286,286,
@@ -1793,7 +1800,7 @@ const short* labclass::loadlevel(int rx, int ry)
         286,286,286,286,286,286,286,286,286,286,286,286,286,286,286,286,286,408,0,0,0,0,0,406,286,286,286,286,286,286,286,286,286,286,286,286,286,286,286,286,
         286,286,286,286,286,286,286,286,286,286,286,286,286,286,286,286,286,408,0,0,0,0,0,406,286,286,286,286,286,286,286,286,286,286,286,286,286,286,286,286,
         286,286,286,286,286,286,286,286,286,286,286,286,286,286,286,286,286,408,0,0,0,0,0,406,286,286,286,286,286,286,286,286,286,286,286,286,286,286,286,286,
-        };
+        });
         rcol = 2;
 
         roomname = "Diode";
@@ -1805,7 +1812,7 @@ const short* labclass::loadlevel(int rx, int ry)
     case rn(50,52):
     {
 
-        static const short contents[] = {
+        ROOM_CONTENTS(LEVELPACK_LAB, t, 0, {
         280,280,280,280,280,280,280,280,280,280,280,280,280,280,280,280,280,280,280,280,280,280,280,280,280,280,280,280,280,280,280,280,280,280,280,280,280,280,280,280,
         281,441,441,441,441,282,281,441,441,441,441,441,441,441,441,441,441,441,441,441,441,441,441,441,441,441,441,441,441,441,441,441,441,441,441,441,441,282,280,280,
         402,0,0,0,0,400,402,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,440,282,280,
@@ -1836,7 +1843,7 @@ const short* labclass::loadlevel(int rx, int ry)
         280,280,280,280,280,280,280,280,402,0,0,0,0,0,400,280,280,280,280,280,280,280,280,280,280,280,280,280,280,280,280,280,280,280,280,280,280,280,280,280,
         280,280,280,280,280,280,280,280,402,0,0,0,0,0,400,280,280,280,280,280,280,280,280,280,280,280,280,280,280,280,280,280,280,280,280,280,280,280,280,280,
         280,280,280,280,280,280,280,280,402,0,0,0,0,0,400,280,280,280,280,280,280,280,280,280,280,280,280,280,280,280,280,280,280,280,280,280,280,280,280,280,
-        };
+        });
 
         obj.createentity(267, 24, 12, 184);  // (vertical gravity line)
         obj.createentity(16, 24, 9,  9);  // (shiny trinket)
@@ -1855,7 +1862,7 @@ const short* labclass::loadlevel(int rx, int ry)
     case rn(53,55):
     {
 
-        static const short contents[] = {
+        ROOM_CONTENTS(LEVELPACK_LAB, t, 0, {
         0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
         0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
         0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
@@ -1886,7 +1893,7 @@ const short* labclass::loadlevel(int rx, int ry)
         292,292,292,414,400,280,280,280,280,280,402,409,289,289,289,289,289,289,289,411,375,376,376,376,376,337,295,295,295,295,295,295,295,295,295,295,295,295,295,295,
         292,292,292,414,400,280,280,280,280,280,402,409,289,289,289,289,289,289,289,411,415,295,295,295,295,295,295,295,295,295,295,295,295,295,295,295,295,295,295,295,
         292,292,292,414,400,280,280,280,280,280,402,409,289,289,289,289,289,289,289,411,415,295,295,295,295,295,295,295,295,295,295,295,295,295,295,295,295,295,295,295,
-        };
+        });
 
         rcol = 6;
 
@@ -1898,7 +1905,7 @@ const short* labclass::loadlevel(int rx, int ry)
     case rn(54,55):
     {
 
-        static const short contents[] = {
+        ROOM_CONTENTS(LEVELPACK_LAB, t, 0, {
         0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,415,295,295,295,295,295,295,295,295,417,412,292,
         0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,415,295,295,295,295,295,295,295,295,417,412,292,
         0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,415,295,295,295,295,295,295,296,456,457,412,292,
@@ -1929,7 +1936,7 @@ const short* labclass::loadlevel(int rx, int ry)
         289,289,289,289,289,330,371,446,447,288,286,327,367,367,367,367,328,286,287,447,448,369,331,289,289,289,289,289,289,289,289,289,289,289,289,289,289,330,370,370,
         289,289,289,289,289,289,330,370,371,406,286,286,286,286,286,286,286,286,408,369,370,331,289,289,289,289,289,289,289,289,289,289,289,289,289,289,289,289,289,289,
         289,289,289,289,289,289,289,289,411,406,286,286,286,286,286,286,286,286,408,409,289,289,289,289,289,289,289,289,289,289,289,289,289,289,289,289,289,289,289,289,
-        };
+        });
 
         obj.createentity(104, 128, 9, 11);  // (shiny trinket)
         rcol = 6;
@@ -1943,7 +1950,7 @@ const short* labclass::loadlevel(int rx, int ry)
     case rn(52,58):
     {
 
-        static const short contents[] = {
+        ROOM_CONTENTS(LEVELPACK_LAB, t, 0, {
         295,295,295,295,295,417,0,415,295,295,295,295,295,295,295,295,295,417,0,0,0,0,0,415,295,295,295,295,295,295,295,295,295,295,295,295,295,295,295,295,
         295,295,295,295,295,417,0,415,295,295,295,295,295,295,295,295,295,417,0,0,0,0,0,415,295,295,295,295,295,295,295,295,295,295,295,295,295,295,295,295,
         295,295,295,295,295,417,0,415,295,295,295,295,295,295,295,295,295,417,0,0,0,0,0,415,295,295,295,295,295,295,295,295,295,295,295,295,295,295,295,295,
@@ -1974,7 +1981,7 @@ const short* labclass::loadlevel(int rx, int ry)
         295,295,295,295,295,417,0,415,295,295,417,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,415,295,295,295,295,
         295,295,295,295,295,417,0,415,295,295,336,376,376,376,376,376,376,376,376,376,376,376,376,376,376,376,376,376,376,376,376,376,376,376,376,337,295,295,295,295,
         295,295,295,295,295,417,0,415,295,295,295,295,295,295,295,295,295,295,295,295,295,295,295,295,295,295,295,295,295,295,295,295,295,295,295,295,295,295,295,295,
-        };
+        });
 
         obj.createentity(112, 184, 10, 1, 258520);  // (savepoint)
         rcol = 5;
@@ -1987,7 +1994,7 @@ const short* labclass::loadlevel(int rx, int ry)
     case rn(51,58):
     {
 
-        static const short contents[] = {
+        ROOM_CONTENTS(LEVELPACK_LAB, t, 0, {
         280,280,280,280,280,280,280,280,280,280,280,280,280,280,280,280,280,280,280,280,280,280,280,280,280,280,280,280,280,280,280,280,280,280,280,280,280,280,280,280,
         280,280,280,280,280,280,280,280,280,280,280,280,280,280,280,280,280,280,280,280,280,280,280,280,280,280,280,280,280,280,280,280,280,280,280,280,280,280,280,280,
         280,280,280,280,280,280,280,280,280,280,280,280,280,280,280,280,280,280,280,280,280,280,280,280,280,280,280,280,280,280,280,280,280,280,280,280,280,280,280,280,
@@ -2018,7 +2025,7 @@ const short* labclass::loadlevel(int rx, int ry)
         280,280,280,280,280,280,280,280,280,280,280,280,280,280,280,280,280,280,280,280,280,280,280,280,280,280,280,280,280,280,280,280,280,280,280,280,280,280,280,280,
         280,280,280,280,280,280,280,280,280,280,280,280,280,280,280,280,280,280,280,280,280,280,280,280,280,280,280,280,280,280,280,280,280,280,280,280,280,280,280,280,
         280,280,280,280,280,280,280,280,280,280,280,280,280,280,280,280,280,280,280,280,280,280,280,280,280,280,280,280,280,280,280,280,280,280,280,280,280,280,280,280,
-        };
+        });
         rcol=0;
 
         if(!game.intimetrial)
@@ -2039,7 +2046,7 @@ const short* labclass::loadlevel(int rx, int ry)
     case rn(50,58):
     {
 
-        static const short contents[] = {
+        ROOM_CONTENTS(LEVELPACK_LAB, t, 0, {
         289,289,289,289,289,289,289,289,289,289,289,289,289,289,289,289,289,289,289,289,289,289,289,289,289,289,289,289,289,289,289,289,289,289,289,289,289,289,289,289,
         289,289,289,289,289,289,289,289,289,289,289,289,289,289,289,289,289,289,289,289,289,289,289,289,289,289,289,289,289,289,289,289,289,289,289,289,289,289,289,289,
         289,289,289,289,289,289,289,289,289,289,289,289,289,289,289,289,289,289,289,289,289,289,289,289,289,289,289,289,289,289,289,289,289,289,289,289,289,289,289,289,
@@ -2070,7 +2077,7 @@ const short* labclass::loadlevel(int rx, int ry)
         289,289,289,289,289,289,289,289,289,289,289,289,289,289,289,289,289,289,289,289,289,289,289,289,289,289,289,289,289,289,289,289,289,289,289,289,289,289,289,289,
         289,289,289,289,289,289,289,289,289,289,289,289,289,289,289,289,289,289,289,289,289,289,289,289,289,289,289,289,289,289,289,289,289,289,289,289,289,289,289,289,
         289,289,289,289,289,289,289,289,289,289,289,289,289,289,289,289,289,289,289,289,289,289,289,289,289,289,289,289,289,289,289,289,289,289,289,289,289,289,289,289,
-        };
+        });
         rcol=3;
 
 
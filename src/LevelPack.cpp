@@ -0,0 +1,284 @@
+#include "LevelPack.h"
+
+#include <SDL2/SDL.h>
+
+#include "Exit.h"
+#include "FileSystemUtils.h"
+#include "RAM.h"
+#include "Vlogging.h"
+
+static const char levelpack_magic[5] = {'V', '4', 'L', 'V', 'L'};
+static const uint8_t levelpack_version = 1;
+
+/* magic, version, count */
+static const size_t levelpack_header_size = 8;
+
+levelpackclass::levelpackclass(void)
+{
+    filename[0] = '\0';
+    entries = NULL;
+    num_entries = 0;
+    clock = 0;
+    SDL_zeroa(cache);
+    hits = 0;
+    misses = 0;
+}
+
+void levelpackclass::clear(void)
+{
+    RAM_free(entries);
+    entries = NULL;
+    num_entries = 0;
+    clock = 0;
+    SDL_zeroa(cache);
+}
+
+bool levelpackclass::load(const char* _filename)
+{
+    unsigned char header[levelpack_header_size];
+    uint16_t count;
+    size_t index_size;
+
+    clear();
+
+    if (!FILESYSTEM_loadAssetRange(_filename, 0, header, sizeof(header)))
+    {
+        vlog_error("Unable to read level pack %s", _filename);
+        return false;
+    }
+
+    if (SDL_memcmp(header, levelpack_magic, sizeof(levelpack_magic)) != 0
+    || header[5] != levelpack_version)
+    {
+        vlog_error("%s is not a version %i level pack", _filename, levelpack_version);
+        return false;
+    }
+
+    SDL_memcpy(&count, &header[6], sizeof(count));
+    count = SDL_SwapLE16(count);
+
+    /* Only the index stays resident, the rooms are paged in on demand */
+    index_size = count * sizeof(levelpackentry);
+    entries = (levelpackentry*) RAM_mallocTagged(index_size, RAM_TAG_LEVEL);
+    if (entries == NULL)
+    {
+        VVV_exit(1);
+    }
+
+    if (!FILESYSTEM_loadAssetRange(_filename, sizeof(header), entries, index_size))
+    {
+        vlog_error("Unable to read the index of level pack %s", _filename);
+        clear();
+        return false;
+    }
+
+    for (size_t i = 0; i < count; ++i)
+    {
+        levelpackentry* entry = &entries[i];
+        entry->room = SDL_SwapLE16(entry->room);
+        entry->cells = SDL_SwapLE32(entry->cells);
+        entry->offset = SDL_SwapLE32(entry->offset);
+        entry->size = SDL_SwapLE32(entry->size);
+    }
+
+    num_entries = count;
+    SDL_strlcpy(filename, _filename, sizeof(filename));
+
+    vlog_info("Level pack %s: %i entries, %u bytes of index",
+        filename,
+        num_entries,
+        (unsigned int) index_size
+    );
+    return true;
+}
+
+const levelpackentry* levelpackclass::findentry(int area, int room, int variant)
+{
+    int lo = 0;
+    int hi = num_entries - 1;
+
+    while (lo <= hi)
+    {
+        const int mid = (lo + hi) / 2;
+        const levelpackentry* entry = &entries[mid];
+        int cmp = (int) entry->area - area;
+        if (cmp == 0)
+        {
+            cmp = (int) entry->room - room;
+        }
+        if (cmp == 0)
+        {
+            cmp = (int) entry->variant - variant;
+        }
+
+        if (cmp == 0)
+        {
+            return entry;
+        }
+        else if (cmp < 0)
+        {
+            lo = mid + 1;
+        }
+        else
+        {
+            hi = mid - 1;
+        }
+    }
+
+    return NULL;
+}
+
+bool levelpackclass::loadtiles(int area, int room, int variant, short* dest, size_t cells)
+{
+    const levelpackentry* entry = findentry(area, room, variant);
+    unsigned char* payload;
+    size_t written = 0;
+    bool success;
+
+    if (entry == NULL || entry->cells != cells)
+    {
+        vlog_error("Level pack has no room %i/%i/%i of %u tiles",
+            area, room, variant,
+            (unsigned int) cells
+        );
+        SDL_memset(dest, 0, cells * sizeof(short));
+        return false;
+    }
+
+    payload = (unsigned char*) RAM_mallocTagged(entry->size, RAM_TAG_LEVEL);
+    if (payload == NULL)
+    {
+        VVV_exit(1);
+    }
+
+    success = FILESYSTEM_loadAssetRange(filename, entry->offset, payload, entry->size);
+
+    for (size_t i = 0; success && i + 4 <= entry->size; i += 4)
+    {
+        uint16_t run;
+        int16_t tile;
+        SDL_memcpy(&run, &payload[i], sizeof(run));
+        SDL_memcpy(&tile, &payload[i + 2], sizeof(tile));
+        run = SDL_SwapLE16(run);
+        tile = SDL_SwapLE16(tile);
+
+        if (written + run > cells)
+        {
+            success = false;
+            break;
+        }
+
+        for (uint16_t j = 0; j < run; ++j)
+        {
+            dest[written++] = tile;
+        }
+    }
+
+    RAM_free(payload);
+
+    if (!success || written != cells)
+    {
+        vlog_error("Level pack room %i/%i/%i is corrupt", area, room, variant);
+        SDL_memset(dest, 0, cells * sizeof(short));
+        return false;
+    }
+
+    return true;
+}
+
+bool levelpackclass::loadtiles(int area, int room, int variant, tilestoreclass& dest)
+{
+    const size_t cells = dest.numcells();
+    short* tiles = (short*) RAM_mallocTagged(cells * sizeof(short), RAM_TAG_LEVEL);
+    bool success;
+
+    if (tiles == NULL)
+    {
+        VVV_exit(1);
+    }
+
+    success = loadtiles(area, room, variant, tiles, cells);
+    dest.load(tiles, cells);
+
+    RAM_free(tiles);
+    return success;
+}
+
+levelpackclass::cachedroom* levelpackclass::getcached(const levelpackentry* entry)
+{
+    if (entry == NULL)
+    {
+        return NULL;
+    }
+
+    for (int i = 0; i < cache_size; ++i)
+    {
+        if (cache[i].entry == entry)
+        {
+            return &cache[i];
+        }
+    }
+
+    return NULL;
+}
+
+levelpackclass::cachedroom* levelpackclass::fillcache(int area, int room, int variant, const levelpackentry* entry)
+{
+    cachedroom* slot = &cache[0];
+
+    /* Evict the least recently used room */
+    for (int i = 1; i < cache_size; ++i)
+    {
+        if (cache[i].lastused < slot->lastused)
+        {
+            slot = &cache[i];
+        }
+    }
+
+    slot->entry = NULL;
+    slot->lastused = clock;
+    if (loadtiles(area, room, variant, slot->tiles, room_cells))
+    {
+        slot->entry = entry;
+    }
+
+    return slot;
+}
+
+const short* levelpackclass::loadroom(int area, int room, int variant)
+{
+    const levelpackentry* entry = findentry(area, room, variant);
+    cachedroom* slot = getcached(entry);
+
+    ++clock;
+
+    if (slot != NULL)
+    {
+        ++hits;
+        slot->lastused = clock;
+        return slot->tiles;
+    }
+
+    ++misses;
+    return fillcache(area, room, variant, entry)->tiles;
+}
+
+void levelpackclass::prefetch(int area, int room)
+{
+    /* Which variant gets loaded depends on game state, so get all of them */
+    for (int variant = 0; ; ++variant)
+    {
+        const levelpackentry* entry = findentry(area, room, variant);
+
+        if (entry == NULL)
+        {
+            break;
+        }
+
+        if (getcached(entry) == NULL)
+        {
+            ++clock;
+            fillcache(area, room, variant, entry);
+        }
+    }
+}
@@ -0,0 +1,111 @@
+#ifndef LEVELPACK_H
+#define LEVELPACK_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include "TileStore.h"
+
+/* The level pack (levels.vvp) holds the tile data of every main game room,
+ * generated from the level sources by scripts/pack_levels.py. Room names,
+ * entities and everything else that depends on game state stay compiled in.
+ *
+ * File layout (little endian):
+ *   char     magic[5]     "V4LVL"
+ *   uint8_t  version
+ *   uint16_t count
+ *   levelpackentry entries[count], sorted by (area, room, variant)
+ *   RLE payloads, each a list of (uint16_t run, int16_t tile) pairs
+ */
+
+enum LevelPackArea
+{
+    LEVELPACK_OTHERLEVEL = 0,
+    LEVELPACK_LAB = 1,
+    LEVELPACK_WARP = 2,
+    LEVELPACK_SPACESTATION2 = 3,
+    LEVELPACK_FINAL = 4,
+    LEVELPACK_TOWER = 5
+};
+
+/* Rooms of LEVELPACK_TOWER */
+enum
+{
+    LEVELPACK_TOWER_MAP = 0,
+    LEVELPACK_TOWER_BACKGROUND = 1,
+    LEVELPACK_TOWER_MINITOWER1 = 2,
+    LEVELPACK_TOWER_MINITOWER2 = 3
+};
+
+#ifdef LEVEL_PACK
+# define ROOM_CONTENTS(area, room, variant, ...) \
+    const short* contents = map.levelpack.loadroom(area, room, variant)
+# define TOWER_CONTENTS(block, dest, ...) \
+    map.levelpack.loadtiles(LEVELPACK_TOWER, block, 0, dest)
+#else
+# define ROOM_CONTENTS(area, room, variant, ...) \
+    static const short contents[] = __VA_ARGS__
+# define TOWER_CONTENTS(block, dest, ...) \
+    static const short tmap[] = __VA_ARGS__; \
+    dest.load(tmap, SDL_arraysize(tmap))
+#endif
+
+struct levelpackentry
+{
+    uint8_t area;
+    uint8_t variant;
+    uint16_t room;
+    uint32_t cells;
+    uint32_t offset;
+    uint32_t size;
+};
+
+class levelpackclass
+{
+public:
+    levelpackclass(void);
+
+    bool load(const char* filename);
+
+    void clear(void);
+
+    const short* loadroom(int area, int room, int variant);
+
+    void prefetch(int area, int room);
+
+    bool loadtiles(int area, int room, int variant, short* dest, size_t cells);
+    bool loadtiles(int area, int room, int variant, tilestoreclass& dest);
+
+    static const int room_cells = 40 * 30;
+    /* Room on screen, its four neighbours and the respawn room, plus some
+     * slack for rooms with several variants */
+    static const int cache_size = 8;
+
+    /* How many loadroom() calls were already decoded (by an earlier visit
+     * or by prefetch()), for the room transition stats */
+    uint32_t hits;
+    uint32_t misses;
+
+private:
+    const levelpackentry* findentry(int area, int room, int variant);
+
+    struct cachedroom;
+    cachedroom* getcached(const levelpackentry* entry);
+    cachedroom* fillcache(int area, int room, int variant, const levelpackentry* entry);
+
+    char filename[64];
+    levelpackentry* entries;
+    int num_entries;
+
+    /* Small LRU of decoded rooms, most rooms get loaded more than once */
+    struct cachedroom
+    {
+        const levelpackentry* entry;
+        uint32_t lastused;
+        short tiles[room_cells];
+    };
+    cachedroom cache[cache_size];
+    uint32_t clock;
+};
+
+#endif /* LEVELPACK_H */
@@ -10,6 +10,7 @@
 #include "Network.h"
 #include "Script.h"
 #include "UtilityClass.h"
+#include "Xoshiro.h"
 
 void titlelogic(void)
 {
@@ -62,6 +63,8 @@ void gamecompletelogic(void)
     {
         game.creditposition = -Credits::creditmaxposition;
         graphics.titlebg.bscroll = 0;
+        /* The ending picture comes up next */
+        graphics.grphx.prefetchimage(10);
     }
     else if (!game.press_action)
     {
@@ -502,7 +505,7 @@ void gamelogic(void)
                         if (map.final_colorframe == 1)
                         {
                             map.final_colorframedelay = 40;
-                            int temp = 1+int(fRandom() * 6);
+                            int temp = 1+int(xoshiro_logicrand() * 6);
                             if (temp == map.final_mapcol) temp = (temp + 1) % 6;
                             if (temp == 0) temp = 6;
                             map.changefinalcol(temp);
@@ -510,7 +513,7 @@ void gamelogic(void)
                         else if (map.final_colorframe == 2)
                         {
                             map.final_colorframedelay = 15;
-                            int temp = 1+int(fRandom() * 6);
+                            int temp = 1+int(xoshiro_logicrand() * 6);
                             if (temp == map.final_mapcol) temp = (temp + 1) % 6;
                             if (temp == 0) temp = 6;
                             map.changefinalcol(temp);
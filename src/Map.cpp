@@ -11,6 +11,7 @@
 #include "Music.h"
 #include "Script.h"
 #include "UtilityClass.h"
+#include "Vlogging.h"
 
 mapclass::mapclass(void)
 {
@@ -59,7 +60,17 @@ mapclass::mapclass(void)
     invincibility = false;
 
     //We create a blank map
-    SDL_memset(contents, 0, sizeof(contents));
+    for (int i = 0; i < num_readyrooms; i++)
+    {
+        readyrooms[i].rx = 0;
+        readyrooms[i].ry = 0;
+        readyrooms[i].tileset = 0;
+        readyrooms[i].ready = false;
+        readyrooms[i].wanted = i == 0;
+        SDL_memset(readyrooms[i].contents, 0, sizeof(readyrooms[i].contents));
+    }
+    liveroom = &readyrooms[0];
+    contents = liveroom->contents;
 
     SDL_memset(roomdeaths, 0, sizeof(roomdeaths));
     SDL_memset(roomdeathsfinal, 0, sizeof(roomdeathsfinal));
@@ -83,6 +94,11 @@ mapclass::mapclass(void)
 
     roomname = "";
     hiddenname = "";
+
+    prefetchcount = 0;
+    roomswaps = 0;
+    SDL_zeroa(roomlatency);
+    roomtransitions = 0;
 }
 
 //Areamap starts at 100,100 and extends 20x20
@@ -134,6 +150,9 @@ void mapclass::resetmap(void)
 {
     //clear the explored area of the map
     SDL_memset(explored, 0, sizeof(explored));
+
+    //A new game, maybe of a different level
+    clearreadyrooms();
 }
 
 void mapclass::resetnames(void)
@@ -735,6 +754,7 @@ void mapclass::settile(int xp, int yp, int t)
     if (xp >= 0 && xp < 40 && yp >= 0 && yp < 29+extrarow)
     {
         contents[TILE_IDX(xp, yp)] = t;
+        obj.invalidatecontacts();
     }
 }
 
@@ -913,9 +933,23 @@ void mapclass::gotoroom(int rx, int ry)
 {
     int roomchangedir;
     std::vector<entclass> linecrosskludge;
+    const Uint64 start = SDL_GetPerformanceCounter();
+
+    if (obj.contactprobes > 0)
+    {
+        vlog_debug(
+            "Contact cache: %u of %u floor/roof probes reused",
+            (unsigned int) obj.contacthits,
+            (unsigned int) obj.contactprobes
+        );
+        obj.contactprobes = 0;
+        obj.contacthits = 0;
+    }
 
     //First, destroy the current room
     obj.removeallblocks();
+    roomvector<Roomtext>().swap(roomtext);
+    roomarena.reset();
     game.activetele = false;
     game.readytotele = 0;
     game.oldreadytotele = 0;
@@ -1105,6 +1139,374 @@ void mapclass::gotoroom(int rx, int ry)
         //We've changed room? Let's bring our companion along!
         spawncompanion();
     }
+
+    addroomlatency((int) ((SDL_GetPerformanceCounter() - start) * 1000000 / SDL_GetPerformanceFrequency()));
+
+    prefetchneighbours();
+}
+
+void mapclass::addroomlatency(int us)
+{
+    int bucket = 0;
+    while (bucket < num_roomlatency - 1 && us >= (250 << bucket))
+    {
+        bucket++;
+    }
+    roomlatency[bucket]++;
+    roomtransitions++;
+
+    if (roomtransitions % 64 == 0)
+    {
+        char buffer[256];
+        size_t len = 0;
+        for (int i = 0; i < num_roomlatency; i++)
+        {
+            if (i < num_roomlatency - 1)
+            {
+                len += SDL_snprintf(&buffer[len], sizeof(buffer) - len, " <%ius: %i", 250 << i, roomlatency[i]);
+            }
+            else
+            {
+                len += SDL_snprintf(&buffer[len], sizeof(buffer) - len, " more: %i", roomlatency[i]);
+            }
+        }
+
+        vlog_debug(
+            "Room transitions:%s (%i swapped in ready, level pack: %u cached, %u loaded)",
+            buffer,
+            roomswaps,
+            (unsigned int) levelpack.hits,
+            (unsigned int) levelpack.misses
+        );
+    }
+}
+
+void mapclass::prefetchneighbours(void)
+{
+    static const int dirs[4][2] = {{0, 1}, {0, -1}, {1, 0}, {-1, 0}};
+
+    prefetchcount = 0;
+    for (int i = 0; i < num_readyrooms; i++)
+    {
+        readyrooms[i].wanted = &readyrooms[i] == liveroom;
+    }
+
+    //Towers are loaded in one go, there's nothing next to them worth fetching
+    if (towermode)
+    {
+        return;
+    }
+
+    //Fetched last, the room we respawn in after dying
+    if (game.saverx != game.roomx || game.savery != game.roomy)
+    {
+        prefetchqueue[prefetchcount].x = game.saverx;
+        prefetchqueue[prefetchcount].y = game.savery;
+        prefetchcount++;
+    }
+
+    for (size_t i = 0; i < SDL_arraysize(dirs); i++)
+    {
+        int rx = game.roomx + dirs[i][0];
+        int ry = game.roomy + dirs[i][1];
+
+        //Wrap around the same way gotoroom() does
+        if (finalmode)
+        {
+            if (ry < 10) ry = 11;
+        }
+#if !defined(NO_CUSTOM_LEVELS)
+        else if (custommode)
+        {
+            if (rx < 100) rx = 100 + cl.mapwidth-1;
+            if (ry < 100) ry = 100 + cl.mapheight-1;
+            if (rx > 100 + cl.mapwidth-1) rx = 100;
+            if (ry > 100 + cl.mapheight-1) ry = 100;
+        }
+#endif
+        else
+        {
+            if (rx < 100) rx = 119;
+            if (ry < 100) ry = 119;
+            if (rx > 119) rx = 100;
+            if (ry > 119) ry = 100;
+        }
+
+        if (rx == game.roomx && ry == game.roomy)
+        {
+            continue;
+        }
+
+        prefetchqueue[prefetchcount].x = rx;
+        prefetchqueue[prefetchcount].y = ry;
+        prefetchcount++;
+    }
+
+    //Rooms still ready from before don't need getting ready again
+    for (int i = prefetchcount - 1; i >= 0; i--)
+    {
+        readyroom* room = findreadyroom(prefetchqueue[i].x, prefetchqueue[i].y);
+        if (room == NULL)
+        {
+            continue;
+        }
+
+        room->wanted = true;
+        prefetchcount--;
+        for (int j = i; j < prefetchcount; j++)
+        {
+            prefetchqueue[j] = prefetchqueue[j + 1];
+        }
+    }
+}
+
+/* Get one room from the queue ready. A custom level's room gets a
+ * readyroom, so loadlevel() can swap it in and only has to create its
+ * entities and blocks. Main game rooms only get their tiles decoded: which
+ * tiles, entities and name a room has is up to the level code, and depends
+ * on flags that can change before the room is entered. Returns false if
+ * there was nothing left to do. */
+bool mapclass::prefetchroom(void)
+{
+    if (prefetchcount <= 0)
+    {
+        return false;
+    }
+
+    prefetchcount--;
+    const int rx = prefetchqueue[prefetchcount].x;
+    const int ry = prefetchqueue[prefetchcount].y;
+
+#if !defined(NO_CUSTOM_LEVELS)
+    if (custommodeforreal)
+    {
+        //Not in the editor's playtests, rooms can be edited in between
+        if (findreadyroom(rx, ry) == NULL)
+        {
+            for (int i = 0; i < num_readyrooms; i++)
+            {
+                if (!readyrooms[i].wanted)
+                {
+                    getroomready(&readyrooms[i], rx, ry);
+                    break;
+                }
+            }
+        }
+        return true;
+    }
+    else if (custommode)
+    {
+        //Reading any tile decodes the whole room
+        cl.gettile(rx - 100, ry - 100, 0, 0);
+        return true;
+    }
+#endif
+
+#ifdef LEVEL_PACK
+    if (finalmode)
+    {
+        levelpack.prefetch(LEVELPACK_FINAL, finalclass::roomindex(rx, ry));
+        return true;
+    }
+
+    switch (area(rx, ry))
+    {
+    case 0:
+    case 1:
+        levelpack.prefetch(LEVELPACK_OTHERLEVEL, otherlevelclass::roomindex(rx, ry));
+        break;
+    case 2:
+        levelpack.prefetch(LEVELPACK_LAB, labclass::roomindex(rx, ry));
+        break;
+    case 4:
+        levelpack.prefetch(LEVELPACK_WARP, warpclass::roomindex(rx, ry));
+        break;
+    case 5:
+        levelpack.prefetch(LEVELPACK_SPACESTATION2, spacestation2class::roomindex(rx, ry));
+        break;
+    case 6:
+    case 11:
+        //The tower hallways are held in the final level
+        levelpack.prefetch(LEVELPACK_FINAL, finalclass::roomindex(rx, ry));
+        break;
+    }
+#endif
+
+    return true;
+}
+
+static void pushblock(std::vector<roomblock>& blocks, const bool breakable, const int t, const int x, const int y, const int w, const int h, const int trig)
+{
+    roomblock block;
+    block.breakable = breakable;
+    block.t = t;
+    block.x = x;
+    block.y = y;
+    block.w = w;
+    block.h = h;
+    block.trig = trig;
+    blocks.push_back(block);
+}
+
+readyroom* mapclass::findreadyroom(const int rx, const int ry)
+{
+    for (int i = 0; i < num_readyrooms; i++)
+    {
+        readyroom* room = &readyrooms[i];
+        if (room->ready && room->rx == rx && room->ry == ry)
+        {
+            return room;
+        }
+    }
+    return NULL;
+}
+
+/* Point contents at the room prefetchroom() got ready, if it did. Otherwise
+ * loadlevel() fills in the room that was on screen. */
+bool mapclass::swapinroom(const int rx, const int ry)
+{
+    readyroom* room = findreadyroom(rx, ry);
+
+    if (room == NULL)
+    {
+        liveroom->rx = rx;
+        liveroom->ry = ry;
+        return false;
+    }
+
+    liveroom->wanted = false;
+    //It's on screen now, settile() can change it
+    room->ready = false;
+    room->wanted = true;
+    liveroom = room;
+    contents = room->contents;
+    roomswaps++;
+    return true;
+}
+
+void mapclass::getroomready(readyroom* room, const int rx, const int ry)
+{
+#if !defined(NO_CUSTOM_LEVELS)
+    const RoomProperty* const prop = cl.getroomprop(rx - 100, ry - 100);
+
+    room->rx = rx;
+    room->ry = ry;
+    //Same as loadlevel() picks
+    room->tileset = prop->tileset == 0 ? 0 : 1;
+    SDL_memcpy(room->contents, cl.loadlevel(rx, ry), sizeof(room->contents));
+    findcustomentities(room);
+    findtileblocks(room, 30);
+    room->ready = true;
+    room->wanted = true;
+#endif
+}
+
+void mapclass::findcustomentities(readyroom* room)
+{
+    room->entities.clear();
+
+#if !defined(NO_CUSTOM_LEVELS)
+    for (size_t i = 0; i < customentities.size(); i++)
+    {
+        const CustomEntity& ent = customentities[i];
+        if (ent.x / 40 == room->rx - 100 && ent.y / 30 == room->ry - 100)
+        {
+            room->entities.push_back(i);
+        }
+    }
+#endif
+}
+
+void mapclass::clearreadyrooms(void)
+{
+    for (int i = 0; i < num_readyrooms; i++)
+    {
+        readyrooms[i].ready = false;
+    }
+    prefetchcount = 0;
+}
+
+/* Works out the damage blocks, directional blocks and breakable blocks
+ * that the room's tiles call for */
+void mapclass::findtileblocks(readyroom* room, const int rows)
+{
+    room->blocks.clear();
+
+    for (int j = 0; j < rows; j++)
+    {
+        for (int i = 0; i < 40; i++)
+        {
+            int tile = room->contents[TILE_IDX(i, j)];
+            //Damage blocks
+            if (room->tileset == 0)
+            {
+                if (tile == 6 || tile == 8)
+                {
+                    //sticking up
+                    pushblock(room->blocks, false, 2, (i * 8), (j * 8)+4, 8, 4, 0);
+                }
+                if (tile == 7 || tile == 9)
+                {
+                    //Sticking down
+                    pushblock(room->blocks, false, 2, (i * 8), (j * 8), 8, 4, 0);
+                }
+                if (tile == 49 || tile == 50)
+                {
+                    //left or right
+                    pushblock(room->blocks, false, 2, (i * 8), (j * 8)+3, 8, 2, 0);
+                }
+            }
+            else if (room->tileset == 1)
+            {
+                if ((tile >= 63 && tile <= 74) ||
+                        (tile >= 6 && tile <= 9))
+                {
+                    //sticking up) {
+                    if (tile < 10) tile++;
+                    //sticking up
+                    if(tile%2==0)
+                    {
+                        pushblock(room->blocks, false, 2, (i * 8), (j * 8), 8, 4, 0);
+                    }
+                    else
+                    {
+                        //Sticking down
+                        pushblock(room->blocks, false, 2, (i * 8), (j * 8) + 4, 8, 4, 0);
+                    }
+                    if (tile < 11) tile--;
+                }
+                if (tile >= 49 && tile <= 62)
+                {
+                    //left or right
+                    pushblock(room->blocks, false, 2, (i * 8), (j * 8)+3, 8, 2, 0);
+                }
+            }
+            else if (room->tileset == 2)
+            {
+                if (tile == 6 || tile == 8)
+                {
+                    //sticking up
+                    pushblock(room->blocks, false, 2, (i * 8), (j * 8)+4, 8, 4, 0);
+                }
+                if (tile == 7 || tile == 9)
+                {
+                    //Sticking down
+                    pushblock(room->blocks, false, 2, (i * 8), (j * 8), 8, 4, 0);
+                }
+            }
+            //Breakable blocks
+            if (tile == 10)
+            {
+                tile = 0;
+                pushblock(room->blocks, true, 0, i * 8, j * 8, 0, 0, 0);
+            }
+            //Directional blocks
+            if (tile >= 14 && tile <= 17)
+            {
+                pushblock(room->blocks, false, 3, i * 8, j * 8, 8, 8, tile-14);
+            }
+        }
+    }
 }
 
 void mapclass::spawncompanion(void)
@@ -1342,6 +1744,8 @@ static void copy_short_to_int(int* dest, const short* src, const size_t size)
 void mapclass::loadlevel(int rx, int ry)
 {
     int t;
+    const bool swapped = swapinroom(rx, ry);
+
     if (!finalmode)
     {
         setexplored(rx - 100, ry - 100, true);
@@ -1355,6 +1759,8 @@ void mapclass::loadlevel(int rx, int ry)
     roomtexton = false;
     roomtext.clear();
 
+    obj.invalidatecontacts();
+
     obj.platformtile = 0;
     obj.customplatformtile=0;
     obj.vertplatforms = false;
@@ -1490,7 +1896,7 @@ void mapclass::loadlevel(int rx, int ry)
         tileset = 1;
         extrarow = 1;
         const short* tmap = otherlevel.loadlevel(rx, ry);
-        copy_short_to_int(contents, tmap, SDL_arraysize(contents));
+        copy_short_to_int(contents, tmap, SDL_arraysize(liveroom->contents));
         roomname = otherlevel.roomname;
         hiddenname = otherlevel.hiddenname;
         tileset = otherlevel.roomtileset;
@@ -1499,7 +1905,7 @@ void mapclass::loadlevel(int rx, int ry)
     case 2: //The Lab
     {
         const short* tmap = lablevel.loadlevel(rx, ry);
-        copy_short_to_int(contents, tmap, SDL_arraysize(contents));
+        copy_short_to_int(contents, tmap, SDL_arraysize(liveroom->contents));
         roomname = lablevel.roomname;
         tileset = 1;
         background = 2;
@@ -1546,7 +1952,7 @@ void mapclass::loadlevel(int rx, int ry)
     case 4: //The Warpzone
     {
         const short* tmap = warplevel.loadlevel(rx, ry);
-        copy_short_to_int(contents, tmap, SDL_arraysize(contents));
+        copy_short_to_int(contents, tmap, SDL_arraysize(liveroom->contents));
         roomname = warplevel.roomname;
         tileset = 1;
         background = 3;
@@ -1564,7 +1970,7 @@ void mapclass::loadlevel(int rx, int ry)
     case 5: //Space station
     {
         const short* tmap = spacestation2.loadlevel(rx, ry);
-        copy_short_to_int(contents, tmap, SDL_arraysize(contents));
+        copy_short_to_int(contents, tmap, SDL_arraysize(liveroom->contents));
         roomname = spacestation2.roomname;
         tileset = 0;
         break;
@@ -1572,7 +1978,7 @@ void mapclass::loadlevel(int rx, int ry)
     case 6: //final level
     {
         const short* tmap = finallevel.loadlevel(rx, ry);
-        copy_short_to_int(contents, tmap, SDL_arraysize(contents));
+        copy_short_to_int(contents, tmap, SDL_arraysize(liveroom->contents));
         roomname = finallevel.roomname;
         tileset = 1;
         background = 3;
@@ -1731,7 +2137,7 @@ void mapclass::loadlevel(int rx, int ry)
     case 11: //Tower Hallways //Content is held in final level routine
     {
         const short* tmap = finallevel.loadlevel(rx, ry);
-        copy_short_to_int(contents, tmap, SDL_arraysize(contents));
+        copy_short_to_int(contents, tmap, SDL_arraysize(liveroom->contents));
         roomname = finallevel.roomname;
         tileset = 2;
         if (rx == 108)
@@ -1817,8 +2223,12 @@ void mapclass::loadlevel(int rx, int ry)
 
         roomname = room->roomname.c_str();
         extrarow = 1;
-        const int* tmap = cl.loadlevel(rx, ry);
-        SDL_memcpy(contents, tmap, sizeof(contents));
+        if (!swapped)
+        {
+            const int* tmap = cl.loadlevel(rx, ry);
+            SDL_memcpy(contents, tmap, sizeof(liveroom->contents));
+            findcustomentities(liveroom);
+        }
 
 
         roomtexton = false;
@@ -1827,17 +2237,10 @@ void mapclass::loadlevel(int rx, int ry)
         // Entities have to be created HERE, akwardly
         int tempcheckpoints = 0;
         int tempscriptbox = 0;
-        for (size_t edi = 0; edi < customentities.size(); edi++)
+        for (size_t i = 0; i < liveroom->entities.size(); i++)
         {
-            // If entity is in this room, create it
+            const int edi = liveroom->entities[i];
             const CustomEntity& ent = customentities[edi];
-            const int tsx = ent.x / 40;
-            const int tsy = ent.y / 30;
-
-            if (tsx != rx-100 || tsy != ry-100)
-            {
-                continue;
-            }
 
             const int ex = (ent.x % 40) * 8;
             const int ey = (ent.y % 30) * 8;
@@ -1956,7 +2359,7 @@ void mapclass::loadlevel(int rx, int ry)
                 {
                     game.customscript[tempscriptbox] = ent.scriptname;
                 }
-                obj.createblock(TRIGGER, ex, ey, ent.p1 * 8, ent.p2 * 8, 300 + tempscriptbox, "custom_" + ent.scriptname);
+                obj.createblock(TRIGGER, ex, ey, ent.p1 * 8, ent.p2 * 8, 300 + tempscriptbox, obj.blocknames.intern("custom_", ent.scriptname.c_str()));
                 tempscriptbox++;
                 break;
             case 50: // Warp Lines
@@ -1992,79 +2395,22 @@ void mapclass::loadlevel(int rx, int ry)
     }
     else
     {
-        for (int j = 0; j < 29 + extrarow; j++)
+        if (!swapped || liveroom->tileset != tileset)
+        {
+            liveroom->tileset = tileset;
+            findtileblocks(liveroom, 29 + extrarow);
+        }
+
+        for (size_t i = 0; i < liveroom->blocks.size(); i++)
         {
-            for (int i = 0; i < 40; i++)
+            const roomblock& block = liveroom->blocks[i];
+            if (block.breakable)
             {
-                int tile = contents[TILE_IDX(i, j)];
-                //Damage blocks
-                if(tileset==0)
-                {
-                    if (tile == 6 || tile == 8)
-                    {
-                        //sticking up
-                        obj.createblock(2, (i * 8), (j * 8)+4, 8, 4);
-                    }
-                    if (tile == 7 || tile == 9)
-                    {
-                        //Sticking down
-                        obj.createblock(2, (i * 8), (j * 8), 8, 4);
-                    }
-                    if (tile == 49 || tile == 50)
-                    {
-                        //left or right
-                        obj.createblock(2, (i * 8), (j * 8)+3, 8, 2);
-                    }
-                }
-                else if(tileset==1)
-                {
-                    if ((tile >= 63 && tile <= 74) ||
-                            (tile >= 6 && tile <= 9))
-                    {
-                        //sticking up) {
-                        if (tile < 10) tile++;
-                        //sticking up
-                        if(tile%2==0)
-                        {
-                            obj.createblock(2, (i * 8), (j * 8), 8, 4);
-                        }
-                        else
-                        {
-                            //Sticking down
-                            obj.createblock(2, (i * 8), (j * 8) + 4, 8, 4);
-                        }
-                        if (tile < 11) tile--;
-                    }
-                    if (tile >= 49 && tile <= 62)
-                    {
-                        //left or right
-                        obj.createblock(2, (i * 8), (j * 8)+3, 8, 2);
-                    }
-                }
-                else if(tileset==2)
-                {
-                    if (tile == 6 || tile == 8)
-                    {
-                        //sticking up
-                        obj.createblock(2, (i * 8), (j * 8)+4, 8, 4);
-                    }
-                    if (tile == 7 || tile == 9)
-                    {
-                        //Sticking down
-                        obj.createblock(2, (i * 8), (j * 8), 8, 4);
-                    }
-                }
-                //Breakable blocks
-                if (tile == 10)
-                {
-                    tile = 0;
-                    obj.createentity(i * 8, j * 8, 4);
-                }
-                //Directional blocks
-                if (tile >= 14 && tile <= 17)
-                {
-                    obj.createblock(3, i * 8, j * 8, 8, 8, tile-14);
-                }
+                obj.createentity(block.x, block.y, 4);
+            }
+            else
+            {
+                obj.createblock(block.t, block.x, block.y, block.w, block.h, block.trig);
             }
         }
 
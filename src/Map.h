@@ -5,8 +5,10 @@
 
 #include "Finalclass.h"
 #include "Labclass.h"
+#include "LevelPack.h"
 #include "Maths.h"
 #include "Otherlevel.h"
+#include "RoomArena.h"
 #include "Spacestation2.h"
 #include "Tower.h"
 #include "TowerBG.h"
@@ -18,6 +20,34 @@ struct Roomtext
     const char* text;
 };
 
+/* A block, or a breakable block's entity, that a room's tiles call for */
+struct roomblock
+{
+    bool breakable;
+    int t;
+    int x, y, w, h;
+    int trig;
+};
+
+/* Tiles and what comes from them for one room. loadlevel() points
+ * mapclass::contents at one of these, and if prefetchroom() already got
+ * it ready, only has to create what it lists. */
+struct readyroom
+{
+    int rx, ry;
+    /* The tileset the blocks were worked out for */
+    int tileset;
+    bool ready;
+    /* On screen, or in mapclass::prefetchqueue */
+    bool wanted;
+    int contents[40 * 30];
+    /* Spikes, directional blocks and breakable blocks, in the order
+     * loadlevel() creates them */
+    std::vector<roomblock> blocks;
+    /* Indices into customentities of the ones in this room */
+    std::vector<int> entities;
+};
+
 class mapclass
 {
 public:
@@ -81,6 +111,24 @@ public:
 
     void gotoroom(int rx, int ry);
 
+    void prefetchneighbours(void);
+
+    bool prefetchroom(void);
+
+    readyroom* findreadyroom(int rx, int ry);
+
+    bool swapinroom(int rx, int ry);
+
+    void getroomready(readyroom* room, int rx, int ry);
+
+    void findtileblocks(readyroom* room, int rows);
+
+    void findcustomentities(readyroom* room);
+
+    void clearreadyrooms(void);
+
+    void addroomlatency(int us);
+
     void spawncompanion(void);
 
     const char* currentarea(int t);
@@ -93,7 +141,7 @@ public:
     int roomdeaths[20 * 20];
     int roomdeathsfinal[20 * 20];
     static const int areamap[20 * 20];
-    int contents[40 * 30];
+    int* contents;
     bool explored[20 * 20];
 
     bool isexplored(const int rx, const int ry);
@@ -154,9 +202,27 @@ public:
 
     //Roomtext
     bool roomtexton;
-    std::vector<Roomtext> roomtext;
+    roomvector<Roomtext> roomtext;
+
+    //Rooms to get ready in spare frame time, fetched last to first
+    point prefetchqueue[5];
+    int prefetchcount;
+
+    //The room on screen and the ones in prefetchqueue
+    static const int num_readyrooms = 6;
+    readyroom readyrooms[num_readyrooms];
+    //The one contents points at
+    readyroom* liveroom;
+    //How many room transitions only had to swap in a ready room
+    int roomswaps;
+
+    //Room transition times, bucket i counts transitions under 250us << i
+    static const int num_roomlatency = 8;
+    int roomlatency[num_roomlatency];
+    int roomtransitions;
 
     //Levels
+    levelpackclass levelpack;
     otherlevelclass otherlevel;
     spacestation2class spacestation2;
     labclass lablevel;
@@ -0,0 +1,438 @@
+#include "Mixer.h"
+
+#include <SDL2/SDL.h>
+#include <SDL2/SDL_mixer.h>
+
+#include "MusicStream.h"
+#include "Vlogging.h"
+
+enum
+{
+    MIXER_PLAY,
+    MIXER_STOPEFFECTS,
+    MIXER_PAUSEEFFECTS,
+    MIXER_RESUMEEFFECTS,
+    MIXER_PAUSEMUSIC,
+    MIXER_RESUMEMUSIC,
+    MIXER_EFFECTVOLUME,
+    MIXER_MUSICVOLUME
+};
+
+/* Accumulating sample * volume keeps everything in integers, the sum is
+ * only shifted back down and clipped once at the end. Nine full scale
+ * sources at MIX_MAX_VOLUME still fit in 32 bits. */
+static const int volume_shift = 7;
+
+/* The loops below are kept branchless and over plain arrays, so that
+ * compilers can turn them into SIMD where there is some */
+static void mixsamples(Sint32* acc, const Sint16* in, const int samples, const Sint32 volume)
+{
+    for (int i = 0; i < samples; i++)
+    {
+        acc[i] += in[i] * volume;
+    }
+}
+
+static void clipsamples(Sint16* out, const Sint32* acc, const int samples)
+{
+    for (int i = 0; i < samples; i++)
+    {
+        const Sint32 sample = acc[i] >> volume_shift;
+        out[i] = sample < -32768 ? -32768 : sample > 32767 ? 32767 : sample;
+    }
+}
+
+static void SDLCALL mixercallback(void* udata, Uint8* stream, int len)
+{
+    ((mixerclass*) udata)->render(stream, len);
+}
+
+mixerclass::mixerclass(void)
+{
+    sent_effectvolume = -1;
+    sent_musicvolume = -1;
+    paused_music = false;
+    frequency = 44100;
+    dropped = 0;
+
+    SDL_zeroa(queue);
+    SDL_AtomicSet(&head, 0);
+    SDL_AtomicSet(&tail, 0);
+
+    SDL_zeroa(voices);
+    music = NULL;
+    musicplaying = true;
+    effectvolume = MIX_MAX_VOLUME;
+    musicgain = 0;
+    musicgainstep = 0;
+    fadeleft = 0;
+
+    slowest_ticks = 0;
+    slowest_samples = 0;
+}
+
+void mixerclass::init(musicstreamclass* music_)
+{
+    int channels;
+    Uint16 format;
+
+    if (Mix_QuerySpec(&frequency, &format, &channels) == 0)
+    {
+        vlog_error("Unable to start the mixer: %s", Mix_GetError());
+        return;
+    }
+    if (format != AUDIO_S16SYS || channels != 2)
+    {
+        vlog_error("Unable to start the mixer: the device isn't 16-bit stereo");
+        return;
+    }
+
+    music = music_;
+    Mix_HookMusic(mixercallback, this);
+}
+
+#ifdef MIXER_TEST
+void mixerclass::initoffline(musicstreamclass* music_)
+{
+    frequency = SoundSystem::frequency;
+    music = music_;
+}
+#endif
+
+void mixerclass::destroy(void)
+{
+    /* No more callbacks after this returns, so the voices can go */
+    Mix_HookMusic(NULL, NULL);
+    for (int i = 0; i < num_voices; i++)
+    {
+        stopvoice(&voices[i]);
+    }
+    music = NULL;
+
+    if (dropped > 0)
+    {
+        vlog_warn("Mixer queue was full %i times", dropped);
+    }
+
+    if (slowest_samples > 0)
+    {
+        /* Decoding effects as they play mustn't make the mixer miss a buffer */
+        const int took_us = slowest_ticks * 1000000 / SDL_GetPerformanceFrequency();
+        const int lasts_us = (Sint64) slowest_samples / 2 * 1000000 / frequency;
+        if (took_us > lasts_us)
+        {
+            vlog_warn("Mixing a buffer took up to %i us, but it only plays for %i us", took_us, lasts_us);
+        }
+        else
+        {
+            vlog_info("Mixing a buffer took up to %i us of %i us", took_us, lasts_us);
+        }
+    }
+}
+
+/* Returns false if the command was dropped */
+bool mixerclass::push(const command& cmd)
+{
+    const Uint32 h = SDL_AtomicGet(&head);
+
+    if (h - (Uint32) SDL_AtomicGet(&tail) >= (Uint32) queue_size)
+    {
+        /* The audio callback isn't running, or is far behind */
+        dropped++;
+        return false;
+    }
+
+    queue[h % queue_size] = cmd;
+    /* Publishes the command, SDL_AtomicSet is a full barrier */
+    SDL_AtomicSet(&head, h + 1);
+    return true;
+}
+
+void mixerclass::play(const Sint16* samples, const Uint32 length, SDL_atomic_t* users)
+{
+    command cmd;
+    SDL_zero(cmd);
+    cmd.type = MIXER_PLAY;
+    cmd.samples = samples;
+    cmd.length = length & ~1;
+    cmd.users = users;
+
+    /* Counted before it's queued, so samples can't go while it's on its way */
+    if (users != NULL)
+    {
+        SDL_AtomicIncRef(users);
+    }
+    if (!push(cmd) && users != NULL)
+    {
+        SDL_AtomicDecRef(users);
+    }
+}
+
+void mixerclass::play(const adpcmsound* sound)
+{
+    command cmd;
+    SDL_zero(cmd);
+    cmd.type = MIXER_PLAY;
+    cmd.sound = *sound;
+    push(cmd);
+}
+
+#define SIMPLE_COMMAND(name, type_) \
+    void mixerclass::name(void) \
+    { \
+        command cmd; \
+        SDL_zero(cmd); \
+        cmd.type = type_; \
+        push(cmd); \
+    }
+
+SIMPLE_COMMAND(stopeffects, MIXER_STOPEFFECTS)
+SIMPLE_COMMAND(pauseeffects, MIXER_PAUSEEFFECTS)
+SIMPLE_COMMAND(resumeeffects, MIXER_RESUMEEFFECTS)
+
+#undef SIMPLE_COMMAND
+
+void mixerclass::pausemusic(void)
+{
+    command cmd;
+    SDL_zero(cmd);
+    cmd.type = MIXER_PAUSEMUSIC;
+    if (push(cmd))
+    {
+        paused_music = true;
+    }
+}
+
+void mixerclass::resumemusic(void)
+{
+    command cmd;
+    SDL_zero(cmd);
+    cmd.type = MIXER_RESUMEMUSIC;
+    if (push(cmd))
+    {
+        paused_music = false;
+    }
+}
+
+bool mixerclass::musicpaused(void)
+{
+    return paused_music;
+}
+
+void mixerclass::seteffectvolume(const int volume)
+{
+    if (volume == sent_effectvolume)
+    {
+        return;
+    }
+
+    command cmd;
+    SDL_zero(cmd);
+    cmd.type = MIXER_EFFECTVOLUME;
+    cmd.volume = volume;
+    /* Sent again next time if it was dropped */
+    if (push(cmd))
+    {
+        sent_effectvolume = volume;
+    }
+}
+
+void mixerclass::setmusicvolume(const int volume, const int fade_ms)
+{
+    if (volume == sent_musicvolume)
+    {
+        return;
+    }
+
+    command cmd;
+    SDL_zero(cmd);
+    cmd.type = MIXER_MUSICVOLUME;
+    cmd.volume = volume;
+    cmd.fade_frames = SDL_max(fade_ms, 0) * frequency / 1000;
+    if (push(cmd))
+    {
+        sent_musicvolume = volume;
+    }
+}
+
+void mixerclass::runcommands(void)
+{
+    const Uint32 end = SDL_AtomicGet(&head);
+    Uint32 t = SDL_AtomicGet(&tail);
+
+    for (; t != end; t++)
+    {
+        const command& cmd = queue[t % queue_size];
+
+        switch (cmd.type)
+        {
+        case MIXER_PLAY:
+        {
+            /* Like Mix_PlayChannel(), nothing plays if every voice is busy */
+            bool started = false;
+            for (int i = 0; i < num_voices; i++)
+            {
+                voice* v = &voices[i];
+                if (!v->active)
+                {
+                    v->active = true;
+                    v->paused = false;
+                    v->samples = cmd.samples;
+                    v->length = cmd.length;
+                    v->users = cmd.users;
+                    v->pos = 0;
+                    ADPCM_start(&v->decoder, &cmd.sound);
+                    started = true;
+                    break;
+                }
+            }
+            if (!started && cmd.users != NULL)
+            {
+                SDL_AtomicDecRef(cmd.users);
+            }
+            break;
+        }
+        case MIXER_STOPEFFECTS:
+            for (int i = 0; i < num_voices; i++)
+            {
+                stopvoice(&voices[i]);
+            }
+            break;
+        case MIXER_PAUSEEFFECTS:
+        case MIXER_RESUMEEFFECTS:
+            for (int i = 0; i < num_voices; i++)
+            {
+                voices[i].paused = cmd.type == MIXER_PAUSEEFFECTS;
+            }
+            break;
+        case MIXER_PAUSEMUSIC:
+            musicplaying = false;
+            break;
+        case MIXER_RESUMEMUSIC:
+            musicplaying = true;
+            break;
+        case MIXER_EFFECTVOLUME:
+            effectvolume = cmd.volume;
+            break;
+        case MIXER_MUSICVOLUME:
+        {
+            const Sint32 target = cmd.volume << 16;
+            fadeleft = cmd.fade_frames;
+            if (fadeleft == 0)
+            {
+                musicgain = target;
+                musicgainstep = 0;
+            }
+            else
+            {
+                musicgainstep = (target - musicgain) / (Sint32) fadeleft;
+            }
+            break;
+        }
+        }
+    }
+
+    SDL_AtomicSet(&tail, t);
+}
+
+void mixerclass::stopvoice(voice* v)
+{
+    if (v->active && v->users != NULL)
+    {
+        SDL_AtomicDecRef(v->users);
+    }
+    SDL_zerop(v);
+}
+
+void mixerclass::mixblock(Sint16* out, const int samples)
+{
+    int got = 0;
+
+    if (music != NULL && musicplaying)
+    {
+        got = music->read(musicbuffer, samples);
+    }
+
+    if (fadeleft == 0)
+    {
+        const Sint32 volume = musicgain >> 16;
+        for (int i = 0; i < got; i++)
+        {
+            mixbuffer[i] = musicbuffer[i] * volume;
+        }
+    }
+    else
+    {
+        /* Only while a fade is going, one step per stereo frame */
+        for (int i = 0; i + 1 < samples; i += 2)
+        {
+            const Sint32 volume = musicgain >> 16;
+            mixbuffer[i] = i < got ? musicbuffer[i] * volume : 0;
+            mixbuffer[i + 1] = i + 1 < got ? musicbuffer[i + 1] * volume : 0;
+
+            if (fadeleft > 0)
+            {
+                musicgain += musicgainstep;
+                fadeleft--;
+            }
+        }
+        if (fadeleft == 0)
+        {
+            /* Rounding may have left it short */
+            musicgain = (musicgain + 0x8000) & ~0xFFFF;
+        }
+        got = samples;
+    }
+    SDL_memset(&mixbuffer[got], 0, (samples - got) * sizeof(Sint32));
+
+    for (int i = 0; i < num_voices; i++)
+    {
+        voice* v = &voices[i];
+        if (!v->active || v->paused)
+        {
+            continue;
+        }
+
+        if (v->samples != NULL)
+        {
+            const int run = SDL_min((Uint32) samples, v->length - v->pos);
+            mixsamples(mixbuffer, &v->samples[v->pos], run, effectvolume);
+
+            v->pos += run;
+            if (v->pos >= v->length)
+            {
+                stopvoice(v);
+            }
+        }
+        else
+        {
+            const int frames = ADPCM_decode(&v->decoder, decodebuffer, samples / 2);
+            mixsamples(mixbuffer, decodebuffer, frames * 2, effectvolume);
+
+            v->active = frames == samples / 2;
+        }
+    }
+
+    clipsamples(out, mixbuffer, samples);
+}
+
+void mixerclass::render(Uint8* stream, const int len)
+{
+    Sint16* out = (Sint16*) stream;
+    const int samples = len / 2;
+    const Uint64 start = SDL_GetPerformanceCounter();
+
+    runcommands();
+
+    for (int done = 0; done < samples; done += block_samples)
+    {
+        mixblock(&out[done], SDL_min(block_samples, samples - done));
+    }
+
+    const Uint64 ticks = SDL_GetPerformanceCounter() - start;
+    if (ticks > slowest_ticks)
+    {
+        slowest_ticks = ticks;
+        slowest_samples = samples;
+    }
+}
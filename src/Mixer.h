@@ -0,0 +1,115 @@
+#ifndef MIXER_H
+#define MIXER_H
+
+#include <SDL2/SDL.h>
+
+#include "SoundSystem.h"
+
+class musicstreamclass;
+
+/* Mixes the sound effects and the music stream into SDL_mixer's music hook,
+ * all in 16-bit fixed point. The game thread never touches the voices, it
+ * queues commands, and the audio callback picks them up at the start of
+ * every buffer. There's one producer and one consumer, so the queue only
+ * needs two atomic counters and no lock. */
+class mixerclass
+{
+public:
+    mixerclass(void);
+
+    /* Takes over SDL_mixer's music hook, music may be NULL */
+    void init(musicstreamclass* music);
+#ifdef MIXER_TEST
+    /* Only for calling render() by hand, see MixerTest.cpp */
+    void initoffline(musicstreamclass* music);
+#endif
+    void destroy(void);
+
+    /* Game thread. samples is 16-bit stereo in the mixer's format, and has
+     * to stay around until destroy(), or if users isn't NULL, until it's
+     * back to 0. It counts the voices playing samples and the plays still
+     * queued. */
+    void play(const Sint16* samples, Uint32 length, SDL_atomic_t* users = NULL);
+    /* Decoded a block at a time as it plays */
+    void play(const adpcmsound* sound);
+    void stopeffects(void);
+    void pauseeffects(void);
+    void resumeeffects(void);
+    void pausemusic(void);
+    void resumemusic(void);
+    bool musicpaused(void);
+
+    /* 0..MIX_MAX_VOLUME. Nothing is queued if the volume didn't change. */
+    void seteffectvolume(int volume);
+    /* Ramps from the current volume over fade_ms instead of jumping */
+    void setmusicvolume(int volume, int fade_ms);
+
+    /* Mixes the next len bytes, either from the audio callback or offline
+     * when there's no audio device */
+    void render(Uint8* stream, int len);
+
+    static const int num_voices = 8;
+    static const int queue_size = 64;
+    /* Samples mixed at a time, for the size of the scratch buffers */
+    static const int block_samples = 512;
+
+private:
+    struct command
+    {
+        Uint8 type;
+        int volume;
+        Uint32 fade_frames;
+        const Sint16* samples;
+        Uint32 length;
+        SDL_atomic_t* users;
+        adpcmsound sound;
+    };
+
+    struct voice
+    {
+        bool active;
+        bool paused;
+        /* NULL if it's decoded from ADPCM */
+        const Sint16* samples;
+        Uint32 length;
+        SDL_atomic_t* users;
+        Uint32 pos;
+        adpcmdecoder decoder;
+    };
+
+    bool push(const command& cmd);
+    void runcommands(void);
+    void stopvoice(voice* v);
+    void mixblock(Sint16* out, int samples);
+
+    /* Game thread only */
+    int sent_effectvolume;
+    int sent_musicvolume;
+    bool paused_music;
+    int frequency;
+    int dropped;
+
+    /* head is only written by the game thread, tail by the audio callback */
+    command queue[queue_size];
+    SDL_atomic_t head;
+    SDL_atomic_t tail;
+
+    /* Audio callback only */
+    voice voices[num_voices];
+    musicstreamclass* music;
+    bool musicplaying;
+    int effectvolume;
+    /* 16.16, so that short fades still move every sample */
+    Sint32 musicgain;
+    Sint32 musicgainstep;
+    Uint32 fadeleft;
+    Sint32 mixbuffer[block_samples];
+    Sint16 musicbuffer[block_samples];
+    Sint16 decodebuffer[block_samples];
+
+    /* How long the slowest buffer took to mix, against how long it plays */
+    Uint64 slowest_ticks;
+    int slowest_samples;
+};
+
+#endif /* MIXER_H */
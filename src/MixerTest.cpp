@@ -0,0 +1,226 @@
+#include "MixerTest.h"
+
+#include <SDL2/SDL.h>
+#include <vector>
+
+#include "Mixer.h"
+#include "MusicStream.h"
+#include "SoundSystem.h"
+#include "Vlogging.h"
+
+/* What the sequence below renders to. Update it when the mixer is meant
+ * to sound different, the log says what it got. */
+#define MIXER_TEST_CHECKSUM 0xf23d8000u
+
+enum
+{
+    EVENT_PLAY_PCM,
+    EVENT_PLAY_ADPCM,
+    EVENT_STOP_EFFECTS,
+    EVENT_PAUSE_EFFECTS,
+    EVENT_RESUME_EFFECTS,
+    EVENT_PAUSE_MUSIC,
+    EVENT_RESUME_MUSIC,
+    EVENT_EFFECT_VOLUME,
+    EVENT_MUSIC_VOLUME
+};
+
+struct mixerevent
+{
+    /* Before which render() call */
+    int render;
+    int type;
+    int value;
+    int fade_ms;
+};
+
+static const mixerevent events[] = {
+    {0, EVENT_MUSIC_VOLUME, MIX_MAX_VOLUME, 0},
+    {0, EVENT_EFFECT_VOLUME, MIX_MAX_VOLUME, 0},
+    {0, EVENT_PLAY_PCM, 0, 0},
+    {3, EVENT_PLAY_PCM, 1, 0},
+    {3, EVENT_PLAY_ADPCM, 0, 0},
+    {5, EVENT_PAUSE_EFFECTS, 0, 0},
+    {8, EVENT_RESUME_EFFECTS, 0, 0},
+    {8, EVENT_PLAY_ADPCM, 1, 0},
+    {10, EVENT_MUSIC_VOLUME, 32, 300},
+    {12, EVENT_EFFECT_VOLUME, 64, 0},
+    /* Not sent again */
+    {12, EVENT_EFFECT_VOLUME, 64, 0},
+    {12, EVENT_PLAY_PCM, 0, 0},
+    {16, EVENT_PAUSE_MUSIC, 0, 0},
+    {20, EVENT_RESUME_MUSIC, 0, 0},
+    {20, EVENT_MUSIC_VOLUME, MIX_MAX_VOLUME, 50},
+    /* One more than there are voices */
+    {24, EVENT_PLAY_PCM, 1, 0},
+    {24, EVENT_PLAY_PCM, 1, 0},
+    {24, EVENT_PLAY_PCM, 1, 0},
+    {24, EVENT_PLAY_PCM, 1, 0},
+    {24, EVENT_PLAY_ADPCM, 0, 0},
+    {24, EVENT_PLAY_ADPCM, 0, 0},
+    {24, EVENT_PLAY_ADPCM, 1, 0},
+    {24, EVENT_PLAY_ADPCM, 1, 0},
+    {24, EVENT_PLAY_PCM, 0, 0},
+    {26, EVENT_STOP_EFFECTS, 0, 0},
+    {28, EVENT_EFFECT_VOLUME, 0, 0},
+    {28, EVENT_PLAY_PCM, 0, 0},
+    {30, EVENT_EFFECT_VOLUME, MIX_MAX_VOLUME, 0},
+    {30, EVENT_MUSIC_VOLUME, 0, 100},
+    {34, EVENT_PLAY_ADPCM, 0, 0}
+};
+
+static const int num_renders = 40;
+
+/* Bytes a render() call gets, whole stereo frames that don't always line
+ * up with the mixer's blocks */
+static const int render_bytes[] = {4096, 1500, 2048};
+
+static const Uint32 pcm_frames[2] = {2205, 3000};
+static const Uint32 adpcm_frames = 1500;
+
+static std::vector<Sint16> pcm[2];
+static std::vector<Uint8> adpcmdata[2];
+static adpcmsound adpcm[2];
+
+static mixerclass testmixer;
+static musicstreamclass teststream;
+
+/* Same every time, so that the checksum is */
+static Uint32 lcg(Uint32* state)
+{
+    *state = *state * 1664525u + 1013904223u;
+    return *state >> 16;
+}
+
+static void makesounds(void)
+{
+    /* A square wave, with the right channel an octave up */
+    pcm[0].resize(pcm_frames[0] * 2);
+    for (Uint32 i = 0; i < pcm_frames[0]; i++)
+    {
+        pcm[0][i * 2] = (i / 50) % 2 ? 12000 : -12000;
+        pcm[0][i * 2 + 1] = (i / 25) % 2 ? 12000 : -12000;
+    }
+
+    /* A sawtooth, loud enough to clip together with everything else */
+    pcm[1].resize(pcm_frames[1] * 2);
+    for (Uint32 i = 0; i < pcm_frames[1]; i++)
+    {
+        pcm[1][i * 2] = (Sint16) ((i % 128) * 512 - 32768);
+        pcm[1][i * 2 + 1] = pcm[1][i * 2];
+    }
+
+    /* Any nibbles are valid ADPCM, one sound mono and one stereo */
+    Uint32 state = 1;
+    for (int i = 0; i < 2; i++)
+    {
+        adpcm[i].channels = i + 1;
+        adpcm[i].frames = adpcm_frames;
+        adpcmdata[i].resize((adpcm_frames * adpcm[i].channels + 1) / 2);
+        for (size_t ii = 0; ii < adpcmdata[i].size(); ii++)
+        {
+            adpcmdata[i][ii] = lcg(&state);
+        }
+        adpcm[i].data = &adpcmdata[i][0];
+    }
+}
+
+static void runevent(const mixerevent& event)
+{
+    switch (event.type)
+    {
+    case EVENT_PLAY_PCM:
+        testmixer.play(&pcm[event.value][0], pcm[event.value].size());
+        break;
+    case EVENT_PLAY_ADPCM:
+        testmixer.play(&adpcm[event.value]);
+        break;
+    case EVENT_STOP_EFFECTS:
+        testmixer.stopeffects();
+        break;
+    case EVENT_PAUSE_EFFECTS:
+        testmixer.pauseeffects();
+        break;
+    case EVENT_RESUME_EFFECTS:
+        testmixer.resumeeffects();
+        break;
+    case EVENT_PAUSE_MUSIC:
+        testmixer.pausemusic();
+        break;
+    case EVENT_RESUME_MUSIC:
+        testmixer.resumemusic();
+        break;
+    case EVENT_EFFECT_VOLUME:
+        testmixer.seteffectvolume(event.value);
+        break;
+    case EVENT_MUSIC_VOLUME:
+        testmixer.setmusicvolume(event.value, event.fade_ms);
+        break;
+    }
+}
+
+/* A triangle wave for the music, fed in as it's played */
+static void feedmusic(Uint32* musicpos, const int samples)
+{
+    static Sint16 buffer[4096];
+    const int count = SDL_min(samples, (int) SDL_arraysize(buffer));
+
+    for (int i = 0; i < count; i++)
+    {
+        const int phase = (*musicpos + i) % 400;
+        buffer[i] = (phase < 200 ? phase : 400 - phase) * 100 - 10000;
+    }
+
+    *musicpos += teststream.feed(buffer, count);
+}
+
+bool MIXERTEST_run(void)
+{
+    std::vector<Sint16> out;
+    size_t event = 0;
+    Uint32 musicpos = 0;
+
+    makesounds();
+    teststream.initoffline();
+    testmixer.initoffline(&teststream);
+
+    for (int i = 0; i < num_renders; i++)
+    {
+        for (; event < SDL_arraysize(events) && events[event].render == i; event++)
+        {
+            runevent(events[event]);
+        }
+
+        const int bytes = render_bytes[i % SDL_arraysize(render_bytes)];
+        const size_t at = out.size();
+        out.resize(at + bytes / sizeof(Sint16));
+
+        feedmusic(&musicpos, bytes / sizeof(Sint16));
+        testmixer.render((Uint8*) &out[at], bytes);
+    }
+
+    teststream.destroy();
+
+    /* FNV-1a over the samples as little endian */
+    Uint32 checksum = 2166136261u;
+    for (size_t i = 0; i < out.size(); i++)
+    {
+        const Uint16 sample = out[i];
+        checksum = (checksum ^ (sample & 0xFF)) * 16777619u;
+        checksum = (checksum ^ (sample >> 8)) * 16777619u;
+    }
+
+    if (checksum != MIXER_TEST_CHECKSUM)
+    {
+        vlog_error(
+            "MIXER | %i samples rendered to checksum %08x, expected %08x",
+            (int) out.size(),
+            checksum,
+            MIXER_TEST_CHECKSUM
+        );
+        return false;
+    }
+
+    vlog_info("MIXER | %i samples rendered to checksum %08x as expected", (int) out.size(), checksum);
+    return true;
+}
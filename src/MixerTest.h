@@ -0,0 +1,10 @@
+#ifndef MIXERTEST_H
+#define MIXERTEST_H
+
+/* Renders a fixed sequence of effects, pauses, fades and volume changes
+ * with mixerclass::render(), no audio device involved, and compares a
+ * checksum of it against the one that's expected. Returns false if they
+ * differ. Only built with MIXER_TEST. */
+bool MIXERTEST_run(void);
+
+#endif /* MIXERTEST_H */
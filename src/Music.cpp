@@ -2,12 +2,14 @@
 #include "Music.h"
 
 #include <SDL2/SDL.h>
-#include <physfsrwops.h>
 
 #include "BinaryBlob.h"
+#include "Exit.h"
 #include "Game.h"
 #include "Graphics.h"
+#include "Jobs.h"
 #include "Map.h"
+#include "RAM.h"
 #include "Script.h"
 #include "UtilityClass.h"
 #include "Vlogging.h"
@@ -28,6 +30,43 @@ musicclass::musicclass(void)
     quick_fade = true;
 
     usingmmmmmm = false;
+
+    effectcachebytes = 0;
+}
+
+/* Effects played this often get decoded once and kept, like jumping. Past
+ * the budget, less played ones make way for them. */
+static const int effect_cache_plays = 4;
+static const Uint32 effect_cache_budget = 256 * 1024;
+
+/* A missing track still gets added, so that the numbers of the ones after
+ * it don't change */
+static void addblobtrack(std::vector<musicsource>& tracks, const char* file, binaryBlob& blob, const int index)
+{
+    musicsource source = {NULL, 0, 0};
+
+    if (index >= 0 && index < blob.max_headers)
+    {
+        source.file = file;
+        source.offset = blob.getOffset(index);
+        source.size = blob.getSize(index);
+    }
+    else
+    {
+        vlog_error("Music track missing from %s", file);
+    }
+
+    tracks.push_back(source);
+}
+
+static void loadsoundtrack(void* userdata)
+{
+    ((SoundTrack*) userdata)->load();
+}
+
+static void soundtracksloaded(void* userdata)
+{
+    ((musicclass*) userdata)->reporteffectmemory();
 }
 
 void musicclass::init(void)
@@ -62,9 +101,12 @@ void musicclass::init(void)
     soundTracks.push_back(SoundTrack( "sounds/trophy.wav" ));
     soundTracks.push_back(SoundTrack( "sounds/rescue.wav" ));
 
-// PSP: Music is temporarily disabled as it'll need to be streamed during the game instead of being
-// loaded all at once, as is done here.
-#if 0
+    /* Decoded as jobs, soundTracks mustn't change size until they're done */
+    for (size_t i = 0; i < soundTracks.size(); ++i)
+    {
+        JOB_add(soundTracks[i].fileName, loadsoundtrack, NULL, &soundTracks[i]);
+    }
+    JOB_add("sounds", NULL, soundtracksloaded, this);
 
 #ifdef VVV_COMPILEMUSIC
     binaryBlob musicWriteBlob;
@@ -76,6 +118,9 @@ void musicclass::init(void)
     musicWriteBlob.clear();
 #endif
 
+    // PSP: Tracks are streamed from the blobs, see musicstreamclass
+    mixer.init(stream.init() ? &stream : NULL);
+
     num_mmmmmm_tracks = 0;
     num_pppppp_tracks = 0;
 
@@ -89,12 +134,10 @@ void musicclass::init(void)
             usingmmmmmm=false;
 
             int index;
-            SDL_RWops* rw;
 
 #define FOREACH_TRACK(blob, track_name) \
     index = blob.getIndex("data/" track_name); \
-    rw = SDL_RWFromMem(blob.getAddress(index), blob.getSize(index)); \
-    musicTracks.push_back(MusicTrack( rw ));
+    addblobtrack(musicTracks, "vvvvvvmusic.vvv", blob, index);
 
             TRACK_NAMES(pppppp_blob)
 
@@ -104,10 +147,11 @@ void musicclass::init(void)
         {
             vlog_info("Loading music from loose files...");
 
-            SDL_RWops* rw;
 #define FOREACH_TRACK(_, track_name) \
-    rw = PHYSFSRWOPS_openRead(track_name); \
-    musicTracks.push_back(MusicTrack( rw ));
+    { \
+        const musicsource source = {track_name, 0, 0}; \
+        musicTracks.push_back(source); \
+    }
 
             TRACK_NAMES(_)
 
@@ -120,23 +164,15 @@ void musicclass::init(void)
 
         mmmmmm = true;
         int index;
-        SDL_RWops *rw;
 
 #define FOREACH_TRACK(blob, track_name) \
     index = blob.getIndex("data/" track_name); \
     if (index >= 0 && index < blob.max_headers) \
     { \
-        rw = SDL_RWFromConstMem(blob.getAddress(index), blob.getSize(index)); \
-        if (rw == NULL) \
-        { \
-            vlog_error("Unable to read music file header: %s", SDL_GetError()); \
-        } \
-        else \
-        { \
-            musicTracks.push_back(MusicTrack( rw )); \
-        } \
+        addblobtrack(musicTracks, blobname, blob, index); \
     }
 
+        const char* blobname = "mmmmmm.vvv";
         TRACK_NAMES(mmmmmm_blob)
 
         num_mmmmmm_tracks += musicTracks.size();
@@ -144,8 +180,7 @@ void musicclass::init(void)
         size_t index_ = 0;
         while (mmmmmm_blob.nextExtra(&index_))
         {
-            rw = SDL_RWFromConstMem(mmmmmm_blob.getAddress(index_), mmmmmm_blob.getSize(index_));
-            musicTracks.push_back(MusicTrack( rw ));
+            addblobtrack(musicTracks, "mmmmmm.vvv", mmmmmm_blob, index_);
 
             num_mmmmmm_tracks++;
             index_++;
@@ -154,6 +189,7 @@ void musicclass::init(void)
         bool ohCrap = pppppp_blob.unPackBinary("vvvvvvmusic.vvv");
         SDL_assert(ohCrap && "Music not found!");
 
+        blobname = "vvvvvvmusic.vvv";
     TRACK_NAMES(pppppp_blob)
 
 #undef FOREACH_TRACK
@@ -161,36 +197,29 @@ void musicclass::init(void)
 
     num_pppppp_tracks += musicTracks.size() - num_mmmmmm_tracks;
 
-    SDL_RWops* rw;
     size_t index_ = 0;
     while (pppppp_blob.nextExtra(&index_))
     {
-        rw = SDL_RWFromConstMem(pppppp_blob.getAddress(index_), pppppp_blob.getSize(index_));
-        musicTracks.push_back(MusicTrack( rw ));
+        addblobtrack(musicTracks, "vvvvvvmusic.vvv", pppppp_blob, index_);
 
         num_pppppp_tracks++;
         index_++;
     }
-
-#endif // #if 0
 }
 
 void musicclass::destroy(void)
 {
+    mixer.destroy();
+
+    reporteffectmemory();
     for (size_t i = 0; i < soundTracks.size(); ++i)
     {
-        Mix_FreeChunk(soundTracks[i].sound);
+        soundTracks[i].clear();
     }
     soundTracks.clear();
+    effectcachebytes = 0;
 
-    // Before we free all the music: stop playing music, else SDL2_mixer
-    // will call SDL_Delay() if we are fading, resulting in no-draw frames
-    Mix_HaltMusic();
-
-    for (size_t i = 0; i < musicTracks.size(); ++i)
-    {
-        Mix_FreeMusic(musicTracks[i].m_music);
-    }
+    stream.destroy();
     musicTracks.clear();
 
     pppppp_blob.clear();
@@ -199,10 +228,6 @@ void musicclass::destroy(void)
 
 void musicclass::play(int t)
 {
-    // PSP: Music was too memory-intensive.
-    vlog_error("Music is temporarily disabled");
-    return;
-
     if (mmmmmm && usingmmmmmm)
     {
         // Don't conjoin this if-statement with the above one...
@@ -235,7 +260,7 @@ void musicclass::play(int t)
         return;
     }
 
-    if (!INBOUNDS_VEC(t, musicTracks))
+    if (!INBOUNDS_VEC(t, musicTracks) || musicTracks[t].file == NULL)
     {
         vlog_error("play() out-of-bounds!");
         currentsong = -1;
@@ -245,17 +270,13 @@ void musicclass::play(int t)
     if (currentsong == 0 || currentsong == 7 || (!map.custommode && (currentsong == 0+num_mmmmmm_tracks || currentsong == 7+num_mmmmmm_tracks)))
     {
         // Level Complete theme, no fade in or repeat
-        if (Mix_PlayMusic(musicTracks[t].m_music, 0) == -1)
-        {
-            vlog_error("Mix_PlayMusic: %s", Mix_GetError());
-        }
-        else
-        {
-            m_doFadeInVol = false;
-            m_doFadeOutVol = false;
-            musicVolume = MIX_MAX_VOLUME;
-            Mix_VolumeMusic(musicVolume);
-        }
+        /* Like Mix_PlayMusic(), this also unpauses */
+        mixer.resumemusic();
+        stream.play(musicTracks[t], false);
+        m_doFadeInVol = false;
+        m_doFadeOutVol = false;
+        musicVolume = MIX_MAX_VOLUME;
+        mixer.setmusicvolume(musicVolume, 0);
     }
     else
     {
@@ -275,12 +296,10 @@ void musicclass::play(int t)
                 quick_fade = true;
             }
         }
-        else if (Mix_PlayMusic(musicTracks[t].m_music, -1) == -1)
-        {
-            vlog_error("Mix_PlayMusic: %s", Mix_GetError());
-        }
         else
         {
+            mixer.resumemusic();
+            stream.play(musicTracks[t], true);
             m_doFadeInVol = false;
             m_doFadeOutVol = false;
             fadeMusicVolumeIn(3000);
@@ -290,7 +309,7 @@ void musicclass::play(int t)
 
 void musicclass::resume()
 {
-    Mix_ResumeMusic();
+    mixer.resumemusic();
 }
 
 void musicclass::resumefade(const int fadein_ms)
@@ -306,7 +325,7 @@ void musicclass::fadein(void)
 
 void musicclass::pause(void)
 {
-    Mix_PauseMusic();
+    mixer.pausemusic();
 }
 
 void musicclass::haltdasmusik(void)
@@ -380,7 +399,7 @@ void musicclass::fadeMusicVolumeIn(int ms)
     musicVolume = 0;
 
     /* Fix 1-frame glitch */
-    Mix_VolumeMusic(0);
+    mixer.setmusicvolume(0, 0);
 
     fade.step_ms = 0;
     fade.duration_ms = ms;
@@ -551,32 +570,152 @@ void musicclass::changemusicarea(int x, int y)
     niceplay(track);
 }
 
+/* Gets effect t's PCM into the cache's budget, letting go of effects that
+ * have been played less often than it, fewest plays first. Returns false
+ * if that wouldn't make enough room. */
+bool musicclass::makeeffectroom(const int t)
+{
+    const Uint32 needed = soundTracks[t].pcmbytes();
+    Uint32 freeable = 0;
+
+    if (needed > effect_cache_budget)
+    {
+        return false;
+    }
+
+    /* Ones still playing can't go yet */
+    for (size_t i = 0; i < soundTracks.size(); ++i)
+    {
+        SoundTrack& other = soundTracks[i];
+        if (other.pcm != NULL
+        && other.plays < soundTracks[t].plays
+        && SDL_AtomicGet(&other.users) == 0)
+        {
+            freeable += other.pcmbytes();
+        }
+    }
+    if (effectcachebytes + needed > effect_cache_budget + freeable)
+    {
+        return false;
+    }
+
+    while (effectcachebytes + needed > effect_cache_budget)
+    {
+        SoundTrack* coldest = NULL;
+        for (size_t i = 0; i < soundTracks.size(); ++i)
+        {
+            SoundTrack& other = soundTracks[i];
+            if (other.pcm != NULL
+            && other.plays < soundTracks[t].plays
+            && SDL_AtomicGet(&other.users) == 0
+            && (coldest == NULL || other.plays < coldest->plays))
+            {
+                coldest = &other;
+            }
+        }
+        if (coldest == NULL)
+        {
+            return false;
+        }
+
+        RAM_free(coldest->pcm);
+        coldest->pcm = NULL;
+        effectcachebytes -= coldest->pcmbytes();
+        vlog_debug(
+            "Sound effect %i (%i plays) made way for %i (%i plays)",
+            (int) (coldest - &soundTracks[0]),
+            coldest->plays,
+            t,
+            soundTracks[t].plays
+        );
+    }
+
+    return true;
+}
+
 void musicclass::playef(int t)
 {
     if (!INBOUNDS_VEC(t, soundTracks))
     {
         return;
     }
-    int channel;
+    SoundTrack& track = soundTracks[t];
+    if (track.sound.data == NULL)
+    {
+        return;
+    }
+
+    track.plays++;
+    if (track.pcm == NULL
+    && track.plays >= effect_cache_plays
+    && makeeffectroom(t))
+    {
+        /* Decoded right here on the game thread, once per effect */
+        const Uint64 start = SDL_GetPerformanceCounter();
+        adpcmdecoder decoder;
+
+        track.pcm = (Sint16*) RAM_mallocTagged(track.pcmbytes(), RAM_TAG_AUDIO);
+        if (track.pcm == NULL)
+        {
+            VVV_exit(1);
+        }
+        ADPCM_start(&decoder, &track.sound);
+        ADPCM_decode(&decoder, track.pcm, track.sound.frames);
+        effectcachebytes += track.pcmbytes();
+
+        /* This holds up the effect, so it shouldn't take longer than the
+         * audio callback would have */
+        const int took_us = (SDL_GetPerformanceCounter() - start) * 1000000 / SDL_GetPerformanceFrequency();
+        const int buffer_us = SoundSystem::buffer_frames * 1000000 / SoundSystem::frequency;
+        if (took_us > buffer_us)
+        {
+            vlog_warn("Decoding sound effect %i took %i us, longer than an audio buffer (%i us)", t, took_us, buffer_us);
+        }
+        vlog_debug("Sound effect %i is now kept decoded, %u KB in the cache", t, effectcachebytes / 1024);
+    }
 
-    channel = Mix_PlayChannel(-1, soundTracks[t].sound, 0);
-    if(channel == -1)
+    if (track.pcm != NULL)
     {
-        vlog_error("Unable to play WAV file: %s", Mix_GetError());
+        mixer.play(track.pcm, track.pcmbytes() / sizeof(Sint16), &track.users);
+    }
+    else
+    {
+        mixer.play(&track.sound);
     }
 }
 
 void musicclass::pauseef(void)
 {
-    Mix_Pause(-1);
+    mixer.pauseeffects();
 }
 
 void musicclass::resumeef(void)
 {
-    Mix_Resume(-1);
+    mixer.resumeeffects();
+}
+
+void musicclass::reporteffectmemory(void)
+{
+    Uint32 adpcm = 0;
+    Uint32 pcm = 0;
+
+    for (size_t i = 0; i < soundTracks.size(); ++i)
+    {
+        const adpcmsound& sound = soundTracks[i].sound;
+        adpcm += (sound.frames * sound.channels + 1) / 2;
+        pcm += soundTracks[i].pcmbytes();
+    }
+
+    vlog_info(
+        "MUSIC | %i sound effects: %u KB as ADPCM plus %u KB of cached PCM, instead of %u KB of PCM",
+        (int) soundTracks.size(),
+        adpcm / 1024,
+        effectcachebytes / 1024,
+        pcm / 1024
+    );
 }
 
 bool musicclass::halted(void)
 {
-    return Mix_PausedMusic() == 1;
+    return mixer.musicpaused();
 }
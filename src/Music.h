@@ -4,6 +4,8 @@
 #include <vector>
 
 #include "BinaryBlob.h"
+#include "Mixer.h"
+#include "MusicStream.h"
 #include "SoundSystem.h"
 
 #define musicroom(rx, ry) ((rx) + ((ry) * 20))
@@ -40,15 +42,21 @@ public:
 
     int currentsong;
 
+    bool makeeffectroom(int t);
     void playef(int t);
     void pauseef(void);
     void resumeef(void);
+    void reporteffectmemory(void);
 
     bool halted(void);
 
     std::vector<SoundTrack> soundTracks;
-    std::vector<MusicTrack> musicTracks;
+    /* Bytes of decoded PCM kept for the most played effects */
+    Uint32 effectcachebytes;
+    std::vector<musicsource> musicTracks;
     SoundSystem soundSystem;
+    musicstreamclass stream;
+    mixerclass mixer;
     bool safeToProcessMusic;
 
     int nicechange; // -1 if no song queued
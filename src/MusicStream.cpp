@@ -0,0 +1,661 @@
+#include "MusicStream.h"
+
+#ifdef DECODE_TRACK
+#include <malloc.h>
+#endif
+#include <physfsrwops.h>
+#include <SDL2/SDL.h>
+#include <SDL2/SDL_mixer.h>
+#include <stdio.h>
+#include <vorbis/vorbisfile.h>
+
+#include "Exit.h"
+#include "FileSystemUtils.h"
+#include "RAM.h"
+#include "SoundSystem.h"
+#include "Vlogging.h"
+
+/* Don't bother decoding less than this at a time */
+static const Uint32 min_decode_bytes = 4096;
+
+struct musicdecoder
+{
+    SDL_RWops* rw;
+    Uint32 size;
+    Uint32 pos;
+    Uint32 filepos;
+    Uint32 bufstart;
+    Uint32 buflen;
+
+    OggVorbis_File vf;
+    bool open;
+    bool loop;
+    bool ended;
+    int errors;
+    int channels;
+    long rate;
+
+    Uint8 buffer[musicstreamclass::read_bytes];
+};
+
+static size_t decoderreadfunc(void* ptr, size_t size, size_t nmemb, void* datasource)
+{
+    musicdecoder* d = (musicdecoder*) datasource;
+    Uint8* out = (Uint8*) ptr;
+    const size_t want = size * nmemb;
+    size_t done = 0;
+
+    if (size == 0)
+    {
+        return 0;
+    }
+
+    while (done < want && d->pos < d->size)
+    {
+        if (d->pos < d->bufstart || d->pos >= d->bufstart + d->buflen)
+        {
+            const Uint32 length = SDL_min(musicstreamclass::read_bytes, d->size - d->pos);
+
+            if (d->filepos != d->pos
+            && SDL_RWseek(d->rw, d->pos, RW_SEEK_SET) < 0)
+            {
+                break;
+            }
+
+            d->bufstart = d->pos;
+            d->buflen = SDL_RWread(d->rw, d->buffer, 1, length);
+            d->filepos = d->pos + d->buflen;
+            if (d->buflen == 0)
+            {
+                break;
+            }
+        }
+
+        const size_t n = SDL_min(want - done, (size_t) (d->bufstart + d->buflen - d->pos));
+        SDL_memcpy(&out[done], &d->buffer[d->pos - d->bufstart], n);
+        done += n;
+        d->pos += n;
+    }
+
+    return done / size;
+}
+
+static int decoderseekfunc(void* datasource, ogg_int64_t offset, int whence)
+{
+    musicdecoder* d = (musicdecoder*) datasource;
+    ogg_int64_t pos;
+
+    switch (whence)
+    {
+    case SEEK_SET:
+        pos = offset;
+        break;
+    case SEEK_CUR:
+        pos = d->pos + offset;
+        break;
+    case SEEK_END:
+        pos = d->size + offset;
+        break;
+    default:
+        return -1;
+    }
+
+    if (pos < 0 || pos > d->size)
+    {
+        return -1;
+    }
+
+    d->pos = pos;
+    return 0;
+}
+
+static long decodertellfunc(void* datasource)
+{
+    return ((musicdecoder*) datasource)->pos;
+}
+
+static int decoderclosefunc(void* datasource)
+{
+    /* decoderclose() takes care of it */
+    (void) datasource;
+    return 0;
+}
+
+static void decoderclose(musicdecoder* d)
+{
+    if (d->open)
+    {
+        ov_clear(&d->vf);
+    }
+    if (d->rw != NULL)
+    {
+        SDL_RWclose(d->rw);
+    }
+    d->rw = NULL;
+    d->open = false;
+}
+
+static bool decoderopen(musicdecoder* d, const musicsource& source, const bool loop)
+{
+    static const ov_callbacks callbacks = {
+        decoderreadfunc,
+        decoderseekfunc,
+        decoderclosefunc,
+        decodertellfunc
+    };
+    vorbis_info* info;
+
+    decoderclose(d);
+
+    d->rw = FILESYSTEM_openAssetRange(source.file, source.offset, source.size);
+    if (d->rw == NULL)
+    {
+        return false;
+    }
+
+    d->size = SDL_RWsize(d->rw);
+    d->pos = 0;
+    d->filepos = (Uint32) -1;
+    d->bufstart = 0;
+    d->buflen = 0;
+    d->loop = loop;
+    d->ended = false;
+    d->errors = 0;
+
+    if (ov_open_callbacks(d, &d->vf, NULL, 0, callbacks) != 0)
+    {
+        vlog_error("%s at %u is not an Ogg Vorbis track", source.file, source.offset);
+        decoderclose(d);
+        return false;
+    }
+    d->open = true;
+
+    info = ov_info(&d->vf, -1);
+    d->channels = info->channels;
+    d->rate = info->rate;
+    if (d->channels != 1 && d->channels != 2)
+    {
+        vlog_error("Music with %i channels isn't supported", d->channels);
+        decoderclose(d);
+        return false;
+    }
+
+    return true;
+}
+
+/* Decodes some 16-bit stereo into out, returns how many bytes. 0 doesn't
+ * mean the track ended, check d->ended for that. */
+static int decoderread(musicdecoder* d, Uint8* out, const int length)
+{
+    const int want = d->channels == 1 ? length / 4 * 2 : length / 4 * 4;
+    int bitstream;
+
+    if (!d->open || d->ended)
+    {
+        return 0;
+    }
+
+    long got = ov_read(
+        &d->vf,
+        (char*) out,
+        want,
+        SDL_BYTEORDER == SDL_BIG_ENDIAN,
+        2,
+        1,
+        &bitstream
+    );
+
+    if (got == 0)
+    {
+        if (!d->loop || ov_pcm_seek(&d->vf, 0) != 0)
+        {
+            d->ended = true;
+        }
+        return 0;
+    }
+    if (got < 0)
+    {
+        /* Holes in the data are fine, but don't keep going forever */
+        d->errors++;
+        if (d->errors > 16)
+        {
+            vlog_error("Giving up on a broken music track");
+            d->ended = true;
+        }
+        return 0;
+    }
+    d->errors = 0;
+
+    if (d->channels == 1)
+    {
+        Sint16* samples = (Sint16*) out;
+        for (long i = got / 2 - 1; i >= 0; i--)
+        {
+            samples[i * 2] = samples[i];
+            samples[i * 2 + 1] = samples[i];
+        }
+        got *= 2;
+    }
+
+    return got;
+}
+
+musicstreamclass::musicstreamclass(void)
+{
+    SDL_AtomicSet(&writepos, 0);
+    SDL_AtomicSet(&flushpos, 0);
+    SDL_AtomicSet(&readpos, 0);
+    SDL_AtomicSet(&requested, 0);
+    SDL_AtomicSet(&handled, 0);
+    SDL_AtomicSet(&active, 0);
+    SDL_AtomicSet(&underruns, 0);
+
+    lock = NULL;
+    wake = NULL;
+    quit = false;
+    pendingplay = false;
+    pendingloop = false;
+    SDL_zero(pendingsource);
+
+    thread = NULL;
+    decoder = NULL;
+    ring = NULL;
+    frequency = 0;
+}
+
+bool musicstreamclass::init(void)
+{
+    int channels;
+    Uint16 format;
+
+    if (Mix_QuerySpec(&frequency, &format, &channels) == 0)
+    {
+        vlog_error("Unable to stream music: %s", Mix_GetError());
+        return false;
+    }
+    if (format != AUDIO_S16SYS || channels != 2)
+    {
+        vlog_error("Unable to stream music: the mixer isn't 16-bit stereo");
+        return false;
+    }
+
+    ring = (Uint8*) RAM_mallocTagged(ring_bytes, RAM_TAG_AUDIO);
+    decoder = (musicdecoder*) RAM_mallocTagged(sizeof(musicdecoder), RAM_TAG_AUDIO);
+    if (ring == NULL || decoder == NULL)
+    {
+        VVV_exit(1);
+    }
+    SDL_zerop(decoder);
+
+    SDL_AtomicSet(&writepos, 0);
+    SDL_AtomicSet(&flushpos, 0);
+    SDL_AtomicSet(&readpos, 0);
+    SDL_AtomicSet(&requested, 0);
+    SDL_AtomicSet(&handled, 0);
+    SDL_AtomicSet(&active, 0);
+    SDL_AtomicSet(&underruns, 0);
+
+    quit = false;
+    lock = SDL_CreateMutex();
+    wake = SDL_CreateSemaphore(0);
+    if (lock != NULL && wake != NULL)
+    {
+        thread = SDL_CreateThread(threadfunc, "Music", this);
+    }
+    if (thread == NULL)
+    {
+        vlog_error("Unable to start the music thread: %s", SDL_GetError());
+        destroy();
+        return false;
+    }
+
+    vlog_info(
+        "MUSIC | Streaming through %u KB of buffers",
+        (unsigned int) (buffer_bytes() / 1024)
+    );
+    return true;
+}
+
+void musicstreamclass::destroy(void)
+{
+    /* The mixer has let go of the audio callback by now */
+    if (thread != NULL)
+    {
+        SDL_LockMutex(lock);
+        quit = true;
+        SDL_UnlockMutex(lock);
+        SDL_SemPost(wake);
+        SDL_WaitThread(thread, NULL);
+        thread = NULL;
+    }
+    if (wake != NULL)
+    {
+        SDL_DestroySemaphore(wake);
+        wake = NULL;
+    }
+    if (lock != NULL)
+    {
+        SDL_DestroyMutex(lock);
+        lock = NULL;
+    }
+
+    if (decoder != NULL)
+    {
+        decoderclose(decoder);
+        RAM_free(decoder);
+        decoder = NULL;
+    }
+    RAM_free(ring);
+    ring = NULL;
+
+    if (SDL_AtomicGet(&underruns) > 0)
+    {
+        vlog_warn("Music ran dry %i times", SDL_AtomicGet(&underruns));
+    }
+}
+
+void musicstreamclass::request(const bool play, const musicsource* source, const bool loop)
+{
+    if (thread == NULL)
+    {
+        return;
+    }
+
+    SDL_LockMutex(lock);
+    pendingplay = play;
+    pendingloop = loop;
+    if (source != NULL)
+    {
+        pendingsource = *source;
+    }
+    SDL_AtomicAdd(&requested, 1);
+    SDL_UnlockMutex(lock);
+
+    SDL_SemPost(wake);
+}
+
+void musicstreamclass::play(const musicsource& source, const bool loop)
+{
+    request(true, &source, loop);
+}
+
+void musicstreamclass::stop(void)
+{
+    request(false, NULL, false);
+}
+
+int SDLCALL musicstreamclass::threadfunc(void* data)
+{
+    ((musicstreamclass*) data)->decodeloop();
+    return 0;
+}
+
+void musicstreamclass::decodeloop(void)
+{
+    SDL_SetThreadPriority(SDL_THREAD_PRIORITY_HIGH);
+
+    while (true)
+    {
+        /* Woken up by requests, and whenever the ring buffer got drained */
+        SDL_SemWaitTimeout(wake, 100);
+
+        SDL_LockMutex(lock);
+        const bool quitting = quit;
+        const int serial = SDL_AtomicGet(&requested);
+        const bool play = pendingplay;
+        const bool loop = pendingloop;
+        const musicsource source = pendingsource;
+        SDL_UnlockMutex(lock);
+
+        if (quitting)
+        {
+            break;
+        }
+
+        if (serial != SDL_AtomicGet(&handled))
+        {
+            decoderclose(decoder);
+            if (play && decoderopen(decoder, source, loop) && decoder->rate != frequency)
+            {
+                vlog_warn("Music is %li Hz, but the mixer runs at %i Hz", decoder->rate, frequency);
+            }
+
+            /* Whatever is still in the ring buffer is from the old track */
+            SDL_AtomicSet(&flushpos, SDL_AtomicGet(&writepos));
+            SDL_AtomicSet(&handled, serial);
+        }
+
+        while (decoder->open && !decoder->ended && SDL_AtomicGet(&requested) == serial)
+        {
+            const Uint32 write = SDL_AtomicGet(&writepos);
+            const Uint32 read = SDL_AtomicGet(&readpos);
+            const Uint32 space = ring_bytes - (write - read);
+
+            if (space < min_decode_bytes)
+            {
+                break;
+            }
+
+            const Uint32 offset = write % ring_bytes;
+            const int got = decoderread(decoder, &ring[offset], SDL_min(space, ring_bytes - offset));
+            SDL_AtomicSet(&writepos, write + got);
+        }
+
+        SDL_AtomicSet(&active, decoder->open && !decoder->ended);
+    }
+
+    decoderclose(decoder);
+}
+
+int musicstreamclass::read(Sint16* out, const int samples)
+{
+    int done = 0;
+
+    if (ring == NULL)
+    {
+        return 0;
+    }
+
+    /* flushpos is always a value writepos had before, so read it first */
+    const Uint32 flush = SDL_AtomicGet(&flushpos);
+    const Uint32 write = SDL_AtomicGet(&writepos);
+    Uint32 read = SDL_AtomicGet(&readpos);
+
+    /* Skip what's left of the previous track */
+    if ((Sint32) (flush - read) > 0)
+    {
+        read = flush;
+    }
+
+    /* Stay quiet until a new track has replaced the old one */
+    if (SDL_AtomicGet(&requested) == SDL_AtomicGet(&handled))
+    {
+        const int available = SDL_min((Uint32) samples, (write - read) / 2);
+
+        while (done < available)
+        {
+            const Uint32 offset = read % ring_bytes;
+            const int run = SDL_min(available - done, (int) (ring_bytes - offset) / 2);
+
+            SDL_memcpy(&out[done], &ring[offset], run * sizeof(Sint16));
+
+            done += run;
+            read += run * 2;
+        }
+
+        if (done < samples && SDL_AtomicGet(&active))
+        {
+            SDL_AtomicAdd(&underruns, 1);
+        }
+    }
+
+    SDL_AtomicSet(&readpos, read);
+    SDL_SemPost(wake);
+    return done;
+}
+
+#ifdef MIXER_TEST
+void musicstreamclass::initoffline(void)
+{
+    ring = (Uint8*) RAM_mallocTagged(ring_bytes, RAM_TAG_AUDIO);
+    if (ring == NULL)
+    {
+        VVV_exit(1);
+    }
+    frequency = SoundSystem::frequency;
+}
+
+int musicstreamclass::feed(const Sint16* samples, const int count)
+{
+    Uint32 write = SDL_AtomicGet(&writepos);
+    const Uint32 read = SDL_AtomicGet(&readpos);
+    const int fits = SDL_min((Uint32) count, (ring_bytes - (write - read)) / 2);
+    int done = 0;
+
+    while (done < fits)
+    {
+        const Uint32 offset = write % ring_bytes;
+        const int run = SDL_min(fits - done, (int) (ring_bytes - offset) / 2);
+
+        SDL_memcpy(&ring[offset], &samples[done], run * sizeof(Sint16));
+
+        done += run;
+        write += run * 2;
+    }
+
+    SDL_AtomicSet(&writepos, write);
+    return done;
+}
+#endif
+
+static void writewavheader(SDL_RWops* rw, const Uint32 rate, const Uint32 datasize)
+{
+    SDL_RWwrite(rw, "RIFF", 1, 4);
+    SDL_WriteLE32(rw, 36 + datasize);
+    SDL_RWwrite(rw, "WAVEfmt ", 1, 8);
+    SDL_WriteLE32(rw, 16);
+    SDL_WriteLE16(rw, 1); /* PCM */
+    SDL_WriteLE16(rw, 2); /* Channels */
+    SDL_WriteLE32(rw, rate);
+    SDL_WriteLE32(rw, rate * 4);
+    SDL_WriteLE16(rw, 4); /* Bytes per frame */
+    SDL_WriteLE16(rw, 16); /* Bits per sample */
+    SDL_RWwrite(rw, "data", 1, 4);
+    SDL_WriteLE32(rw, datasize);
+}
+
+Uint32 musicstreamclass::buffer_bytes(void)
+{
+    return ring_bytes + sizeof(musicdecoder);
+}
+
+#ifdef DECODE_TRACK
+static Uint32 heapinuse(void)
+{
+    const struct mallinfo info = mallinfo();
+    return info.uordblks;
+}
+
+Uint32 musicstreamclass::measuredecoder(const musicsource& source, const Uint32 limit)
+{
+    musicdecoder* d = (musicdecoder*) RAM_mallocTagged(sizeof(musicdecoder), RAM_TAG_AUDIO);
+    Uint8* pcm = (Uint8*) RAM_mallocTagged(read_bytes, RAM_TAG_AUDIO);
+    Uint32 base;
+    Uint32 peak = 0;
+    Uint32 decoded = 0;
+
+    if (d == NULL || pcm == NULL)
+    {
+        VVV_exit(1);
+    }
+    SDL_zerop(d);
+
+    /* Allocations vorbis frees again within one ov_read() aren't seen, but
+     * its setup, codebooks and block storage stay allocated */
+    base = heapinuse();
+    if (decoderopen(d, source, false))
+    {
+        for (;;)
+        {
+            const Uint32 now = heapinuse();
+            if (now > base)
+            {
+                peak = SDL_max(peak, now - base);
+            }
+
+            if (d->ended || (limit > 0 && decoded >= limit))
+            {
+                break;
+            }
+
+            const int got = decoderread(d, pcm, read_bytes);
+            if (got > 0)
+            {
+                decoded += got;
+            }
+        }
+    }
+
+    decoderclose(d);
+    RAM_free(d);
+    RAM_free(pcm);
+    return peak;
+}
+#endif
+
+bool musicstreamclass::decodetowav(const musicsource& source, const char* filename)
+{
+    musicdecoder* d = (musicdecoder*) RAM_mallocTagged(sizeof(musicdecoder), RAM_TAG_AUDIO);
+    Uint8* pcm = (Uint8*) RAM_mallocTagged(read_bytes, RAM_TAG_AUDIO);
+    SDL_RWops* rw = NULL;
+    Uint32 datasize = 0;
+    bool success = false;
+
+    if (d == NULL || pcm == NULL)
+    {
+        VVV_exit(1);
+    }
+    SDL_zerop(d);
+
+    if (!decoderopen(d, source, false))
+    {
+        goto end;
+    }
+
+    rw = PHYSFSRWOPS_openWrite(filename);
+    if (rw == NULL)
+    {
+        vlog_error("Unable to write %s: %s", filename, SDL_GetError());
+        goto end;
+    }
+
+    /* Filled in once the size is known */
+    writewavheader(rw, d->rate, 0);
+
+    while (!d->ended)
+    {
+        const int got = decoderread(d, pcm, read_bytes);
+        if (got > 0 && SDL_RWwrite(rw, pcm, 1, got) != (size_t) got)
+        {
+            vlog_error("Unable to write %s", filename);
+            goto end;
+        }
+        datasize += got;
+    }
+
+    SDL_RWseek(rw, 0, RW_SEEK_SET);
+    writewavheader(rw, d->rate, datasize);
+    success = true;
+
+    vlog_info("Decoded %s at %u into %s, %u bytes", source.file, source.offset, filename, datasize);
+
+end:
+    if (rw != NULL)
+    {
+        SDL_RWclose(rw);
+    }
+    decoderclose(d);
+    RAM_free(d);
+    RAM_free(pcm);
+    return success;
+}
@@ -0,0 +1,104 @@
+#ifndef MUSICSTREAM_H
+#define MUSICSTREAM_H
+
+#include <SDL2/SDL.h>
+
+/* Where a track is: a byte range of a file in the data archive, either a
+ * music blob or a loose .ogg file */
+struct musicsource
+{
+    const char* file;
+    Uint32 offset;
+    /* 0 for the rest of the file */
+    Uint32 size;
+};
+
+struct musicdecoder;
+
+/* Plays one Ogg Vorbis track at a time. The track is read from the data
+ * archive a few KB at a time and decoded on a thread of its own into a
+ * ring buffer of PCM, which the mixer drains from the audio callback.
+ * That's the only thing the decoding thread and the audio callback share,
+ * and neither has to lock it. Memory use doesn't depend on how long the track is, it's the
+ * ring buffer plus one decoder. */
+class musicstreamclass
+{
+public:
+    musicstreamclass(void);
+
+    bool init(void);
+    void destroy(void);
+
+    void play(const musicsource& source, bool loop);
+    void stop(void);
+
+    /* Decodes a whole track into a WAV file in the save directory, without
+     * a thread or an audio device */
+    static bool decodetowav(const musicsource& source, const char* filename);
+
+    /* About 0.37 seconds of 44.1 kHz stereo */
+    static const Uint32 ring_bytes = 64 * 1024;
+    static const Uint32 read_bytes = 16 * 1024;
+
+    /* What music may take altogether, buffer_bytes() plus what vorbis and
+     * the file it reads from allocate */
+    static const Uint32 memory_budget = 256 * 1024;
+
+    /* The ring buffer and one decoder with its read buffer */
+    static Uint32 buffer_bytes(void);
+
+#ifdef DECODE_TRACK
+    /* Decodes the first limit bytes of a track (all of it if 0) and returns
+     * the most heap vorbis and the file took on top of buffer_bytes(). The
+     * heap is measured as a whole, so nothing else may be running. */
+    static Uint32 measuredecoder(const musicsource& source, Uint32 limit);
+#endif
+
+    /* Called from the audio callback. Copies up to samples of 16-bit
+     * stereo into out, returns how many there were. */
+    int read(Sint16* out, int samples);
+
+#ifdef MIXER_TEST
+    /* A ring buffer without a decoding thread, for MixerTest.cpp. It's
+     * filled with feed(), which returns how many of the samples fit. */
+    void initoffline(void);
+    int feed(const Sint16* samples, int count);
+#endif
+
+private:
+    static int SDLCALL threadfunc(void* data);
+    void decodeloop(void);
+
+    /* Written by the decoding thread, read by the audio callback */
+    SDL_atomic_t writepos;
+    /* Where the current track starts, everything before is skipped */
+    SDL_atomic_t flushpos;
+    /* Written by the audio callback, read by the decoding thread */
+    SDL_atomic_t readpos;
+
+    /* Counts requests from the game, the audio callback stays quiet
+     * while the decoding thread hasn't caught up yet */
+    SDL_atomic_t requested;
+    SDL_atomic_t handled;
+
+    /* Whether a track is still being decoded, for counting underruns */
+    SDL_atomic_t active;
+    SDL_atomic_t underruns;
+
+    void request(bool play, const musicsource* source, bool loop);
+
+    /* The latest request, for the decoding thread */
+    SDL_mutex* lock;
+    SDL_sem* wake;
+    bool quit;
+    bool pendingplay;
+    bool pendingloop;
+    musicsource pendingsource;
+
+    SDL_Thread* thread;
+    musicdecoder* decoder;
+    Uint8* ring;
+    int frequency;
+};
+
+#endif /* MUSICSTREAM_H */
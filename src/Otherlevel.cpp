@@ -2,17 +2,24 @@
 
 #include "Game.h"
 #include "Entity.h"
+#include "LevelPack.h"
 #include "MakeAndPlay.h"
+#include "Map.h"
 #include "UtilityClass.h"
 
+int otherlevelclass::roomindex(int rx, int ry)
+{
+    rx -= 100;
+    ry -= 100;
+    return rx + (ry * 100);
+}
+
 const short* otherlevelclass::loadlevel(int rx, int ry)
 {
     int t;
     roomtileset = 1;
 
-    rx -= 100;
-    ry -= 100;
-    t = rx + (ry * 100);
+    t = roomindex(rx, ry);
     const short* result;
     roomname = "";
     hiddenname = "Dimension VVVVVV";
@@ -23,7 +30,7 @@ const short* otherlevelclass::loadlevel(int rx, int ry)
     case rn(0,0):
     {
 
-        static const short contents[] = {
+        ROOM_CONTENTS(LEVELPACK_OTHERLEVEL, t, 0, {
         201,201,201,201,200,80,80,202,200,80,80,80,80,80,80,80,80,80,80,80,80,80,202,200,80,202,201,201,201,201,200,80,202,606,486,486,486,486,486,486,
         201,201,201,201,200,80,80,202,200,80,80,80,80,80,80,80,80,80,80,80,80,80,202,200,80,202,201,201,201,201,200,80,202,606,486,486,486,486,486,486,
         201,201,201,201,200,80,80,202,240,241,241,241,241,241,241,241,241,241,241,241,241,241,242,200,80,202,201,201,201,201,200,80,202,606,486,486,486,486,486,486,
@@ -54,7 +61,7 @@ const short* otherlevelclass::loadlevel(int rx, int ry)
         486,486,486,486,486,486,486,486,486,608,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,606,486,486,486,486,486,486,
         486,486,486,486,486,486,486,486,486,608,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,606,486,486,486,486,486,486,
         486,486,486,486,486,486,486,486,486,608,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,606,486,486,486,486,486,486,
-        };
+        });
 
         obj.createentity(72, 32, 14); //Teleporter!
         obj.createentity(216, 144, 20, 1);
@@ -67,7 +74,7 @@ const short* otherlevelclass::loadlevel(int rx, int ry)
     case rn(0,1):
     {
 
-        static const short contents[] = {
+        ROOM_CONTENTS(LEVELPACK_OTHERLEVEL, t, 0, {
         495,495,495,495,495,495,495,495,495,617,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,615,495,495,495,495,495,495,
         495,495,495,495,495,495,495,495,495,617,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,615,495,495,495,495,495,495,
         495,495,495,495,495,495,495,495,495,617,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,615,495,495,495,495,495,495,
@@ -98,7 +105,7 @@ const short* otherlevelclass::loadlevel(int rx, int ry)
         495,495,495,495,495,495,495,495,495,617,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,615,495,495,495,495,495,495,
         495,495,495,495,495,495,495,495,495,617,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,615,495,495,495,495,495,495,
         495,495,495,495,495,495,495,495,495,617,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,615,495,495,495,495,495,495,
-        };
+        });
         result = contents;
         break;
     }
@@ -106,7 +113,7 @@ const short* otherlevelclass::loadlevel(int rx, int ry)
     case rn(0,2):
     {
 
-        static const short contents[] = {
+        ROOM_CONTENTS(LEVELPACK_OTHERLEVEL, t, 0, {
         492,492,492,492,492,492,492,492,492,614,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,612,492,492,492,492,492,492,
         492,492,492,492,492,492,492,492,492,614,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,612,492,492,492,492,492,492,
         492,492,492,492,492,492,492,492,492,614,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,612,492,492,492,492,492,492,
@@ -137,7 +144,7 @@ const short* otherlevelclass::loadlevel(int rx, int ry)
         492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,614,0,0,0,612,492,492,492,492,492,492,492,492,492,492,492,492,492,492,
         492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,614,0,0,0,612,492,492,492,492,492,492,492,492,492,492,492,492,492,492,
         492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,614,0,0,0,612,492,492,492,492,492,492,492,492,492,492,492,492,492,492,
-        };
+        });
         result = contents;
         break;
     }
@@ -145,7 +152,7 @@ const short* otherlevelclass::loadlevel(int rx, int ry)
     case rn(0,3):
     {
 
-        static const short contents[] = {
+        ROOM_CONTENTS(LEVELPACK_OTHERLEVEL, t, 0, {
         480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,602,0,0,0,600,480,480,480,480,480,480,480,480,480,480,480,480,480,480,
         480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,602,681,681,681,600,480,480,480,480,480,480,480,480,480,480,480,480,480,480,
         480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,602,0,0,0,600,480,480,480,480,480,480,480,480,480,480,480,480,480,480,
@@ -176,7 +183,7 @@ const short* otherlevelclass::loadlevel(int rx, int ry)
         480,480,480,480,480,602,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
         480,480,480,480,480,602,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
         480,480,480,480,480,602,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-        };
+        });
         result = contents;
         break;
     }
@@ -184,7 +191,7 @@ const short* otherlevelclass::loadlevel(int rx, int ry)
     case rn(0,4):
     {
 
-        static const short contents[] = {
+        ROOM_CONTENTS(LEVELPACK_OTHERLEVEL, t, 0, {
         495,495,495,495,495,617,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
         495,495,495,495,495,617,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
         495,495,495,495,495,617,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
@@ -215,7 +222,7 @@ const short* otherlevelclass::loadlevel(int rx, int ry)
         0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,695,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
         0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,695,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
         0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,695,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-        };
+        });
         result = contents;
         break;
     }
@@ -223,7 +230,7 @@ const short* otherlevelclass::loadlevel(int rx, int ry)
     case rn(0,5):
     {
 
-        static const short contents[] = {
+        ROOM_CONTENTS(LEVELPACK_OTHERLEVEL, t, 0, {
         0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,689,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
         0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,689,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
         0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,689,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
@@ -254,7 +261,7 @@ const short* otherlevelclass::loadlevel(int rx, int ry)
         489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,
         489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,
         489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,
-        };
+        });
         result = contents;
         break;
     }
@@ -262,7 +269,7 @@ const short* otherlevelclass::loadlevel(int rx, int ry)
     case rn(0,6):
     {
 
-        static const short contents[] = {
+        ROOM_CONTENTS(LEVELPACK_OTHERLEVEL, t, 0, {
         480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,
         480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,
         480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,
@@ -293,7 +300,7 @@ const short* otherlevelclass::loadlevel(int rx, int ry)
         480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,602,0,0,0,0,0,0,
         480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,602,0,0,0,0,0,0,
         480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,602,0,0,0,0,0,0,
-        };
+        });
         result = contents;
         break;
     }
@@ -301,7 +308,7 @@ const short* otherlevelclass::loadlevel(int rx, int ry)
     case rn(0,7):
     {
 
-        static const short contents[] = {
+        ROOM_CONTENTS(LEVELPACK_OTHERLEVEL, t, 0, {
         501,501,501,501,501,501,501,501,501,501,501,501,501,501,501,501,501,501,501,501,501,501,501,501,501,501,501,501,501,501,501,501,501,623,0,0,0,0,0,0,
         501,501,501,501,501,501,501,501,501,501,501,501,501,501,501,501,501,501,501,501,501,501,501,501,501,501,501,501,501,501,501,501,501,623,0,0,0,0,0,0,
         501,501,501,501,501,501,501,501,501,501,501,501,501,501,501,501,501,501,501,501,501,501,501,501,501,501,501,501,501,501,501,501,501,623,0,0,0,0,0,0,
@@ -332,7 +339,7 @@ const short* otherlevelclass::loadlevel(int rx, int ry)
         501,501,501,501,501,501,501,501,501,501,501,501,501,501,501,501,501,501,501,501,501,501,501,501,501,623,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
         501,501,501,501,501,501,501,501,501,501,501,501,501,501,501,501,501,501,501,501,501,501,501,501,501,623,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
         501,501,501,501,501,501,501,501,501,501,501,501,501,501,501,501,501,501,501,501,501,501,501,501,501,623,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-        };
+        });
         result = contents;
         break;
     }
@@ -340,7 +347,7 @@ const short* otherlevelclass::loadlevel(int rx, int ry)
     case rn(0,8):
     {
 
-        static const short contents[] = {
+        ROOM_CONTENTS(LEVELPACK_OTHERLEVEL, t, 0, {
         498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,620,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
         498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,620,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
         498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,620,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
@@ -371,7 +378,7 @@ const short* otherlevelclass::loadlevel(int rx, int ry)
         498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,620,0,0,0,0,0,0,0,
         498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,620,0,0,0,0,0,0,0,
         498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,620,0,0,0,0,0,0,0,
-        };
+        });
         result = contents;
         break;
     }
@@ -379,7 +386,7 @@ const short* otherlevelclass::loadlevel(int rx, int ry)
     case rn(0,9):
     {
 
-        static const short contents[] = {
+        ROOM_CONTENTS(LEVELPACK_OTHERLEVEL, t, 0, {
         480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,602,0,0,0,0,0,0,0,
         480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,602,0,0,0,0,0,0,0,
         641,641,641,641,482,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,602,0,0,0,0,0,0,0,
@@ -410,7 +417,7 @@ const short* otherlevelclass::loadlevel(int rx, int ry)
         480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,
         480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,
         480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,
-        };
+        });
 
         obj.createentity(152, 144, 10, 1, 9000);  // (savepoint)
         result = contents;
@@ -420,7 +427,7 @@ const short* otherlevelclass::loadlevel(int rx, int ry)
     case rn(0,10):
     {
 
-        static const short contents[] = {
+        ROOM_CONTENTS(LEVELPACK_OTHERLEVEL, t, 0, {
         483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,
         483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,
         483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,
@@ -451,7 +458,7 @@ const short* otherlevelclass::loadlevel(int rx, int ry)
         483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,
         483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,
         483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,
-        };
+        });
 
         obj.createentity(224, 96, 10, 0, 10000);  // (savepoint)
         result = contents;
@@ -461,7 +468,7 @@ const short* otherlevelclass::loadlevel(int rx, int ry)
     case rn(0,11):
     {
 
-        static const short contents[] = {
+        ROOM_CONTENTS(LEVELPACK_OTHERLEVEL, t, 0, {
         480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,
         480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,
         641,641,641,641,641,641,641,641,641,641,482,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,
@@ -492,7 +499,7 @@ const short* otherlevelclass::loadlevel(int rx, int ry)
         480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,521,561,561,561,561,561,561,561,561,561,561,561,
         480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,
         480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,
-        };
+        });
 
         obj.createentity(56, 32, 13); //Warp Token
 
@@ -503,7 +510,7 @@ const short* otherlevelclass::loadlevel(int rx, int ry)
     case rn(0,12):
     {
 
-        static const short contents[] = {
+        ROOM_CONTENTS(LEVELPACK_OTHERLEVEL, t, 0, {
         492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,
         492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,
         492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,
@@ -534,7 +541,7 @@ const short* otherlevelclass::loadlevel(int rx, int ry)
         0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
         0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
         0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-        };
+        });
         result = contents;
         break;
     }
@@ -542,7 +549,7 @@ const short* otherlevelclass::loadlevel(int rx, int ry)
     case rn(0,13):
     {
 
-        static const short contents[] = {
+        ROOM_CONTENTS(LEVELPACK_OTHERLEVEL, t, 0, {
         0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
         0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
         0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
@@ -573,7 +580,7 @@ const short* otherlevelclass::loadlevel(int rx, int ry)
         483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,
         483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,
         483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,
-        };
+        });
         result = contents;
         break;
     }
@@ -581,7 +588,7 @@ const short* otherlevelclass::loadlevel(int rx, int ry)
     case rn(0,14):
     {
 
-        static const short contents[] = {
+        ROOM_CONTENTS(LEVELPACK_OTHERLEVEL, t, 0, {
         495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,
         495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,
         495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,
@@ -612,7 +619,7 @@ const short* otherlevelclass::loadlevel(int rx, int ry)
         495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,617,0,0,0,0,0,
         495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,617,0,0,0,0,0,
         495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,617,0,0,0,0,0,
-        };
+        });
         result = contents;
         break;
     }
@@ -620,7 +627,7 @@ const short* otherlevelclass::loadlevel(int rx, int ry)
     case rn(0,15):
     {
 
-        static const short contents[] = {
+        ROOM_CONTENTS(LEVELPACK_OTHERLEVEL, t, 0, {
         498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,620,0,0,0,0,0,
         498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,620,0,0,0,0,0,
         498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,620,0,0,0,0,0,
@@ -651,7 +658,7 @@ const short* otherlevelclass::loadlevel(int rx, int ry)
         498,498,498,498,498,498,498,498,620,699,699,699,699,699,700,699,699,699,699,699,699,699,699,699,699,699,699,700,699,699,699,699,699,699,699,699,699,699,699,699,
         498,498,498,498,498,498,498,498,620,0,0,0,0,0,698,0,0,0,0,0,0,0,0,0,0,0,0,698,0,0,0,0,0,0,0,0,0,0,0,0,
         498,498,498,498,498,498,498,498,620,0,0,0,0,0,698,0,0,0,0,0,0,0,0,0,0,0,0,698,0,0,0,0,0,0,0,0,0,0,0,0,
-        };
+        });
         result = contents;
         break;
     }
@@ -659,7 +666,7 @@ const short* otherlevelclass::loadlevel(int rx, int ry)
     case rn(0,16):
     {
 
-        static const short contents[] = {
+        ROOM_CONTENTS(LEVELPACK_OTHERLEVEL, t, 0, {
         480,480,480,480,480,480,480,480,602,0,0,0,0,0,680,0,0,0,0,0,0,0,0,0,0,0,0,680,0,0,0,0,0,0,0,0,0,0,0,0,
         480,480,480,480,480,480,480,481,642,0,0,0,0,0,680,0,0,0,0,0,0,0,0,0,0,0,0,680,0,0,0,0,0,0,0,0,0,0,0,0,
         480,480,480,480,480,480,480,602,0,0,0,0,0,0,680,0,0,0,0,0,0,0,0,0,0,0,0,680,0,0,0,0,0,0,0,0,0,0,0,0,
@@ -690,7 +697,7 @@ const short* otherlevelclass::loadlevel(int rx, int ry)
         480,480,480,480,480,480,480,480,480,480,480,480,480,480,521,561,561,561,561,561,561,561,561,561,561,561,561,561,561,561,561,561,561,561,561,561,561,561,561,561,
         480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,
         480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,
-        };
+        });
 
         obj.createentity(120, 40, 14); //Teleporter!
         result = contents;
@@ -700,7 +707,7 @@ const short* otherlevelclass::loadlevel(int rx, int ry)
     case rn(0,17):
     {
 
-        static const short contents[] = {
+        ROOM_CONTENTS(LEVELPACK_OTHERLEVEL, t, 0, {
         489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,
         489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,
         489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,
@@ -731,7 +738,7 @@ const short* otherlevelclass::loadlevel(int rx, int ry)
         489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,
         489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,
         489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,
-        };
+        });
         result = contents;
         break;
     }
@@ -739,7 +746,7 @@ const short* otherlevelclass::loadlevel(int rx, int ry)
     case rn(1,2):
     {
 
-        static const short contents[] = {
+        ROOM_CONTENTS(LEVELPACK_OTHERLEVEL, t, 0, {
         495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,
         495,495,495,495,495,495,495,496,656,656,656,656,656,656,656,656,656,656,656,656,656,656,656,656,656,656,656,656,656,656,656,656,656,656,656,656,656,656,656,656,
         495,495,495,495,495,495,495,617,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
@@ -770,7 +777,7 @@ const short* otherlevelclass::loadlevel(int rx, int ry)
         495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,617,0,0,0,0,0,0,615,495,495,495,495,495,495,495,495,495,495,
         495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,617,0,0,0,0,0,0,615,495,495,495,495,495,495,495,495,495,495,
         495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,617,0,0,0,0,0,0,615,495,495,495,495,495,495,495,495,495,495,
-        };
+        });
         result = contents;
         break;
     }
@@ -778,7 +785,7 @@ const short* otherlevelclass::loadlevel(int rx, int ry)
     case rn(1,3):
     {
 
-        static const short contents[] = {
+        ROOM_CONTENTS(LEVELPACK_OTHERLEVEL, t, 0, {
         489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,611,0,0,0,0,0,0,609,489,489,489,489,489,489,489,489,489,489,
         489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,490,651,0,0,0,0,0,0,609,489,489,489,489,489,489,489,489,489,489,
         489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,611,0,0,0,0,0,0,0,609,489,489,489,489,489,489,489,489,489,489,
@@ -809,7 +816,7 @@ const short* otherlevelclass::loadlevel(int rx, int ry)
         0,0,0,0,0,0,569,570,570,531,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,
         0,0,0,0,0,0,609,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,
         0,0,0,0,0,0,609,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,
-        };
+        });
         result = contents;
         break;
     }
@@ -817,7 +824,7 @@ const short* otherlevelclass::loadlevel(int rx, int ry)
     case rn(1,4):
     {
 
-        static const short contents[] = {
+        ROOM_CONTENTS(LEVELPACK_OTHERLEVEL, t, 0, {
         0,0,0,0,0,0,603,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,
         0,0,0,0,0,0,643,485,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,
         0,0,0,0,0,0,0,603,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,
@@ -848,7 +855,7 @@ const short* otherlevelclass::loadlevel(int rx, int ry)
         0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,603,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,
         0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,603,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,
         0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,603,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,
-        };
+        });
 
         obj.createentity(144, 136, 10, 1, 4010);  // (savepoint)
         result = contents;
@@ -858,7 +865,7 @@ const short* otherlevelclass::loadlevel(int rx, int ry)
     case rn(1,5):
     {
 
-        static const short contents[] = {
+        ROOM_CONTENTS(LEVELPACK_OTHERLEVEL, t, 0, {
         0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,600,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,
         0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,600,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,
         0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,600,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,
@@ -889,7 +896,7 @@ const short* otherlevelclass::loadlevel(int rx, int ry)
         480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,
         480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,
         480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,
-        };
+        });
 
         obj.createentity(88, 104, 10, 1, 106010);  // (savepoint)
         result = contents;
@@ -899,7 +906,7 @@ const short* otherlevelclass::loadlevel(int rx, int ry)
     case rn(1,6):
     {
 
-        static const short contents[] = {
+        ROOM_CONTENTS(LEVELPACK_OTHERLEVEL, t, 0, {
         489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,
         489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,
         489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,
@@ -930,7 +937,7 @@ const short* otherlevelclass::loadlevel(int rx, int ry)
         0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
         0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
         0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-        };
+        });
         result = contents;
         break;
     }
@@ -938,7 +945,7 @@ const short* otherlevelclass::loadlevel(int rx, int ry)
     case rn(1,8):
     {
 
-        static const short contents[] = {
+        ROOM_CONTENTS(LEVELPACK_OTHERLEVEL, t, 0, {
         0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
         0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
         0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
@@ -969,7 +976,7 @@ const short* otherlevelclass::loadlevel(int rx, int ry)
         0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
         0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
         0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-        };
+        });
         result = contents;
         break;
     }
@@ -977,7 +984,7 @@ const short* otherlevelclass::loadlevel(int rx, int ry)
     case rn(1,9):
     {
 
-        static const short contents[] = {
+        ROOM_CONTENTS(LEVELPACK_OTHERLEVEL, t, 0, {
         0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
         0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
         0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
@@ -1008,7 +1015,7 @@ const short* otherlevelclass::loadlevel(int rx, int ry)
         483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,524,564,565,236,116,116,116,116,116,116,116,116,116,116,116,116,116,116,116,116,
         483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,605,236,116,116,116,116,116,116,116,116,116,116,116,116,116,116,116,116,
         483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,605,236,116,116,116,116,116,116,116,116,116,116,116,116,116,116,116,116,
-        };
+        });
 
         obj.createentity(152, 64, 10, 0, 9010);  // (savepoint)
         result = contents;
@@ -1018,7 +1025,7 @@ const short* otherlevelclass::loadlevel(int rx, int ry)
     case rn(1,10):
     {
 
-        static const short contents[] = {
+        ROOM_CONTENTS(LEVELPACK_OTHERLEVEL, t, 0, {
         492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,
         492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,
         492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,
@@ -1049,7 +1056,7 @@ const short* otherlevelclass::loadlevel(int rx, int ry)
         492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,
         492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,
         492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,
-        };
+        });
 
         obj.createentity(208, 120, 9, 15);  // (shiny trinket)
         result = contents;
@@ -1059,7 +1066,7 @@ const short* otherlevelclass::loadlevel(int rx, int ry)
     case rn(1,11):
     {
 
-        static const short contents[] = {
+        ROOM_CONTENTS(LEVELPACK_OTHERLEVEL, t, 0, {
         492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,
         492,492,493,653,653,653,653,653,653,653,653,653,653,653,653,653,653,653,653,653,653,653,653,653,653,653,653,653,653,653,494,492,493,653,653,653,653,494,492,492,
         492,492,614,0,0,0,0,0,0,0,0,692,0,0,0,0,692,0,0,0,0,692,0,0,0,0,692,0,0,0,612,492,614,0,0,0,0,612,492,492,
@@ -1090,7 +1097,7 @@ const short* otherlevelclass::loadlevel(int rx, int ry)
         573,573,573,573,573,573,573,573,534,492,533,573,573,573,573,573,573,573,573,573,573,573,573,573,573,573,573,573,573,573,573,573,573,573,573,573,573,534,492,492,
         492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,
         492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,
-        };
+        });
 
         obj.createentity(40, 192, 13); //Warp Token
         obj.createentity(168, 136, 13); //Warp Token
@@ -1107,7 +1114,7 @@ const short* otherlevelclass::loadlevel(int rx, int ry)
     case rn(1,12):
     {
 
-        static const short contents[] = {
+        ROOM_CONTENTS(LEVELPACK_OTHERLEVEL, t, 0, {
         489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,611,230,110,110,110,110,110,110,
         489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,611,270,271,271,271,271,271,271,
         489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,530,570,570,570,570,570,570,570,
@@ -1138,7 +1145,7 @@ const short* otherlevelclass::loadlevel(int rx, int ry)
         0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,689,0,0,0,0,0,0,0,0,0,0,0,0,0,
         0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,689,0,0,0,0,0,0,0,0,0,0,0,0,0,
         0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,689,0,0,0,0,0,0,0,0,0,0,0,0,0,
-        };
+        });
         result = contents;
         break;
     }
@@ -1146,7 +1153,7 @@ const short* otherlevelclass::loadlevel(int rx, int ry)
     case rn(1,13):
     {
 
-        static const short contents[] = {
+        ROOM_CONTENTS(LEVELPACK_OTHERLEVEL, t, 0, {
         0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,680,0,0,0,0,0,0,0,0,0,0,0,0,0,
         0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,680,0,0,0,0,0,0,0,0,0,0,0,0,0,
         0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,680,0,0,0,0,0,0,0,0,0,0,0,0,0,
@@ -1177,7 +1184,7 @@ const short* otherlevelclass::loadlevel(int rx, int ry)
         480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,
         480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,
         480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,
-        };
+        });
 
         obj.createentity(112, 152, 10, 1, 13010);  // (savepoint)
         result = contents;
@@ -1187,7 +1194,7 @@ const short* otherlevelclass::loadlevel(int rx, int ry)
     case rn(1,14):
     {
 
-        static const short contents[] = {
+        ROOM_CONTENTS(LEVELPACK_OTHERLEVEL, t, 0, {
         483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,
         483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,
         483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,
@@ -1218,7 +1225,7 @@ const short* otherlevelclass::loadlevel(int rx, int ry)
         0,0,0,0,0,0,0,0,0,683,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,603,483,483,483,483,483,483,483,483,
         0,0,0,0,0,0,0,0,0,683,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,603,483,483,483,483,483,483,483,483,
         0,0,0,0,0,0,0,0,0,683,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,603,483,483,483,483,483,483,483,483,
-        };
+        });
         result = contents;
         break;
     }
@@ -1226,7 +1233,7 @@ const short* otherlevelclass::loadlevel(int rx, int ry)
     case rn(1,15):
     {
 
-        static const short contents[] = {
+        ROOM_CONTENTS(LEVELPACK_OTHERLEVEL, t, 0, {
         0,0,0,0,0,0,0,0,0,692,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,612,492,492,492,492,492,492,492,492,
         0,0,0,0,0,0,0,0,0,692,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,612,492,492,492,492,492,492,492,492,
         0,0,0,0,0,0,0,0,0,692,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,612,492,492,492,492,492,492,492,492,
@@ -1257,7 +1264,7 @@ const short* otherlevelclass::loadlevel(int rx, int ry)
         693,693,693,693,693,693,693,693,693,694,693,693,693,693,693,693,693,693,693,693,693,693,693,693,693,693,612,492,492,492,492,492,492,492,492,492,492,492,492,492,
         0,0,0,0,0,0,0,0,0,692,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,612,492,492,492,492,492,492,492,492,492,492,492,492,492,
         0,0,0,0,0,0,0,0,0,692,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,612,492,492,492,492,492,492,492,492,492,492,492,492,492,
-        };
+        });
         result = contents;
         break;
     }
@@ -1265,7 +1272,7 @@ const short* otherlevelclass::loadlevel(int rx, int ry)
     case rn(1,16):
     {
 
-        static const short contents[] = {
+        ROOM_CONTENTS(LEVELPACK_OTHERLEVEL, t, 0, {
         0,0,0,0,0,0,0,0,0,695,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,615,495,495,495,495,495,495,495,495,495,495,495,495,495,
         0,0,0,0,0,0,0,0,0,695,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,615,495,495,495,495,495,495,495,495,495,495,495,495,495,
         0,0,0,0,0,0,0,0,0,695,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,615,495,495,495,495,495,495,495,495,495,495,495,495,495,
@@ -1296,7 +1303,7 @@ const short* otherlevelclass::loadlevel(int rx, int ry)
         576,576,576,576,576,576,576,576,576,576,576,576,576,576,576,576,576,576,576,576,576,576,576,576,576,576,576,576,576,576,576,576,576,577,415,295,295,295,295,295,
         495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,617,415,295,295,295,295,295,
         495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,617,415,295,295,295,295,295,
-        };
+        });
 
         obj.createentity(280, 120, 10, 1, 16010);  // (savepoint)
         result = contents;
@@ -1306,7 +1313,7 @@ const short* otherlevelclass::loadlevel(int rx, int ry)
     case rn(2,2):
     {
 
-        static const short contents[] = {
+        ROOM_CONTENTS(LEVELPACK_OTHERLEVEL, t, 0, {
         483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,
         644,644,644,644,644,644,644,644,644,644,644,644,644,644,644,644,644,644,644,644,644,644,644,644,485,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,
         0,0,0,0,683,0,0,0,0,0,0,0,683,0,0,0,0,0,0,0,0,0,0,50,603,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,
@@ -1337,7 +1344,7 @@ const short* otherlevelclass::loadlevel(int rx, int ry)
         483,483,483,483,483,483,483,483,483,605,49,0,0,0,0,0,0,50,603,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,
         483,483,483,483,483,483,483,483,483,605,49,0,0,0,0,0,0,50,603,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,
         483,483,483,483,483,483,483,483,483,605,49,0,0,0,0,0,0,50,603,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,
-        };
+        });
 
         obj.createentity(56, 32, 10, 1, 2020);  // (savepoint)
         result = contents;
@@ -1347,7 +1354,7 @@ const short* otherlevelclass::loadlevel(int rx, int ry)
     case rn(2,3):
     {
 
-        static const short contents[] = {
+        ROOM_CONTENTS(LEVELPACK_OTHERLEVEL, t, 0, {
         489,489,489,489,489,489,489,489,489,611,49,0,0,0,0,0,0,50,609,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,
         489,489,489,489,489,489,489,489,489,611,49,0,0,0,0,0,0,50,609,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,
         489,489,489,489,489,489,489,489,489,611,49,0,0,0,0,0,0,50,609,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,
@@ -1378,7 +1385,7 @@ const short* otherlevelclass::loadlevel(int rx, int ry)
         489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,
         489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,
         489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,
-        };
+        });
         result = contents;
         break;
     }
@@ -1386,7 +1393,7 @@ const short* otherlevelclass::loadlevel(int rx, int ry)
     case rn(2,5):
     {
 
-        static const short contents[] = {
+        ROOM_CONTENTS(LEVELPACK_OTHERLEVEL, t, 0, {
         483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,
         483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,
         483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,
@@ -1417,7 +1424,7 @@ const short* otherlevelclass::loadlevel(int rx, int ry)
         483,483,483,483,483,483,483,483,483,483,605,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
         483,483,483,483,483,483,483,483,483,483,605,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
         483,483,483,483,483,483,483,483,483,483,605,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-        };
+        });
         result = contents;
         break;
     }
@@ -1425,7 +1432,7 @@ const short* otherlevelclass::loadlevel(int rx, int ry)
     case rn(2,6):
     {
 
-        static const short contents[] = {
+        ROOM_CONTENTS(LEVELPACK_OTHERLEVEL, t, 0, {
         486,486,486,486,486,486,486,486,486,486,608,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
         486,486,486,486,486,486,486,486,486,486,608,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
         486,486,486,486,486,486,486,486,486,486,608,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
@@ -1456,7 +1463,7 @@ const short* otherlevelclass::loadlevel(int rx, int ry)
         0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
         0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
         0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-        };
+        });
 
         obj.createentity(40, 88, 10, 1, 6020);  // (savepoint)
         result = contents;
@@ -1466,7 +1473,7 @@ const short* otherlevelclass::loadlevel(int rx, int ry)
     case rn(2,8):
     {
 
-        static const short contents[] = {
+        ROOM_CONTENTS(LEVELPACK_OTHERLEVEL, t, 0, {
         0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
         0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
         0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
@@ -1497,7 +1504,7 @@ const short* otherlevelclass::loadlevel(int rx, int ry)
         0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,695,0,0,0,0,0,0,0,0,
         0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,695,0,0,0,0,0,0,0,0,
         0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,695,0,0,0,0,0,0,0,0,
-        };
+        });
         result = contents;
         break;
     }
@@ -1505,7 +1512,7 @@ const short* otherlevelclass::loadlevel(int rx, int ry)
     case rn(2,9):
     {
 
-        static const short contents[] = {
+        ROOM_CONTENTS(LEVELPACK_OTHERLEVEL, t, 0, {
         0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,680,0,0,0,0,0,0,0,0,
         0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,680,0,0,0,0,0,0,0,0,
         0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,680,0,0,0,0,0,0,0,0,
@@ -1536,7 +1543,7 @@ const short* otherlevelclass::loadlevel(int rx, int ry)
         113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,
         113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,
         113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,
-        };
+        });
         result = contents;
         break;
     }
@@ -1545,7 +1552,7 @@ const short* otherlevelclass::loadlevel(int rx, int ry)
         if(obj.altstates==0)
         {
 
-            static const short contents[] = {
+            ROOM_CONTENTS(LEVELPACK_OTHERLEVEL, t, 0, {
             113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,
             113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,
             113,113,113,114,274,274,274,274,274,274,274,274,274,274,274,274,274,274,274,274,274,274,274,274,274,274,274,274,274,274,115,113,113,113,113,113,113,113,113,113,
@@ -1576,7 +1583,7 @@ const short* otherlevelclass::loadlevel(int rx, int ry)
             113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,
             113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,
             113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,
-            };
+            });
 
             obj.createentity(40, 32, 22, 0);  // (shiny trinket)
             obj.createentity(64, 32, 22, 1);  // (shiny trinket)
@@ -1608,7 +1615,7 @@ const short* otherlevelclass::loadlevel(int rx, int ry)
         else
         {
 
-            static const short contents[] = {
+            ROOM_CONTENTS(LEVELPACK_OTHERLEVEL, t, 1, {
             113,113,113,113,113,113,113,114,274,274,274,274,274,274,274,274,274,274,115,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,
             113,113,113,113,113,114,274,275,0,0,0,0,0,0,0,0,0,0,273,274,274,274,274,274,274,274,115,113,113,113,113,113,113,113,113,113,113,113,113,113,
             113,113,113,114,274,275,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,273,274,274,274,115,113,113,113,113,113,113,113,113,113,
@@ -1639,7 +1646,7 @@ const short* otherlevelclass::loadlevel(int rx, int ry)
             113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,154,194,194,194,194,194,194,194,155,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,
             113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,
             113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,
-            };
+            });
 
             obj.createentity(90, 52, 26, 0);  // (super warp)
             result = contents;
@@ -1651,7 +1658,7 @@ const short* otherlevelclass::loadlevel(int rx, int ry)
     case rn(2,11):
     {
 
-        static const short contents[] = {
+        ROOM_CONTENTS(LEVELPACK_OTHERLEVEL, t, 0, {
         104,104,104,104,104,104,104,104,104,104,104,104,104,104,104,104,104,104,104,104,104,104,104,104,104,104,104,104,104,104,104,104,104,104,104,104,104,104,104,104,
         104,104,104,104,104,104,104,104,104,104,104,104,104,104,104,104,104,104,104,104,104,104,104,104,104,104,104,104,104,104,104,104,104,104,104,104,104,104,104,104,
         104,104,104,104,104,104,104,104,104,104,104,104,104,104,104,104,104,104,104,104,104,104,104,104,104,104,104,104,104,104,104,104,104,104,104,104,104,104,104,104,
@@ -1682,7 +1689,7 @@ const short* otherlevelclass::loadlevel(int rx, int ry)
         104,104,104,104,104,104,104,104,104,104,104,104,104,104,104,104,104,104,104,104,104,104,104,104,104,104,104,104,104,104,104,104,104,104,104,104,104,104,104,104,
         104,104,104,104,104,104,104,104,104,104,104,104,104,104,104,104,104,104,104,104,104,104,104,104,104,104,104,104,104,104,104,104,104,104,104,104,104,104,104,104,
         104,104,104,104,104,104,104,104,104,104,104,104,104,104,104,104,104,104,104,104,104,104,104,104,104,104,104,104,104,104,104,104,104,104,104,104,104,104,104,104,
-        };
+        });
 
         obj.createentity(64, 64, 14); //Teleporter!
         hiddenname = "The Ship";
@@ -1693,7 +1700,7 @@ const short* otherlevelclass::loadlevel(int rx, int ry)
     case rn(2,12):
     {
 
-        static const short contents[] = {
+        ROOM_CONTENTS(LEVELPACK_OTHERLEVEL, t, 0, {
         104,104,104,104,104,104,104,104,104,104,104,104,104,104,104,104,104,104,104,104,104,104,104,104,104,104,104,104,104,104,104,104,104,104,104,104,104,104,104,104,
         265,265,265,265,106,105,265,265,265,265,265,265,265,106,104,105,265,265,265,265,265,265,265,106,105,265,265,265,265,265,265,265,106,104,105,265,265,265,265,265,
         567,567,567,568,224,226,566,567,567,567,567,567,568,224,105,266,566,567,567,567,567,567,568,224,226,566,567,567,567,567,567,568,264,106,226,566,567,567,567,567,
@@ -1724,7 +1731,7 @@ const short* otherlevelclass::loadlevel(int rx, int ry)
         0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
         0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
         0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-        };
+        });
         hiddenname = "The Ship";
         result = contents;
         break;
@@ -1733,7 +1740,7 @@ const short* otherlevelclass::loadlevel(int rx, int ry)
     case rn(2,13):
     {
 
-        static const short contents[] = {
+        ROOM_CONTENTS(LEVELPACK_OTHERLEVEL, t, 0, {
         0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
         0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
         0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
@@ -1764,7 +1771,7 @@ const short* otherlevelclass::loadlevel(int rx, int ry)
         495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,
         495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,
         495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,
-        };
+        });
         result = contents;
         break;
     }
@@ -1772,7 +1779,7 @@ const short* otherlevelclass::loadlevel(int rx, int ry)
     case rn(2,14):
     {
 
-        static const short contents[] = {
+        ROOM_CONTENTS(LEVELPACK_OTHERLEVEL, t, 0, {
         486,486,486,486,486,486,486,486,486,486,486,486,486,486,486,486,486,486,486,486,486,486,486,486,486,486,486,486,486,486,486,486,486,486,486,486,486,486,486,486,
         486,486,486,486,486,486,486,486,486,486,486,486,486,486,486,486,486,486,486,486,486,486,486,486,486,486,486,486,486,486,486,486,486,486,486,486,486,486,486,486,
         486,486,486,486,486,486,486,486,486,486,486,486,486,486,486,486,486,486,486,486,486,486,486,486,486,486,486,486,486,486,486,486,486,486,486,486,486,486,486,486,
@@ -1803,7 +1810,7 @@ const short* otherlevelclass::loadlevel(int rx, int ry)
         486,486,486,486,486,486,486,486,486,486,486,486,486,486,486,486,608,0,0,0,606,486,486,486,486,486,486,486,486,486,486,486,486,486,486,486,486,486,486,486,
         486,486,486,486,486,486,486,486,486,486,486,486,486,486,486,486,608,0,0,0,606,486,486,486,486,486,486,486,486,486,486,486,486,486,486,486,486,486,486,486,
         486,486,486,486,486,486,486,486,486,486,486,486,486,486,486,486,608,0,0,0,606,486,486,486,486,486,486,486,486,486,486,486,486,486,486,486,486,486,486,486,
-        };
+        });
         result = contents;
         break;
     }
@@ -1811,7 +1818,7 @@ const short* otherlevelclass::loadlevel(int rx, int ry)
     case rn(2,15):
     {
 
-        static const short contents[] = {
+        ROOM_CONTENTS(LEVELPACK_OTHERLEVEL, t, 0, {
         489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,611,0,0,0,609,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,
         489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,611,0,0,0,609,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,
         489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,611,0,0,0,609,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,
@@ -1842,7 +1849,7 @@ const short* otherlevelclass::loadlevel(int rx, int ry)
         489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,
         489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,
         489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,
-        };
+        });
 
         obj.createentity(240, 96, 10, 0, 15020);  // (savepoint)
         result = contents;
@@ -1852,7 +1859,7 @@ const short* otherlevelclass::loadlevel(int rx, int ry)
     case rn(3,2):
     {
 
-        static const short contents[] = {
+        ROOM_CONTENTS(LEVELPACK_OTHERLEVEL, t, 0, {
         498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,
         498,498,498,499,659,659,659,659,500,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,499,659,659,659,659,500,498,498,
         498,498,498,620,0,0,0,0,618,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,620,0,0,0,0,618,498,498,
@@ -1883,7 +1890,7 @@ const short* otherlevelclass::loadlevel(int rx, int ry)
         498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,620,0,0,0,0,618,498,498,
         498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,620,0,0,0,0,618,498,498,
         498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,620,0,0,0,0,618,498,498,
-        };
+        });
 
         obj.createentity(152, 96, 9, 16);  // (shiny trinket)
         result = contents;
@@ -1893,7 +1900,7 @@ const short* otherlevelclass::loadlevel(int rx, int ry)
     case rn(3,3):
     {
 
-        static const short contents[] = {
+        ROOM_CONTENTS(LEVELPACK_OTHERLEVEL, t, 0, {
         501,501,501,501,501,501,501,501,501,501,501,501,501,501,501,501,501,501,501,501,501,501,501,501,501,501,501,501,501,501,501,501,623,0,0,0,0,621,501,501,
         501,501,501,501,501,501,501,501,501,501,501,501,501,501,501,501,501,501,501,501,501,501,501,501,501,501,501,501,501,501,501,501,623,0,0,0,0,621,501,501,
         501,501,501,501,501,501,501,501,501,501,501,501,501,501,501,501,501,501,501,501,501,501,501,501,501,501,501,501,501,501,501,501,623,0,0,0,0,621,501,501,
@@ -1924,7 +1931,7 @@ const short* otherlevelclass::loadlevel(int rx, int ry)
         501,501,501,501,501,501,501,501,501,501,501,501,501,501,501,501,501,501,501,501,501,501,501,501,501,501,501,501,501,501,501,501,501,501,501,501,501,501,501,501,
         501,501,501,501,501,501,501,501,501,501,501,501,501,501,501,501,501,501,501,501,501,501,501,501,501,501,501,501,501,501,501,501,501,501,501,501,501,501,501,501,
         501,501,501,501,501,501,501,501,501,501,501,501,501,501,501,501,501,501,501,501,501,501,501,501,501,501,501,501,501,501,501,501,501,501,501,501,501,501,501,501,
-        };
+        });
 
         obj.createentity(24, 192, 10, 1, 3030);  // (savepoint)
         result = contents;
@@ -1934,7 +1941,7 @@ const short* otherlevelclass::loadlevel(int rx, int ry)
     case rn(3,5):
     {
 
-        static const short contents[] = {
+        ROOM_CONTENTS(LEVELPACK_OTHERLEVEL, t, 0, {
         480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,
         480,480,480,480,480,480,480,480,480,480,480,481,641,641,641,641,641,641,641,482,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,
         480,480,480,480,480,480,480,480,481,641,641,642,0,0,0,0,0,0,0,640,641,641,641,641,641,641,482,480,480,480,480,480,480,480,480,480,480,480,480,480,
@@ -1965,7 +1972,7 @@ const short* otherlevelclass::loadlevel(int rx, int ry)
         0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,680,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
         0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,680,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
         0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,680,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-        };
+        });
         result = contents;
         break;
     }
@@ -1973,7 +1980,7 @@ const short* otherlevelclass::loadlevel(int rx, int ry)
     case rn(3,6):
     {
 
-        static const short contents[] = {
+        ROOM_CONTENTS(LEVELPACK_OTHERLEVEL, t, 0, {
         0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,692,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
         0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,692,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
         0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,692,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
@@ -2004,7 +2011,7 @@ const short* otherlevelclass::loadlevel(int rx, int ry)
         0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,692,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
         0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,692,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
         0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,692,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-        };
+        });
         result = contents;
         break;
     }
@@ -2012,7 +2019,7 @@ const short* otherlevelclass::loadlevel(int rx, int ry)
     case rn(3,7):
     {
 
-        static const short contents[] = {
+        ROOM_CONTENTS(LEVELPACK_OTHERLEVEL, t, 0, {
         0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,689,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
         0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,689,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
         0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,689,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
@@ -2043,7 +2050,7 @@ const short* otherlevelclass::loadlevel(int rx, int ry)
         0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,689,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
         0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,689,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
         0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,689,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-        };
+        });
         result = contents;
         break;
     }
@@ -2051,7 +2058,7 @@ const short* otherlevelclass::loadlevel(int rx, int ry)
     case rn(3,8):
     {
 
-        static const short contents[] = {
+        ROOM_CONTENTS(LEVELPACK_OTHERLEVEL, t, 0, {
         0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,686,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
         0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,686,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
         0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,686,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
@@ -2082,7 +2089,7 @@ const short* otherlevelclass::loadlevel(int rx, int ry)
         0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
         0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
         0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-        };
+        });
         result = contents;
         break;
     }
@@ -2090,7 +2097,7 @@ const short* otherlevelclass::loadlevel(int rx, int ry)
     case rn(3,9):
     {
 
-        static const short contents[] = {
+        ROOM_CONTENTS(LEVELPACK_OTHERLEVEL, t, 0, {
         0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
         0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
         0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
@@ -2121,7 +2128,7 @@ const short* otherlevelclass::loadlevel(int rx, int ry)
         101,101,101,101,101,101,101,101,101,101,101,101,101,101,101,101,101,101,101,101,101,101,101,101,101,101,101,101,101,101,101,101,101,101,101,101,101,101,101,101,
         101,101,101,101,101,101,101,101,101,101,101,101,101,101,101,101,101,101,101,101,101,101,101,101,101,101,101,101,101,101,101,101,101,101,101,101,101,101,101,101,
         101,101,101,101,101,101,101,101,101,101,101,101,101,101,101,101,101,101,101,101,101,101,101,101,101,101,101,101,101,101,101,101,101,101,101,101,101,101,101,101,
-        };
+        });
 
         obj.createentity(248, 168, 10, 1, 9030);  // (savepoint)
         result = contents;
@@ -2131,7 +2138,7 @@ const short* otherlevelclass::loadlevel(int rx, int ry)
     case rn(3,10):
     {
 
-        static const short contents[] = {
+        ROOM_CONTENTS(LEVELPACK_OTHERLEVEL, t, 0, {
         101,101,101,101,101,101,101,101,101,101,101,101,101,101,101,101,101,101,101,101,101,101,101,101,101,101,101,101,101,101,101,101,101,101,101,101,101,101,101,101,
         101,101,101,101,101,101,101,101,101,101,101,101,101,101,101,101,101,101,101,101,101,101,101,101,101,101,101,101,101,101,101,101,101,101,101,101,101,101,101,101,
         101,101,101,101,101,101,101,101,101,101,101,101,101,101,101,101,101,101,101,101,101,101,101,101,101,101,101,101,101,101,101,101,101,101,101,101,101,101,101,101,
@@ -2162,7 +2169,7 @@ const short* otherlevelclass::loadlevel(int rx, int ry)
         101,101,101,101,101,101,101,101,101,101,101,101,101,101,101,101,223,741,741,741,741,741,741,221,101,101,101,101,101,101,101,101,101,101,101,101,101,101,101,101,
         101,101,101,101,101,101,101,101,101,101,101,101,101,101,101,101,223,741,741,741,741,741,741,221,101,101,101,101,101,101,101,101,101,101,101,101,101,101,101,101,
         101,101,101,101,101,101,101,101,101,101,101,101,101,101,101,101,223,741,741,741,741,741,741,221,101,101,101,101,101,101,101,101,101,101,101,101,101,101,101,101,
-        };
+        });
 
         obj.createentity(88, 80, 21, 1); //Terminal    // UU Brothers
         obj.createblock(5, 88 - 4, 80, 20, 16, 25);
@@ -2232,7 +2239,7 @@ const short* otherlevelclass::loadlevel(int rx, int ry)
     case rn(3,11):
     {
 
-        static const short contents[] = {
+        ROOM_CONTENTS(LEVELPACK_OTHERLEVEL, t, 0, {
         107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,229,747,748,908,908,749,747,227,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,
         107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,229,747,869,0,0,867,747,227,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,
         107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,229,747,869,0,0,867,747,227,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,
@@ -2263,7 +2270,7 @@ const short* otherlevelclass::loadlevel(int rx, int ry)
         107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,
         107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,
         107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,
-        };
+        });
         hiddenname = "The Ship";
         result = contents;
         break;
@@ -2272,7 +2279,7 @@ const short* otherlevelclass::loadlevel(int rx, int ry)
     case rn(3,12):
     {
 
-        static const short contents[] = {
+        ROOM_CONTENTS(LEVELPACK_OTHERLEVEL, t, 0, {
         107,107,107,107,107,107,107,107,108,268,268,109,108,268,268,109,108,268,268,109,108,268,268,268,109,108,268,268,268,268,109,107,108,268,268,268,109,107,107,107,
         268,268,268,268,268,268,268,268,269,572,574,227,229,572,574,267,269,572,574,267,269,572,573,574,227,229,572,573,573,574,267,268,269,572,573,574,267,268,268,268,
         573,573,573,573,573,573,573,573,573,534,614,227,229,612,533,573,573,534,533,573,573,534,492,614,227,229,612,492,492,533,573,573,573,534,492,614,0,0,0,0,
@@ -2303,7 +2310,7 @@ const short* otherlevelclass::loadlevel(int rx, int ry)
         0,0,0,0,0,0,692,0,0,0,0,0,612,492,492,492,492,492,492,492,492,492,492,492,492,492,492,614,0,0,0,0,0,0,0,0,0,0,0,0,
         0,0,0,0,0,0,692,0,0,0,0,0,612,492,492,492,492,492,492,492,492,492,492,492,492,492,492,614,0,0,0,0,0,0,0,0,0,0,0,0,
         0,0,0,0,0,0,692,0,0,0,0,0,612,492,492,492,492,492,492,492,492,492,492,492,492,492,492,614,0,0,0,0,0,0,0,0,0,0,0,0,
-        };
+        });
 
         obj.createentity(128, 160, 10, 1, 113030);  // (savepoint)
         result = contents;
@@ -2314,7 +2321,7 @@ const short* otherlevelclass::loadlevel(int rx, int ry)
     case rn(3,13):
     {
 
-        static const short contents[] = {
+        ROOM_CONTENTS(LEVELPACK_OTHERLEVEL, t, 0, {
         0,0,0,0,0,0,0,683,0,0,0,0,603,483,483,483,483,483,483,483,483,483,483,483,483,483,483,605,0,0,0,0,0,0,0,0,0,0,0,0,
         0,0,0,0,0,0,0,683,0,0,0,0,603,483,483,483,483,483,483,483,483,483,483,483,483,483,483,605,0,0,0,0,0,0,0,0,0,0,0,0,
         0,0,0,0,0,0,0,683,0,0,0,0,603,483,483,483,483,483,483,483,483,483,483,483,483,483,483,605,0,0,0,0,0,0,0,0,0,0,0,0,
@@ -2345,7 +2352,7 @@ const short* otherlevelclass::loadlevel(int rx, int ry)
         483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,605,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
         483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,605,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
         483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,605,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-        };
+        });
 
         obj.createentity(192, 96, 10, 0, 114030);  // (savepoint)
         result = contents;
@@ -2355,7 +2362,7 @@ const short* otherlevelclass::loadlevel(int rx, int ry)
     case rn(3,14):
     {
 
-        static const short contents[] = {
+        ROOM_CONTENTS(LEVELPACK_OTHERLEVEL, t, 0, {
         498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,620,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
         498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,620,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
         498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,620,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
@@ -2386,7 +2393,7 @@ const short* otherlevelclass::loadlevel(int rx, int ry)
         498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,
         498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,
         498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,
-        };
+        });
         result = contents;
         break;
     }
@@ -2394,7 +2401,7 @@ const short* otherlevelclass::loadlevel(int rx, int ry)
     case rn(3,15):
     {
 
-        static const short contents[] = {
+        ROOM_CONTENTS(LEVELPACK_OTHERLEVEL, t, 0, {
         483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,
         483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,
         483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,484,644,644,644,644,644,
@@ -2425,7 +2432,7 @@ const short* otherlevelclass::loadlevel(int rx, int ry)
         483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,524,564,564,564,564,564,564,564,564,525,483,483,483,483,483,483,483,483,483,483,483,
         483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,
         483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,
-        };
+        });
         result = contents;
         break;
     }
@@ -2433,7 +2440,7 @@ const short* otherlevelclass::loadlevel(int rx, int ry)
     case rn(4,5):
     {
 
-        static const short contents[] = {
+        ROOM_CONTENTS(LEVELPACK_OTHERLEVEL, t, 0, {
         498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,
         498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,
         498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,
@@ -2464,7 +2471,7 @@ const short* otherlevelclass::loadlevel(int rx, int ry)
         0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
         0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
         0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-        };
+        });
         result = contents;
         break;
     }
@@ -2472,7 +2479,7 @@ const short* otherlevelclass::loadlevel(int rx, int ry)
     case rn(4,7):
     {
 
-        static const short contents[] = {
+        ROOM_CONTENTS(LEVELPACK_OTHERLEVEL, t, 0, {
         0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
         0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
         0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
@@ -2503,7 +2510,7 @@ const short* otherlevelclass::loadlevel(int rx, int ry)
         0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
         0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
         0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-        };
+        });
         result = contents;
         break;
     }
@@ -2511,7 +2518,7 @@ const short* otherlevelclass::loadlevel(int rx, int ry)
     case rn(4,9):
     {
 
-        static const short contents[] = {
+        ROOM_CONTENTS(LEVELPACK_OTHERLEVEL, t, 0, {
         0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
         0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
         0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
@@ -2542,7 +2549,7 @@ const short* otherlevelclass::loadlevel(int rx, int ry)
         110,110,110,110,110,110,110,232,0,0,0,230,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,232,0,0,0,230,110,110,110,110,
         110,110,110,110,110,110,110,151,191,191,191,152,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,232,0,0,0,230,110,110,110,110,
         110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,151,191,191,191,152,110,110,110,110,
-        };
+        });
         result = contents;
         break;
     }
@@ -2550,7 +2557,7 @@ const short* otherlevelclass::loadlevel(int rx, int ry)
     case rn(4,10):
     {
 
-        static const short contents[] = {
+        ROOM_CONTENTS(LEVELPACK_OTHERLEVEL, t, 0, {
         110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,
         110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,
         110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,
@@ -2581,7 +2588,7 @@ const short* otherlevelclass::loadlevel(int rx, int ry)
         110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,
         110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,
         110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,
-        };
+        });
 
         obj.createentity(256, 120, 20, 1); //Terminal Ship computer
         obj.createblock(5, 256 - 4, 120, 20, 16, 22);
@@ -2598,7 +2605,7 @@ const short* otherlevelclass::loadlevel(int rx, int ry)
     case rn(4,11):
     {
 
-        static const short contents[] = {
+        ROOM_CONTENTS(LEVELPACK_OTHERLEVEL, t, 0, {
         116,116,116,116,116,116,116,116,116,116,116,116,116,116,116,116,116,116,116,116,116,116,116,116,116,116,116,116,116,116,116,116,116,116,116,116,116,116,116,116,
         116,116,116,116,116,116,116,116,116,116,116,116,116,116,116,116,116,116,116,116,116,116,116,116,116,116,116,116,116,116,116,116,116,116,116,116,116,116,116,116,
         116,116,116,116,116,116,116,116,116,116,116,116,116,116,116,116,116,116,116,116,116,116,116,116,116,116,116,116,116,116,116,116,116,116,116,116,116,116,116,116,
@@ -2629,7 +2636,7 @@ const short* otherlevelclass::loadlevel(int rx, int ry)
         116,116,116,116,116,116,116,116,116,116,116,116,116,116,116,116,116,238,0,0,0,0,0,0,0,0,0,0,236,116,116,116,116,116,116,116,116,116,116,116,
         116,116,116,116,116,116,116,116,116,116,116,116,116,116,116,116,116,238,0,0,0,0,0,0,0,0,0,0,236,116,116,116,116,116,116,116,116,116,116,116,
         116,116,116,116,116,116,116,116,116,116,116,116,116,116,116,116,116,238,0,0,0,0,0,0,0,0,0,0,236,116,116,116,116,116,116,116,116,116,116,116,
-        };
+        });
         hiddenname = "The Ship";
         result = contents;
         break;
@@ -2638,7 +2645,7 @@ const short* otherlevelclass::loadlevel(int rx, int ry)
     case rn(4,12):
     {
 
-        static const short contents[] = {
+        ROOM_CONTENTS(LEVELPACK_OTHERLEVEL, t, 0, {
         116,116,116,116,116,116,116,116,116,116,116,116,116,116,116,116,116,238,0,0,0,0,0,0,0,0,0,0,236,116,116,116,116,116,116,116,116,116,116,116,
         277,277,277,277,277,277,277,277,277,277,277,277,277,277,277,118,116,238,0,0,0,0,0,0,0,0,0,0,236,116,117,277,277,277,277,277,277,277,277,277,
         0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,236,116,238,0,0,0,0,0,0,0,0,0,0,236,116,238,0,0,0,0,0,0,0,0,0,
@@ -2669,7 +2676,7 @@ const short* otherlevelclass::loadlevel(int rx, int ry)
         0,0,0,0,0,0,0,0,0,0,0,683,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
         0,0,0,0,0,0,0,0,0,0,0,683,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
         0,0,0,0,0,0,0,0,0,0,0,683,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-        };
+        });
         result = contents;
         break;
     }
@@ -2677,7 +2684,7 @@ const short* otherlevelclass::loadlevel(int rx, int ry)
     case rn(4,13):
     {
 
-        static const short contents[] = {
+        ROOM_CONTENTS(LEVELPACK_OTHERLEVEL, t, 0, {
         0,0,0,0,0,0,0,0,0,0,0,689,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
         0,0,0,0,0,0,0,0,0,0,0,689,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
         0,0,0,0,0,0,0,0,0,0,0,689,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
@@ -2708,7 +2715,7 @@ const short* otherlevelclass::loadlevel(int rx, int ry)
         0,0,0,0,0,0,0,0,0,0,0,689,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,609,489,489,489,489,489,489,489,489,489,489,489,
         0,0,0,0,0,0,0,0,0,0,0,689,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,609,489,489,489,489,489,489,489,489,489,489,489,
         0,0,0,0,0,0,0,0,0,0,0,689,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,609,489,489,489,489,489,489,489,489,489,489,489,
-        };
+        });
 
         obj.createentity(248, 112, 10, 1, 114040);  // (savepoint)
         result = contents;
@@ -2718,7 +2725,7 @@ const short* otherlevelclass::loadlevel(int rx, int ry)
     case rn(4,14):
     {
 
-        static const short contents[] = {
+        ROOM_CONTENTS(LEVELPACK_OTHERLEVEL, t, 0, {
         0,0,0,0,0,0,0,0,0,0,0,692,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,612,492,492,492,492,492,492,492,492,492,492,492,
         0,0,0,0,0,0,0,0,0,0,0,692,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,612,492,492,492,492,492,492,492,492,492,492,492,
         0,0,0,0,0,0,0,0,0,0,0,692,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,612,492,492,492,492,492,492,492,492,492,492,492,
@@ -2749,7 +2756,7 @@ const short* otherlevelclass::loadlevel(int rx, int ry)
         492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,614,0,0,0,0,0,612,492,492,492,492,492,492,492,492,492,492,492,492,492,492,
         492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,614,0,0,0,0,0,612,492,492,492,492,492,492,492,492,492,492,492,492,492,492,
         492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,614,0,0,0,0,0,612,492,492,492,492,492,492,492,492,492,492,492,492,492,492,
-        };
+        });
 
         obj.createentity(104, 176, 10, 1, 115040);  // (savepoint)
         result = contents;
@@ -2759,7 +2766,7 @@ const short* otherlevelclass::loadlevel(int rx, int ry)
     case rn(4,15):
     {
 
-        static const short contents[] = {
+        ROOM_CONTENTS(LEVELPACK_OTHERLEVEL, t, 0, {
         480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,602,0,0,0,0,0,600,480,480,480,480,480,480,480,480,480,480,480,480,480,480,
         480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,602,0,0,0,0,0,600,480,480,480,480,480,480,480,480,480,480,480,480,480,480,
         641,641,641,641,641,641,482,480,480,480,480,480,480,480,480,480,480,480,480,602,0,0,0,0,0,600,480,480,480,480,480,480,480,480,480,480,480,480,480,480,
@@ -2790,7 +2797,7 @@ const short* otherlevelclass::loadlevel(int rx, int ry)
         480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,
         480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,
         480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,
-        };
+        });
 
         obj.createentity(16, 40, 10, 1, 15040);  // (savepoint)
         result = contents;
@@ -2800,7 +2807,7 @@ const short* otherlevelclass::loadlevel(int rx, int ry)
     case rn(5,2):
     {
 
-        static const short contents[] = {
+        ROOM_CONTENTS(LEVELPACK_OTHERLEVEL, t, 0, {
         483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,
         483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,
         483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,
@@ -2831,7 +2838,7 @@ const short* otherlevelclass::loadlevel(int rx, int ry)
         483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,605,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
         483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,605,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
         483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,605,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-        };
+        });
         result = contents;
         break;
     }
@@ -2839,7 +2846,7 @@ const short* otherlevelclass::loadlevel(int rx, int ry)
     case rn(5,3):
     {
 
-        static const short contents[] = {
+        ROOM_CONTENTS(LEVELPACK_OTHERLEVEL, t, 0, {
         492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,614,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
         492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,614,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
         492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,614,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
@@ -2870,7 +2877,7 @@ const short* otherlevelclass::loadlevel(int rx, int ry)
         492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,614,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
         492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,614,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
         492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,614,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-        };
+        });
 
         obj.createentity(272, 128, 10, 0, 3050);  // (savepoint)
         result = contents;
@@ -2880,7 +2887,7 @@ const short* otherlevelclass::loadlevel(int rx, int ry)
     case rn(5,4):
     {
 
-        static const short contents[] = {
+        ROOM_CONTENTS(LEVELPACK_OTHERLEVEL, t, 0, {
         489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,611,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
         489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,611,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
         489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,611,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
@@ -2911,7 +2918,7 @@ const short* otherlevelclass::loadlevel(int rx, int ry)
         489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,611,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
         489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,611,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
         489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,611,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-        };
+        });
         result = contents;
         break;
     }
@@ -2919,7 +2926,7 @@ const short* otherlevelclass::loadlevel(int rx, int ry)
     case rn(5,5):
     {
 
-        static const short contents[] = {
+        ROOM_CONTENTS(LEVELPACK_OTHERLEVEL, t, 0, {
         486,486,486,486,486,486,486,486,486,486,486,486,486,486,486,486,486,486,608,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
         486,486,486,486,486,486,486,486,486,486,486,486,486,486,486,486,486,486,608,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
         486,486,486,486,486,486,486,486,486,486,486,486,486,486,486,486,486,486,608,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
@@ -2950,7 +2957,7 @@ const short* otherlevelclass::loadlevel(int rx, int ry)
         0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
         0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
         0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-        };
+        });
         result = contents;
         break;
     }
@@ -2958,7 +2965,7 @@ const short* otherlevelclass::loadlevel(int rx, int ry)
     case rn(5,6):
     {
 
-        static const short contents[] = {
+        ROOM_CONTENTS(LEVELPACK_OTHERLEVEL, t, 0, {
         0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
         0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
         0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
@@ -2989,7 +2996,7 @@ const short* otherlevelclass::loadlevel(int rx, int ry)
         0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
         0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
         0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-        };
+        });
         result = contents;
         break;
     }
@@ -2997,7 +3004,7 @@ const short* otherlevelclass::loadlevel(int rx, int ry)
     case rn(5,7):
     {
 
-        static const short contents[] = {
+        ROOM_CONTENTS(LEVELPACK_OTHERLEVEL, t, 0, {
         0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
         0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
         0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
@@ -3028,7 +3035,7 @@ const short* otherlevelclass::loadlevel(int rx, int ry)
         0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,603,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,
         0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,603,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,
         0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,603,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,
-        };
+        });
         result = contents;
         break;
     }
@@ -3036,7 +3043,7 @@ const short* otherlevelclass::loadlevel(int rx, int ry)
     case rn(5,8):
     {
 
-        static const short contents[] = {
+        ROOM_CONTENTS(LEVELPACK_OTHERLEVEL, t, 0, {
         0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,606,486,486,486,486,486,486,486,486,486,486,486,486,486,486,486,486,486,486,486,486,
         0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,606,486,486,486,486,486,486,486,486,486,486,486,486,486,486,486,486,486,486,486,486,
         0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,606,486,486,486,486,486,486,486,486,486,486,486,486,486,486,486,486,486,486,486,486,
@@ -3067,7 +3074,7 @@ const short* otherlevelclass::loadlevel(int rx, int ry)
         0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
         0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
         0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-        };
+        });
         result = contents;
         break;
     }
@@ -3075,7 +3082,7 @@ const short* otherlevelclass::loadlevel(int rx, int ry)
     case rn(5,9):
     {
 
-        static const short contents[] = {
+        ROOM_CONTENTS(LEVELPACK_OTHERLEVEL, t, 0, {
         0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
         0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
         0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
@@ -3106,7 +3113,7 @@ const short* otherlevelclass::loadlevel(int rx, int ry)
         104,104,104,104,104,104,104,104,104,226,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
         104,104,104,104,104,104,104,104,104,226,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
         104,104,104,104,104,104,104,104,104,226,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-        };
+        });
         result = contents;
         break;
     }
@@ -3114,7 +3121,7 @@ const short* otherlevelclass::loadlevel(int rx, int ry)
     case rn(5,10):
     {
 
-        static const short contents[] = {
+        ROOM_CONTENTS(LEVELPACK_OTHERLEVEL, t, 0, {
         104,104,104,104,104,104,104,104,104,226,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
         104,104,104,104,104,104,104,104,104,226,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
         104,104,104,104,104,104,104,104,104,226,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
@@ -3145,7 +3152,7 @@ const short* otherlevelclass::loadlevel(int rx, int ry)
         104,104,104,104,104,104,104,104,104,226,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
         104,104,104,104,104,104,104,104,104,226,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
         104,104,104,104,104,104,104,104,104,226,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-        };
+        });
         result = contents;
         break;
     }
@@ -3153,7 +3160,7 @@ const short* otherlevelclass::loadlevel(int rx, int ry)
     case rn(5,11):
     {
 
-        static const short contents[] = {
+        ROOM_CONTENTS(LEVELPACK_OTHERLEVEL, t, 0, {
         113,113,113,113,113,113,113,113,113,235,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
         113,113,113,113,113,113,113,113,113,235,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
         113,113,113,113,113,113,113,113,113,235,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
@@ -3184,7 +3191,7 @@ const short* otherlevelclass::loadlevel(int rx, int ry)
         113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,235,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
         113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,235,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
         113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,235,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-        };
+        });
         result = contents;
         break;
     }
@@ -3192,7 +3199,7 @@ const short* otherlevelclass::loadlevel(int rx, int ry)
     case rn(5,12):
     {
 
-        static const short contents[] = {
+        ROOM_CONTENTS(LEVELPACK_OTHERLEVEL, t, 0, {
         113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,235,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
         274,274,274,274,274,274,274,274,274,274,274,274,274,274,274,274,275,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
         0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
@@ -3223,7 +3230,7 @@ const short* otherlevelclass::loadlevel(int rx, int ry)
         0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,680,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
         0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,680,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
         0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,680,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-        };
+        });
         result = contents;
         break;
     }
@@ -3231,7 +3238,7 @@ const short* otherlevelclass::loadlevel(int rx, int ry)
     case rn(5,13):
     {
 
-        static const short contents[] = {
+        ROOM_CONTENTS(LEVELPACK_OTHERLEVEL, t, 0, {
         0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,692,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
         0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,692,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
         0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,692,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
@@ -3262,7 +3269,7 @@ const short* otherlevelclass::loadlevel(int rx, int ry)
         492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,
         492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,
         492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,
-        };
+        });
 
         obj.createentity(184, 176, 10, 1, 13050);  // (savepoint)
         result = contents;
@@ -3272,7 +3279,7 @@ const short* otherlevelclass::loadlevel(int rx, int ry)
     case rn(5,14):
     {
 
-        static const short contents[] = {
+        ROOM_CONTENTS(LEVELPACK_OTHERLEVEL, t, 0, {
         495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,
         495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,
         495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,
@@ -3303,7 +3310,7 @@ const short* otherlevelclass::loadlevel(int rx, int ry)
         495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,
         495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,
         495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,
-        };
+        });
         result = contents;
         break;
     }
@@ -3312,7 +3319,7 @@ const short* otherlevelclass::loadlevel(int rx, int ry)
     case rn(5,15):
     {
 
-        static const short contents[] = {
+        ROOM_CONTENTS(LEVELPACK_OTHERLEVEL, t, 0, {
         486,486,486,486,486,486,486,487,647,647,647,647,488,486,486,486,486,487,647,647,647,647,647,647,647,647,647,647,647,488,486,486,486,486,486,486,486,486,486,486,
         486,486,486,486,486,486,486,608,0,0,0,0,606,486,486,486,486,608,0,0,0,0,0,0,0,0,0,0,0,646,488,486,486,486,486,486,486,486,486,486,
         486,486,486,486,487,647,647,648,0,0,0,0,606,486,486,487,647,648,0,0,0,0,0,0,0,0,0,0,0,0,646,647,647,647,488,486,486,486,486,486,
@@ -3343,7 +3350,7 @@ const short* otherlevelclass::loadlevel(int rx, int ry)
         486,486,486,486,486,486,486,486,608,0,0,0,0,686,0,0,606,486,486,486,486,486,486,486,608,0,0,0,0,0,0,0,0,606,486,527,567,567,567,567,
         486,486,486,486,486,486,486,486,527,567,568,0,0,686,0,0,606,486,486,486,486,486,486,486,527,568,0,0,0,0,0,566,567,528,486,486,486,486,486,486,
         486,486,486,486,486,486,486,486,486,486,527,567,567,567,567,567,528,486,486,486,486,486,486,486,486,527,567,567,567,567,567,528,486,486,486,486,486,486,486,486,
-        };
+        });
 
         obj.createentity(72, 16, 9, 14);  // (shiny trinket)
         result = contents;
@@ -3353,7 +3360,7 @@ const short* otherlevelclass::loadlevel(int rx, int ry)
     case rn(5,18):
     {
 
-        static const short contents[] = {
+        ROOM_CONTENTS(LEVELPACK_OTHERLEVEL, t, 0, {
         489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,
         489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,
         489,489,490,650,650,650,650,650,650,650,650,650,650,650,650,650,650,650,650,650,650,650,650,650,650,650,650,650,650,650,650,650,650,650,650,650,650,650,650,650,
@@ -3384,7 +3391,7 @@ const short* otherlevelclass::loadlevel(int rx, int ry)
         489,489,611,0,0,0,0,609,489,489,611,0,0,0,0,609,489,489,611,0,0,0,0,609,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,
         489,489,611,0,0,0,0,609,489,489,611,0,0,0,0,609,489,489,611,0,0,0,0,609,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,
         489,489,611,0,0,0,0,609,489,489,611,0,0,0,0,609,489,489,611,0,0,0,0,609,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,
-        };
+        });
 
         obj.createentity(224, 160, 13); //Warp Token
 
@@ -3395,7 +3402,7 @@ const short* otherlevelclass::loadlevel(int rx, int ry)
     case rn(5,19):
     {
 
-        static const short contents[] = {
+        ROOM_CONTENTS(LEVELPACK_OTHERLEVEL, t, 0, {
         492,492,614,0,0,0,0,612,492,492,614,0,0,0,0,612,492,492,614,0,0,0,0,612,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,
         492,492,614,0,0,0,0,612,492,492,614,0,0,0,0,612,492,492,614,0,0,0,0,612,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,
         492,492,614,0,0,0,0,612,492,492,614,0,0,0,0,612,492,492,614,693,693,693,693,612,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,
@@ -3426,7 +3433,7 @@ const short* otherlevelclass::loadlevel(int rx, int ry)
         492,492,533,573,573,573,573,573,573,573,573,573,573,573,573,573,573,573,573,573,573,573,573,573,573,573,573,573,573,573,573,573,573,573,573,573,573,573,573,573,
         492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,
         492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,
-        };
+        });
         result = contents;
         break;
     }
@@ -3434,7 +3441,7 @@ const short* otherlevelclass::loadlevel(int rx, int ry)
     case rn(6,2):
     {
 
-        static const short contents[] = {
+        ROOM_CONTENTS(LEVELPACK_OTHERLEVEL, t, 0, {
         480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,
         480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,
         480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,
@@ -3465,7 +3472,7 @@ const short* otherlevelclass::loadlevel(int rx, int ry)
         0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
         0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
         0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-        };
+        });
 
         obj.createentity(152, 152, 10, 0, 103060);  // (savepoint)
         result = contents;
@@ -3475,7 +3482,7 @@ const short* otherlevelclass::loadlevel(int rx, int ry)
     case rn(6,4):
     {
 
-        static const short contents[] = {
+        ROOM_CONTENTS(LEVELPACK_OTHERLEVEL, t, 0, {
         0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
         0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
         0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
@@ -3506,7 +3513,7 @@ const short* otherlevelclass::loadlevel(int rx, int ry)
         0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,603,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,
         0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,603,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,
         0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,603,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,
-        };
+        });
 
         obj.createentity(128, 120, 10, 1, 4060);  // (savepoint)
         result = contents;
@@ -3516,7 +3523,7 @@ const short* otherlevelclass::loadlevel(int rx, int ry)
     case rn(6,5):
     {
 
-        static const short contents[] = {
+        ROOM_CONTENTS(LEVELPACK_OTHERLEVEL, t, 0, {
         0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,618,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,
         0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,618,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,
         0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,618,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,
@@ -3547,7 +3554,7 @@ const short* otherlevelclass::loadlevel(int rx, int ry)
         0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,618,498,498,498,498,498,498,498,498,498,498,498,498,498,
         0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,618,498,498,498,498,498,498,498,498,498,498,498,498,498,
         0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,618,498,498,498,498,498,498,498,498,498,498,498,498,498,
-        };
+        });
         result = contents;
         break;
     }
@@ -3555,7 +3562,7 @@ const short* otherlevelclass::loadlevel(int rx, int ry)
     case rn(6,6):
     {
 
-        static const short contents[] = {
+        ROOM_CONTENTS(LEVELPACK_OTHERLEVEL, t, 0, {
         0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,606,486,486,486,486,486,486,486,486,486,486,486,486,486,
         0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,606,486,486,486,486,486,486,486,486,486,486,486,486,486,
         0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,606,486,486,486,486,486,486,486,486,486,486,486,486,486,
@@ -3586,7 +3593,7 @@ const short* otherlevelclass::loadlevel(int rx, int ry)
         0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,606,486,486,486,486,486,486,486,486,486,486,486,486,486,
         0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,606,486,486,486,486,486,486,486,486,486,486,486,486,486,
         0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,606,486,486,486,486,486,486,486,486,486,486,486,486,486,
-        };
+        });
         result = contents;
         break;
     }
@@ -3594,7 +3601,7 @@ const short* otherlevelclass::loadlevel(int rx, int ry)
     case rn(6,7):
     {
 
-        static const short contents[] = {
+        ROOM_CONTENTS(LEVELPACK_OTHERLEVEL, t, 0, {
         0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,609,489,489,489,489,489,489,489,489,489,489,489,489,489,
         0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,609,489,489,489,489,489,489,489,489,489,489,489,489,489,
         0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,609,489,489,489,489,489,489,489,489,489,489,489,489,489,
@@ -3625,7 +3632,7 @@ const short* otherlevelclass::loadlevel(int rx, int ry)
         489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,
         489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,
         489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,
-        };
+        });
 
         obj.createentity(64, 88, 10, 1, 7060);  // (savepoint)
         result = contents;
@@ -3635,7 +3642,7 @@ const short* otherlevelclass::loadlevel(int rx, int ry)
     case rn(6,8):
     {
 
-        static const short contents[] = {
+        ROOM_CONTENTS(LEVELPACK_OTHERLEVEL, t, 0, {
         492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,
         492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,
         492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,
@@ -3666,7 +3673,7 @@ const short* otherlevelclass::loadlevel(int rx, int ry)
         0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,612,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,
         0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,612,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,
         0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,612,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,
-        };
+        });
         result = contents;
         break;
     }
@@ -3674,7 +3681,7 @@ const short* otherlevelclass::loadlevel(int rx, int ry)
     case rn(6,9):
     {
 
-        static const short contents[] = {
+        ROOM_CONTENTS(LEVELPACK_OTHERLEVEL, t, 0, {
         0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,603,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,
         0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,603,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,
         0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,603,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,
@@ -3705,7 +3712,7 @@ const short* otherlevelclass::loadlevel(int rx, int ry)
         0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,603,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,
         0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,603,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,
         0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,603,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,
-        };
+        });
         result = contents;
         break;
     }
@@ -3713,7 +3720,7 @@ const short* otherlevelclass::loadlevel(int rx, int ry)
     case rn(6,10):
     {
 
-        static const short contents[] = {
+        ROOM_CONTENTS(LEVELPACK_OTHERLEVEL, t, 0, {
         0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,618,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,
         0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,618,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,
         0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,618,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,
@@ -3744,7 +3751,7 @@ const short* otherlevelclass::loadlevel(int rx, int ry)
         0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,618,498,498,498,498,498,498,498,498,498,
         0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,618,498,498,498,498,498,498,498,498,498,
         0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,618,498,498,498,498,498,498,498,498,498,
-        };
+        });
 
         obj.createentity(152, 128, 10, 0, 10060);  // (savepoint)
         result = contents;
@@ -3754,7 +3761,7 @@ const short* otherlevelclass::loadlevel(int rx, int ry)
     case rn(6,11):
     {
 
-        static const short contents[] = {
+        ROOM_CONTENTS(LEVELPACK_OTHERLEVEL, t, 0, {
         0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,615,495,495,495,495,495,495,495,495,495,
         0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,615,495,495,495,495,495,495,495,495,495,
         0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,615,495,495,495,495,495,495,495,495,495,
@@ -3785,7 +3792,7 @@ const short* otherlevelclass::loadlevel(int rx, int ry)
         0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
         0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
         0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-        };
+        });
         result = contents;
         break;
     }
@@ -3793,7 +3800,7 @@ const short* otherlevelclass::loadlevel(int rx, int ry)
     case rn(6,12):
     {
 
-        static const short contents[] = {
+        ROOM_CONTENTS(LEVELPACK_OTHERLEVEL, t, 0, {
         0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
         0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
         0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
@@ -3824,7 +3831,7 @@ const short* otherlevelclass::loadlevel(int rx, int ry)
         0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,689,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
         0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,689,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
         0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,689,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-        };
+        });
         result = contents;
         break;
     }
@@ -3832,7 +3839,7 @@ const short* otherlevelclass::loadlevel(int rx, int ry)
     case rn(6,13):
     {
 
-        static const short contents[] = {
+        ROOM_CONTENTS(LEVELPACK_OTHERLEVEL, t, 0, {
         0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,686,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
         0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,686,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
         0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,686,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
@@ -3863,7 +3870,7 @@ const short* otherlevelclass::loadlevel(int rx, int ry)
         486,486,486,486,486,486,486,486,486,486,486,486,527,567,567,567,567,567,568,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
         486,486,486,486,486,486,486,486,486,486,486,486,486,486,486,486,486,486,527,567,568,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
         486,486,486,486,486,486,486,486,486,486,486,486,486,486,486,486,486,486,486,486,608,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-        };
+        });
         result = contents;
         break;
     }
@@ -3871,7 +3878,7 @@ const short* otherlevelclass::loadlevel(int rx, int ry)
     case rn(6,14):
     {
 
-        static const short contents[] = {
+        ROOM_CONTENTS(LEVELPACK_OTHERLEVEL, t, 0, {
         480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,602,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
         480,480,480,480,480,480,480,480,480,480,480,480,480,481,641,641,641,641,641,641,642,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
         480,480,480,480,480,480,480,480,480,481,641,641,641,642,0,0,0,0,680,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
@@ -3902,7 +3909,7 @@ const short* otherlevelclass::loadlevel(int rx, int ry)
         480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,
         480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,
         480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,
-        };
+        });
         result = contents;
         break;
     }
@@ -3911,7 +3918,7 @@ const short* otherlevelclass::loadlevel(int rx, int ry)
     case rn(6,15):
     {
 
-        static const short contents[] = {
+        ROOM_CONTENTS(LEVELPACK_OTHERLEVEL, t, 0, {
         489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,
         489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,
         489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,
@@ -3942,7 +3949,7 @@ const short* otherlevelclass::loadlevel(int rx, int ry)
         570,570,570,570,531,489,611,0,0,0,0,0,0,0,0,0,0,0,0,0,569,570,571,0,0,0,0,609,489,611,0,0,0,0,0,609,489,489,489,489,
         489,489,489,489,489,489,530,570,570,570,570,570,570,571,0,0,0,0,0,0,609,489,530,570,570,570,570,531,489,530,570,570,570,570,570,531,489,489,489,489,
         489,489,489,489,489,489,489,489,489,489,489,489,489,530,570,570,570,570,570,570,531,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,
-        };
+        });
 
         if(!game.intimetrial)
         {
@@ -3958,7 +3965,7 @@ const short* otherlevelclass::loadlevel(int rx, int ry)
     case rn(6,18):
     {
 
-        static const short contents[] = {
+        ROOM_CONTENTS(LEVELPACK_OTHERLEVEL, t, 0, {
         483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,
         483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,
         644,644,644,644,644,644,644,644,644,644,644,644,644,644,644,644,644,644,644,644,644,644,644,644,644,644,644,644,644,644,644,644,644,644,644,644,644,485,483,483,
@@ -3989,7 +3996,7 @@ const short* otherlevelclass::loadlevel(int rx, int ry)
         483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,605,0,0,0,0,603,483,483,605,684,684,684,684,603,483,483,605,0,0,0,0,603,483,483,
         483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,605,0,0,0,0,603,483,483,605,0,0,0,0,603,483,483,605,0,0,0,0,603,483,483,
         483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,605,0,0,0,0,603,483,483,605,0,0,0,0,603,483,483,605,0,0,0,0,603,483,483,
-        };
+        });
         result = contents;
         break;
     }
@@ -3997,7 +4004,7 @@ const short* otherlevelclass::loadlevel(int rx, int ry)
     case rn(6,19):
     {
 
-        static const short contents[] = {
+        ROOM_CONTENTS(LEVELPACK_OTHERLEVEL, t, 0, {
         486,486,486,486,486,486,486,486,486,486,486,486,486,486,486,486,608,0,0,0,0,606,486,486,608,0,0,0,0,606,486,486,608,0,0,0,0,606,486,486,
         486,486,486,486,486,486,486,486,486,486,486,486,486,486,486,486,608,0,0,0,0,606,486,486,608,0,0,0,0,606,486,486,608,0,0,0,0,606,486,486,
         486,486,486,486,486,486,486,486,486,486,486,486,486,486,486,486,608,0,0,0,0,606,486,486,608,0,0,0,0,606,486,486,608,0,0,0,0,606,486,486,
@@ -4028,7 +4035,7 @@ const short* otherlevelclass::loadlevel(int rx, int ry)
         567,567,567,567,567,567,567,567,567,567,567,567,567,567,567,567,567,567,567,567,567,567,567,567,567,567,567,567,567,567,567,567,567,567,567,567,567,528,486,486,
         486,486,486,486,486,486,486,486,486,486,486,486,486,486,486,486,486,486,486,486,486,486,486,486,486,486,486,486,486,486,486,486,486,486,486,486,486,486,486,486,
         486,486,486,486,486,486,486,486,486,486,486,486,486,486,486,486,486,486,486,486,486,486,486,486,486,486,486,486,486,486,486,486,486,486,486,486,486,486,486,486,
-        };
+        });
         result = contents;
         break;
     }
@@ -4036,7 +4043,7 @@ const short* otherlevelclass::loadlevel(int rx, int ry)
     case rn(7,1):
     {
 
-        static const short contents[] = {
+        ROOM_CONTENTS(LEVELPACK_OTHERLEVEL, t, 0, {
         486,486,486,486,486,486,486,486,486,486,486,486,486,486,486,486,486,486,486,486,486,486,486,486,486,486,486,486,486,486,486,486,486,486,486,486,486,486,486,486,
         486,486,486,486,486,486,486,486,486,486,486,486,486,486,486,486,486,486,486,486,486,486,486,486,486,486,486,486,486,486,486,486,486,486,486,486,486,486,486,486,
         486,486,486,486,486,486,486,486,486,486,486,486,486,486,486,486,486,486,486,486,486,486,486,486,486,486,486,486,486,486,486,486,486,486,486,486,486,486,486,486,
@@ -4067,7 +4074,7 @@ const short* otherlevelclass::loadlevel(int rx, int ry)
         486,486,486,486,486,486,486,486,486,486,486,486,486,486,486,486,486,486,486,486,486,486,486,486,486,486,486,486,486,486,486,486,486,486,486,486,486,486,486,486,
         486,486,486,486,486,486,486,486,486,486,486,486,486,486,486,486,486,486,486,486,486,486,486,486,486,486,486,486,486,486,486,486,486,486,486,486,486,486,486,486,
         486,486,486,486,486,486,486,486,486,486,486,486,486,486,486,486,486,486,486,486,486,486,486,486,486,486,486,486,486,486,486,486,486,486,486,486,486,486,486,486,
-        };
+        });
 
         obj.createentity(192, 104, 13); //Warp Token
 
@@ -4078,7 +4085,7 @@ const short* otherlevelclass::loadlevel(int rx, int ry)
     case rn(7,2):
     {
 
-        static const short contents[] = {
+        ROOM_CONTENTS(LEVELPACK_OTHERLEVEL, t, 0, {
         492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,
         492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,
         492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,
@@ -4109,7 +4116,7 @@ const short* otherlevelclass::loadlevel(int rx, int ry)
         0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
         0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
         0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-        };
+        });
 
         obj.createentity(88, 136, 10, 0, 103070);  // (savepoint)
         result = contents;
@@ -4119,7 +4126,7 @@ const short* otherlevelclass::loadlevel(int rx, int ry)
     case rn(7,3):
     {
 
-        static const short contents[] = {
+        ROOM_CONTENTS(LEVELPACK_OTHERLEVEL, t, 0, {
         0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
         0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
         0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
@@ -4150,7 +4157,7 @@ const short* otherlevelclass::loadlevel(int rx, int ry)
         0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
         0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
         0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-        };
+        });
         result = contents;
         break;
     }
@@ -4158,7 +4165,7 @@ const short* otherlevelclass::loadlevel(int rx, int ry)
     case rn(7,4):
     {
 
-        static const short contents[] = {
+        ROOM_CONTENTS(LEVELPACK_OTHERLEVEL, t, 0, {
         0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
         0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
         0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
@@ -4189,7 +4196,7 @@ const short* otherlevelclass::loadlevel(int rx, int ry)
         486,486,486,486,486,486,486,486,486,486,608,0,0,0,606,486,486,486,486,486,486,486,486,486,486,486,486,486,486,486,486,486,486,486,486,486,486,486,486,486,
         486,486,486,486,486,486,486,486,486,486,527,567,567,567,528,486,486,486,486,486,486,486,486,486,486,486,486,486,486,486,486,486,486,486,486,486,486,486,486,486,
         486,486,486,486,486,486,486,486,486,486,486,486,486,486,486,486,486,486,486,486,486,486,486,486,486,486,486,486,486,486,486,486,486,486,486,486,486,486,486,486,
-        };
+        });
 
         obj.createentity(208, 128, 10, 1, 4070);  // (savepoint)
         result = contents;
@@ -4199,7 +4206,7 @@ const short* otherlevelclass::loadlevel(int rx, int ry)
     case rn(7,5):
     {
 
-        static const short contents[] = {
+        ROOM_CONTENTS(LEVELPACK_OTHERLEVEL, t, 0, {
         480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,
         480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,
         480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,
@@ -4230,7 +4237,7 @@ const short* otherlevelclass::loadlevel(int rx, int ry)
         480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,602,681,681,681,681,681,600,480,480,480,480,480,480,480,521,561,561,561,561,561,561,
         480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,602,0,0,0,0,0,600,480,480,480,480,480,480,480,480,480,480,480,480,480,480,
         480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,602,0,0,0,0,0,600,480,480,480,480,480,480,480,480,480,480,480,480,480,480,
-        };
+        });
         result = contents;
         break;
     }
@@ -4238,7 +4245,7 @@ const short* otherlevelclass::loadlevel(int rx, int ry)
     case rn(7,6):
     {
 
-        static const short contents[] = {
+        ROOM_CONTENTS(LEVELPACK_OTHERLEVEL, t, 0, {
         492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,614,0,0,0,0,0,612,492,492,492,492,492,492,492,492,492,492,492,492,492,492,
         492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,614,0,0,0,0,0,612,492,492,492,492,492,492,492,492,492,492,492,492,492,492,
         492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,614,0,0,0,0,0,612,492,492,492,492,492,492,492,492,492,492,492,492,492,492,
@@ -4269,7 +4276,7 @@ const short* otherlevelclass::loadlevel(int rx, int ry)
         492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,614,0,0,0,612,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,
         492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,614,0,0,0,612,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,
         492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,614,0,0,0,612,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,
-        };
+        });
         result = contents;
         break;
     }
@@ -4277,7 +4284,7 @@ const short* otherlevelclass::loadlevel(int rx, int ry)
     case rn(7,7):
     {
 
-        static const short contents[] = {
+        ROOM_CONTENTS(LEVELPACK_OTHERLEVEL, t, 0, {
         489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,611,0,0,0,609,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,
         489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,611,0,0,0,609,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,
         489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,611,690,690,690,609,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,
@@ -4308,7 +4315,7 @@ const short* otherlevelclass::loadlevel(int rx, int ry)
         489,489,489,489,489,489,489,489,489,489,611,0,0,0,0,0,0,0,0,0,0,0,0,0,609,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,
         489,489,489,489,489,489,489,489,489,489,611,0,0,0,0,0,0,0,0,0,0,0,0,0,609,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,
         489,489,489,489,489,489,489,489,489,489,611,0,0,0,0,0,0,0,0,0,0,0,0,0,609,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,
-        };
+        });
         result = contents;
         break;
     }
@@ -4316,7 +4323,7 @@ const short* otherlevelclass::loadlevel(int rx, int ry)
     case rn(7,8):
     {
 
-        static const short contents[] = {
+        ROOM_CONTENTS(LEVELPACK_OTHERLEVEL, t, 0, {
         480,480,480,480,480,480,480,480,480,480,602,0,0,0,0,0,0,0,0,0,0,0,0,0,600,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,
         480,480,480,480,480,480,480,480,480,480,602,0,0,0,0,0,0,0,0,0,0,0,0,0,600,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,
         480,480,480,480,480,480,480,480,480,480,602,0,0,0,0,0,0,0,0,0,0,0,0,0,640,482,480,480,480,480,480,480,480,480,480,480,480,480,480,480,
@@ -4347,7 +4354,7 @@ const short* otherlevelclass::loadlevel(int rx, int ry)
         480,480,480,480,602,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,600,480,480,480,480,480,480,480,480,480,
         480,480,480,480,602,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,600,480,480,480,480,480,480,480,480,480,
         480,480,480,480,602,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,600,480,480,480,480,480,480,480,480,480,
-        };
+        });
         result = contents;
         break;
     }
@@ -4355,7 +4362,7 @@ const short* otherlevelclass::loadlevel(int rx, int ry)
     case rn(7,9):
     {
 
-        static const short contents[] = {
+        ROOM_CONTENTS(LEVELPACK_OTHERLEVEL, t, 0, {
         483,483,483,483,605,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,603,483,483,483,483,483,483,483,483,483,
         483,483,483,483,605,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,603,483,483,483,483,483,483,483,483,483,
         483,483,483,483,605,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,603,483,483,483,483,483,483,483,483,483,
@@ -4386,7 +4393,7 @@ const short* otherlevelclass::loadlevel(int rx, int ry)
         483,483,483,483,483,483,524,564,564,564,564,564,564,564,564,564,564,564,564,564,564,525,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,
         483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,
         483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,
-        };
+        });
 
         obj.createentity(64, 112, 14); //Teleporter!
         result = contents;
@@ -4396,7 +4403,7 @@ const short* otherlevelclass::loadlevel(int rx, int ry)
     case rn(7,10):
     {
 
-        static const short contents[] = {
+        ROOM_CONTENTS(LEVELPACK_OTHERLEVEL, t, 0, {
         495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,
         495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,
         495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,
@@ -4427,7 +4434,7 @@ const short* otherlevelclass::loadlevel(int rx, int ry)
         495,495,495,495,495,495,495,495,495,536,576,576,576,576,576,576,576,537,495,536,576,576,576,576,576,576,576,537,495,495,495,495,495,617,696,696,615,495,495,495,
         495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,617,0,0,615,495,495,495,
         495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,617,0,0,615,495,495,495,
-        };
+        });
         result = contents;
         break;
     }
@@ -4435,7 +4442,7 @@ const short* otherlevelclass::loadlevel(int rx, int ry)
     case rn(7,11):
     {
 
-        static const short contents[] = {
+        ROOM_CONTENTS(LEVELPACK_OTHERLEVEL, t, 0, {
         486,486,486,486,486,486,486,486,486,486,486,486,486,486,486,486,486,486,486,486,486,486,486,486,486,486,486,486,486,486,486,486,486,608,0,0,606,486,486,486,
         486,486,486,486,486,486,486,486,486,486,486,486,486,486,486,486,486,486,486,486,486,486,486,486,486,486,486,486,486,486,486,486,486,608,687,687,606,486,486,486,
         486,486,486,486,486,486,486,486,486,486,486,486,486,486,486,486,486,486,486,486,486,486,486,486,486,486,486,486,486,486,486,486,486,608,0,0,606,486,486,486,
@@ -4466,7 +4473,7 @@ const short* otherlevelclass::loadlevel(int rx, int ry)
         0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
         0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
         0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-        };
+        });
         result = contents;
         break;
     }
@@ -4474,7 +4481,7 @@ const short* otherlevelclass::loadlevel(int rx, int ry)
     case rn(7,14):
     {
 
-        static const short contents[] = {
+        ROOM_CONTENTS(LEVELPACK_OTHERLEVEL, t, 0, {
         0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
         0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
         0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
@@ -4505,7 +4512,7 @@ const short* otherlevelclass::loadlevel(int rx, int ry)
         483,483,483,483,483,483,483,483,483,483,483,483,605,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,603,483,483,483,483,483,483,483,483,483,483,483,
         483,483,483,483,483,483,483,483,483,483,483,483,524,564,564,564,564,564,564,564,564,564,564,564,564,564,564,564,525,483,483,483,483,483,483,483,483,483,483,483,
         483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,
-        };
+        });
 
         obj.createentity(48, 192, 10, 1, 14070);  // (savepoint)
         result = contents;
@@ -4515,7 +4522,7 @@ const short* otherlevelclass::loadlevel(int rx, int ry)
     case rn(8,0):
     {
 
-        static const short contents[] = {
+        ROOM_CONTENTS(LEVELPACK_OTHERLEVEL, t, 0, {
         495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,617,0,0,0,0,0,0,0,0,615,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,
         495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,617,0,0,0,0,0,0,0,0,615,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,
         495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,617,0,0,0,0,0,0,0,0,615,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,
@@ -4546,7 +4553,7 @@ const short* otherlevelclass::loadlevel(int rx, int ry)
         495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,617,0,0,0,0,0,0,0,0,0,0,0,0,0,615,495,495,495,495,495,495,495,495,
         495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,617,0,0,0,0,0,0,0,0,0,0,0,0,0,615,495,495,495,495,495,495,495,495,
         495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,617,0,0,0,0,0,0,0,0,0,0,0,0,0,615,495,495,495,495,495,495,495,495,
-        };
+        });
         result = contents;
         break;
     }
@@ -4554,7 +4561,7 @@ const short* otherlevelclass::loadlevel(int rx, int ry)
     case rn(8,1):
     {
 
-        static const short contents[] = {
+        ROOM_CONTENTS(LEVELPACK_OTHERLEVEL, t, 0, {
         489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,611,0,0,0,0,0,0,0,0,0,0,0,0,0,609,489,489,489,489,489,489,489,489,
         489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,611,0,0,0,0,0,0,0,0,0,0,0,0,0,609,489,489,489,489,489,489,489,489,
         489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,611,0,0,0,0,0,0,0,0,0,0,0,0,0,609,489,489,489,489,489,489,489,489,
@@ -4585,7 +4592,7 @@ const short* otherlevelclass::loadlevel(int rx, int ry)
         489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,530,571,0,0,0,609,489,489,489,489,489,489,489,489,489,489,489,489,489,489,
         489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,611,690,690,690,609,489,489,489,489,489,489,489,489,489,489,489,489,489,489,
         489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,611,0,0,0,609,489,489,489,489,489,489,489,489,489,489,489,489,489,489,
-        };
+        });
         result = contents;
         break;
     }
@@ -4593,7 +4600,7 @@ const short* otherlevelclass::loadlevel(int rx, int ry)
     case rn(8,2):
     {
 
-        static const short contents[] = {
+        ROOM_CONTENTS(LEVELPACK_OTHERLEVEL, t, 0, {
         486,486,486,486,486,486,486,486,486,486,486,486,486,486,486,486,486,486,486,486,486,608,0,0,0,606,486,486,486,486,486,486,486,486,486,486,486,486,486,486,
         486,486,486,486,486,486,486,486,486,486,486,486,486,486,486,486,486,486,486,486,486,608,687,687,687,606,486,486,486,486,486,486,486,486,486,486,486,486,486,486,
         486,486,486,486,486,486,486,486,486,486,486,486,486,486,486,486,486,486,486,486,486,608,0,0,0,606,486,486,486,486,486,486,486,486,486,486,486,486,486,486,
@@ -4624,7 +4631,7 @@ const short* otherlevelclass::loadlevel(int rx, int ry)
         0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,606,486,486,486,486,486,
         0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,606,486,486,486,486,486,
         0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,606,486,486,486,486,486,
-        };
+        });
         result = contents;
         break;
     }
@@ -4632,7 +4639,7 @@ const short* otherlevelclass::loadlevel(int rx, int ry)
     case rn(8,3):
     {
 
-        static const short contents[] = {
+        ROOM_CONTENTS(LEVELPACK_OTHERLEVEL, t, 0, {
         0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,603,483,483,483,483,483,
         0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,603,483,483,483,483,483,
         0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,603,483,483,483,483,483,
@@ -4663,7 +4670,7 @@ const short* otherlevelclass::loadlevel(int rx, int ry)
         0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,603,483,483,483,
         0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,603,483,483,483,
         0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,603,483,483,483,
-        };
+        });
         result = contents;
         break;
     }
@@ -4671,7 +4678,7 @@ const short* otherlevelclass::loadlevel(int rx, int ry)
     case rn(8,4):
     {
 
-        static const short contents[] = {
+        ROOM_CONTENTS(LEVELPACK_OTHERLEVEL, t, 0, {
         0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,621,501,501,501,
         0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,621,501,501,501,
         0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,621,501,501,501,
@@ -4702,7 +4709,7 @@ const short* otherlevelclass::loadlevel(int rx, int ry)
         501,501,501,501,501,501,501,501,501,501,501,501,501,501,501,501,501,501,501,501,501,501,623,0,0,0,0,0,621,501,501,501,501,501,501,501,501,501,501,501,
         501,501,501,501,501,501,501,501,501,501,501,501,501,501,501,501,501,501,501,501,501,501,623,0,0,0,0,0,621,501,501,501,501,501,501,501,501,501,501,501,
         501,501,501,501,501,501,501,501,501,501,501,501,501,501,501,501,501,501,501,501,501,501,623,0,0,0,0,0,621,501,501,501,501,501,501,501,501,501,501,501,
-        };
+        });
         result = contents;
         break;
     }
@@ -4710,7 +4717,7 @@ const short* otherlevelclass::loadlevel(int rx, int ry)
     case rn(8,5):
     {
 
-        static const short contents[] = {
+        ROOM_CONTENTS(LEVELPACK_OTHERLEVEL, t, 0, {
         495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,617,0,0,0,0,0,615,495,495,495,495,495,495,495,495,495,495,495,
         495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,617,0,0,0,0,0,615,495,495,495,495,495,495,495,495,495,495,495,
         495,495,495,495,495,495,495,496,656,656,656,656,656,656,656,656,656,497,495,495,495,495,617,0,0,0,0,0,615,495,495,495,495,495,495,495,495,495,495,495,
@@ -4741,7 +4748,7 @@ const short* otherlevelclass::loadlevel(int rx, int ry)
         576,576,576,576,576,576,576,576,576,576,576,537,495,495,495,495,495,495,495,495,536,576,576,576,576,576,576,576,576,576,576,576,537,495,495,495,495,495,495,495,
         495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,
         495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,
-        };
+        });
 
         obj.createentity(80, 40, 10, 1, 5080);  // (savepoint)
         result = contents;
@@ -4751,7 +4758,7 @@ const short* otherlevelclass::loadlevel(int rx, int ry)
     case rn(8,6):
     {
 
-        static const short contents[] = {
+        ROOM_CONTENTS(LEVELPACK_OTHERLEVEL, t, 0, {
         489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,
         489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,
         489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,
@@ -4782,7 +4789,7 @@ const short* otherlevelclass::loadlevel(int rx, int ry)
         489,489,489,489,489,489,611,0,0,0,0,609,489,489,489,489,611,690,690,690,690,690,690,609,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,
         489,489,489,489,489,489,611,0,0,0,0,609,489,489,489,489,611,0,0,0,0,0,0,609,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,
         489,489,489,489,489,489,611,0,0,0,0,609,489,489,489,489,611,0,0,0,0,0,0,609,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,
-        };
+        });
 
         obj.createentity(96, 72, 13); //Warp Token
 
@@ -4793,7 +4800,7 @@ const short* otherlevelclass::loadlevel(int rx, int ry)
     case rn(8,7):
     {
 
-        static const short contents[] = {
+        ROOM_CONTENTS(LEVELPACK_OTHERLEVEL, t, 0, {
         492,492,492,492,492,492,614,0,0,0,0,612,492,492,492,492,614,0,0,0,0,0,0,612,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,
         492,492,492,492,492,492,614,0,0,0,0,612,492,492,492,492,614,0,0,0,0,0,0,612,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,
         492,492,492,492,492,492,614,0,0,0,0,612,492,492,492,492,614,0,0,0,0,0,0,612,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,
@@ -4824,7 +4831,7 @@ const short* otherlevelclass::loadlevel(int rx, int ry)
         492,492,492,492,492,492,614,0,0,0,0,612,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,614,0,0,0,0,612,492,492,492,492,492,492,
         492,492,492,492,492,492,614,0,0,0,0,612,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,614,0,0,0,0,612,492,492,492,492,492,492,
         492,492,492,492,492,492,614,0,0,0,0,612,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,614,0,0,0,0,612,492,492,492,492,492,492,
-        };
+        });
         result = contents;
         break;
     }
@@ -4832,7 +4839,7 @@ const short* otherlevelclass::loadlevel(int rx, int ry)
     case rn(8,8):
     {
 
-        static const short contents[] = {
+        ROOM_CONTENTS(LEVELPACK_OTHERLEVEL, t, 0, {
         483,483,483,483,483,483,605,0,0,0,0,603,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,605,0,0,0,0,603,483,483,483,483,483,483,
         483,483,483,483,483,483,605,0,0,0,0,603,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,605,0,0,0,0,603,483,483,483,483,483,483,
         483,483,483,483,483,483,605,684,684,684,684,603,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,605,684,684,684,684,603,483,483,483,483,483,483,
@@ -4863,7 +4870,7 @@ const short* otherlevelclass::loadlevel(int rx, int ry)
         483,483,524,564,564,564,564,564,564,564,564,564,564,564,564,564,564,564,564,564,564,564,564,564,564,564,564,564,564,564,564,564,564,564,564,564,564,525,483,483,
         483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,
         483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,
-        };
+        });
         result = contents;
         break;
     }
@@ -4871,7 +4878,7 @@ const short* otherlevelclass::loadlevel(int rx, int ry)
     case rn(8,10):
     {
 
-        static const short contents[] = {
+        ROOM_CONTENTS(LEVELPACK_OTHERLEVEL, t, 0, {
         492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,
         492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,
         492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,
@@ -4902,7 +4909,7 @@ const short* otherlevelclass::loadlevel(int rx, int ry)
         492,492,492,492,492,492,614,0,0,0,0,612,492,492,492,492,492,492,492,492,614,0,0,0,0,0,0,0,0,0,0,0,0,0,0,612,492,492,492,492,
         492,492,492,492,492,492,614,0,0,0,0,612,492,492,492,492,492,492,492,492,614,0,0,0,0,0,0,0,0,0,0,0,0,0,0,612,492,492,492,492,
         492,492,492,492,492,492,614,0,0,0,0,612,492,492,492,492,492,492,492,492,614,0,0,0,0,0,0,0,0,0,0,0,0,0,0,612,492,492,492,492,
-        };
+        });
         result = contents;
         break;
     }
@@ -4910,7 +4917,7 @@ const short* otherlevelclass::loadlevel(int rx, int ry)
     case rn(8,11):
     {
 
-        static const short contents[] = {
+        ROOM_CONTENTS(LEVELPACK_OTHERLEVEL, t, 0, {
         483,483,483,483,483,483,605,0,0,0,0,603,483,483,483,483,483,483,483,483,605,0,0,0,0,0,0,0,0,0,0,0,0,0,0,603,483,483,483,483,
         483,483,483,483,483,483,605,0,0,0,0,603,483,483,483,483,483,483,483,483,605,0,0,0,0,0,0,0,0,0,0,0,0,0,0,603,483,483,483,483,
         483,483,483,483,483,483,605,684,684,684,684,603,483,483,483,483,483,483,483,483,605,0,0,0,0,0,0,0,0,0,0,0,0,0,0,603,483,483,483,483,
@@ -4941,7 +4948,7 @@ const short* otherlevelclass::loadlevel(int rx, int ry)
         0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,603,483,483,483,483,
         0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,603,483,483,483,483,
         0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,603,483,483,483,483,
-        };
+        });
 
         obj.createentity(176, 40, 14); //Teleporter!
         obj.createentity(120, 128, 20, 1);  // (terminal)
@@ -4954,7 +4961,7 @@ const short* otherlevelclass::loadlevel(int rx, int ry)
     case rn(8,12):
     {
 
-        static const short contents[] = {
+        ROOM_CONTENTS(LEVELPACK_OTHERLEVEL, t, 0, {
         0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,615,495,495,495,495,
         0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,615,495,495,495,495,
         0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,615,495,495,495,495,
@@ -4985,7 +4992,7 @@ const short* otherlevelclass::loadlevel(int rx, int ry)
         0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,615,495,495,495,495,
         0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,615,495,495,495,495,
         0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,615,495,495,495,495,
-        };
+        });
         result = contents;
         break;
     }
@@ -4993,7 +5000,7 @@ const short* otherlevelclass::loadlevel(int rx, int ry)
     case rn(8,13):
     {
 
-        static const short contents[] = {
+        ROOM_CONTENTS(LEVELPACK_OTHERLEVEL, t, 0, {
         0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,600,480,480,480,480,
         0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,600,480,480,480,480,
         0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,600,480,480,480,480,
@@ -5024,7 +5031,7 @@ const short* otherlevelclass::loadlevel(int rx, int ry)
         0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,600,480,480,480,480,
         0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,600,480,480,480,480,
         0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,600,480,480,480,480,
-        };
+        });
         result = contents;
         break;
     }
@@ -5032,7 +5039,7 @@ const short* otherlevelclass::loadlevel(int rx, int ry)
     case rn(8,14):
     {
 
-        static const short contents[] = {
+        ROOM_CONTENTS(LEVELPACK_OTHERLEVEL, t, 0, {
         0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,612,492,492,492,492,
         0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,612,492,492,492,492,
         0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,612,492,492,492,492,
@@ -5063,7 +5070,7 @@ const short* otherlevelclass::loadlevel(int rx, int ry)
         492,492,614,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,612,492,492,
         492,492,614,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,612,492,492,
         492,492,614,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,612,492,492,
-        };
+        });
 
         obj.createentity(40, 152, 10, 1, 14080);  // (savepoint)
         result = contents;
@@ -5073,7 +5080,7 @@ const short* otherlevelclass::loadlevel(int rx, int ry)
     case rn(8,15):
     {
 
-        static const short contents[] = {
+        ROOM_CONTENTS(LEVELPACK_OTHERLEVEL, t, 0, {
         495,495,617,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,615,495,495,
         495,495,617,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,615,495,495,
         495,495,617,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,615,495,495,
@@ -5104,7 +5111,7 @@ const short* otherlevelclass::loadlevel(int rx, int ry)
         495,495,495,495,495,495,617,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,615,495,495,495,495,495,495,
         495,495,495,495,495,495,617,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,615,495,495,495,495,495,495,
         495,495,495,495,495,495,617,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,615,495,495,495,495,495,495,
-        };
+        });
         result = contents;
         break;
     }
@@ -5112,7 +5119,7 @@ const short* otherlevelclass::loadlevel(int rx, int ry)
     case rn(8,16):
     {
 
-        static const short contents[] = {
+        ROOM_CONTENTS(LEVELPACK_OTHERLEVEL, t, 0, {
         489,489,489,489,489,489,611,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,609,489,489,489,489,489,489,
         489,489,489,489,489,489,611,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,609,489,489,489,489,489,489,
         489,489,489,489,489,489,611,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,609,489,489,489,489,489,489,
@@ -5143,7 +5150,7 @@ const short* otherlevelclass::loadlevel(int rx, int ry)
         489,489,489,489,611,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,609,489,489,489,489,
         489,489,489,489,611,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,609,489,489,489,489,
         489,489,489,489,611,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,609,489,489,489,489,
-        };
+        });
 
         obj.createentity(152, 80, 10, 1, 16080);  // (savepoint)
         result = contents;
@@ -5153,7 +5160,7 @@ const short* otherlevelclass::loadlevel(int rx, int ry)
     case rn(8,17):
     {
 
-        static const short contents[] = {
+        ROOM_CONTENTS(LEVELPACK_OTHERLEVEL, t, 0, {
         498,498,498,498,620,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,618,498,498,498,498,
         498,498,498,498,620,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,618,498,498,498,498,
         498,498,498,498,620,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,618,498,498,498,498,
@@ -5184,7 +5191,7 @@ const short* otherlevelclass::loadlevel(int rx, int ry)
         498,498,498,498,498,498,498,498,498,498,620,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,618,498,498,
         498,498,498,498,498,498,498,498,498,498,620,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,618,498,498,
         498,498,498,498,498,498,498,498,498,498,620,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,618,498,498,
-        };
+        });
         result = contents;
         break;
     }
@@ -5192,7 +5199,7 @@ const short* otherlevelclass::loadlevel(int rx, int ry)
     case rn(8,18):
     {
 
-        static const short contents[] = {
+        ROOM_CONTENTS(LEVELPACK_OTHERLEVEL, t, 0, {
         486,486,486,486,486,486,486,486,486,486,608,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,606,486,486,
         486,486,486,486,486,486,486,486,486,486,608,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,606,486,486,
         486,486,486,486,486,486,486,486,486,486,608,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,606,486,486,
@@ -5223,7 +5230,7 @@ const short* otherlevelclass::loadlevel(int rx, int ry)
         486,486,486,486,486,486,486,486,486,486,486,486,486,486,486,486,486,608,0,0,0,0,0,0,0,0,0,0,0,0,0,606,486,486,486,486,486,486,486,486,
         486,486,486,486,486,486,486,486,486,486,486,486,486,486,486,486,486,608,0,0,0,0,0,0,0,0,0,0,0,0,0,606,486,486,486,486,486,486,486,486,
         486,486,486,486,486,486,486,486,486,486,486,486,486,486,486,486,486,608,0,0,0,0,0,0,0,0,0,0,0,0,0,606,486,486,486,486,486,486,486,486,
-        };
+        });
         result = contents;
         break;
     }
@@ -5231,7 +5238,7 @@ const short* otherlevelclass::loadlevel(int rx, int ry)
     case rn(8,19):
     {
 
-        static const short contents[] = {
+        ROOM_CONTENTS(LEVELPACK_OTHERLEVEL, t, 0, {
         483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,605,0,0,0,0,0,0,0,0,0,0,0,0,0,603,483,483,483,483,483,483,483,483,
         483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,605,0,0,0,0,0,0,0,0,0,0,0,0,0,603,483,483,483,483,483,483,483,483,
         483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,605,0,0,0,0,0,0,0,0,0,0,0,0,0,603,483,483,483,483,483,483,483,483,
@@ -5262,7 +5269,7 @@ const short* otherlevelclass::loadlevel(int rx, int ry)
         483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,605,0,0,0,0,0,0,0,0,603,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,
         483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,605,0,0,0,0,0,0,0,0,603,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,
         483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,605,0,0,0,0,0,0,0,0,603,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,
-        };
+        });
         result = contents;
         break;
     }
@@ -5270,7 +5277,7 @@ const short* otherlevelclass::loadlevel(int rx, int ry)
     case rn(10,0):
     {
 
-        static const short contents[] = {
+        ROOM_CONTENTS(LEVELPACK_OTHERLEVEL, t, 0, {
         498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,620,0,0,0,0,0,618,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,
         498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,620,0,0,0,0,0,618,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,
         498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,620,0,0,0,0,0,658,659,659,659,500,498,498,498,498,498,498,498,498,498,498,498,
@@ -5301,7 +5308,7 @@ const short* otherlevelclass::loadlevel(int rx, int ry)
         498,498,498,498,498,498,498,498,498,498,498,498,498,539,579,579,579,579,580,0,0,0,0,0,618,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,
         498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,620,0,0,0,0,0,618,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,
         498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,620,0,0,0,0,0,618,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,
-        };
+        });
         result = contents;
         break;
     }
@@ -5309,7 +5316,7 @@ const short* otherlevelclass::loadlevel(int rx, int ry)
     case rn(10,1):
     {
 
-        static const short contents[] = {
+        ROOM_CONTENTS(LEVELPACK_OTHERLEVEL, t, 0, {
         498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,620,0,0,0,0,0,618,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,
         498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,620,0,0,0,0,0,618,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,
         498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,620,0,0,0,0,0,658,659,659,659,500,498,498,498,498,498,498,498,498,498,498,498,
@@ -5340,7 +5347,7 @@ const short* otherlevelclass::loadlevel(int rx, int ry)
         498,498,498,498,498,498,498,498,498,498,498,498,498,539,579,579,579,579,580,0,0,0,0,0,618,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,
         498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,620,0,0,0,0,0,618,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,
         498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,620,0,0,0,0,0,618,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,
-        };
+        });
         result = contents;
         break;
     }
@@ -5348,7 +5355,7 @@ const short* otherlevelclass::loadlevel(int rx, int ry)
     case rn(10,2):
     {
 
-        static const short contents[] = {
+        ROOM_CONTENTS(LEVELPACK_OTHERLEVEL, t, 0, {
         498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,620,0,0,0,0,0,618,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,
         498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,620,0,0,0,0,0,618,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,
         498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,620,0,0,0,0,0,658,659,659,659,500,498,498,498,498,498,498,498,498,498,498,498,
@@ -5379,7 +5386,7 @@ const short* otherlevelclass::loadlevel(int rx, int ry)
         498,498,498,498,498,498,498,498,498,498,498,498,498,539,579,579,579,579,580,0,0,0,0,0,618,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,
         498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,620,0,0,0,0,0,618,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,
         498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,620,0,0,0,0,0,618,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,
-        };
+        });
         result = contents;
         break;
     }
@@ -5387,7 +5394,7 @@ const short* otherlevelclass::loadlevel(int rx, int ry)
     case rn(10,3):
     {
 
-        static const short contents[] = {
+        ROOM_CONTENTS(LEVELPACK_OTHERLEVEL, t, 0, {
         486,486,486,486,486,486,486,486,486,486,486,486,486,486,486,486,486,486,608,0,0,0,0,0,606,486,486,486,486,486,486,486,486,486,486,486,486,486,486,486,
         486,486,486,486,486,486,486,486,486,486,486,486,486,486,486,486,486,486,608,0,0,0,0,0,606,486,486,486,486,486,486,486,486,486,486,486,486,486,486,486,
         486,486,486,486,486,486,486,486,486,486,486,486,486,486,486,486,486,486,608,0,0,0,0,0,646,647,647,647,488,486,486,486,486,486,486,486,486,486,486,486,
@@ -5418,7 +5425,7 @@ const short* otherlevelclass::loadlevel(int rx, int ry)
         486,486,486,486,486,486,486,486,486,486,486,486,486,486,486,486,486,486,486,486,486,486,486,486,486,486,486,486,486,486,486,486,486,486,486,486,486,486,486,486,
         486,486,486,486,486,486,486,486,486,486,486,486,486,486,486,486,486,486,486,486,486,486,486,486,486,486,486,486,486,486,486,486,486,486,486,486,486,486,486,486,
         486,486,486,486,486,486,486,486,486,486,486,486,486,486,486,486,486,486,486,486,486,486,486,486,486,486,486,486,486,486,486,486,486,486,486,486,486,486,486,486,
-        };
+        });
         result = contents;
         break;
     }
@@ -5426,7 +5433,7 @@ const short* otherlevelclass::loadlevel(int rx, int ry)
     case rn(10,8):
     {
 
-        static const short contents[] = {
+        ROOM_CONTENTS(LEVELPACK_OTHERLEVEL, t, 0, {
         295,295,295,295,295,295,295,295,295,295,295,295,295,295,295,295,295,295,295,295,295,295,295,295,295,295,295,295,295,295,295,295,295,295,295,295,295,295,295,295,
         295,295,295,295,295,295,295,295,295,295,295,295,295,295,295,295,295,295,295,295,295,295,295,295,295,295,295,295,295,295,295,295,295,295,295,295,295,295,295,295,
         295,295,295,295,295,295,295,295,295,295,295,295,295,295,295,295,295,295,295,295,295,295,295,295,295,295,295,295,295,295,295,295,295,295,295,295,295,295,295,295,
@@ -5457,7 +5464,7 @@ const short* otherlevelclass::loadlevel(int rx, int ry)
         295,295,295,295,295,295,295,295,295,295,295,417,698,698,698,698,698,698,698,698,698,698,698,698,698,698,698,698,415,295,295,295,295,295,295,295,295,295,295,295,
         295,295,295,295,295,295,295,295,295,295,295,417,698,698,698,698,698,698,698,698,698,698,698,698,698,698,698,698,415,295,295,295,295,295,295,295,295,295,295,295,
         295,295,295,295,295,295,295,295,295,295,295,417,698,698,698,698,698,698,698,698,698,698,698,698,698,698,698,698,415,295,295,295,295,295,295,295,295,295,295,295,
-        };
+        });
 
         obj.createentity(80, 40, 9, 17);  // (shiny trinket)
         roomtileset = 0; // (Use space station tileset)
@@ -5468,7 +5475,7 @@ const short* otherlevelclass::loadlevel(int rx, int ry)
     case rn(10,9):
     {
 
-        static const short contents[] = {
+        ROOM_CONTENTS(LEVELPACK_OTHERLEVEL, t, 0, {
         283,283,283,283,283,283,283,283,283,283,283,405,695,695,695,695,695,695,695,695,695,695,695,695,695,695,695,695,403,283,283,283,283,283,283,283,283,283,283,283,
         283,283,283,283,283,283,283,283,283,283,283,405,695,695,695,695,695,695,695,695,695,695,695,695,695,695,695,695,403,283,283,283,283,283,283,283,283,283,283,283,
         283,283,283,283,283,283,283,283,283,283,283,405,695,695,695,695,695,695,695,695,695,695,695,695,695,695,695,695,403,283,283,283,283,283,283,283,283,283,283,283,
@@ -5499,7 +5506,7 @@ const short* otherlevelclass::loadlevel(int rx, int ry)
         283,283,283,283,283,283,283,283,283,283,283,324,364,364,364,364,364,364,364,364,364,364,364,364,364,364,364,364,364,364,364,364,364,364,364,364,364,364,364,364,
         283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,
         283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,
-        };
+        });
 
         obj.nearelephant = false;
         roomtileset = 0; // (Use space station tileset)
@@ -5510,7 +5517,7 @@ const short* otherlevelclass::loadlevel(int rx, int ry)
     case rn(10,10):
     {
 
-        static const short contents[] = {
+        ROOM_CONTENTS(LEVELPACK_OTHERLEVEL, t, 0, {
         316,316,316,316,316,316,316,316,316,316,316,316,316,316,316,316,316,316,316,316,316,316,438,403,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,
         316,316,316,316,316,316,316,316,316,316,316,316,316,316,316,316,316,316,316,316,316,316,438,403,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,
         316,316,316,316,316,316,316,316,316,316,316,316,316,316,316,316,316,316,316,316,316,316,438,443,285,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,
@@ -5541,7 +5548,7 @@ const short* otherlevelclass::loadlevel(int rx, int ry)
         316,316,316,316,316,316,316,316,316,316,316,316,316,316,316,316,316,316,316,316,316,316,316,438,0,0,0,0,0,363,364,325,283,283,283,283,283,283,283,283,
         316,316,316,316,316,316,316,316,316,316,316,316,316,316,316,316,316,316,316,316,316,316,316,438,0,0,0,0,0,403,283,283,283,283,283,283,283,283,283,283,
         316,316,316,316,316,316,316,316,316,316,316,316,316,316,316,316,316,316,316,316,316,316,316,438,0,0,0,0,0,403,283,283,283,283,283,283,283,283,283,283,
-        };
+        });
 
         roomtileset = 0; // (Use space station tileset)
         result = contents;
@@ -5551,7 +5558,7 @@ const short* otherlevelclass::loadlevel(int rx, int ry)
     case rn(10,11):
     {
 
-        static const short contents[] = {
+        ROOM_CONTENTS(LEVELPACK_OTHERLEVEL, t, 0, {
         116,116,116,116,116,116,116,116,116,116,116,116,116,116,116,116,116,116,116,116,116,116,116,238,0,0,0,0,0,612,492,492,492,492,492,492,492,492,492,492,
         116,116,116,116,116,116,116,116,116,116,116,116,116,116,116,116,116,116,116,116,116,116,116,238,0,0,0,0,0,612,492,492,492,492,492,492,492,492,492,492,
         116,116,116,116,116,116,116,116,116,116,116,116,116,116,116,116,116,116,116,116,116,116,116,238,0,0,0,0,0,612,492,492,492,492,492,492,492,492,492,492,
@@ -5582,7 +5589,7 @@ const short* otherlevelclass::loadlevel(int rx, int ry)
         116,116,116,116,116,116,116,116,116,116,116,116,116,116,116,116,116,116,116,116,116,116,116,116,116,238,0,0,0,612,492,492,492,492,492,492,492,492,492,492,
         116,116,116,116,116,116,116,116,116,116,116,116,116,116,116,116,116,116,116,116,116,116,116,116,116,238,0,0,0,612,492,492,492,492,492,492,492,492,492,492,
         116,116,116,116,116,116,116,116,116,116,116,116,116,116,116,116,116,116,116,116,116,116,116,116,116,238,0,0,0,612,492,492,492,492,492,492,492,492,492,492,
-        };
+        });
 
         roomtileset = 0; // (Use space station tileset)
         result = contents;
@@ -5592,7 +5599,7 @@ const short* otherlevelclass::loadlevel(int rx, int ry)
     case rn(10,12):
     {
 
-        static const short contents[] = {
+        ROOM_CONTENTS(LEVELPACK_OTHERLEVEL, t, 0, {
         516,516,516,516,516,516,516,516,516,516,516,516,516,516,516,516,516,516,516,516,516,516,516,516,516,638,0,0,0,630,510,510,510,510,510,510,510,510,510,510,
         516,516,516,516,516,516,516,516,516,516,516,516,516,516,516,516,516,516,516,516,516,516,516,516,516,638,0,0,0,630,510,510,510,510,510,510,510,510,510,510,
         516,516,516,516,516,516,516,516,516,516,516,516,516,516,516,516,516,516,516,516,516,516,516,516,516,638,0,0,0,630,510,510,510,510,510,510,510,510,510,510,
@@ -5623,7 +5630,7 @@ const short* otherlevelclass::loadlevel(int rx, int ry)
         516,516,638,0,0,0,590,591,591,591,591,591,591,591,591,591,552,510,510,510,510,510,510,510,510,510,510,510,510,510,510,510,510,510,510,510,510,510,510,510,
         516,516,638,0,0,0,630,510,510,510,510,510,510,510,510,510,510,510,510,510,510,510,510,510,510,510,510,510,510,510,510,510,510,510,510,510,510,510,510,510,
         516,516,638,0,0,0,630,510,510,510,510,510,510,510,510,510,510,510,510,510,510,510,510,510,510,510,510,510,510,510,510,510,510,510,510,510,510,510,510,510,
-        };
+        });
 
         obj.createentity(184, 176, 10, 1, 12100);  // (savepoint)
         roomtileset = 0; // (Use space station tileset)
@@ -5634,7 +5641,7 @@ const short* otherlevelclass::loadlevel(int rx, int ry)
     case rn(10,13):
     {
 
-        static const short contents[] = {
+        ROOM_CONTENTS(LEVELPACK_OTHERLEVEL, t, 0, {
         513,513,635,0,0,0,224,104,104,104,104,104,104,104,104,104,104,104,104,104,104,104,104,104,104,104,104,104,104,104,104,104,104,104,104,104,104,104,104,104,
         513,513,635,0,0,0,224,104,104,104,104,104,104,104,104,104,104,104,104,104,104,104,104,104,104,104,104,104,104,104,104,104,104,104,104,104,104,104,104,104,
         513,514,675,0,0,0,224,104,104,104,104,104,104,104,104,104,104,104,104,104,104,104,104,104,104,104,104,104,104,104,104,104,104,104,104,104,104,104,104,104,
@@ -5665,7 +5672,7 @@ const short* otherlevelclass::loadlevel(int rx, int ry)
         513,513,635,0,0,0,224,104,104,104,104,104,104,104,104,104,104,104,104,104,104,104,104,104,104,104,104,104,104,104,104,104,104,104,104,104,104,104,104,104,
         513,513,635,0,0,184,146,104,104,104,104,104,104,104,104,104,104,104,104,104,104,104,104,104,104,104,104,104,104,104,104,104,104,104,104,104,104,104,104,104,
         513,513,635,0,0,224,104,104,104,104,104,104,104,104,104,104,104,104,104,104,104,104,104,104,104,104,104,104,104,104,104,104,104,104,104,104,104,104,104,104,
-        };
+        });
 
         roomtileset = 0; // (Use space station tileset)
         result = contents;
@@ -5675,7 +5682,7 @@ const short* otherlevelclass::loadlevel(int rx, int ry)
     case rn(10,14):
     {
 
-        static const short contents[] = {
+        ROOM_CONTENTS(LEVELPACK_OTHERLEVEL, t, 0, {
         316,316,438,0,0,403,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,
         316,316,438,0,0,403,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,
         316,316,438,0,0,403,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,
@@ -5706,7 +5713,7 @@ const short* otherlevelclass::loadlevel(int rx, int ry)
         316,316,316,316,438,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
         316,316,316,316,438,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
         316,316,316,316,438,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-        };
+        });
 
         roomtileset = 0; // (Use space station tileset)
         result = contents;
@@ -5716,7 +5723,7 @@ const short* otherlevelclass::loadlevel(int rx, int ry)
     case rn(10,15):
     {
 
-        static const short contents[] = {
+        ROOM_CONTENTS(LEVELPACK_OTHERLEVEL, t, 0, {
         495,495,495,495,617,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
         495,495,495,495,617,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
         495,495,495,495,617,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
@@ -5747,7 +5754,7 @@ const short* otherlevelclass::loadlevel(int rx, int ry)
         495,495,495,495,495,495,495,495,495,617,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
         495,495,495,495,495,495,495,495,495,617,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
         495,495,495,495,495,495,495,495,495,617,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-        };
+        });
         result = contents;
         break;
     }
@@ -5755,7 +5762,7 @@ const short* otherlevelclass::loadlevel(int rx, int ry)
     case rn(10,16):
     {
 
-        static const short contents[] = {
+        ROOM_CONTENTS(LEVELPACK_OTHERLEVEL, t, 0, {
         486,486,486,486,486,486,486,486,486,608,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
         486,486,486,486,486,486,486,486,486,608,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
         486,486,486,486,486,486,486,486,486,608,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
@@ -5786,7 +5793,7 @@ const short* otherlevelclass::loadlevel(int rx, int ry)
         486,486,486,486,486,486,486,486,486,486,486,486,486,486,486,486,486,486,486,486,486,486,486,486,486,486,486,486,486,486,486,486,486,486,486,486,486,486,486,486,
         486,486,486,486,486,486,486,486,486,486,486,486,486,486,486,486,486,486,486,486,486,486,486,486,486,486,486,486,486,486,486,486,486,486,486,486,486,486,486,486,
         486,486,486,486,486,486,486,486,486,486,486,486,486,486,486,486,486,486,486,486,486,486,486,486,486,486,486,486,486,486,486,486,486,486,486,486,486,486,486,486,
-        };
+        });
 
         obj.createentity(216, 72, 10, 1, 16100);  // (savepoint)
         result = contents;
@@ -5796,7 +5803,7 @@ const short* otherlevelclass::loadlevel(int rx, int ry)
     case rn(10,17):
     {
 
-        static const short contents[] = {
+        ROOM_CONTENTS(LEVELPACK_OTHERLEVEL, t, 0, {
         492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,
         492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,
         492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,
@@ -5827,7 +5834,7 @@ const short* otherlevelclass::loadlevel(int rx, int ry)
         492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,
         492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,
         492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,
-        };
+        });
         result = contents;
         break;
     }
@@ -5835,7 +5842,7 @@ const short* otherlevelclass::loadlevel(int rx, int ry)
     case rn(10,18):
     {
 
-        static const short contents[] = {
+        ROOM_CONTENTS(LEVELPACK_OTHERLEVEL, t, 0, {
         483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,
         483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,
         483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,
@@ -5866,7 +5873,7 @@ const short* otherlevelclass::loadlevel(int rx, int ry)
         483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,
         483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,
         483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,
-        };
+        });
         result = contents;
         break;
     }
@@ -5874,7 +5881,7 @@ const short* otherlevelclass::loadlevel(int rx, int ry)
     case rn(10,19):
     {
 
-        static const short contents[] = {
+        ROOM_CONTENTS(LEVELPACK_OTHERLEVEL, t, 0, {
         501,501,501,501,501,501,501,501,501,501,501,501,501,501,501,501,501,501,501,501,501,501,501,501,501,501,501,501,501,501,501,501,501,501,501,501,501,501,501,501,
         501,501,501,501,501,501,501,501,501,501,501,501,501,501,501,501,501,501,501,501,501,501,501,501,501,501,501,501,501,501,501,501,501,501,501,501,501,501,501,501,
         501,501,501,501,501,501,501,501,501,501,501,501,501,501,501,501,501,501,501,501,501,501,501,501,501,501,501,501,501,501,501,501,501,501,501,501,501,501,501,501,
@@ -5905,7 +5912,7 @@ const short* otherlevelclass::loadlevel(int rx, int ry)
         501,501,501,501,501,501,501,501,501,501,501,501,501,501,501,501,501,501,623,0,0,0,0,0,621,501,501,501,501,501,501,501,501,501,501,501,501,501,501,501,
         501,501,501,501,501,501,501,501,501,501,501,501,501,501,501,501,501,501,623,0,0,0,0,0,621,501,501,501,501,501,501,501,501,501,501,501,501,501,501,501,
         501,501,501,501,501,501,501,501,501,501,501,501,501,501,501,501,501,501,623,0,0,0,0,0,621,501,501,501,501,501,501,501,501,501,501,501,501,501,501,501,
-        };
+        });
 
         obj.createentity(40, 112, 9, 13);  // (shiny trinket)
         result = contents;
@@ -5915,7 +5922,7 @@ const short* otherlevelclass::loadlevel(int rx, int ry)
     case rn(11,0):
     {
 
-        static const short contents[] = {
+        ROOM_CONTENTS(LEVELPACK_OTHERLEVEL, t, 0, {
         486,486,486,486,486,486,486,486,486,486,486,486,486,486,486,608,0,0,0,0,0,0,0,0,606,486,486,486,486,486,486,486,486,486,486,486,486,486,486,486,
         486,486,486,486,486,486,486,486,486,486,486,486,486,486,486,608,0,0,0,0,0,0,0,0,606,486,486,486,486,486,486,486,486,486,486,486,486,486,486,486,
         486,486,486,486,486,486,486,486,486,486,486,486,486,486,486,608,0,0,0,0,0,0,0,0,606,486,486,486,486,486,486,486,486,486,486,486,486,486,486,486,
@@ -5946,7 +5953,7 @@ const short* otherlevelclass::loadlevel(int rx, int ry)
         486,486,486,486,486,486,486,486,486,486,486,486,486,486,486,608,0,0,0,0,0,0,0,0,606,486,486,486,486,486,486,486,486,486,486,486,486,486,486,486,
         486,486,486,486,486,486,486,486,486,486,486,486,486,486,486,608,0,0,0,0,0,0,0,0,606,486,486,486,486,486,486,486,486,486,486,486,486,486,486,486,
         486,486,486,486,486,486,486,486,486,486,486,486,486,486,486,608,0,0,0,0,0,0,0,0,606,486,486,486,486,486,486,486,486,486,486,486,486,486,486,486,
-        };
+        });
         result = contents;
         break;
     }
@@ -5954,7 +5961,7 @@ const short* otherlevelclass::loadlevel(int rx, int ry)
     case rn(11,1):
     {
 
-        static const short contents[] = {
+        ROOM_CONTENTS(LEVELPACK_OTHERLEVEL, t, 0, {
         486,486,486,486,486,486,486,486,486,486,486,486,486,486,486,608,0,0,0,0,0,0,0,0,606,486,486,486,486,486,486,486,486,486,486,486,486,486,486,486,
         486,486,486,486,486,486,486,486,486,486,486,486,486,486,486,608,0,0,0,0,0,0,0,0,606,486,486,486,486,486,486,486,486,486,486,486,486,486,486,486,
         486,486,486,486,486,486,486,486,486,486,486,486,486,486,486,608,0,0,0,0,0,0,0,0,606,486,486,486,486,486,486,486,486,486,486,486,486,486,486,486,
@@ -5985,7 +5992,7 @@ const short* otherlevelclass::loadlevel(int rx, int ry)
         486,486,486,486,486,486,486,486,486,486,486,486,486,486,486,608,0,0,0,0,0,0,0,0,606,486,486,486,486,486,486,486,486,486,486,486,486,486,486,486,
         486,486,486,486,486,486,486,486,486,486,486,486,486,486,486,608,0,0,0,0,0,0,0,0,606,486,486,486,486,486,486,486,486,486,486,486,486,486,486,486,
         486,486,486,486,486,486,486,486,486,486,486,486,486,486,486,608,0,0,0,0,0,0,0,0,606,486,486,486,486,486,486,486,486,486,486,486,486,486,486,486,
-        };
+        });
         result = contents;
         break;
     }
@@ -5993,7 +6000,7 @@ const short* otherlevelclass::loadlevel(int rx, int ry)
     case rn(11,2):
     {
 
-        static const short contents[] = {
+        ROOM_CONTENTS(LEVELPACK_OTHERLEVEL, t, 0, {
         495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,617,0,0,0,0,0,0,0,0,615,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,
         495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,617,0,0,0,0,0,0,0,0,615,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,
         495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,617,0,0,0,0,0,0,0,0,615,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,
@@ -6024,7 +6031,7 @@ const short* otherlevelclass::loadlevel(int rx, int ry)
         495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,617,0,0,0,0,0,0,0,0,615,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,
         495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,617,0,0,0,0,0,0,0,0,615,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,
         495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,617,0,0,0,0,0,0,0,0,615,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,
-        };
+        });
         result = contents;
         break;
     }
@@ -6032,7 +6039,7 @@ const short* otherlevelclass::loadlevel(int rx, int ry)
     case rn(11,3):
     {
 
-        static const short contents[] = {
+        ROOM_CONTENTS(LEVELPACK_OTHERLEVEL, t, 0, {
         489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,611,0,0,0,0,0,0,0,0,609,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,
         489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,611,0,0,0,0,0,0,0,0,609,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,
         489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,611,0,0,0,0,0,0,0,0,609,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,
@@ -6063,7 +6070,7 @@ const short* otherlevelclass::loadlevel(int rx, int ry)
         489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,
         489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,
         489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,
-        };
+        });
         result = contents;
         break;
     }
@@ -6071,7 +6078,7 @@ const short* otherlevelclass::loadlevel(int rx, int ry)
     case rn(11,8):
     {
 
-        static const short contents[] = {
+        ROOM_CONTENTS(LEVELPACK_OTHERLEVEL, t, 0, {
         495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,
         495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,
         495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,
@@ -6102,7 +6109,7 @@ const short* otherlevelclass::loadlevel(int rx, int ry)
         495,495,617,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
         495,495,617,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
         495,495,617,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-        };
+        });
 
 
         obj.createentity((8 * 8), (12 * 8), 1, 0, 0, -10000, -10000, 10000, 100000);  // Enemy
@@ -6116,7 +6123,7 @@ const short* otherlevelclass::loadlevel(int rx, int ry)
     case rn(11,9):
     {
 
-        static const short contents[] = {
+        ROOM_CONTENTS(LEVELPACK_OTHERLEVEL, t, 0, {
         310,310,432,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
         310,310,432,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
         310,310,432,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
@@ -6147,7 +6154,7 @@ const short* otherlevelclass::loadlevel(int rx, int ry)
         391,391,391,391,391,391,391,391,391,391,391,391,391,391,391,391,391,391,391,391,391,391,391,391,391,391,391,391,391,391,391,391,391,391,391,391,391,391,391,391,
         310,310,310,310,310,310,310,310,310,310,310,310,310,310,310,310,310,310,310,310,310,310,310,310,310,310,310,310,310,310,310,310,310,310,310,310,310,310,310,310,
         310,310,310,310,310,310,310,310,310,310,310,310,310,310,310,310,310,310,310,310,310,310,310,310,310,310,310,310,310,310,310,310,310,310,310,310,310,310,310,310,
-        };
+        });
 
 
         obj.createentity(8 * 8, -248 + (12 * 8), 1, 0, 0, -10000, -10000, 10000, 100000);  // Enemy
@@ -6161,7 +6168,7 @@ const short* otherlevelclass::loadlevel(int rx, int ry)
     case rn(11,10):
     {
 
-        static const short contents[] = {
+        ROOM_CONTENTS(LEVELPACK_OTHERLEVEL, t, 0, {
         92,92,92,92,92,92,92,92,92,92,92,92,92,92,92,92,92,92,92,92,92,92,92,92,92,92,92,92,92,92,92,92,92,92,92,92,92,92,92,92,
         92,92,92,92,92,92,92,92,92,92,92,92,92,92,92,92,92,92,92,92,92,92,92,92,92,92,92,92,92,92,92,92,92,92,92,92,92,92,92,92,
         92,92,92,92,92,92,92,92,92,92,92,92,92,92,92,92,92,92,92,92,92,92,92,92,92,92,92,92,92,92,92,92,92,92,92,92,92,92,92,92,
@@ -6192,7 +6199,7 @@ const short* otherlevelclass::loadlevel(int rx, int ry)
         92,92,92,92,92,92,92,92,92,92,92,92,92,92,92,92,92,92,92,92,92,92,92,92,92,214,683,683,683,683,683,683,683,683,683,683,683,683,683,683,
         92,92,92,92,92,92,92,92,92,92,92,92,92,92,92,92,92,92,92,92,92,92,92,92,92,133,173,173,173,173,173,173,173,173,173,173,173,173,173,173,
         92,92,92,92,92,92,92,92,92,92,92,92,92,92,92,92,92,92,92,92,92,92,92,92,92,92,92,92,92,92,92,92,92,92,92,92,92,92,92,92,
-        };
+        });
 
         roomtileset = 0; // (Use space station tileset)
         result = contents;
@@ -6202,7 +6209,7 @@ const short* otherlevelclass::loadlevel(int rx, int ry)
     case rn(11,16):
     {
 
-        static const short contents[] = {
+        ROOM_CONTENTS(LEVELPACK_OTHERLEVEL, t, 0, {
         0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
         0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
         0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
@@ -6233,7 +6240,7 @@ const short* otherlevelclass::loadlevel(int rx, int ry)
         489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,
         489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,
         489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,
-        };
+        });
         result = contents;
         break;
     }
@@ -6241,7 +6248,7 @@ const short* otherlevelclass::loadlevel(int rx, int ry)
     case rn(11,17):
     {
 
-        static const short contents[] = {
+        ROOM_CONTENTS(LEVELPACK_OTHERLEVEL, t, 0, {
         480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,
         480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,
         480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,
@@ -6272,7 +6279,7 @@ const short* otherlevelclass::loadlevel(int rx, int ry)
         480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,602,0,0,0,0,0,0,0,0,600,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,
         480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,602,0,0,0,0,0,0,0,0,600,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,
         480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,602,0,0,0,0,0,0,0,0,600,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,
-        };
+        });
         result = contents;
         break;
     }
@@ -6280,7 +6287,7 @@ const short* otherlevelclass::loadlevel(int rx, int ry)
     case rn(11,18):
     {
 
-        static const short contents[] = {
+        ROOM_CONTENTS(LEVELPACK_OTHERLEVEL, t, 0, {
         486,486,486,486,486,486,486,486,486,486,486,486,486,486,486,608,0,0,0,0,0,0,0,0,606,486,486,486,486,486,486,486,486,486,486,486,486,486,486,486,
         486,486,486,486,486,486,486,486,486,486,486,486,486,486,486,608,0,0,0,0,0,0,0,0,606,486,486,486,486,486,486,486,486,486,486,486,486,486,486,486,
         486,486,486,486,486,486,486,486,486,486,486,486,486,486,486,608,0,0,0,0,0,0,0,0,606,486,486,486,486,486,486,486,486,486,486,486,486,486,486,486,
@@ -6311,7 +6318,7 @@ const short* otherlevelclass::loadlevel(int rx, int ry)
         486,486,486,486,486,486,486,486,486,486,486,486,486,486,486,608,0,0,0,0,0,0,0,0,606,486,486,486,486,486,486,486,486,486,486,486,486,486,486,486,
         486,486,486,486,486,486,486,486,486,486,486,486,486,486,486,608,0,0,0,0,0,0,0,0,606,486,486,486,486,486,486,486,486,486,486,486,486,486,486,486,
         486,486,486,486,486,486,486,486,486,486,486,486,486,486,486,608,0,0,0,0,0,0,0,0,606,486,486,486,486,486,486,486,486,486,486,486,486,486,486,486,
-        };
+        });
         result = contents;
         break;
     }
@@ -6319,7 +6326,7 @@ const short* otherlevelclass::loadlevel(int rx, int ry)
     case rn(11,19):
     {
 
-        static const short contents[] = {
+        ROOM_CONTENTS(LEVELPACK_OTHERLEVEL, t, 0, {
         486,486,486,486,486,486,486,486,486,486,486,486,486,486,486,608,0,0,0,0,0,0,0,0,606,486,486,486,486,486,486,486,486,486,486,486,486,486,486,486,
         486,486,486,486,486,486,486,486,486,486,486,486,486,486,486,608,0,0,0,0,0,0,0,0,606,486,486,486,486,486,486,486,486,486,486,486,486,486,486,486,
         486,486,486,486,486,486,486,486,486,486,486,486,486,486,486,608,0,0,0,0,0,0,0,0,606,486,486,486,486,486,486,486,486,486,486,486,486,486,486,486,
@@ -6350,7 +6357,7 @@ const short* otherlevelclass::loadlevel(int rx, int ry)
         486,486,486,486,486,486,486,486,486,486,486,486,486,486,486,608,0,0,0,0,0,0,0,0,606,486,486,486,486,486,486,486,486,486,486,486,486,486,486,486,
         486,486,486,486,486,486,486,486,486,486,486,486,486,486,486,608,0,0,0,0,0,0,0,0,606,486,486,486,486,486,486,486,486,486,486,486,486,486,486,486,
         486,486,486,486,486,486,486,486,486,486,486,486,486,486,486,608,0,0,0,0,0,0,0,0,606,486,486,486,486,486,486,486,486,486,486,486,486,486,486,486,
-        };
+        });
         result = contents;
         break;
     }
@@ -6358,7 +6365,7 @@ const short* otherlevelclass::loadlevel(int rx, int ry)
     case rn(12,0):
     {
 
-        static const short contents[] = {
+        ROOM_CONTENTS(LEVELPACK_OTHERLEVEL, t, 0, {
         489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,
         489,489,490,650,650,650,650,650,491,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,
         489,489,611,166,167,167,167,168,609,489,489,489,489,489,489,489,489,489,490,650,650,650,491,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,
@@ -6389,7 +6396,7 @@ const short* otherlevelclass::loadlevel(int rx, int ry)
         489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,
         489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,
         489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,
-        };
+        });
         result = contents;
         break;
     }
@@ -6397,7 +6404,7 @@ const short* otherlevelclass::loadlevel(int rx, int ry)
     case rn(12,1):
     {
 
-        static const short contents[] = {
+        ROOM_CONTENTS(LEVELPACK_OTHERLEVEL, t, 0, {
         498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,
         498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,
         498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,
@@ -6428,7 +6435,7 @@ const short* otherlevelclass::loadlevel(int rx, int ry)
         498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,620,0,0,0,0,0,0,0,0,618,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,
         498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,620,0,0,0,0,0,0,0,0,618,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,
         498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,620,0,0,0,0,0,0,0,0,618,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,
-        };
+        });
         result = contents;
         break;
     }
@@ -6436,7 +6443,7 @@ const short* otherlevelclass::loadlevel(int rx, int ry)
     case rn(12,2):
     {
 
-        static const short contents[] = {
+        ROOM_CONTENTS(LEVELPACK_OTHERLEVEL, t, 0, {
         483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,605,0,0,0,0,0,0,0,0,603,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,
         483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,605,0,0,0,0,0,0,0,0,603,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,
         483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,605,0,0,0,0,0,0,0,0,603,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,
@@ -6467,7 +6474,7 @@ const short* otherlevelclass::loadlevel(int rx, int ry)
         483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,
         483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,
         483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,
-        };
+        });
         result = contents;
         break;
     }
@@ -6475,7 +6482,7 @@ const short* otherlevelclass::loadlevel(int rx, int ry)
     case rn(12,8):
     {
 
-        static const short contents[] = {
+        ROOM_CONTENTS(LEVELPACK_OTHERLEVEL, t, 0, {
         292,292,292,292,292,292,292,292,292,292,292,292,292,292,292,292,292,292,292,292,292,292,292,292,292,292,292,292,292,292,292,292,292,292,292,292,292,292,292,292,
         292,292,292,292,292,292,292,292,292,292,292,292,292,292,292,292,292,292,292,292,292,292,292,292,292,292,292,292,292,292,292,292,292,292,292,292,292,292,292,292,
         292,292,292,292,292,292,292,292,292,292,292,292,292,292,292,292,292,292,292,292,292,292,292,292,292,292,292,292,292,292,292,292,292,292,292,292,292,292,292,292,
@@ -6506,7 +6513,7 @@ const short* otherlevelclass::loadlevel(int rx, int ry)
         0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,412,292,292,414,698,698,698,412,292,292,292,
         0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,412,292,292,414,698,698,698,412,292,292,292,
         0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,412,292,292,414,698,698,698,412,292,292,292,
-        };
+        });
 
 
         obj.createentity(-328 + (8 * 8), (12 * 8), 1, 0, 0, -10000, -10000, 10000, 100000);  // Enemy
@@ -6521,7 +6528,7 @@ const short* otherlevelclass::loadlevel(int rx, int ry)
     case rn(12,9):
     {
 
-        static const short contents[] = {
+        ROOM_CONTENTS(LEVELPACK_OTHERLEVEL, t, 0, {
         0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,215,95,95,217,689,689,689,215,95,95,95,
         0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,215,95,95,217,689,689,689,215,95,95,95,
         0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,215,95,95,217,689,689,689,215,95,95,95,
@@ -6552,7 +6559,7 @@ const short* otherlevelclass::loadlevel(int rx, int ry)
         176,176,176,176,176,176,176,176,176,176,176,176,176,176,176,176,176,176,176,176,176,176,176,176,176,176,176,176,176,137,95,95,217,689,689,689,215,95,95,95,
         95,95,95,95,95,95,95,95,95,95,95,95,95,95,95,95,95,95,95,95,95,95,95,95,95,95,95,95,95,95,95,95,217,689,689,689,215,95,95,95,
         95,95,95,95,95,95,95,95,95,95,95,95,95,95,95,95,95,95,95,95,95,95,95,95,95,95,95,95,95,95,95,95,217,689,689,689,215,95,95,95,
-        };
+        });
 
 
         obj.createentity(-328 + (8 * 8), -248 + (12 * 8), 1, 0, 0, -10000, -10000, 10000, 100000);  // Enemy
@@ -6566,7 +6573,7 @@ const short* otherlevelclass::loadlevel(int rx, int ry)
     case rn(12,10):
     {
 
-        static const short contents[] = {
+        ROOM_CONTENTS(LEVELPACK_OTHERLEVEL, t, 0, {
         104,104,104,104,104,104,104,104,104,104,104,104,104,104,104,104,104,104,104,104,104,104,104,104,104,104,104,104,104,104,104,104,226,704,704,704,224,104,104,104,
         104,104,104,104,104,104,104,104,104,104,104,104,104,104,104,104,104,104,104,104,104,104,104,104,104,104,104,104,104,104,104,104,226,704,704,704,224,104,104,104,
         104,104,104,104,104,104,104,104,104,104,104,104,104,104,104,104,104,104,104,104,104,104,104,104,104,104,104,104,104,104,104,104,226,704,704,704,224,104,104,104,
@@ -6597,7 +6604,7 @@ const short* otherlevelclass::loadlevel(int rx, int ry)
         704,704,704,704,704,704,704,704,704,704,704,704,704,704,704,704,704,704,704,704,704,704,704,704,704,704,704,704,704,704,704,704,704,704,704,704,224,104,104,104,
         185,185,185,185,185,185,185,185,185,185,185,185,185,185,185,185,185,185,185,185,185,185,185,185,185,185,185,185,185,185,185,185,185,185,185,185,146,104,104,104,
         104,104,104,104,104,104,104,104,104,104,104,104,104,104,104,104,104,104,104,104,104,104,104,104,104,104,104,104,104,104,104,104,104,104,104,104,104,104,104,104,
-        };
+        });
 
         obj.nearelephant = false;
         roomtileset = 0; // (Use space station tileset)
@@ -6608,7 +6615,7 @@ const short* otherlevelclass::loadlevel(int rx, int ry)
     case rn(12,16):
     {
 
-        static const short contents[] = {
+        ROOM_CONTENTS(LEVELPACK_OTHERLEVEL, t, 0, {
         0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
         0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
         0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
@@ -6639,7 +6646,7 @@ const short* otherlevelclass::loadlevel(int rx, int ry)
         498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,
         498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,
         498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,
-        };
+        });
         result = contents;
         break;
     }
@@ -6647,7 +6654,7 @@ const short* otherlevelclass::loadlevel(int rx, int ry)
     case rn(12,17):
     {
 
-        static const short contents[] = {
+        ROOM_CONTENTS(LEVELPACK_OTHERLEVEL, t, 0, {
         489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,
         489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,
         489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,
@@ -6678,7 +6685,7 @@ const short* otherlevelclass::loadlevel(int rx, int ry)
         489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,611,0,0,0,0,0,0,0,0,609,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,
         489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,611,0,0,0,0,0,0,0,0,609,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,
         489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,611,0,0,0,0,0,0,0,0,609,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,
-        };
+        });
         result = contents;
         break;
     }
@@ -6686,7 +6693,7 @@ const short* otherlevelclass::loadlevel(int rx, int ry)
     case rn(12,18):
     {
 
-        static const short contents[] = {
+        ROOM_CONTENTS(LEVELPACK_OTHERLEVEL, t, 0, {
         486,486,486,486,486,486,486,486,486,486,486,486,486,486,486,608,0,0,0,0,0,0,0,0,606,486,486,486,486,486,486,486,486,486,486,486,486,486,486,486,
         486,486,486,486,486,486,486,486,486,486,486,486,486,486,486,608,0,0,0,0,0,0,0,0,606,486,486,486,486,486,486,486,486,486,486,486,486,486,486,486,
         486,486,486,486,486,486,486,486,486,486,486,486,486,486,486,608,0,0,0,0,0,0,0,0,606,486,486,486,486,486,486,486,486,486,486,486,486,486,486,486,
@@ -6717,7 +6724,7 @@ const short* otherlevelclass::loadlevel(int rx, int ry)
         486,486,486,486,486,486,486,486,486,486,486,486,486,486,486,608,0,0,0,0,0,0,0,0,606,486,486,486,486,486,486,486,486,486,486,486,486,486,486,486,
         486,486,486,486,486,486,486,486,486,486,486,486,486,486,486,608,0,0,0,0,0,0,0,0,606,486,486,486,486,486,486,486,486,486,486,486,486,486,486,486,
         486,486,486,486,486,486,486,486,486,486,486,486,486,486,486,608,0,0,0,0,0,0,0,0,606,486,486,486,486,486,486,486,486,486,486,486,486,486,486,486,
-        };
+        });
         result = contents;
         break;
     }
@@ -6725,7 +6732,7 @@ const short* otherlevelclass::loadlevel(int rx, int ry)
     case rn(12,19):
     {
 
-        static const short contents[] = {
+        ROOM_CONTENTS(LEVELPACK_OTHERLEVEL, t, 0, {
         489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,611,0,0,0,0,0,0,0,0,609,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,
         489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,611,0,0,0,0,0,0,0,0,609,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,
         489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,611,0,0,0,0,0,0,0,0,609,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,
@@ -6756,7 +6763,7 @@ const short* otherlevelclass::loadlevel(int rx, int ry)
         489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,
         489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,
         489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,
-        };
+        });
         result = contents;
         break;
     }
@@ -6764,7 +6771,7 @@ const short* otherlevelclass::loadlevel(int rx, int ry)
     case rn(13,1):
     {
 
-        static const short contents[] = {
+        ROOM_CONTENTS(LEVELPACK_OTHERLEVEL, t, 0, {
         495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,617,215,95,95,95,217,215,95,217,216,216,216,216,216,216,216,216,216,216,216,
         495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,617,215,95,95,95,217,215,95,217,216,216,216,216,216,216,216,216,216,216,216,
         495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,617,215,95,95,95,217,215,95,217,216,216,216,216,216,216,216,216,216,216,216,
@@ -6795,7 +6802,7 @@ const short* otherlevelclass::loadlevel(int rx, int ry)
         495,495,495,495,495,495,495,495,495,495,495,495,495,495,617,0,0,0,0,0,0,615,495,495,495,617,0,0,0,0,0,215,95,217,216,216,216,216,216,216,
         495,495,495,495,495,495,495,495,495,495,495,495,495,495,617,0,0,0,0,0,0,615,495,495,495,617,0,0,0,0,0,215,95,217,216,216,216,216,216,216,
         495,495,495,495,495,495,495,495,495,495,495,495,495,495,617,0,0,0,0,0,0,615,495,495,495,617,0,0,0,0,0,215,95,217,216,216,216,216,216,216,
-        };
+        });
         result = contents;
         break;
     }
@@ -6803,7 +6810,7 @@ const short* otherlevelclass::loadlevel(int rx, int ry)
     case rn(13,2):
     {
 
-        static const short contents[] = {
+        ROOM_CONTENTS(LEVELPACK_OTHERLEVEL, t, 0, {
         480,480,480,480,480,480,480,480,480,480,480,480,480,480,602,0,0,0,0,0,0,600,480,480,480,602,0,0,0,0,0,209,89,211,210,210,210,210,210,210,
         480,480,480,480,480,480,480,480,480,480,480,480,480,480,602,0,0,0,0,0,0,600,480,480,480,602,0,0,0,0,0,209,89,211,210,210,210,210,210,210,
         480,480,480,480,480,480,480,480,480,480,480,480,480,480,602,0,0,0,0,0,0,600,480,480,480,602,0,0,0,0,0,209,89,211,210,210,210,210,210,210,
@@ -6834,7 +6841,7 @@ const short* otherlevelclass::loadlevel(int rx, int ry)
         480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,
         480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,
         480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,
-        };
+        });
 
         obj.createentity(48, 96, 14); //Teleporter!
         result = contents;
@@ -6844,7 +6851,7 @@ const short* otherlevelclass::loadlevel(int rx, int ry)
     case rn(13,14):
     {
 
-        static const short contents[] = {
+        ROOM_CONTENTS(LEVELPACK_OTHERLEVEL, t, 0, {
         89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,
         89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,90,250,250,250,250,250,250,250,250,250,250,250,250,250,91,89,
         89,89,89,89,89,89,89,89,89,89,89,89,90,250,250,250,250,250,250,250,250,250,250,250,251,0,0,0,0,0,0,0,0,0,815,695,695,695,209,89,
@@ -6875,7 +6882,7 @@ const short* otherlevelclass::loadlevel(int rx, int ry)
         0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
         0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
         0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-        };
+        });
 
         obj.createentity(280, 32, 20, 1); //terminal
         obj.createblock(5, 280-4, 32, 20, 16, 9);
@@ -6888,7 +6895,7 @@ const short* otherlevelclass::loadlevel(int rx, int ry)
     case rn(13,15):
     {
 
-        static const short contents[] = {
+        ROOM_CONTENTS(LEVELPACK_OTHERLEVEL, t, 0, {
         0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
         0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
         0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
@@ -6919,7 +6926,7 @@ const short* otherlevelclass::loadlevel(int rx, int ry)
         0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,701,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
         0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,701,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
         0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,701,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-        };
+        });
         result = contents;
         break;
     }
@@ -6927,7 +6934,7 @@ const short* otherlevelclass::loadlevel(int rx, int ry)
     case rn(13,16):
     {
 
-        static const short contents[] = {
+        ROOM_CONTENTS(LEVELPACK_OTHERLEVEL, t, 0, {
         0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,695,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
         0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,695,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
         0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,695,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
@@ -6958,7 +6965,7 @@ const short* otherlevelclass::loadlevel(int rx, int ry)
         495,495,495,495,495,495,495,495,495,495,495,495,495,495,536,576,576,576,576,576,576,576,576,576,576,576,576,576,576,576,576,537,495,495,495,495,495,495,495,495,
         495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,
         495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,
-        };
+        });
 
         obj.createentity(80, 104, 10, 1, 16130);  // (savepoint)
         result = contents;
@@ -6968,7 +6975,7 @@ const short* otherlevelclass::loadlevel(int rx, int ry)
     case rn(13,17):
     {
 
-        static const short contents[] = {
+        ROOM_CONTENTS(LEVELPACK_OTHERLEVEL, t, 0, {
         495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,
         495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,
         495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,
@@ -6999,7 +7006,7 @@ const short* otherlevelclass::loadlevel(int rx, int ry)
         495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,617,696,696,696,696,696,696,696,696,615,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,
         495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,617,0,0,0,0,0,0,0,0,615,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,
         495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,617,0,0,0,0,0,0,0,0,615,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,
-        };
+        });
 
         obj.createentity(240, 128, 10, 1, 17130);  // (savepoint)
         result = contents;
@@ -7009,7 +7016,7 @@ const short* otherlevelclass::loadlevel(int rx, int ry)
     case rn(13,18):
     {
 
-        static const short contents[] = {
+        ROOM_CONTENTS(LEVELPACK_OTHERLEVEL, t, 0, {
         489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,611,0,0,0,0,0,0,0,0,609,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,
         489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,611,0,0,0,0,0,0,0,0,609,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,
         489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,611,0,0,0,0,0,0,0,0,609,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,
@@ -7040,7 +7047,7 @@ const short* otherlevelclass::loadlevel(int rx, int ry)
         489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,
         489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,
         489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,
-        };
+        });
         result = contents;
         break;
     }
@@ -7048,7 +7055,7 @@ const short* otherlevelclass::loadlevel(int rx, int ry)
     case rn(13,19):
     {
 
-        static const short contents[] = {
+        ROOM_CONTENTS(LEVELPACK_OTHERLEVEL, t, 0, {
         483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,
         483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,
         483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,
@@ -7079,7 +7086,7 @@ const short* otherlevelclass::loadlevel(int rx, int ry)
         483,483,483,483,483,483,483,483,483,483,524,564,564,564,525,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,
         483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,
         483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,
-        };
+        });
         result = contents;
         break;
     }
@@ -7087,7 +7094,7 @@ const short* otherlevelclass::loadlevel(int rx, int ry)
     case rn(14,14):
     {
 
-        static const short contents[] = {
+        ROOM_CONTENTS(LEVELPACK_OTHERLEVEL, t, 0, {
         292,292,292,292,292,292,292,292,292,292,292,292,292,292,292,292,292,292,292,292,292,292,292,292,292,292,292,292,292,292,292,292,292,292,292,292,292,292,292,292,
         292,292,292,292,292,292,292,292,292,292,292,292,292,292,292,292,292,292,292,292,292,292,292,292,292,292,292,292,292,292,292,292,292,292,292,292,292,292,292,292,
         292,292,292,292,292,292,292,292,292,292,292,293,453,453,453,294,292,292,292,292,292,292,292,292,293,453,453,453,294,292,292,292,292,292,292,292,292,292,292,292,
@@ -7118,7 +7125,7 @@ const short* otherlevelclass::loadlevel(int rx, int ry)
         0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
         0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
         0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-        };
+        });
 
         roomtileset = 0; // (Use space station tileset)
         result = contents;
@@ -7128,7 +7135,7 @@ const short* otherlevelclass::loadlevel(int rx, int ry)
     case rn(14,16):
     {
 
-        static const short contents[] = {
+        ROOM_CONTENTS(LEVELPACK_OTHERLEVEL, t, 0, {
         0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
         0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
         0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
@@ -7159,7 +7166,7 @@ const short* otherlevelclass::loadlevel(int rx, int ry)
         492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,
         492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,
         492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,
-        };
+        });
         result = contents;
         break;
     }
@@ -7167,7 +7174,7 @@ const short* otherlevelclass::loadlevel(int rx, int ry)
     case rn(14,17):
     {
 
-        static const short contents[] = {
+        ROOM_CONTENTS(LEVELPACK_OTHERLEVEL, t, 0, {
         498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,
         498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,
         498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,
@@ -7198,7 +7205,7 @@ const short* otherlevelclass::loadlevel(int rx, int ry)
         498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,
         498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,
         498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,
-        };
+        });
         result = contents;
         break;
     }
@@ -7206,7 +7213,7 @@ const short* otherlevelclass::loadlevel(int rx, int ry)
     case rn(14,18):
     {
 
-        static const short contents[] = {
+        ROOM_CONTENTS(LEVELPACK_OTHERLEVEL, t, 0, {
         498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,
         498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,
         498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,
@@ -7237,7 +7244,7 @@ const short* otherlevelclass::loadlevel(int rx, int ry)
         498,498,498,620,0,0,0,0,0,0,0,618,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,
         498,498,498,620,0,0,0,0,0,0,0,618,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,
         498,498,498,620,0,0,0,0,0,0,0,618,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,
-        };
+        });
         result = contents;
         break;
     }
@@ -7245,7 +7252,7 @@ const short* otherlevelclass::loadlevel(int rx, int ry)
     case rn(14,19):
     {
 
-        static const short contents[] = {
+        ROOM_CONTENTS(LEVELPACK_OTHERLEVEL, t, 0, {
         495,495,495,617,0,0,0,0,0,0,0,615,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,
         495,495,495,617,0,0,0,0,0,0,0,615,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,
         495,495,495,617,0,0,0,0,0,0,0,615,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,
@@ -7276,7 +7283,7 @@ const short* otherlevelclass::loadlevel(int rx, int ry)
         495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,
         495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,
         495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,
-        };
+        });
 
         obj.createentity(176, 72, 14); //Teleporter!
         obj.createentity(88, 160, 20, 1);//terminal
@@ -7289,7 +7296,7 @@ const short* otherlevelclass::loadlevel(int rx, int ry)
     case rn(15,14):
     {
 
-        static const short contents[] = {
+        ROOM_CONTENTS(LEVELPACK_OTHERLEVEL, t, 0, {
         104,104,104,104,104,104,104,104,104,104,104,104,104,104,104,104,104,104,104,104,104,104,104,104,104,104,104,104,104,104,104,104,104,104,104,104,104,104,104,104,
         104,104,104,104,104,104,104,104,104,104,104,104,104,104,104,104,104,104,104,104,104,104,104,104,104,104,104,104,104,104,104,104,104,104,104,104,104,104,104,104,
         104,104,104,104,104,104,104,104,104,104,104,104,104,104,104,104,104,104,104,104,104,104,104,104,104,104,104,104,104,104,104,104,104,104,104,104,104,104,104,104,
@@ -7320,7 +7327,7 @@ const short* otherlevelclass::loadlevel(int rx, int ry)
         0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
         0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
         0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-        };
+        });
 
         roomtileset = 0; // (Use space station tileset)
         result = contents;
@@ -7330,7 +7337,7 @@ const short* otherlevelclass::loadlevel(int rx, int ry)
     case rn(15,16):
     {
 
-        static const short contents[] = {
+        ROOM_CONTENTS(LEVELPACK_OTHERLEVEL, t, 0, {
         0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
         0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
         0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
@@ -7361,7 +7368,7 @@ const short* otherlevelclass::loadlevel(int rx, int ry)
         480,480,480,480,480,480,480,480,480,480,480,480,480,602,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
         480,480,480,480,480,480,480,480,480,480,480,480,480,602,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
         480,480,480,480,480,480,480,480,480,480,480,480,480,602,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-        };
+        });
         result = contents;
         break;
     }
@@ -7369,7 +7376,7 @@ const short* otherlevelclass::loadlevel(int rx, int ry)
     case rn(15,17):
     {
 
-        static const short contents[] = {
+        ROOM_CONTENTS(LEVELPACK_OTHERLEVEL, t, 0, {
         495,495,495,495,495,495,495,495,495,495,495,495,495,617,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
         495,495,495,495,495,495,495,495,495,495,495,495,495,617,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
         495,495,495,495,495,495,495,495,495,495,495,495,495,617,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
@@ -7400,7 +7407,7 @@ const short* otherlevelclass::loadlevel(int rx, int ry)
         495,495,495,495,495,495,495,495,495,495,617,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
         495,495,495,495,495,495,495,495,495,495,617,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
         495,495,495,495,495,495,495,495,495,495,617,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-        };
+        });
         result = contents;
         break;
     }
@@ -7408,7 +7415,7 @@ const short* otherlevelclass::loadlevel(int rx, int ry)
     case rn(15,18):
     {
 
-        static const short contents[] = {
+        ROOM_CONTENTS(LEVELPACK_OTHERLEVEL, t, 0, {
         486,486,486,486,486,486,486,486,486,486,608,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
         486,486,486,486,486,486,486,486,486,486,608,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
         486,486,486,486,486,486,486,486,486,486,608,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
@@ -7439,7 +7446,7 @@ const short* otherlevelclass::loadlevel(int rx, int ry)
         486,486,486,486,486,486,486,486,486,486,608,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
         486,486,486,486,486,486,486,486,486,486,608,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
         486,486,486,486,486,486,486,486,486,486,608,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-        };
+        });
 
         obj.createentity(88, 96, 10, 0, 18150);  // (savepoint)
         result = contents;
@@ -7449,7 +7456,7 @@ const short* otherlevelclass::loadlevel(int rx, int ry)
     case rn(15,19):
     {
 
-        static const short contents[] = {
+        ROOM_CONTENTS(LEVELPACK_OTHERLEVEL, t, 0, {
         489,489,489,489,489,489,489,489,489,489,611,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
         489,489,489,489,489,489,489,489,489,489,611,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
         489,489,489,489,489,489,489,489,489,489,611,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
@@ -7480,7 +7487,7 @@ const short* otherlevelclass::loadlevel(int rx, int ry)
         489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,
         489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,
         489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,
-        };
+        });
         result = contents;
         break;
     }
@@ -7488,7 +7495,7 @@ const short* otherlevelclass::loadlevel(int rx, int ry)
     case rn(16,4):
     {
 
-        static const short contents[] = {
+        ROOM_CONTENTS(LEVELPACK_OTHERLEVEL, t, 0, {
         483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,
         483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,
         483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,
@@ -7519,7 +7526,7 @@ const short* otherlevelclass::loadlevel(int rx, int ry)
         483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,
         483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,
         483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,
-        };
+        });
 
         obj.createentity(72, 120, 13); //Warp Token
 
@@ -7530,7 +7537,7 @@ const short* otherlevelclass::loadlevel(int rx, int ry)
     case rn(16,14):
     {
 
-        static const short contents[] = {
+        ROOM_CONTENTS(LEVELPACK_OTHERLEVEL, t, 0, {
         107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,
         107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,
         107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,
@@ -7561,7 +7568,7 @@ const short* otherlevelclass::loadlevel(int rx, int ry)
         0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
         0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
         0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-        };
+        });
 
         roomtileset = 0; // (Use space station tileset)
         obj.createentity(176, 152, 10, 1, 14160);  // (savepoint)
@@ -7572,7 +7579,7 @@ const short* otherlevelclass::loadlevel(int rx, int ry)
     case rn(16,17):
     {
 
-        static const short contents[] = {
+        ROOM_CONTENTS(LEVELPACK_OTHERLEVEL, t, 0, {
         0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
         0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
         0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
@@ -7603,7 +7610,7 @@ const short* otherlevelclass::loadlevel(int rx, int ry)
         0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
         0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
         0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-        };
+        });
         result = contents;
         break;
     }
@@ -7611,7 +7618,7 @@ const short* otherlevelclass::loadlevel(int rx, int ry)
     case rn(16,19):
     {
 
-        static const short contents[] = {
+        ROOM_CONTENTS(LEVELPACK_OTHERLEVEL, t, 0, {
         0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
         0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
         0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
@@ -7642,7 +7649,7 @@ const short* otherlevelclass::loadlevel(int rx, int ry)
         483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,
         483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,
         483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,
-        };
+        });
         result = contents;
         break;
     }
@@ -7650,7 +7657,7 @@ const short* otherlevelclass::loadlevel(int rx, int ry)
     case rn(17,4):
     {
 
-        static const short contents[] = {
+        ROOM_CONTENTS(LEVELPACK_OTHERLEVEL, t, 0, {
         498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,
         498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,
         498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,
@@ -7681,7 +7688,7 @@ const short* otherlevelclass::loadlevel(int rx, int ry)
         498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,539,579,579,579,580,6,6,6,6,6,
         498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,539,579,579,579,579,579,
         498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,
-        };
+        });
         result = contents;
         break;
     }
@@ -7689,7 +7696,7 @@ const short* otherlevelclass::loadlevel(int rx, int ry)
     case rn(17,12):
     {
 
-        static const short contents[] = {
+        ROOM_CONTENTS(LEVELPACK_OTHERLEVEL, t, 0, {
         495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,
         495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,
         495,495,495,496,656,656,656,656,656,656,656,656,656,656,656,656,656,656,497,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,
@@ -7720,7 +7727,7 @@ const short* otherlevelclass::loadlevel(int rx, int ry)
         495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,617,680,680,680,680,680,680,615,495,495,495,495,495,
         495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,617,680,680,680,680,680,680,615,495,495,495,495,495,
         495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,617,680,680,680,680,680,680,615,495,495,495,495,495,
-        };
+        });
 
         obj.createentity(40, 40, 14); //Teleporter!
         obj.createentity(192, 120, 20, 1);//terminal
@@ -7734,7 +7741,7 @@ const short* otherlevelclass::loadlevel(int rx, int ry)
     case rn(17,13):
     {
 
-        static const short contents[] = {
+        ROOM_CONTENTS(LEVELPACK_OTHERLEVEL, t, 0, {
         92,92,92,92,92,92,92,92,92,92,92,92,92,92,92,92,92,92,92,92,92,92,92,92,92,92,92,214,683,683,683,683,683,683,212,92,92,92,92,92,
         92,92,92,92,92,92,92,92,92,92,92,92,92,92,92,92,92,92,92,92,92,92,92,92,92,92,92,214,683,683,683,683,683,683,212,92,92,92,92,92,
         92,92,92,92,92,92,92,92,92,92,92,92,92,92,92,92,92,92,92,92,92,92,92,92,92,92,92,214,684,844,844,844,844,685,212,92,92,92,92,92,
@@ -7765,7 +7772,7 @@ const short* otherlevelclass::loadlevel(int rx, int ry)
         92,92,92,92,92,92,92,92,92,92,92,92,92,92,92,92,92,92,92,92,92,92,92,92,92,92,92,214,724,764,764,764,764,725,212,92,92,92,92,92,
         92,92,92,92,92,92,92,92,92,92,92,92,92,92,92,92,92,92,92,92,92,92,92,92,92,92,92,214,683,683,683,683,683,683,212,92,92,92,92,92,
         92,92,92,92,92,92,92,92,92,92,92,92,92,92,92,92,92,92,92,92,92,92,92,92,92,92,92,214,683,683,683,683,683,683,212,92,92,92,92,92,
-        };
+        });
 
         roomtileset = 0; // (Use space station tileset)
         result = contents;
@@ -7775,7 +7782,7 @@ const short* otherlevelclass::loadlevel(int rx, int ry)
     case rn(17,14):
     {
 
-        static const short contents[] = {
+        ROOM_CONTENTS(LEVELPACK_OTHERLEVEL, t, 0, {
         89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,211,695,695,695,695,695,695,209,89,89,89,89,89,
         89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,211,695,695,695,695,695,695,209,89,89,89,89,89,
         89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,211,695,695,695,695,695,695,209,89,89,89,89,89,
@@ -7806,7 +7813,7 @@ const short* otherlevelclass::loadlevel(int rx, int ry)
         0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,209,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,
         0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,209,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,
         0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,209,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,
-        };
+        });
 
         roomtileset = 0; // (Use space station tileset)
         result = contents;
@@ -7816,7 +7823,7 @@ const short* otherlevelclass::loadlevel(int rx, int ry)
     case rn(17,15):
     {
 
-        static const short contents[] = {
+        ROOM_CONTENTS(LEVELPACK_OTHERLEVEL, t, 0, {
         0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,206,86,86,86,86,86,86,86,86,86,86,86,86,86,86,86,86,86,86,86,
         0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,206,86,86,86,86,86,86,86,86,86,86,86,86,86,86,86,86,86,86,86,
         0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,206,86,86,86,86,86,86,86,86,86,86,86,86,86,86,86,86,86,86,86,
@@ -7847,7 +7854,7 @@ const short* otherlevelclass::loadlevel(int rx, int ry)
         0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
         0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
         0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-        };
+        });
 
         roomtileset = 0; // (Use space station tileset)
         result = contents;
@@ -7857,7 +7864,7 @@ const short* otherlevelclass::loadlevel(int rx, int ry)
     case rn(17,16):
     {
 
-        static const short contents[] = {
+        ROOM_CONTENTS(LEVELPACK_OTHERLEVEL, t, 0, {
         0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
         0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
         0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
@@ -7888,7 +7895,7 @@ const short* otherlevelclass::loadlevel(int rx, int ry)
         0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
         0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
         0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-        };
+        });
         result = contents;
         break;
     }
@@ -7896,7 +7903,7 @@ const short* otherlevelclass::loadlevel(int rx, int ry)
     case rn(17,17):
     {
 
-        static const short contents[] = {
+        ROOM_CONTENTS(LEVELPACK_OTHERLEVEL, t, 0, {
         0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
         0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
         0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
@@ -7927,7 +7934,7 @@ const short* otherlevelclass::loadlevel(int rx, int ry)
         0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
         0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
         0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-        };
+        });
 
         obj.createentity(112, 72, 14); //Teleporter!
         result = contents;
@@ -7937,7 +7944,7 @@ const short* otherlevelclass::loadlevel(int rx, int ry)
     case rn(17,18):
     {
 
-        static const short contents[] = {
+        ROOM_CONTENTS(LEVELPACK_OTHERLEVEL, t, 0, {
         0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
         0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
         0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
@@ -7968,7 +7975,7 @@ const short* otherlevelclass::loadlevel(int rx, int ry)
         0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
         0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
         0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-        };
+        });
         result = contents;
         break;
     }
@@ -7976,7 +7983,7 @@ const short* otherlevelclass::loadlevel(int rx, int ry)
     case rn(17,19):
     {
 
-        static const short contents[] = {
+        ROOM_CONTENTS(LEVELPACK_OTHERLEVEL, t, 0, {
         0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
         0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
         0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
@@ -8007,7 +8014,7 @@ const short* otherlevelclass::loadlevel(int rx, int ry)
         486,486,486,486,486,486,486,486,486,486,486,486,486,486,486,486,486,486,486,486,486,486,486,486,486,486,486,486,486,486,486,486,486,486,486,486,486,486,486,486,
         486,486,486,486,486,486,486,486,486,486,486,486,486,486,486,486,486,486,486,486,486,486,486,486,486,486,486,486,486,486,486,486,486,486,486,486,486,486,486,486,
         486,486,486,486,486,486,486,486,486,486,486,486,486,486,486,486,486,486,486,486,486,486,486,486,486,486,486,486,486,486,486,486,486,486,486,486,486,486,486,486,
-        };
+        });
 
         obj.createentity(152, 152, 10, 0, 19170);  // (savepoint)
         result = contents;
@@ -8017,7 +8024,7 @@ const short* otherlevelclass::loadlevel(int rx, int ry)
     case rn(18,4):
     {
 
-        static const short contents[] = {
+        ROOM_CONTENTS(LEVELPACK_OTHERLEVEL, t, 0, {
         495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,
         495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,496,656,656,656,497,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,
         495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,617,7,7,7,615,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,
@@ -8048,7 +8055,7 @@ const short* otherlevelclass::loadlevel(int rx, int ry)
         6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,
         576,576,576,576,576,576,576,576,576,576,576,576,576,576,576,576,576,576,576,576,576,576,576,576,576,576,576,576,576,576,576,576,576,576,576,576,576,576,576,576,
         495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,
-        };
+        });
         result = contents;
         break;
     }
@@ -8056,7 +8063,7 @@ const short* otherlevelclass::loadlevel(int rx, int ry)
     case rn(18,15):
     {
 
-        static const short contents[] = {
+        ROOM_CONTENTS(LEVELPACK_OTHERLEVEL, t, 0, {
         289,289,289,289,289,289,289,289,289,289,289,289,289,289,289,289,289,289,289,289,289,411,633,513,513,513,513,513,513,513,513,513,513,513,513,513,513,513,513,513,
         289,289,289,289,289,289,289,289,289,289,289,289,289,289,289,289,289,289,289,289,289,411,633,513,513,513,513,513,513,513,513,513,513,513,513,513,513,513,513,513,
         289,289,289,289,289,289,289,289,289,289,289,289,289,289,289,289,289,289,289,289,289,411,633,513,513,514,674,674,674,515,513,513,513,513,513,513,513,513,513,513,
@@ -8087,7 +8094,7 @@ const short* otherlevelclass::loadlevel(int rx, int ry)
         0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
         0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
         0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-        };
+        });
 
         roomtileset = 0; // (Use space station tileset)
         obj.createentity(104, 152, 10, 1, 15180);  // (savepoint)
@@ -8098,7 +8105,7 @@ const short* otherlevelclass::loadlevel(int rx, int ry)
     case rn(18,17):
     {
 
-        static const short contents[] = {
+        ROOM_CONTENTS(LEVELPACK_OTHERLEVEL, t, 0, {
         0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
         0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
         0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
@@ -8129,7 +8136,7 @@ const short* otherlevelclass::loadlevel(int rx, int ry)
         0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
         0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
         0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-        };
+        });
         result = contents;
         break;
     }
@@ -8137,7 +8144,7 @@ const short* otherlevelclass::loadlevel(int rx, int ry)
     case rn(18,19):
     {
 
-        static const short contents[] = {
+        ROOM_CONTENTS(LEVELPACK_OTHERLEVEL, t, 0, {
         0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
         0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
         0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
@@ -8168,7 +8175,7 @@ const short* otherlevelclass::loadlevel(int rx, int ry)
         483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,
         483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,
         483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,
-        };
+        });
         result = contents;
         break;
     }
@@ -8176,7 +8183,7 @@ const short* otherlevelclass::loadlevel(int rx, int ry)
     case rn(19,4):
     {
 
-        static const short contents[] = {
+        ROOM_CONTENTS(LEVELPACK_OTHERLEVEL, t, 0, {
         483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,
         483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,
         483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,
@@ -8207,7 +8214,7 @@ const short* otherlevelclass::loadlevel(int rx, int ry)
         6,6,6,6,6,6,6,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
         564,564,564,564,564,564,565,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
         483,483,483,483,483,483,605,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-        };
+        });
 
         obj.createentity(192, 176, 10, 1, 105190);  // (savepoint)
         result = contents;
@@ -8217,7 +8224,7 @@ const short* otherlevelclass::loadlevel(int rx, int ry)
     case rn(19,5):
     {
 
-        static const short contents[] = {
+        ROOM_CONTENTS(LEVELPACK_OTHERLEVEL, t, 0, {
         495,495,495,495,495,495,617,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
         495,495,495,495,495,495,617,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
         495,495,495,495,495,495,617,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
@@ -8248,7 +8255,7 @@ const short* otherlevelclass::loadlevel(int rx, int ry)
         495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,
         495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,
         495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,
-        };
+        });
 
         obj.createentity(40, 192, 10, 1, 106190);  // (savepoint)
         result = contents;
@@ -8259,7 +8266,7 @@ const short* otherlevelclass::loadlevel(int rx, int ry)
     case rn(19,9):
     {
 
-        static const short contents[] = {
+        ROOM_CONTENTS(LEVELPACK_OTHERLEVEL, t, 0, {
         495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,
         495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,
         495,495,495,495,495,495,495,495,495,495,496,656,656,656,656,656,656,656,497,495,496,656,656,656,656,656,656,656,656,656,656,656,656,497,495,496,656,656,656,656,
@@ -8290,7 +8297,7 @@ const short* otherlevelclass::loadlevel(int rx, int ry)
         495,495,617,0,0,0,0,0,0,0,615,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,
         495,495,617,0,0,0,0,0,0,0,615,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,
         495,495,617,0,0,0,0,0,0,0,615,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,
-        };
+        });
         result = contents;
         break;
     }
@@ -8298,7 +8305,7 @@ const short* otherlevelclass::loadlevel(int rx, int ry)
     case rn(19,10):
     {
 
-        static const short contents[] = {
+        ROOM_CONTENTS(LEVELPACK_OTHERLEVEL, t, 0, {
         498,498,620,0,0,0,0,0,0,0,618,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,
         498,498,620,0,0,0,0,0,0,0,618,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,
         498,498,620,0,0,0,0,0,0,0,618,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,
@@ -8329,7 +8336,7 @@ const short* otherlevelclass::loadlevel(int rx, int ry)
         498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,
         498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,
         498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,
-        };
+        });
 
         obj.createentity(72, 168, 10, 1, 111190);  // (savepoint)
         result = contents;
@@ -8339,7 +8346,7 @@ const short* otherlevelclass::loadlevel(int rx, int ry)
     case rn(19,11):
     {
 
-        static const short contents[] = {
+        ROOM_CONTENTS(LEVELPACK_OTHERLEVEL, t, 0, {
         495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,
         495,495,496,656,656,656,656,656,656,656,656,656,656,656,656,497,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,
         495,495,617,0,0,0,0,0,695,0,0,0,0,0,0,615,495,495,495,495,495,495,495,495,495,495,495,495,495,496,656,656,656,656,656,656,656,656,656,656,
@@ -8370,7 +8377,7 @@ const short* otherlevelclass::loadlevel(int rx, int ry)
         495,495,536,576,576,576,576,537,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,
         495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,
         495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,
-        };
+        });
         result = contents;
         break;
     }
@@ -8378,7 +8385,7 @@ const short* otherlevelclass::loadlevel(int rx, int ry)
     case rn(19,12):
     {
 
-        static const short contents[] = {
+        ROOM_CONTENTS(LEVELPACK_OTHERLEVEL, t, 0, {
         498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,
         498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,
         498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,
@@ -8409,7 +8416,7 @@ const short* otherlevelclass::loadlevel(int rx, int ry)
         498,498,498,498,498,498,620,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
         498,498,498,498,498,498,620,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
         498,498,498,498,498,498,620,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-        };
+        });
         result = contents;
         break;
     }
@@ -8417,7 +8424,7 @@ const short* otherlevelclass::loadlevel(int rx, int ry)
     case rn(19,13):
     {
 
-        static const short contents[] = {
+        ROOM_CONTENTS(LEVELPACK_OTHERLEVEL, t, 0, {
         480,480,480,480,480,480,602,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
         480,480,480,480,480,480,602,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
         480,480,480,480,480,480,602,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
@@ -8448,7 +8455,7 @@ const short* otherlevelclass::loadlevel(int rx, int ry)
         480,480,480,480,480,480,602,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,560,561,561,561,522,480,480,
         480,480,480,480,480,480,602,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,600,480,480,480,480,480,480,
         480,480,480,480,480,480,602,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,600,480,480,480,480,480,480,
-        };
+        });
         result = contents;
         break;
     }
@@ -8456,7 +8463,7 @@ const short* otherlevelclass::loadlevel(int rx, int ry)
     case rn(19,14):
     {
 
-        static const short contents[] = {
+        ROOM_CONTENTS(LEVELPACK_OTHERLEVEL, t, 0, {
         489,489,489,489,489,489,611,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,609,489,489,489,489,489,489,
         489,489,489,489,489,489,611,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,609,489,489,489,489,489,489,
         489,489,489,489,489,489,611,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,609,489,489,489,489,489,489,
@@ -8487,7 +8494,7 @@ const short* otherlevelclass::loadlevel(int rx, int ry)
         489,489,489,489,489,489,611,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,609,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,
         489,489,489,489,489,489,611,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,609,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,
         489,489,489,489,489,489,611,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,609,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,
-        };
+        });
 
         obj.createentity(80, 144, 10, 1, 14190);  // (savepoint)
         result = contents;
@@ -8497,7 +8504,7 @@ const short* otherlevelclass::loadlevel(int rx, int ry)
     case rn(19,15):
     {
 
-        static const short contents[] = {
+        ROOM_CONTENTS(LEVELPACK_OTHERLEVEL, t, 0, {
         492,492,492,492,492,492,614,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,612,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,
         492,492,492,492,492,492,614,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,612,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,
         492,492,492,492,492,492,614,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,612,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,
@@ -8528,7 +8535,7 @@ const short* otherlevelclass::loadlevel(int rx, int ry)
         0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,612,492,492,492,492,492,492,492,492,492,492,
         0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,612,492,492,492,492,492,492,492,492,492,492,
         0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,612,492,492,492,492,492,492,492,492,492,492,
-        };
+        });
         result = contents;
         break;
     }
@@ -8536,7 +8543,7 @@ const short* otherlevelclass::loadlevel(int rx, int ry)
     case rn(19,16):
     {
 
-        static const short contents[] = {
+        ROOM_CONTENTS(LEVELPACK_OTHERLEVEL, t, 0, {
         0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,603,483,483,483,483,483,483,483,483,483,483,
         0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,603,483,483,483,483,483,483,483,483,483,483,
         0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,603,483,483,483,483,483,483,483,483,483,483,
@@ -8567,7 +8574,7 @@ const short* otherlevelclass::loadlevel(int rx, int ry)
         0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,603,483,483,483,483,483,483,483,483,483,483,
         0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,603,483,483,483,483,483,483,483,483,483,483,
         0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,603,483,483,483,483,483,483,483,483,483,483,
-        };
+        });
         result = contents;
         break;
     }
@@ -8575,7 +8582,7 @@ const short* otherlevelclass::loadlevel(int rx, int ry)
     case rn(19,17):
     {
 
-        static const short contents[] = {
+        ROOM_CONTENTS(LEVELPACK_OTHERLEVEL, t, 0, {
         0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,615,495,495,495,495,495,495,495,495,495,495,
         0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,615,495,495,495,495,495,495,495,495,495,495,
         0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,615,495,495,495,495,495,495,495,495,495,495,
@@ -8606,7 +8613,7 @@ const short* otherlevelclass::loadlevel(int rx, int ry)
         0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,615,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,
         0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,615,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,
         0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,615,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,
-        };
+        });
 
         obj.createentity(168, 88, 10, 1, 17190);  // (savepoint)
         result = contents;
@@ -8616,7 +8623,7 @@ const short* otherlevelclass::loadlevel(int rx, int ry)
     case rn(19,18):
     {
 
-        static const short contents[] = {
+        ROOM_CONTENTS(LEVELPACK_OTHERLEVEL, t, 0, {
         0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,618,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,
         0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,618,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,
         0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,618,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,
@@ -8647,7 +8654,7 @@ const short* otherlevelclass::loadlevel(int rx, int ry)
         0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,618,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,
         0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,618,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,
         0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,618,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,
-        };
+        });
         result = contents;
         break;
     }
@@ -8655,7 +8662,7 @@ const short* otherlevelclass::loadlevel(int rx, int ry)
     case rn(19,19):
     {
 
-        static const short contents[] = {
+        ROOM_CONTENTS(LEVELPACK_OTHERLEVEL, t, 0, {
         0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,600,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,
         0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,600,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,
         0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,600,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,
@@ -8686,7 +8693,7 @@ const short* otherlevelclass::loadlevel(int rx, int ry)
         480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,
         480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,
         480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,480,
-        };
+        });
         result = contents;
         break;
     }
@@ -8698,7 +8705,7 @@ const short* otherlevelclass::loadlevel(int rx, int ry)
         if(obj.altstates==1)
         {
 
-            static const short contents[] = {
+            ROOM_CONTENTS(LEVELPACK_OTHERLEVEL, t, 0, {
             286,286,286,286,286,286,286,286,286,286,286,286,286,286,286,286,286,286,286,286,286,286,286,286,286,286,286,286,286,286,286,286,286,286,286,286,286,286,286,286,
             286,286,286,286,286,286,286,286,286,286,286,286,286,286,286,286,286,286,286,286,286,286,286,286,286,286,286,286,286,286,286,286,286,286,286,286,286,286,286,286,
             286,286,286,286,286,286,286,286,286,286,286,286,286,286,286,286,286,286,286,286,286,286,286,286,286,286,286,286,286,286,286,286,286,286,286,286,286,286,286,286,
@@ -8729,14 +8736,14 @@ const short* otherlevelclass::loadlevel(int rx, int ry)
             286,286,286,286,286,286,286,286,286,286,286,286,286,286,286,286,286,286,286,286,286,286,286,286,286,286,286,286,286,286,286,286,286,286,286,286,286,286,286,286,
             286,286,286,286,286,286,286,286,286,286,286,286,286,286,286,286,286,286,286,286,286,286,286,286,286,286,286,286,286,286,286,286,286,286,286,286,286,286,286,286,
             286,286,286,286,286,286,286,286,286,286,286,286,286,286,286,286,286,286,286,286,286,286,286,286,286,286,286,286,286,286,286,286,286,286,286,286,286,286,286,286,
-            };
+            });
             result = contents;
         }
         else if(obj.altstates==2)
         {
             //Phase 2
 
-            static const short contents[] = {
+            ROOM_CONTENTS(LEVELPACK_OTHERLEVEL, t, 1, {
             286,286,286,286,286,286,286,286,286,286,286,286,286,286,286,286,286,286,286,286,286,286,286,286,286,286,286,286,286,286,286,286,286,286,286,286,286,286,286,286,
             286,286,286,286,286,286,286,286,286,286,286,286,286,286,286,286,286,286,286,286,286,286,286,286,286,286,286,286,286,286,286,286,286,286,286,286,286,286,286,286,
             286,286,286,286,286,286,286,286,286,286,286,286,286,286,286,286,286,286,286,286,286,286,286,286,286,286,286,286,286,286,286,286,286,286,286,286,286,286,286,286,
@@ -8767,13 +8774,13 @@ const short* otherlevelclass::loadlevel(int rx, int ry)
             286,286,286,286,286,286,286,286,286,286,286,286,286,286,286,286,286,286,286,286,286,286,286,286,286,286,286,286,286,286,286,286,286,286,286,286,286,286,286,286,
             286,286,286,286,286,286,286,286,286,286,286,286,286,286,286,286,286,286,286,286,286,286,286,286,286,286,286,286,286,286,286,286,286,286,286,286,286,286,286,286,
             286,286,286,286,286,286,286,286,286,286,286,286,286,286,286,286,286,286,286,286,286,286,286,286,286,286,286,286,286,286,286,286,286,286,286,286,286,286,286,286,
-            };
+            });
             result = contents;
         }
         else
         {
             //Phase 3
-            static const short contents[] = {
+            ROOM_CONTENTS(LEVELPACK_OTHERLEVEL, t, 2, {
             286,286,286,286,286,286,286,286,286,286,286,286,286,286,286,286,286,286,286,286,286,286,286,286,286,286,286,286,286,286,286,286,286,286,286,286,286,286,286,286,
             286,286,286,286,286,286,286,286,286,286,286,286,286,286,286,286,286,286,286,286,286,286,286,286,286,286,286,286,286,286,286,286,286,286,286,286,286,286,286,286,
             286,286,286,286,286,286,286,286,286,286,286,286,286,286,286,286,286,286,286,286,286,286,286,286,286,286,286,286,286,286,286,286,286,286,286,286,286,286,286,286,
@@ -8804,7 +8811,7 @@ const short* otherlevelclass::loadlevel(int rx, int ry)
             286,286,286,286,286,286,286,286,286,286,286,286,286,286,286,286,286,286,286,286,286,286,286,286,286,286,286,286,286,286,286,286,286,286,286,286,286,286,286,286,
             286,286,286,286,286,286,286,286,286,286,286,286,286,286,286,286,286,286,286,286,286,286,286,286,286,286,286,286,286,286,286,286,286,286,286,286,286,286,286,286,
             286,286,286,286,286,286,286,286,286,286,286,286,286,286,286,286,286,286,286,286,286,286,286,286,286,286,286,286,286,286,286,286,286,286,286,286,286,286,286,286,
-            };
+            });
             result = contents;
         }
         hiddenname = "Secret Lab";
@@ -8813,7 +8820,7 @@ const short* otherlevelclass::loadlevel(int rx, int ry)
     case rn(18,6):
     {
 
-        static const short contents[] = {
+        ROOM_CONTENTS(LEVELPACK_OTHERLEVEL, t, 0, {
         280,280,280,280,280,280,280,280,280,280,280,280,280,280,280,280,280,280,280,280,402,0,0,0,0,0,0,0,400,280,280,280,280,280,280,280,280,280,280,280,
         280,280,280,280,280,280,280,280,280,280,280,280,280,280,280,280,280,280,280,280,402,0,0,0,0,0,0,0,400,280,280,280,280,280,280,280,280,280,280,280,
         280,280,280,280,280,280,280,280,280,280,280,280,280,280,280,280,280,280,280,280,402,0,0,0,0,0,0,0,400,280,280,280,280,280,280,280,280,280,280,280,
@@ -8844,7 +8851,7 @@ const short* otherlevelclass::loadlevel(int rx, int ry)
         280,280,280,280,280,280,280,280,280,280,280,280,280,280,280,280,280,280,280,280,280,280,280,280,280,280,280,280,280,280,280,280,280,280,280,280,280,280,280,280,
         280,280,280,280,280,280,280,280,280,280,280,280,280,280,280,280,280,280,280,280,280,280,280,280,280,280,280,280,280,280,280,280,280,280,280,280,280,280,280,280,
         280,280,280,280,280,280,280,280,280,280,280,280,280,280,280,280,280,280,280,280,280,280,280,280,280,280,280,280,280,280,280,280,280,280,280,280,280,280,280,280,
-        };
+        });
         hiddenname = "Secret Lab";
         result = contents;
         break;
@@ -8853,7 +8860,7 @@ const short* otherlevelclass::loadlevel(int rx, int ry)
     case rn(18,5):
     {
 
-        static const short contents[] = {
+        ROOM_CONTENTS(LEVELPACK_OTHERLEVEL, t, 0, {
         292,292,292,292,292,292,292,292,292,292,292,292,292,292,292,292,292,292,292,292,292,292,292,292,292,292,292,292,292,292,292,292,292,292,292,292,292,292,292,292,
         292,292,292,292,292,292,292,292,292,292,292,292,292,292,292,292,292,292,292,292,292,292,292,292,292,292,292,292,292,292,292,292,292,292,292,292,292,292,292,292,
         292,292,292,292,292,292,292,292,292,292,292,292,292,292,292,292,292,292,292,292,292,292,292,292,292,292,292,292,292,292,292,292,292,292,292,292,292,292,292,292,
@@ -8884,7 +8891,7 @@ const short* otherlevelclass::loadlevel(int rx, int ry)
         292,292,292,292,292,292,292,292,292,292,292,292,292,292,292,292,292,292,292,292,414,0,0,0,0,0,0,0,412,292,292,292,292,292,292,292,292,292,292,292,
         292,292,292,292,292,292,292,292,292,292,292,292,292,292,292,292,292,292,292,292,414,0,0,0,0,0,0,0,412,292,292,292,292,292,292,292,292,292,292,292,
         292,292,292,292,292,292,292,292,292,292,292,292,292,292,292,292,292,292,292,292,414,0,0,0,0,0,0,0,412,292,292,292,292,292,292,292,292,292,292,292,
-        };
+        });
 
         obj.createentity(256, 88, 21, 1); //Terminal
         obj.createentity(128, 88, 21, 1); //Terminal
@@ -8919,7 +8926,7 @@ const short* otherlevelclass::loadlevel(int rx, int ry)
     case rn(17,5):
     {
 
-        static const short contents[] = {
+        ROOM_CONTENTS(LEVELPACK_OTHERLEVEL, t, 0, {
         295,295,295,295,295,295,295,295,295,295,295,295,295,295,295,295,295,295,295,295,295,295,295,295,295,295,295,295,295,295,295,295,295,295,295,295,295,295,295,295,
         295,295,295,295,295,295,295,295,295,295,295,295,295,295,295,295,295,295,295,295,295,295,295,295,295,295,295,295,295,295,295,295,295,295,295,295,295,295,295,295,
         295,295,295,295,295,295,295,295,295,295,295,295,295,295,295,295,295,295,295,295,295,295,295,295,295,295,295,295,295,295,295,295,295,295,295,295,295,295,295,295,
@@ -8950,7 +8957,7 @@ const short* otherlevelclass::loadlevel(int rx, int ry)
         295,295,295,295,295,295,295,295,295,295,295,295,295,295,295,295,295,295,295,295,295,295,295,295,295,295,295,295,295,295,295,295,295,295,295,295,295,295,295,295,
         295,295,295,295,295,295,295,295,295,295,295,295,295,295,295,295,295,295,295,295,295,295,295,295,295,295,295,295,295,295,295,295,295,295,295,295,295,295,295,295,
         295,295,295,295,295,295,295,295,295,295,295,295,295,295,295,295,295,295,295,295,295,295,295,295,295,295,295,295,295,295,295,295,295,295,295,295,295,295,295,295,
-        };
+        });
 
         obj.createentity(96, 48, 25, 0, 1); // Trophy
         obj.createentity(128, 48, 25, 0, 2); // Trophy
@@ -8981,7 +8988,7 @@ const short* otherlevelclass::loadlevel(int rx, int ry)
     case rn(16,5):
     {
 
-        static const short contents[] = {
+        ROOM_CONTENTS(LEVELPACK_OTHERLEVEL, t, 0, {
         283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,
         283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,
         283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,
@@ -9012,7 +9019,7 @@ const short* otherlevelclass::loadlevel(int rx, int ry)
         283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,
         283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,
         283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,
-        };
+        });
 
         obj.createentity(152, 168, 25, 0, 20); // Trophy placeholder
         obj.createentity(152, 168, 25, 0, 19); // Trophy
@@ -9024,7 +9031,7 @@ const short* otherlevelclass::loadlevel(int rx, int ry)
     case rn(19,6):
     {
 
-        static const short contents[] = {
+        ROOM_CONTENTS(LEVELPACK_OTHERLEVEL, t, 0, {
         289,289,289,289,289,289,289,289,289,289,289,289,289,289,289,289,289,289,289,289,289,289,289,289,289,289,289,289,289,289,289,289,289,289,289,289,289,289,289,289,
         289,289,289,289,289,289,289,289,289,289,289,289,289,289,289,289,289,289,289,289,289,289,289,289,289,289,289,289,289,289,289,289,289,289,289,289,289,289,289,289,
         289,289,289,289,289,289,289,289,289,289,289,289,289,289,289,289,289,289,289,289,289,289,289,289,289,289,289,289,289,289,289,289,289,289,289,289,289,289,289,289,
@@ -9055,7 +9062,7 @@ const short* otherlevelclass::loadlevel(int rx, int ry)
         289,289,289,289,289,289,289,289,289,289,289,289,289,289,289,289,289,289,289,289,289,289,289,289,289,289,289,289,289,411,0,0,0,0,0,0,409,289,289,289,
         289,289,289,289,289,289,289,289,289,289,289,289,289,289,289,289,289,289,289,289,289,289,289,289,289,289,289,289,289,411,0,0,0,0,0,0,409,289,289,289,
         289,289,289,289,289,289,289,289,289,289,289,289,289,289,289,289,289,289,289,289,289,289,289,289,289,289,289,289,289,411,0,0,0,0,0,0,409,289,289,289,
-        };
+        });
 
         obj.createentity(216, 176, 21, 1); //Terminal
         obj.createentity(192, 176, 21, 1); //Terminal
@@ -9082,7 +9089,7 @@ const short* otherlevelclass::loadlevel(int rx, int ry)
     case rn(19,7):
     {
 
-        static const short contents[] = {
+        ROOM_CONTENTS(LEVELPACK_OTHERLEVEL, t, 0, {
         283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,405,0,0,0,0,0,0,403,283,283,283,
         283,284,444,444,444,444,444,444,444,444,444,444,444,444,444,285,283,283,283,283,283,283,283,283,283,283,283,283,283,405,0,0,0,0,0,0,403,283,283,283,
         283,405,0,0,0,0,0,0,0,0,0,0,0,0,0,403,283,283,283,283,283,283,283,283,283,283,283,283,283,405,0,0,0,0,0,0,403,283,283,283,
@@ -9113,7 +9120,7 @@ const short* otherlevelclass::loadlevel(int rx, int ry)
         283,283,283,283,283,283,283,324,364,364,364,364,325,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,
         283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,
         283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,
-        };
+        });
 
         obj.createentity(72, 192, 13);  // (shiny trinket)
         obj.createentity(112, 144, 20, 1);  // (terminal)
@@ -9136,7 +9143,7 @@ const short* otherlevelclass::loadlevel(int rx, int ry)
     {
         //The SUPER GRAVITRON
 
-        static const short contents[] = {
+        ROOM_CONTENTS(LEVELPACK_OTHERLEVEL, t, 0, {
         283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,
         283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,
         283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,
@@ -9167,7 +9174,7 @@ const short* otherlevelclass::loadlevel(int rx, int ry)
         283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,
         283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,
         283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,
-        };
+        });
 
         obj.createentity(-8, 84-32, 11, 328+8);  // (horizontal gravity line)
         obj.createentity(-8, 148 + 32, 11, 328+8);  // (horizontal gravity line)
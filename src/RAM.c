@@ -1,60 +1,295 @@
 #include "RAM.h"
 
 #include <SDL2/SDL.h>
+#include <stdlib.h>
 
 #include "Vlogging.h"
 
-static size_t total = 0;
+#ifdef RAM_TRACKING
 
-typedef struct AllocationHeader {
-    size_t allocated_size;
+// Every allocation starts with one of these. It's padded so that what comes
+// after it is as aligned as malloc() would have made it.
+typedef union AllocationHeader {
+    struct {
+        size_t size;
+        Uint16 tag;
+        Uint16 magic;
+    } info;
+    char align[16];
 } AllocationHeader;
 
-// This doesn't work.
+SDL_COMPILE_TIME_ASSERT(header_size, sizeof(AllocationHeader) == 16);
 
-// static void *track(void *allocation, size_t bytes) {
-//     AllocationHeader *ah = allocation;
-//     ah->allocated_size = bytes;
-//     total += bytes;
-//     vlog_debug("(RAM) usage: %u    <++ %u", total, bytes);
-//     return ah + 1;
-// }
+#define HEADER_MAGIC 0x5AFE
 
-// static void untrack(void *allocation) {
-//     AllocationHeader *ah = ((AllocationHeader *)(allocation)) - 1;
-//     total -= ah->allocated_size;
-//     vlog_debug("(RAM) usage: %u    <-- %u", total, ah->allocated_size);
-// }
+typedef struct TagStats {
+    size_t current;
+    size_t peak;
+    Uint32 count;
+    Uint32 allocations;
+} TagStats;
 
-void *RAM_malloc(size_t bytes)
+static const char *tag_names[RAM_NUM_TAGS] = {
+    "other",
+    "graphics",
+    "audio",
+    "script",
+    "level",
+    "physfs",
+    "xml",
+    "sdl",
+    "new"
+};
+
+static TagStats stats[RAM_NUM_TAGS];
+static size_t total = 0;
+static size_t peak = 0;
+
+// Jobs allocate from their own threads
+static SDL_SpinLock lock = 0;
+
+static void *track(AllocationHeader *ah, size_t bytes, enum RAM_Tag tag) {
+    TagStats *tagstats = &stats[tag];
+
+    ah->info.size = bytes;
+    ah->info.tag = tag;
+    ah->info.magic = HEADER_MAGIC;
+
+    SDL_AtomicLock(&lock);
+    tagstats->current += bytes;
+    tagstats->peak = SDL_max(tagstats->peak, tagstats->current);
+    tagstats->count++;
+    tagstats->allocations++;
+    total += bytes;
+    peak = SDL_max(peak, total);
+    SDL_AtomicUnlock(&lock);
+
+    return ah + 1;
+}
+
+static AllocationHeader *untrack(void *allocation) {
+    AllocationHeader *ah = ((AllocationHeader *)(allocation)) - 1;
+    TagStats *tagstats = &stats[ah->info.tag];
+
+    SDL_assert(ah->info.magic == HEADER_MAGIC && "Freeing memory RAM.c didn't allocate!");
+
+    SDL_AtomicLock(&lock);
+    tagstats->current -= ah->info.size;
+    tagstats->count--;
+    total -= ah->info.size;
+    SDL_AtomicUnlock(&lock);
+
+    return ah;
+}
+
+static void *SDLCALL sdl_malloc(size_t size)
+{
+    return RAM_mallocTagged(size, RAM_TAG_SDL);
+}
+
+static void *SDLCALL sdl_calloc(size_t nmemb, size_t size)
+{
+    return RAM_callocTagged(nmemb, size, RAM_TAG_SDL);
+}
+
+static void *SDLCALL sdl_realloc(void *ptr, size_t size)
+{
+    return RAM_reallocTagged(ptr, size, RAM_TAG_SDL);
+}
+
+void RAM_init(void)
 {
-    void *alloc = SDL_malloc(bytes);
-    return alloc; // track(alloc, bytes);
+    if (SDL_SetMemoryFunctions(sdl_malloc, sdl_calloc, sdl_realloc, RAM_free) != 0)
+    {
+        vlog_error("Unable to route SDL allocations: %s", SDL_GetError());
+    }
+}
+
+void *RAM_mallocTagged(size_t bytes, enum RAM_Tag tag)
+{
+    AllocationHeader *ah = malloc(sizeof(AllocationHeader) + bytes);
+    if (!ah) return NULL;
+    return track(ah, bytes, tag);
 }
 
 void RAM_free(void *ptr)
 {
     if (!ptr) return;
-    // untrack(ptr);
-    SDL_free(ptr);
+    free(untrack(ptr));
 }
 
-void *RAM_calloc(size_t nmemb, size_t size)
+void *RAM_callocTagged(size_t nmemb, size_t size, enum RAM_Tag tag)
 {
     size_t bytes = nmemb * size;
-    void *alloc = SDL_calloc(1, bytes);
-    return alloc; // track(alloc, bytes);
+    void *alloc;
+    if (size != 0 && bytes / size != nmemb) return NULL;
+    alloc = RAM_mallocTagged(bytes, tag);
+    if (alloc) SDL_memset(alloc, 0, bytes);
+    return alloc;
 }
 
-void *RAM_realloc(void *ptr, size_t size)
+void *RAM_reallocTagged(void *ptr, size_t size, enum RAM_Tag tag)
 {
-    void *alloc;
-    // untrack(ptr);
-    alloc = SDL_realloc(ptr, size);
-    return alloc; // track(alloc, size);
+    AllocationHeader *ah;
+    TagStats *tagstats;
+    size_t old_size;
+    if (!ptr) return RAM_mallocTagged(size, tag);
+
+    ah = ((AllocationHeader *)(ptr)) - 1;
+    SDL_assert(ah->info.magic == HEADER_MAGIC && "Reallocating memory RAM.c didn't allocate!");
+    old_size = ah->info.size;
+    ah = realloc(ah, sizeof(AllocationHeader) + size);
+    // The old allocation is still there, so leave it counted
+    if (!ah) return NULL;
+    ah->info.size = size;
+    tagstats = &stats[ah->info.tag];
+
+    SDL_AtomicLock(&lock);
+    tagstats->current = tagstats->current - old_size + size;
+    tagstats->peak = SDL_max(tagstats->peak, tagstats->current);
+    total = total - old_size + size;
+    peak = SDL_max(peak, total);
+    SDL_AtomicUnlock(&lock);
+
+    return ah + 1;
 }
 
 size_t RAM_totalAllocated()
 {
     return total;
 }
+
+size_t RAM_peakAllocated()
+{
+    return peak;
+}
+
+unsigned int RAM_allocationCount(void)
+{
+    unsigned int count = 0;
+    int i;
+
+    SDL_AtomicLock(&lock);
+    for (i = 0; i < RAM_NUM_TAGS; i++)
+    {
+        count += stats[i].allocations;
+    }
+    SDL_AtomicUnlock(&lock);
+
+    return count;
+}
+
+void RAM_logUsage(void)
+{
+    int i;
+
+    SDL_AtomicLock(&lock);
+    vlog_info("(RAM) %u KB in use, %u KB at most", (unsigned) (total / 1024), (unsigned) (peak / 1024));
+    for (i = 0; i < RAM_NUM_TAGS; i++)
+    {
+        vlog_info(
+            "(RAM)   %-8s %6u KB in %5u allocations, %6u KB at most, %u allocations made",
+            tag_names[i],
+            (unsigned) (stats[i].current / 1024),
+            stats[i].count,
+            (unsigned) (stats[i].peak / 1024),
+            stats[i].allocations
+        );
+    }
+    SDL_AtomicUnlock(&lock);
+}
+
+void RAM_logLeaks(void)
+{
+    int leaked = 0;
+    int i;
+
+    SDL_AtomicLock(&lock);
+    for (i = 0; i < RAM_NUM_TAGS; i++)
+    {
+        if (stats[i].count > 0)
+        {
+            vlog_warn(
+                "(RAM) Leaked %u bytes in %u allocations tagged %s",
+                (unsigned) stats[i].current,
+                stats[i].count,
+                tag_names[i]
+            );
+            leaked = 1;
+        }
+    }
+    if (!leaked)
+    {
+        vlog_info("(RAM) No leaks, %u KB at most", (unsigned) (peak / 1024));
+    }
+    SDL_AtomicUnlock(&lock);
+}
+
+#else
+
+void RAM_init(void)
+{
+}
+
+void *RAM_mallocTagged(size_t bytes, enum RAM_Tag tag)
+{
+    (void) tag;
+    return SDL_malloc(bytes);
+}
+
+void RAM_free(void *ptr)
+{
+    SDL_free(ptr);
+}
+
+void *RAM_callocTagged(size_t nmemb, size_t size, enum RAM_Tag tag)
+{
+    (void) tag;
+    return SDL_calloc(nmemb, size);
+}
+
+void *RAM_reallocTagged(void *ptr, size_t size, enum RAM_Tag tag)
+{
+    (void) tag;
+    return SDL_realloc(ptr, size);
+}
+
+size_t RAM_totalAllocated()
+{
+    return 0;
+}
+
+size_t RAM_peakAllocated()
+{
+    return 0;
+}
+
+unsigned int RAM_allocationCount(void)
+{
+    return 0;
+}
+
+void RAM_logUsage(void)
+{
+}
+
+void RAM_logLeaks(void)
+{
+}
+
+#endif /* RAM_TRACKING */
+
+void *RAM_malloc(size_t bytes)
+{
+    return RAM_mallocTagged(bytes, RAM_TAG_OTHER);
+}
+
+void *RAM_calloc(size_t nmemb, size_t size)
+{
+    return RAM_callocTagged(nmemb, size, RAM_TAG_OTHER);
+}
+
+void *RAM_realloc(void *ptr, size_t size)
+{
+    return RAM_reallocTagged(ptr, size, RAM_TAG_OTHER);
+}
@@ -9,6 +9,27 @@
 extern "C" {
 #endif
 
+// What an allocation is for, so that usage can be told apart by subsystem.
+enum RAM_Tag
+{
+    RAM_TAG_OTHER,
+    RAM_TAG_GRAPHICS,
+    RAM_TAG_AUDIO,
+    RAM_TAG_SCRIPT,
+    RAM_TAG_LEVEL,
+    RAM_TAG_PHYSFS,
+    RAM_TAG_XML,
+    RAM_TAG_SDL,
+    // C++'s new, see RAMNew.cpp
+    RAM_TAG_NEW,
+
+    RAM_NUM_TAGS
+};
+
+// Call first thing in main(), it routes SDL's own allocations through here
+// too. Does nothing unless built with RAM_TRACKING.
+void RAM_init(void);
+
 void *RAM_malloc(size_t bytes);
 
 void RAM_free(void *ptr);
@@ -17,9 +38,28 @@ void *RAM_calloc(size_t nmemb, size_t size);
 
 void *RAM_realloc(void *ptr, size_t size);
 
-// Might not be precise due to fragmentation.
+void *RAM_mallocTagged(size_t bytes, enum RAM_Tag tag);
+
+void *RAM_callocTagged(size_t nmemb, size_t size, enum RAM_Tag tag);
+
+// The tag is only used if ptr is NULL, otherwise the allocation keeps its own.
+void *RAM_reallocTagged(void *ptr, size_t size, enum RAM_Tag tag);
+
+// Might not be precise due to fragmentation. Always 0 without RAM_TRACKING.
 size_t RAM_totalAllocated();
 
+size_t RAM_peakAllocated();
+
+// How many allocations have been made so far, freed or not. Always 0 without
+// RAM_TRACKING.
+unsigned int RAM_allocationCount(void);
+
+// Logs current and peak usage of every tag.
+void RAM_logUsage(void);
+
+// Logs whatever is still allocated, call once everything has been freed.
+void RAM_logLeaks(void);
+
 #ifdef __cplusplus
 }
 #endif
@@ -0,0 +1,65 @@
+#include "RAM.h"
+
+#ifdef RAM_TRACKING
+
+#include <new>
+
+/* Strings, vectors and everything else C++ allocates get counted too. Only
+ * the replaceable forms the standard library calls are needed. */
+
+void* operator new(std::size_t size)
+{
+    void* ptr = RAM_mallocTagged(size != 0 ? size : 1, RAM_TAG_NEW);
+    if (ptr == NULL)
+    {
+        throw std::bad_alloc();
+    }
+    return ptr;
+}
+
+void* operator new[](std::size_t size)
+{
+    return operator new(size);
+}
+
+void* operator new(std::size_t size, const std::nothrow_t&) noexcept
+{
+    return RAM_mallocTagged(size != 0 ? size : 1, RAM_TAG_NEW);
+}
+
+void* operator new[](std::size_t size, const std::nothrow_t&) noexcept
+{
+    return RAM_mallocTagged(size != 0 ? size : 1, RAM_TAG_NEW);
+}
+
+void operator delete(void* ptr) noexcept
+{
+    RAM_free(ptr);
+}
+
+void operator delete[](void* ptr) noexcept
+{
+    RAM_free(ptr);
+}
+
+void operator delete(void* ptr, const std::nothrow_t&) noexcept
+{
+    RAM_free(ptr);
+}
+
+void operator delete[](void* ptr, const std::nothrow_t&) noexcept
+{
+    RAM_free(ptr);
+}
+
+void operator delete(void* ptr, std::size_t) noexcept
+{
+    RAM_free(ptr);
+}
+
+void operator delete[](void* ptr, std::size_t) noexcept
+{
+    RAM_free(ptr);
+}
+
+#endif /* RAM_TRACKING */
@@ -2040,7 +2040,7 @@ void maprender(void)
     }
     else if (game.menupage <= 3)
     {
-        std::string tab1;
+        const char* tab1;
         if (game.insecretlab)
         {
             tab1 = "GRAV";
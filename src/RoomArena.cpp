@@ -0,0 +1,12 @@
+#include "RoomArena.h"
+
+#ifndef ROOM_ARENA_KB
+#define ROOM_ARENA_KB 48
+#endif
+
+#if ROOM_ARENA_KB > 0
+alignas(Uint64) static Uint8 arena_bytes[ROOM_ARENA_KB * 1024];
+arenaclass roomarena(arena_bytes, sizeof(arena_bytes), "Room", RAM_TAG_LEVEL);
+#else
+arenaclass roomarena(NULL, 0, "Room", RAM_TAG_LEVEL);
+#endif
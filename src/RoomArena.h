@@ -0,0 +1,52 @@
+#ifndef ROOMARENA_H
+#define ROOMARENA_H
+
+#include <stddef.h>
+#include <vector>
+
+#include "Arena.h"
+
+/* One arena for everything that only lives as long as the room does: its
+ * blocks, their lookup grid and its roomtext. map.gotoroom() lets go of all of
+ * it at once, so room after room doesn't leave holes all over the heap. */
+extern arenaclass roomarena;
+
+template <class T>
+struct roomallocator
+{
+    typedef T value_type;
+
+    roomallocator(void) {}
+
+    template <class U>
+    roomallocator(const roomallocator<U>&) {}
+
+    T* allocate(const size_t n)
+    {
+        return static_cast<T*>(roomarena.allocate(n * sizeof(T)));
+    }
+
+    void deallocate(T* ptr, const size_t n)
+    {
+        roomarena.deallocate(ptr, n * sizeof(T));
+    }
+};
+
+template <class T, class U>
+bool operator==(const roomallocator<T>&, const roomallocator<U>&)
+{
+    return true;
+}
+
+template <class T, class U>
+bool operator!=(const roomallocator<T>&, const roomallocator<U>&)
+{
+    return false;
+}
+
+/* To give the memory back before a reset, swap with an empty one, clear()
+ * keeps it */
+template <class T>
+using roomvector = std::vector<T, roomallocator<T> >;
+
+#endif /* ROOMARENA_H */
@@ -0,0 +1,63 @@
+#include "RoomSoak.h"
+
+#include <malloc.h>
+#include <SDL2/SDL.h>
+
+#include "Entity.h"
+#include "Map.h"
+#include "RAM.h"
+#include "RoomArena.h"
+#include "Script.h"
+#include "Vlogging.h"
+
+static void logheap(const char* when)
+{
+    const struct mallinfo info = mallinfo();
+
+    /* Free chunks inside the heap are the holes left between allocations */
+    vlog_info(
+        "SOAK | %s: %i KB in use, %i KB free in %i holes",
+        when,
+        info.uordblks / 1024,
+        info.fordblks / 1024,
+        info.ordblks
+    );
+    vlog_info(
+        "SOAK | Room arena: %u of %u KB at most, %u allocations went to the heap",
+        (unsigned int) (roomarena.peak / 1024),
+        (unsigned int) (roomarena.capacity() / 1024),
+        (unsigned int) roomarena.overflows
+    );
+}
+
+void ROOMSOAK_run(const int passes)
+{
+    char when[32];
+
+    /* A new game, so that there's a player to move around */
+    script.startgamemode(0);
+    logheap("Before");
+
+    const Uint32 start = SDL_GetTicks();
+    for (int pass = 1; pass <= passes; ++pass)
+    {
+        for (int ry = 100; ry < 120; ++ry)
+        {
+            for (int rx = 100; rx < 120; ++rx)
+            {
+                map.gotoroom(rx, ry);
+                obj.updateblockindex();
+            }
+        }
+
+        SDL_snprintf(when, sizeof(when), "After pass %i", pass);
+        logheap(when);
+    }
+
+    vlog_info(
+        "SOAK | %i room loads took %u ms",
+        passes * 20 * 20,
+        SDL_GetTicks() - start
+    );
+    RAM_logUsage();
+}
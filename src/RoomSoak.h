@@ -0,0 +1,9 @@
+#ifndef ROOMSOAK_H
+#define ROOMSOAK_H
+
+/* Loads every room of the main game passes times over, logging how full
+ * and how full of holes the heap is after each pass. Only built with
+ * ROOM_SOAK. */
+void ROOMSOAK_run(int passes);
+
+#endif /* ROOMSOAK_H */
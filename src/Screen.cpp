@@ -5,6 +5,8 @@
 #include <SDL2/SDL.h>
 
 #include "FileSystemUtils.h"
+#include "FrameArena.h"
+#include "FrameProfiler.h"
 #include "Game.h"
 #include "GraphicsUtil.h"
 #include "Vlogging.h"
@@ -51,8 +53,10 @@ void Screen::init(const ScreenSettings& settings)
         0xFF000000
     );
 
+#ifndef HEADLESS
     gpu::init();
     _screenBuffer = gpu::createFramebuffer(SCREEN_WIDTH, SCREEN_HEIGHT);
+#endif
 
     badSignalEffect = settings.badSignal;
 }
@@ -75,25 +79,29 @@ void Screen::GetSettings(ScreenSettings* settings)
 
 void Screen::UpdateScreen(SDL_Surface* buffer, SDL_Rect* rect)
 {
+    PROFILE_ZONE("UpdateScreen");
+
     if((buffer == NULL) && (m_screen == NULL))
     {
         return;
     }
 
-    if(badSignalEffect)
+#ifdef FRAME_PROFILER
+    if (frameprofiler.overlay)
     {
-        buffer = ApplyFilter(buffer);
+        frameprofiler.drawoverlay();
     }
-
-
-    ClearSurface(m_screen);
-    BlitSurfaceStandard(buffer,NULL,m_screen,rect);
+#endif
 
     if(badSignalEffect)
     {
-        SDL_FreeSurface(buffer);
+        ApplyFilter(buffer, _filterBuffer);
+        buffer = _filterBuffer;
     }
 
+
+    ClearSurface(m_screen);
+    BlitSurfaceStandard(buffer,NULL,m_screen,rect);
 }
 
 const SDL_PixelFormat* Screen::GetFormat(void)
@@ -131,6 +139,8 @@ void Screen::FlipScreen(const bool flipmode)
     // TODO(PSP): Fleeeep
     // Implement flip mode.
 
+    PROFILE_ZONE("FlipScreen");
+
     gpu::start();
 
     auto display = gpu::display();
@@ -147,7 +157,12 @@ void Screen::FlipScreen(const bool flipmode)
 
     gpu::end();
 
-    gpu::swap();
+    {
+        PROFILE_ZONE("gpu::swap");
+        gpu::swap();
+    }
+
+    FRAME_end();
 }
 
 void Screen::toggleScalingMode(void)
@@ -4,6 +4,7 @@
 #include <SDL2/SDL.h>
 #include <cstdint>
 
+#include "Alloc.h"
 #include "GPU.h"
 #include "ScreenSettings.h"
 #include "VRAM.h"
@@ -54,6 +55,8 @@ public:
 
 private:
     uint8_t _screenData[SCREEN_WIDTH_VRAM * SCREEN_HEIGHT_VRAM * 4];
+    // What the bad signal filter draws to
+    SurfaceRgba<SCREEN_WIDTH, SCREEN_HEIGHT> _filterBuffer;
     gpu::Framebuffer _screenBuffer;
 };
 
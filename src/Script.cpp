@@ -2,6 +2,7 @@
 #include "Script.h"
 
 #include <limits.h>
+#include <stdlib.h>
 #include <SDL2/SDL.h>
 
 #include "CustomLevels.h"
@@ -9,8 +10,10 @@
 #include "Entity.h"
 #include "Enums.h"
 #include "Exit.h"
+#include "FrameProfiler.h"
 #include "GlitchrunnerMode.h"
 #include "Graphics.h"
+#include "InputJournal.h"
 #include "KeyPoll.h"
 #include "Map.h"
 #include "Music.h"
@@ -35,36 +38,564 @@ scriptclass::scriptclass(void)
     textx = 0;
     texty = 0;
     textflipme = false;
+
+    compiled = false;
+    cachedscript = NULL;
+    retokenized = false;
+    lineints = NULL;
+    numlineints = 0;
+    runsteps = 0;
+    runticks = 0;
+
+#ifdef SCRIPT_BENCHMARK
+    olddispatch = false;
+    benchmarksteps = 0;
+#endif
 }
 
 void scriptclass::clearcustom(void)
 {
+    detachcustom();
     customscripts.clear();
+    customcache.clear();
+
+    /* Don't let words from old levels pile up */
+    compiledlines.clear();
+    compiledwords.clear();
+    compiledints.clear();
+    numlineints = 0;
+    scriptwords.clear();
+    compiled = false;
 }
 
 static bool argexists[NUM_SCRIPT_ARGS];
 
-void scriptclass::tokenize( const std::string& t )
+/* One for every command run() knows, in the order they used to be checked
+ * in when run() was a chain of ifs */
+enum ScriptOp
 {
-    j = 0;
-    std::string tempword;
-    char currentletter;
+    SCRIPTOP_NONE = -1,
+
+    SCRIPTOP_MOVEPLAYER,
+    SCRIPTOP_WARPDIR,
+    SCRIPTOP_IFWARP,
+    SCRIPTOP_DESTROY,
+    SCRIPTOP_CUSTOMIFTRINKETS,
+    SCRIPTOP_CUSTOMIFTRINKETSLESS,
+    SCRIPTOP_CUSTOMIFFLAG,
+    SCRIPTOP_CUSTOMMAP,
+    SCRIPTOP_DELAY,
+    SCRIPTOP_FLAG,
+    SCRIPTOP_FLASH,
+    SCRIPTOP_SHAKE,
+    SCRIPTOP_WALK,
+    SCRIPTOP_FLIP,
+    SCRIPTOP_TOFLOOR,
+    SCRIPTOP_PLAYEF,
+    SCRIPTOP_PLAY,
+    SCRIPTOP_STOPMUSIC,
+    SCRIPTOP_RESUMEMUSIC,
+    SCRIPTOP_MUSICFADEOUT,
+    SCRIPTOP_MUSICFADEIN,
+    SCRIPTOP_TRINKETSCRIPTMUSIC,
+    SCRIPTOP_GOTOPOSITION,
+    SCRIPTOP_GOTOROOM,
+    SCRIPTOP_CUTSCENE,
+    SCRIPTOP_ENDCUTSCENE,
+    SCRIPTOP_AUDIOPAUSE,
+    SCRIPTOP_UNTILBARS,
+    SCRIPTOP_TEXT,
+    SCRIPTOP_POSITION,
+    SCRIPTOP_CUSTOMPOSITION,
+    SCRIPTOP_BACKGROUNDTEXT,
+    SCRIPTOP_FLIPME,
+    SCRIPTOP_SPEAK_ACTIVE,
+    SCRIPTOP_ENDTEXT,
+    SCRIPTOP_ENDTEXTFAST,
+    SCRIPTOP_DO,
+    SCRIPTOP_LOOP,
+    SCRIPTOP_VVVVVVMAN,
+    SCRIPTOP_UNDOVVVVVVMAN,
+    SCRIPTOP_CREATEENTITY,
+    SCRIPTOP_CREATECREWMAN,
+    SCRIPTOP_CHANGEMOOD,
+    SCRIPTOP_CHANGECUSTOMMOOD,
+    SCRIPTOP_CHANGETILE,
+    SCRIPTOP_FLIPGRAVITY,
+    SCRIPTOP_CHANGEGRAVITY,
+    SCRIPTOP_CHANGEDIR,
+    SCRIPTOP_ALARMON,
+    SCRIPTOP_ALARMOFF,
+    SCRIPTOP_CHANGEAI,
+    SCRIPTOP_ACTIVATETELEPORTER,
+    SCRIPTOP_CHANGECOLOUR,
+    SCRIPTOP_SQUEAK,
+    SCRIPTOP_BLACKOUT,
+    SCRIPTOP_BLACKON,
+    SCRIPTOP_SETCHECKPOINT,
+    SCRIPTOP_GAMESTATE,
+    SCRIPTOP_TEXTBOXACTIVE,
+    SCRIPTOP_GAMEMODE,
+    SCRIPTOP_IFEXPLORED,
+    SCRIPTOP_IFLAST,
+    SCRIPTOP_IFSKIP,
+    SCRIPTOP_IFFLAG,
+    SCRIPTOP_IFCREWLOST,
+    SCRIPTOP_IFTRINKETS,
+    SCRIPTOP_IFTRINKETSLESS,
+    SCRIPTOP_HIDECOORDINATES,
+    SCRIPTOP_SHOWCOORDINATES,
+    SCRIPTOP_HIDESHIP,
+    SCRIPTOP_SHOWSHIP,
+    SCRIPTOP_SHOWSECRETLAB,
+    SCRIPTOP_HIDESECRETLAB,
+    SCRIPTOP_SHOWTELEPORTERS,
+    SCRIPTOP_SHOWTARGETS,
+    SCRIPTOP_SHOWTRINKETS,
+    SCRIPTOP_HIDETELEPORTERS,
+    SCRIPTOP_HIDETARGETS,
+    SCRIPTOP_HIDETRINKETS,
+    SCRIPTOP_HIDEPLAYER,
+    SCRIPTOP_SHOWPLAYER,
+    SCRIPTOP_TELEPORTSCRIPT,
+    SCRIPTOP_CLEARTELEPORTSCRIPT,
+    SCRIPTOP_NOCONTROL,
+    SCRIPTOP_HASCONTROL,
+    SCRIPTOP_COMPANION,
+    SCRIPTOP_BEFADEIN,
+    SCRIPTOP_FADEIN,
+    SCRIPTOP_FADEOUT,
+    SCRIPTOP_UNTILFADE,
+    SCRIPTOP_ENTERSECRETLAB,
+    SCRIPTOP_LEAVESECRETLAB,
+    SCRIPTOP_RESETGAME,
+    SCRIPTOP_LOADSCRIPT,
+    SCRIPTOP_ROLLCREDITS,
+    SCRIPTOP_FINALMODE,
+    SCRIPTOP_RESCUED,
+    SCRIPTOP_MISSING,
+    SCRIPTOP_FACE,
+    SCRIPTOP_JUKEBOX,
+    SCRIPTOP_CREATEACTIVITYZONE,
+    SCRIPTOP_SETACTIVITYCOLOUR,
+    SCRIPTOP_SETACTIVITYTEXT,
+    SCRIPTOP_CREATERESCUEDCREW,
+    SCRIPTOP_RESTOREPLAYERCOLOUR,
+    SCRIPTOP_CHANGEPLAYERCOLOUR,
+    SCRIPTOP_CHANGERESPAWNCOLOUR,
+    SCRIPTOP_ALTSTATES,
+    SCRIPTOP_ACTIVETELEPORTER,
+    SCRIPTOP_FOUNDTRINKET,
+    SCRIPTOP_FOUNDLAB,
+    SCRIPTOP_FOUNDLAB2,
+    SCRIPTOP_EVERYBODYSAD,
+    SCRIPTOP_STARTINTERMISSION2,
+    SCRIPTOP_TELESAVE,
+    SCRIPTOP_CREATELASTRESCUED,
+    SCRIPTOP_SPECIALLINE,
+    SCRIPTOP_TRINKETBLUECONTROL,
+    SCRIPTOP_TRINKETYELLOWCONTROL,
+    SCRIPTOP_REDCONTROL,
+    SCRIPTOP_GREENCONTROL,
+    SCRIPTOP_BLUECONTROL,
+    SCRIPTOP_YELLOWCONTROL,
+    SCRIPTOP_PURPLECONTROL,
+    SCRIPTOP_PREFETCHIMAGE,
+
+    NUM_SCRIPTOPS
+};
+
+static const struct
+{
+    const char* name;
+    ScriptOp op;
+}
+scriptops[] = {
+    {"activateteleporter", SCRIPTOP_ACTIVATETELEPORTER},
+    {"activeteleporter", SCRIPTOP_ACTIVETELEPORTER},
+    {"alarmoff", SCRIPTOP_ALARMOFF},
+    {"alarmon", SCRIPTOP_ALARMON},
+    {"altstates", SCRIPTOP_ALTSTATES},
+    {"audiopause", SCRIPTOP_AUDIOPAUSE},
+    {"backgroundtext", SCRIPTOP_BACKGROUNDTEXT},
+    {"befadein", SCRIPTOP_BEFADEIN},
+    {"blackon", SCRIPTOP_BLACKON},
+    {"blackout", SCRIPTOP_BLACKOUT},
+    {"bluecontrol", SCRIPTOP_BLUECONTROL},
+    {"changeai", SCRIPTOP_CHANGEAI},
+    {"changecolour", SCRIPTOP_CHANGECOLOUR},
+    {"changecustommood", SCRIPTOP_CHANGECUSTOMMOOD},
+    {"changedir", SCRIPTOP_CHANGEDIR},
+    {"changegravity", SCRIPTOP_CHANGEGRAVITY},
+    {"changemood", SCRIPTOP_CHANGEMOOD},
+    {"changeplayercolour", SCRIPTOP_CHANGEPLAYERCOLOUR},
+    {"changerespawncolour", SCRIPTOP_CHANGERESPAWNCOLOUR},
+    {"changetile", SCRIPTOP_CHANGETILE},
+    {"clearteleportscript", SCRIPTOP_CLEARTELEPORTSCRIPT},
+    {"companion", SCRIPTOP_COMPANION},
+    {"createactivityzone", SCRIPTOP_CREATEACTIVITYZONE},
+    {"createcrewman", SCRIPTOP_CREATECREWMAN},
+    {"createentity", SCRIPTOP_CREATEENTITY},
+    {"createlastrescued", SCRIPTOP_CREATELASTRESCUED},
+    {"createrescuedcrew", SCRIPTOP_CREATERESCUEDCREW},
+    {"customifflag", SCRIPTOP_CUSTOMIFFLAG},
+    {"customiftrinkets", SCRIPTOP_CUSTOMIFTRINKETS},
+    {"customiftrinketsless", SCRIPTOP_CUSTOMIFTRINKETSLESS},
+    {"custommap", SCRIPTOP_CUSTOMMAP},
+    {"customposition", SCRIPTOP_CUSTOMPOSITION},
+    {"cutscene", SCRIPTOP_CUTSCENE},
+    {"delay", SCRIPTOP_DELAY},
+    {"destroy", SCRIPTOP_DESTROY},
+    {"do", SCRIPTOP_DO},
+    {"endcutscene", SCRIPTOP_ENDCUTSCENE},
+    {"endtext", SCRIPTOP_ENDTEXT},
+    {"endtextfast", SCRIPTOP_ENDTEXTFAST},
+    {"entersecretlab", SCRIPTOP_ENTERSECRETLAB},
+    {"everybodysad", SCRIPTOP_EVERYBODYSAD},
+    {"face", SCRIPTOP_FACE},
+    {"fadein", SCRIPTOP_FADEIN},
+    {"fadeout", SCRIPTOP_FADEOUT},
+    {"finalmode", SCRIPTOP_FINALMODE},
+    {"flag", SCRIPTOP_FLAG},
+    {"flash", SCRIPTOP_FLASH},
+    {"flip", SCRIPTOP_FLIP},
+    {"flipgravity", SCRIPTOP_FLIPGRAVITY},
+    {"flipme", SCRIPTOP_FLIPME},
+    {"foundlab", SCRIPTOP_FOUNDLAB},
+    {"foundlab2", SCRIPTOP_FOUNDLAB2},
+    {"foundtrinket", SCRIPTOP_FOUNDTRINKET},
+    {"gamemode", SCRIPTOP_GAMEMODE},
+    {"gamestate", SCRIPTOP_GAMESTATE},
+    {"gotoposition", SCRIPTOP_GOTOPOSITION},
+    {"gotoroom", SCRIPTOP_GOTOROOM},
+    {"greencontrol", SCRIPTOP_GREENCONTROL},
+    {"hascontrol", SCRIPTOP_HASCONTROL},
+    {"hidecoordinates", SCRIPTOP_HIDECOORDINATES},
+    {"hideplayer", SCRIPTOP_HIDEPLAYER},
+    {"hidesecretlab", SCRIPTOP_HIDESECRETLAB},
+    {"hideship", SCRIPTOP_HIDESHIP},
+    {"hidetargets", SCRIPTOP_HIDETARGETS},
+    {"hideteleporters", SCRIPTOP_HIDETELEPORTERS},
+    {"hidetrinkets", SCRIPTOP_HIDETRINKETS},
+    {"ifcrewlost", SCRIPTOP_IFCREWLOST},
+    {"ifexplored", SCRIPTOP_IFEXPLORED},
+    {"ifflag", SCRIPTOP_IFFLAG},
+    {"iflast", SCRIPTOP_IFLAST},
+    {"ifskip", SCRIPTOP_IFSKIP},
+    {"iftrinkets", SCRIPTOP_IFTRINKETS},
+    {"iftrinketsless", SCRIPTOP_IFTRINKETSLESS},
+    {"ifwarp", SCRIPTOP_IFWARP},
+    {"jukebox", SCRIPTOP_JUKEBOX},
+    {"leavesecretlab", SCRIPTOP_LEAVESECRETLAB},
+    {"loadscript", SCRIPTOP_LOADSCRIPT},
+    {"loop", SCRIPTOP_LOOP},
+    {"missing", SCRIPTOP_MISSING},
+    {"moveplayer", SCRIPTOP_MOVEPLAYER},
+    {"musicfadein", SCRIPTOP_MUSICFADEIN},
+    {"musicfadeout", SCRIPTOP_MUSICFADEOUT},
+    {"nocontrol", SCRIPTOP_NOCONTROL},
+    {"play", SCRIPTOP_PLAY},
+    {"playef", SCRIPTOP_PLAYEF},
+    {"position", SCRIPTOP_POSITION},
+    {"prefetchimage", SCRIPTOP_PREFETCHIMAGE},
+    {"purplecontrol", SCRIPTOP_PURPLECONTROL},
+    {"redcontrol", SCRIPTOP_REDCONTROL},
+    {"rescued", SCRIPTOP_RESCUED},
+    {"resetgame", SCRIPTOP_RESETGAME},
+    {"restoreplayercolour", SCRIPTOP_RESTOREPLAYERCOLOUR},
+    {"resumemusic", SCRIPTOP_RESUMEMUSIC},
+    {"rollcredits", SCRIPTOP_ROLLCREDITS},
+    {"setactivitycolour", SCRIPTOP_SETACTIVITYCOLOUR},
+    {"setactivitytext", SCRIPTOP_SETACTIVITYTEXT},
+    {"setcheckpoint", SCRIPTOP_SETCHECKPOINT},
+    {"shake", SCRIPTOP_SHAKE},
+    {"showcoordinates", SCRIPTOP_SHOWCOORDINATES},
+    {"showplayer", SCRIPTOP_SHOWPLAYER},
+    {"showsecretlab", SCRIPTOP_SHOWSECRETLAB},
+    {"showship", SCRIPTOP_SHOWSHIP},
+    {"showtargets", SCRIPTOP_SHOWTARGETS},
+    {"showteleporters", SCRIPTOP_SHOWTELEPORTERS},
+    {"showtrinkets", SCRIPTOP_SHOWTRINKETS},
+    {"speak", SCRIPTOP_SPEAK_ACTIVE},
+    {"speak_active", SCRIPTOP_SPEAK_ACTIVE},
+    {"specialline", SCRIPTOP_SPECIALLINE},
+    {"squeak", SCRIPTOP_SQUEAK},
+    {"startintermission2", SCRIPTOP_STARTINTERMISSION2},
+    {"stopmusic", SCRIPTOP_STOPMUSIC},
+    {"teleportscript", SCRIPTOP_TELEPORTSCRIPT},
+    {"telesave", SCRIPTOP_TELESAVE},
+    {"text", SCRIPTOP_TEXT},
+    {"textboxactive", SCRIPTOP_TEXTBOXACTIVE},
+    {"tofloor", SCRIPTOP_TOFLOOR},
+    {"trinketbluecontrol", SCRIPTOP_TRINKETBLUECONTROL},
+    {"trinketscriptmusic", SCRIPTOP_TRINKETSCRIPTMUSIC},
+    {"trinketyellowcontrol", SCRIPTOP_TRINKETYELLOWCONTROL},
+    {"undovvvvvvman", SCRIPTOP_UNDOVVVVVVMAN},
+    {"untilbars", SCRIPTOP_UNTILBARS},
+    {"untilfade", SCRIPTOP_UNTILFADE},
+    {"vvvvvvman", SCRIPTOP_VVVVVVMAN},
+    {"walk", SCRIPTOP_WALK},
+    {"warpdir", SCRIPTOP_WARPDIR},
+    {"yellowcontrol", SCRIPTOP_YELLOWCONTROL},
+};
+
+static const ScriptOp scriptopchain[NUM_SCRIPTOPS] = {
+    SCRIPTOP_MOVEPLAYER, /* SCRIPTOP_MOVEPLAYER */
+    SCRIPTOP_WARPDIR, /* SCRIPTOP_WARPDIR */
+    SCRIPTOP_IFWARP, /* SCRIPTOP_IFWARP */
+    SCRIPTOP_DESTROY, /* SCRIPTOP_DESTROY */
+    SCRIPTOP_CUSTOMIFTRINKETS, /* SCRIPTOP_CUSTOMIFTRINKETS */
+    SCRIPTOP_CUSTOMIFTRINKETSLESS, /* SCRIPTOP_CUSTOMIFTRINKETSLESS */
+    SCRIPTOP_CUSTOMIFTRINKETSLESS, /* SCRIPTOP_CUSTOMIFFLAG */
+    SCRIPTOP_CUSTOMMAP, /* SCRIPTOP_CUSTOMMAP */
+    SCRIPTOP_DELAY, /* SCRIPTOP_DELAY */
+    SCRIPTOP_FLAG, /* SCRIPTOP_FLAG */
+    SCRIPTOP_FLASH, /* SCRIPTOP_FLASH */
+    SCRIPTOP_SHAKE, /* SCRIPTOP_SHAKE */
+    SCRIPTOP_WALK, /* SCRIPTOP_WALK */
+    SCRIPTOP_FLIP, /* SCRIPTOP_FLIP */
+    SCRIPTOP_TOFLOOR, /* SCRIPTOP_TOFLOOR */
+    SCRIPTOP_PLAYEF, /* SCRIPTOP_PLAYEF */
+    SCRIPTOP_PLAY, /* SCRIPTOP_PLAY */
+    SCRIPTOP_STOPMUSIC, /* SCRIPTOP_STOPMUSIC */
+    SCRIPTOP_RESUMEMUSIC, /* SCRIPTOP_RESUMEMUSIC */
+    SCRIPTOP_MUSICFADEOUT, /* SCRIPTOP_MUSICFADEOUT */
+    SCRIPTOP_MUSICFADEIN, /* SCRIPTOP_MUSICFADEIN */
+    SCRIPTOP_TRINKETSCRIPTMUSIC, /* SCRIPTOP_TRINKETSCRIPTMUSIC */
+    SCRIPTOP_GOTOPOSITION, /* SCRIPTOP_GOTOPOSITION */
+    SCRIPTOP_GOTOROOM, /* SCRIPTOP_GOTOROOM */
+    SCRIPTOP_CUTSCENE, /* SCRIPTOP_CUTSCENE */
+    SCRIPTOP_ENDCUTSCENE, /* SCRIPTOP_ENDCUTSCENE */
+    SCRIPTOP_AUDIOPAUSE, /* SCRIPTOP_AUDIOPAUSE */
+    SCRIPTOP_UNTILBARS, /* SCRIPTOP_UNTILBARS */
+    SCRIPTOP_UNTILBARS, /* SCRIPTOP_TEXT */
+    SCRIPTOP_UNTILBARS, /* SCRIPTOP_POSITION */
+    SCRIPTOP_UNTILBARS, /* SCRIPTOP_CUSTOMPOSITION */
+    SCRIPTOP_UNTILBARS, /* SCRIPTOP_BACKGROUNDTEXT */
+    SCRIPTOP_UNTILBARS, /* SCRIPTOP_FLIPME */
+    SCRIPTOP_UNTILBARS, /* SCRIPTOP_SPEAK_ACTIVE */
+    SCRIPTOP_UNTILBARS, /* SCRIPTOP_ENDTEXT */
+    SCRIPTOP_UNTILBARS, /* SCRIPTOP_ENDTEXTFAST */
+    SCRIPTOP_UNTILBARS, /* SCRIPTOP_DO */
+    SCRIPTOP_UNTILBARS, /* SCRIPTOP_LOOP */
+    SCRIPTOP_UNTILBARS, /* SCRIPTOP_VVVVVVMAN */
+    SCRIPTOP_UNTILBARS, /* SCRIPTOP_UNDOVVVVVVMAN */
+    SCRIPTOP_UNTILBARS, /* SCRIPTOP_CREATEENTITY */
+    SCRIPTOP_UNTILBARS, /* SCRIPTOP_CREATECREWMAN */
+    SCRIPTOP_UNTILBARS, /* SCRIPTOP_CHANGEMOOD */
+    SCRIPTOP_UNTILBARS, /* SCRIPTOP_CHANGECUSTOMMOOD */
+    SCRIPTOP_UNTILBARS, /* SCRIPTOP_CHANGETILE */
+    SCRIPTOP_UNTILBARS, /* SCRIPTOP_FLIPGRAVITY */
+    SCRIPTOP_UNTILBARS, /* SCRIPTOP_CHANGEGRAVITY */
+    SCRIPTOP_UNTILBARS, /* SCRIPTOP_CHANGEDIR */
+    SCRIPTOP_UNTILBARS, /* SCRIPTOP_ALARMON */
+    SCRIPTOP_UNTILBARS, /* SCRIPTOP_ALARMOFF */
+    SCRIPTOP_UNTILBARS, /* SCRIPTOP_CHANGEAI */
+    SCRIPTOP_UNTILBARS, /* SCRIPTOP_ACTIVATETELEPORTER */
+    SCRIPTOP_UNTILBARS, /* SCRIPTOP_CHANGECOLOUR */
+    SCRIPTOP_UNTILBARS, /* SCRIPTOP_SQUEAK */
+    SCRIPTOP_UNTILBARS, /* SCRIPTOP_BLACKOUT */
+    SCRIPTOP_UNTILBARS, /* SCRIPTOP_BLACKON */
+    SCRIPTOP_UNTILBARS, /* SCRIPTOP_SETCHECKPOINT */
+    SCRIPTOP_UNTILBARS, /* SCRIPTOP_GAMESTATE */
+    SCRIPTOP_UNTILBARS, /* SCRIPTOP_TEXTBOXACTIVE */
+    SCRIPTOP_UNTILBARS, /* SCRIPTOP_GAMEMODE */
+    SCRIPTOP_UNTILBARS, /* SCRIPTOP_IFEXPLORED */
+    SCRIPTOP_UNTILBARS, /* SCRIPTOP_IFLAST */
+    SCRIPTOP_UNTILBARS, /* SCRIPTOP_IFSKIP */
+    SCRIPTOP_UNTILBARS, /* SCRIPTOP_IFFLAG */
+    SCRIPTOP_UNTILBARS, /* SCRIPTOP_IFCREWLOST */
+    SCRIPTOP_UNTILBARS, /* SCRIPTOP_IFTRINKETS */
+    SCRIPTOP_UNTILBARS, /* SCRIPTOP_IFTRINKETSLESS */
+    SCRIPTOP_UNTILBARS, /* SCRIPTOP_HIDECOORDINATES */
+    SCRIPTOP_UNTILBARS, /* SCRIPTOP_SHOWCOORDINATES */
+    SCRIPTOP_UNTILBARS, /* SCRIPTOP_HIDESHIP */
+    SCRIPTOP_UNTILBARS, /* SCRIPTOP_SHOWSHIP */
+    SCRIPTOP_UNTILBARS, /* SCRIPTOP_SHOWSECRETLAB */
+    SCRIPTOP_UNTILBARS, /* SCRIPTOP_HIDESECRETLAB */
+    SCRIPTOP_UNTILBARS, /* SCRIPTOP_SHOWTELEPORTERS */
+    SCRIPTOP_UNTILBARS, /* SCRIPTOP_SHOWTARGETS */
+    SCRIPTOP_UNTILBARS, /* SCRIPTOP_SHOWTRINKETS */
+    SCRIPTOP_UNTILBARS, /* SCRIPTOP_HIDETELEPORTERS */
+    SCRIPTOP_UNTILBARS, /* SCRIPTOP_HIDETARGETS */
+    SCRIPTOP_UNTILBARS, /* SCRIPTOP_HIDETRINKETS */
+    SCRIPTOP_UNTILBARS, /* SCRIPTOP_HIDEPLAYER */
+    SCRIPTOP_UNTILBARS, /* SCRIPTOP_SHOWPLAYER */
+    SCRIPTOP_UNTILBARS, /* SCRIPTOP_TELEPORTSCRIPT */
+    SCRIPTOP_UNTILBARS, /* SCRIPTOP_CLEARTELEPORTSCRIPT */
+    SCRIPTOP_UNTILBARS, /* SCRIPTOP_NOCONTROL */
+    SCRIPTOP_UNTILBARS, /* SCRIPTOP_HASCONTROL */
+    SCRIPTOP_UNTILBARS, /* SCRIPTOP_COMPANION */
+    SCRIPTOP_UNTILBARS, /* SCRIPTOP_BEFADEIN */
+    SCRIPTOP_UNTILBARS, /* SCRIPTOP_FADEIN */
+    SCRIPTOP_UNTILBARS, /* SCRIPTOP_FADEOUT */
+    SCRIPTOP_UNTILBARS, /* SCRIPTOP_UNTILFADE */
+    SCRIPTOP_UNTILBARS, /* SCRIPTOP_ENTERSECRETLAB */
+    SCRIPTOP_UNTILBARS, /* SCRIPTOP_LEAVESECRETLAB */
+    SCRIPTOP_UNTILBARS, /* SCRIPTOP_RESETGAME */
+    SCRIPTOP_UNTILBARS, /* SCRIPTOP_LOADSCRIPT */
+    SCRIPTOP_UNTILBARS, /* SCRIPTOP_ROLLCREDITS */
+    SCRIPTOP_UNTILBARS, /* SCRIPTOP_FINALMODE */
+    SCRIPTOP_UNTILBARS, /* SCRIPTOP_RESCUED */
+    SCRIPTOP_UNTILBARS, /* SCRIPTOP_MISSING */
+    SCRIPTOP_UNTILBARS, /* SCRIPTOP_FACE */
+    SCRIPTOP_UNTILBARS, /* SCRIPTOP_JUKEBOX */
+    SCRIPTOP_UNTILBARS, /* SCRIPTOP_CREATEACTIVITYZONE */
+    SCRIPTOP_UNTILBARS, /* SCRIPTOP_SETACTIVITYCOLOUR */
+    SCRIPTOP_UNTILBARS, /* SCRIPTOP_SETACTIVITYTEXT */
+    SCRIPTOP_UNTILBARS, /* SCRIPTOP_CREATERESCUEDCREW */
+    SCRIPTOP_UNTILBARS, /* SCRIPTOP_RESTOREPLAYERCOLOUR */
+    SCRIPTOP_UNTILBARS, /* SCRIPTOP_CHANGEPLAYERCOLOUR */
+    SCRIPTOP_UNTILBARS, /* SCRIPTOP_CHANGERESPAWNCOLOUR */
+    SCRIPTOP_UNTILBARS, /* SCRIPTOP_ALTSTATES */
+    SCRIPTOP_UNTILBARS, /* SCRIPTOP_ACTIVETELEPORTER */
+    SCRIPTOP_UNTILBARS, /* SCRIPTOP_FOUNDTRINKET */
+    SCRIPTOP_UNTILBARS, /* SCRIPTOP_FOUNDLAB */
+    SCRIPTOP_UNTILBARS, /* SCRIPTOP_FOUNDLAB2 */
+    SCRIPTOP_UNTILBARS, /* SCRIPTOP_EVERYBODYSAD */
+    SCRIPTOP_UNTILBARS, /* SCRIPTOP_STARTINTERMISSION2 */
+    SCRIPTOP_UNTILBARS, /* SCRIPTOP_TELESAVE */
+    SCRIPTOP_UNTILBARS, /* SCRIPTOP_CREATELASTRESCUED */
+    SCRIPTOP_UNTILBARS, /* SCRIPTOP_SPECIALLINE */
+    SCRIPTOP_UNTILBARS, /* SCRIPTOP_TRINKETBLUECONTROL */
+    SCRIPTOP_UNTILBARS, /* SCRIPTOP_TRINKETYELLOWCONTROL */
+    SCRIPTOP_UNTILBARS, /* SCRIPTOP_REDCONTROL */
+    SCRIPTOP_GREENCONTROL, /* SCRIPTOP_GREENCONTROL */
+    SCRIPTOP_GREENCONTROL, /* SCRIPTOP_BLUECONTROL */
+    SCRIPTOP_GREENCONTROL, /* SCRIPTOP_YELLOWCONTROL */
+    SCRIPTOP_GREENCONTROL, /* SCRIPTOP_PURPLECONTROL */
+    SCRIPTOP_PREFETCHIMAGE, /* SCRIPTOP_PREFETCHIMAGE */
+};
+
+const builtinscript* findbuiltinscript(const builtinscript* scripts, size_t numscripts, const char* name)
+{
+    size_t lo = 0;
+    size_t hi = numscripts;
 
-    SDL_zeroa(argexists);
+    while (lo < hi)
+    {
+        const size_t mid = lo + (hi - lo) / 2;
+        const int cmp = SDL_strcmp(name, scripts[mid].name);
 
-    for (size_t i = 0; i < t.length(); i++)
+        if (cmp == 0)
+        {
+            return &scripts[mid];
+        }
+        else if (cmp > 0)
+        {
+            lo = mid + 1;
+        }
+        else
+        {
+            hi = mid;
+        }
+    }
+
+    return NULL;
+}
+
+static int findscriptop(const char* name)
+{
+    size_t lo = 0;
+    size_t hi = SDL_arraysize(scriptops);
+
+    while (lo < hi)
     {
-        currentletter = t[i];
-        if (currentletter == '(' || currentletter == ')' || currentletter == ',')
+        const size_t mid = lo + (hi - lo) / 2;
+        const int cmp = SDL_strcmp(name, scriptops[mid].name);
+
+        if (cmp == 0)
         {
-            words[j] = tempword;
-            argexists[j] = words[j] != "";
-            for (size_t ii = 0; ii < words[j].length(); ii++)
+            return scriptops[mid].op;
+        }
+        else if (cmp > 0)
+        {
+            lo = mid + 1;
+        }
+        else
+        {
+            hi = mid;
+        }
+    }
+
+    return SCRIPTOP_NONE;
+}
+
+#ifdef SCRIPT_BENCHMARK
+/* Goes through the names one by one in the order the chain of ifs did */
+static int findscriptopbychain(const std::string& name)
+{
+    static size_t chain[SDL_arraysize(scriptops)];
+    static bool sorted = false;
+    if (!sorted)
+    {
+        //Insertion sort by op, names of the same command stay together
+        for (size_t i = 0; i < SDL_arraysize(scriptops); i++)
+        {
+            size_t k = i;
+            for (; k > 0 && scriptops[chain[k - 1]].op > scriptops[i].op; k--)
             {
-                words[j][ii] = SDL_tolower(words[j][ii]);
+                chain[k] = chain[k - 1];
             }
+            chain[k] = i;
+        }
+        sorted = true;
+    }
+
+    for (size_t i = 0; i < SDL_arraysize(scriptops); i++)
+    {
+        if (name == scriptops[chain[i]].name)
+        {
+            return scriptops[chain[i]].op;
+        }
+    }
+    return SCRIPTOP_NONE;
+}
+#endif
+
+const char* scriptopname(int op)
+{
+    for (size_t i = 0; i < SDL_arraysize(scriptops); i++)
+    {
+        if (scriptops[i].op == op)
+        {
+            return scriptops[i].name;
+        }
+    }
+
+    return NULL;
+}
+
+/* Splits a command up into words, on brackets and commas. Only records
+ * where the words are, so this never allocates. Words that don't get set
+ * (numwords and up) are meant to keep whatever they were before. */
+void tokenizescriptline(const char* t, size_t length, scripttokens& tokens)
+{
+    int j = 0;
+    size_t start = 0;
+    bool nonempty = false;
+    Uint32 hash = scripthash("");
+    Uint32 lowerhash = scripthash("");
+
+    SDL_zeroa(tokens.argexists);
+
+    for (size_t i = 0; i < length; i++)
+    {
+        const char currentletter = t[i];
+        if (currentletter == '(' || currentletter == ')' || currentletter == ',')
+        {
+            scripttoken& token = tokens.words[j];
+            token.start = start;
+            token.end = i;
+            token.lowercase = true;
+            token.hash = lowerhash;
+            tokens.argexists[j] = nonempty;
             j++;
-            tempword = "";
+
+            start = i + 1;
+            nonempty = false;
+            hash = scripthash("");
+            lowerhash = scripthash("");
         }
         else if (currentletter == ' ')
         {
@@ -72,25 +603,164 @@ void scriptclass::tokenize( const std::string& t )
         }
         else
         {
-            tempword += currentletter;
+            nonempty = true;
+            hash = (hash ^ (Uint8) currentletter) * 16777619u;
+            lowerhash = (lowerhash ^ (Uint8) SDL_tolower(currentletter)) * 16777619u;
         }
-        if (j >= (int) SDL_arraysize(words))
+        if (j >= NUM_SCRIPT_ARGS)
         {
             break;
         }
     }
 
-    if (j < (int) SDL_arraysize(words))
+    tokens.j = j;
+    tokens.numwords = j;
+
+    if (j < NUM_SCRIPT_ARGS)
+    {
+        if (nonempty)
+        {
+            scripttoken& token = tokens.words[j];
+            token.start = start;
+            token.end = length;
+            token.lowercase = false;
+            token.hash = hash;
+            tokens.numwords++;
+        }
+        tokens.argexists[j] = nonempty;
+    }
+}
+
+bool scripttokenequals(const char* t, const scripttoken& token, const char* word, const Uint32 hash)
+{
+    if (token.hash != hash)
+    {
+        return false;
+    }
+
+    for (size_t i = token.start; i < token.end; i++)
+    {
+        if (t[i] == ' ')
+        {
+            continue;
+        }
+
+        const char c = token.lowercase ? SDL_tolower(t[i]) : t[i];
+        if (c != *word)
+        {
+            return false;
+        }
+        word++;
+    }
+
+    return *word == '\0';
+}
+
+void scripttokencopy(const char* t, const scripttoken& token, std::string& out)
+{
+    out.clear();
+    for (size_t i = token.start; i < token.end; i++)
     {
-        const bool lastargexists = tempword != "";
-        if (lastargexists)
+        if (t[i] != ' ')
         {
-            words[j] = tempword;
+            out += token.lowercase ? SDL_tolower(t[i]) : t[i];
         }
-        argexists[j] = lastargexists;
     }
 }
 
+/* Fills in words, for code that still works on those */
+void scriptclass::tokenize( const std::string& t )
+{
+    static scripttokens tokens;
+    tokenizescriptline(t.c_str(), t.length(), tokens);
+
+    for (int ii = 0; ii < tokens.numwords; ii++)
+    {
+        scripttokencopy(t.c_str(), tokens.words[ii], words[ii]);
+    }
+    SDL_memcpy(argexists, tokens.argexists, sizeof(argexists));
+    j = tokens.j;
+
+    retokenized = true;
+}
+
+/* Splits up a command exactly like tokenize() would, but keeps the words
+ * in the compiled line instead of putting them in words[]. Words that
+ * tokenize() wouldn't touch aren't stored, so they keep whatever the
+ * previous command left there, same as before. */
+void scriptclass::compileline(const char* t, scriptline& line)
+{
+    static scripttokens tokens;
+    static std::string word;
+
+    tokenizescriptline(t, SDL_strlen(t), tokens);
+
+    line.firstword = compiledwords.size();
+    line.argexists = 0;
+    line.j = tokens.j;
+    line.numwords = tokens.numwords;
+
+    for (int ii = 0; ii < tokens.numwords; ii++)
+    {
+        scripttokencopy(t, tokens.words[ii], word);
+        compiledwords.push_back(scriptwords.intern(word.c_str()));
+        compiledints.push_back(ss_toi(word));
+    }
+    for (int ii = 0; ii < NUM_SCRIPT_ARGS; ii++)
+    {
+        if (tokens.argexists[ii])
+        {
+            line.argexists |= (Uint64) 1 << ii;
+        }
+    }
+
+    line.op = SCRIPTOP_NONE;
+    if (line.numwords > 0)
+    {
+        line.op = findscriptop(compiledwords[line.firstword]);
+    }
+}
+
+void scriptclass::compile(void)
+{
+    compiledlines.resize(commands.size());
+    compiledwords.clear();
+    compiledints.clear();
+    cachedscript = NULL;
+    numlineints = 0;
+
+    //Lines that text() and setactivitytext() read as they are aren't
+    //commands, so their words don't go in the pool. If one does get run as
+    //a command anyway, run() tokenizes it then.
+    int textlines = 0;
+    for (size_t i = 0; i < commands.size(); i++)
+    {
+        scriptline& line = compiledlines[i];
+        if (textlines > 0)
+        {
+            line.op = SCRIPTOP_NONE;
+            line.j = 0;
+            line.argexists = 0;
+            line.firstword = compiledwords.size();
+            line.numwords = -1;
+            textlines--;
+            continue;
+        }
+
+        compileline(commands[i], line);
+        if (line.op == SCRIPTOP_TEXT && line.numwords > 4)
+        {
+            textlines = compiledints[line.firstword + 4];
+        }
+        else if (line.op == SCRIPTOP_SETACTIVITYTEXT)
+        {
+            textlines = 1;
+        }
+    }
+
+    compiled = true;
+}
+
 static int getcolorfromname(std::string name)
 {
     if      (name == "player")     return CYAN;
@@ -125,14 +795,87 @@ void scriptclass::run(void)
         return;
     }
 
+    PROFILE_ZONE("script.run");
+
+    const Uint64 start = SDL_GetPerformanceCounter();
+
+#ifdef SCRIPT_PROFILER
+    profiler.begintick();
+#endif
+
     // This counter here will stop the function when it gets too high
     short execution_counter = 0;
     while(running && scriptdelay<=0 && !game.pausescript)
     {
+        const std::vector<scriptline>* lines = &compiledlines;
+        const std::vector<const char*>* linewords = &compiledwords;
+        const std::vector<int>* lineintsof = &compiledints;
+        if (cachedscript != NULL)
+        {
+            lines = &cachedscript->lines;
+            linewords = &cachedscript->words;
+            lineintsof = &cachedscript->ints;
+        }
+        if (!compiled || lines->size() != commands.size())
+        {
+            compile();
+            lines = &compiledlines;
+            linewords = &compiledwords;
+            lineintsof = &compiledints;
+        }
+
         if (INBOUNDS_VEC(position, commands))
         {
-            //Let's split or command in an array of words
-            tokenize(commands[position]);
+            int op;
+            const scriptline& line = (*lines)[position];
+#ifdef SCRIPT_BENCHMARK
+            if (olddispatch)
+            {
+                tokenize(commands[position]);
+                op = findscriptopbychain(words[0]);
+                numlineints = 0;
+            }
+            else
+#endif
+            if (line.numwords < 0)
+            {
+                //A line of text after all
+                tokenize(commands[position]);
+                op = findscriptop(words[0].c_str());
+                numlineints = 0;
+            }
+            else
+            {
+                //The command was already split into words when it was loaded
+                for (int ii = 0; ii < line.numwords; ii++)
+                {
+                    words[ii] = (*linewords)[line.firstword + ii];
+                }
+                for (int ii = 0; ii < NUM_SCRIPT_ARGS; ii++)
+                {
+                    argexists[ii] = (line.argexists >> ii) & 1;
+                }
+                j = line.j;
+                lineints = lineintsof->empty() ? NULL : &(*lineintsof)[line.firstword];
+                numlineints = line.numwords;
+
+                //An empty command runs whatever is still in words[0]
+                op = line.op;
+                if (line.numwords == 0)
+                {
+                    op = findscriptop(words[0].c_str());
+                }
+            }
+            retokenized = false;
+            runsteps++;
+#ifdef SCRIPT_BENCHMARK
+            benchmarksteps++;
+#endif
+
+#ifdef SCRIPT_PROFILER
+            const Uint64 commandstart = SDL_GetPerformanceCounter();
+            profiler.begincommand(op, commands[position]);
+#endif
 
             //For script assisted input
             game.press_left = false;
@@ -141,26 +884,30 @@ void scriptclass::run(void)
             game.press_map = false;
 
             //Ok, now we run a command based on that string
-            if (words[0] == "moveplayer")
+        redispatch:
+            switch (op)
+            {
+            case SCRIPTOP_MOVEPLAYER:
             {
                 //USAGE: moveplayer(x offset, y offset)
                 int player = obj.getplayer();
                 if (INBOUNDS_VEC(player, obj.entities))
                 {
-                    obj.entities[player].xp += ss_toi(words[1]);
-                    obj.entities[player].yp += ss_toi(words[2]);
+                    obj.entities[player].xp += intarg(1);
+                    obj.entities[player].yp += intarg(2);
                     obj.entities[player].lerpoldxp = obj.entities[player].xp;
                     obj.entities[player].lerpoldyp = obj.entities[player].yp;
                 }
                 scriptdelay = 1;
+                break;
             }
 #if !defined(NO_CUSTOM_LEVELS)
-            if (words[0] == "warpdir")
+            case SCRIPTOP_WARPDIR:
             {
-                int temprx=ss_toi(words[1])-1;
-                int tempry=ss_toi(words[2])-1;
+                int temprx=intarg(1)-1;
+                int tempry=intarg(2)-1;
                 const RoomProperty* room;
-                cl.setroomwarpdir(temprx, tempry, ss_toi(words[3]));
+                cl.setroomwarpdir(temprx, tempry, intarg(3));
 
                 room = cl.getroomprop(temprx, tempry);
 
@@ -194,18 +941,20 @@ void scriptclass::run(void)
                         graphics.rcol = cl.getwarpbackground(temprx,tempry);
                     }
                 }
+                break;
             }
-            if (words[0] == "ifwarp")
+            case SCRIPTOP_IFWARP:
             {
-                const RoomProperty* const room = cl.getroomprop(ss_toi(words[1])-1, ss_toi(words[2])-1);
-                if (room->warpdir == ss_toi(words[3]))
+                const RoomProperty* const room = cl.getroomprop(intarg(1)-1, intarg(2)-1);
+                if (room->warpdir == intarg(3))
                 {
                     load("custom_"+words[4]);
                     position--;
                 }
+                break;
             }
 #endif
-            if (words[0] == "destroy")
+            case SCRIPTOP_DESTROY:
             {
                 if(words[1]=="gravitylines"){
                     for(size_t edi=0; edi<obj.entities.size(); edi++){
@@ -228,48 +977,54 @@ void scriptclass::run(void)
                         if(obj.entities[edi].type==2 && obj.entities[edi].rule==3) obj.disableentity(edi);
                     }
                 }
+                break;
             }
-            if (words[0] == "customiftrinkets")
+            case SCRIPTOP_CUSTOMIFTRINKETS:
             {
-                if (game.trinkets() >= ss_toi(words[1]))
+                if (game.trinkets() >= intarg(1))
                 {
                     load("custom_"+words[2]);
                     position--;
                 }
+                break;
             }
-            if (words[0] == "customiftrinketsless")
+            case SCRIPTOP_CUSTOMIFTRINKETSLESS:
             {
-                if (game.trinkets() < ss_toi(words[1]))
+                if (game.trinkets() < intarg(1))
                 {
                     load("custom_"+words[2]);
                     position--;
                 }
+                break;
             }
-            else if (words[0] == "customifflag")
+            case SCRIPTOP_CUSTOMIFFLAG:
             {
-                int flag = ss_toi(words[1]);
+                int flag = intarg(1);
                 if (INBOUNDS_ARR(flag, obj.flags) && obj.flags[flag])
                 {
                     load("custom_"+words[2]);
                     position--;
                 }
+                break;
             }
-            if (words[0] == "custommap")
+            case SCRIPTOP_CUSTOMMAP:
             {
                 if(words[1]=="on"){
                     map.customshowmm=true;
                 }else if(words[1]=="off"){
                     map.customshowmm=false;
                 }
+                break;
             }
-            if (words[0] == "delay")
+            case SCRIPTOP_DELAY:
             {
                 //USAGE: delay(frames)
-                scriptdelay = ss_toi(words[1]);
+                scriptdelay = intarg(1);
+                break;
             }
-            if (words[0] == "flag")
+            case SCRIPTOP_FLAG:
             {
-                int flag = ss_toi(words[1]);
+                int flag = intarg(1);
                 if (INBOUNDS_ARR(flag, obj.flags))
                 {
                     if (words[2] == "on")
@@ -281,18 +1036,21 @@ void scriptclass::run(void)
                         obj.flags[flag] = false;
                     }
                 }
+                break;
             }
-            if (words[0] == "flash")
+            case SCRIPTOP_FLASH:
             {
                 //USAGE: flash(frames)
-                game.flashlight = ss_toi(words[1]);
+                game.flashlight = intarg(1);
+                break;
             }
-            if (words[0] == "shake")
+            case SCRIPTOP_SHAKE:
             {
                 //USAGE: shake(frames)
-                game.screenshake = ss_toi(words[1]);
+                game.screenshake = intarg(1);
+                break;
             }
-            if (words[0] == "walk")
+            case SCRIPTOP_WALK:
             {
                 //USAGE: walk(dir,frames)
                 if (words[1] == "left")
@@ -303,14 +1061,16 @@ void scriptclass::run(void)
                 {
                     game.press_right = true;
                 }
-                scriptdelay = ss_toi(words[2]);
+                scriptdelay = intarg(2);
+                break;
             }
-            if (words[0] == "flip")
+            case SCRIPTOP_FLIP:
             {
                 game.press_action = true;
                 scriptdelay = 1;
+                break;
             }
-            if (words[0] == "tofloor")
+            case SCRIPTOP_TOFLOOR:
             {
                 int player = obj.getplayer();
                 if(INBOUNDS_VEC(player, obj.entities) && obj.entities[player].onroof>0)
@@ -318,63 +1078,75 @@ void scriptclass::run(void)
                     game.press_action = true;
                     scriptdelay = 1;
                 }
+                break;
             }
-            if (words[0] == "playef")
+            case SCRIPTOP_PLAYEF:
             {
-                music.playef(ss_toi(words[1]));
+                music.playef(intarg(1));
+                break;
             }
-            if (words[0] == "play")
+            case SCRIPTOP_PLAY:
             {
-                music.play(ss_toi(words[1]));
+                music.play(intarg(1));
+                break;
             }
-            if (words[0] == "stopmusic")
+            case SCRIPTOP_STOPMUSIC:
             {
                 music.haltdasmusik();
+                break;
             }
-            if (words[0] == "resumemusic")
+            case SCRIPTOP_RESUMEMUSIC:
             {
                 music.resumefade(0);
+                break;
             }
-            if (words[0] == "musicfadeout")
+            case SCRIPTOP_MUSICFADEOUT:
             {
                 music.fadeout(false);
+                break;
             }
-            if (words[0] == "musicfadein")
+            case SCRIPTOP_MUSICFADEIN:
             {
                 music.fadein();
+                break;
             }
-            if (words[0] == "trinketscriptmusic")
+            case SCRIPTOP_TRINKETSCRIPTMUSIC:
             {
                 music.play(4);
+                break;
             }
-            if (words[0] == "gotoposition")
+            case SCRIPTOP_GOTOPOSITION:
             {
                 //USAGE: gotoposition(x position, y position, gravity position)
                 int player = obj.getplayer();
                 if (INBOUNDS_VEC(player, obj.entities))
                 {
-                    obj.entities[player].xp = ss_toi(words[1]);
-                    obj.entities[player].yp = ss_toi(words[2]);
+                    obj.entities[player].xp = intarg(1);
+                    obj.entities[player].yp = intarg(2);
                     obj.entities[player].lerpoldxp = obj.entities[player].xp;
                     obj.entities[player].lerpoldyp = obj.entities[player].yp;
                 }
-                game.gravitycontrol = ss_toi(words[3]);
+                game.gravitycontrol = intarg(3);
 
+                break;
             }
-            if (words[0] == "gotoroom")
+            case SCRIPTOP_GOTOROOM:
             {
                 //USAGE: gotoroom(x,y) (manually add 100)
-                map.gotoroom(ss_toi(words[1])+100, ss_toi(words[2])+100);
+                map.gotoroom(intarg(1)+100, intarg(2)+100);
+                break;
             }
-            if (words[0] == "cutscene")
+            case SCRIPTOP_CUTSCENE:
             {
                 graphics.showcutscenebars = true;
+                break;
             }
-            if (words[0] == "endcutscene")
+            case SCRIPTOP_ENDCUTSCENE:
             {
                 graphics.showcutscenebars = false;
+                break;
             }
-            if (words[0] == "audiopause")
+            case SCRIPTOP_AUDIOPAUSE:
             {
                 if (words[1] == "on")
                 {
@@ -384,8 +1156,9 @@ void scriptclass::run(void)
                 {
                     game.disabletemporaryaudiopause = true;
                 }
+                break;
             }
-            if (words[0] == "untilbars")
+            case SCRIPTOP_UNTILBARS:
             {
                 if (graphics.showcutscenebars)
                 {
@@ -403,8 +1176,9 @@ void scriptclass::run(void)
                         position--;
                     }
                 }
+                break;
             }
-            else if (words[0] == "text")
+            case SCRIPTOP_TEXT:
             {
                 //oh boy
                 //first word is the colour.
@@ -477,12 +1251,12 @@ void scriptclass::run(void)
                 }
 
                 //next are the x,y coordinates
-                textx = ss_toi(words[2]);
-                texty = ss_toi(words[3]);
+                textx = intarg(2);
+                texty = intarg(3);
 
                 //Number of lines for the textbox!
                 txt.clear();
-                for (int i = 0; i < ss_toi(words[4]); i++)
+                for (int i = 0; i < intarg(4); i++)
                 {
                     position++;
                     if (INBOUNDS_VEC(position, commands))
@@ -490,8 +1264,9 @@ void scriptclass::run(void)
                         txt.push_back(commands[position]);
                     }
                 }
+                break;
             }
-            else if (words[0] == "position")
+            case SCRIPTOP_POSITION:
             {
                 //are we facing left or right? for some objects we don't care, default at 0.
                 j = 0;
@@ -552,8 +1327,9 @@ void scriptclass::run(void)
                         texty = obj.entities[i].yp + 26;
                     }
                 }
+                break;
             }
-            else if (words[0] == "customposition")
+            case SCRIPTOP_CUSTOMPOSITION:
             {
                 //are we facing left or right? for some objects we don't care, default at 0.
                 j = 0;
@@ -649,16 +1425,19 @@ void scriptclass::run(void)
                         texty = obj.entities[i].yp + 26;
                     }
                 }
+                break;
             }
-            else if (words[0] == "backgroundtext")
+            case SCRIPTOP_BACKGROUNDTEXT:
             {
                 game.backgroundtext = true;
+                break;
             }
-            else if (words[0] == "flipme")
+            case SCRIPTOP_FLIPME:
             {
                 textflipme = !textflipme;
+                break;
             }
-            else if (words[0] == "speak_active" || words[0] == "speak")
+            case SCRIPTOP_SPEAK_ACTIVE:
             {
                 //Ok, actually display the textbox we've initilised now!
                 //If using "speak", don't make the textbox active (so we can use multiple textboxes)
@@ -711,26 +1490,30 @@ void scriptclass::run(void)
                         || key.isDown(KEYBOARD_UP) || key.isDown(KEYBOARD_DOWN)) game.jumpheld = true;
                 }
                 game.backgroundtext = false;
+                break;
             }
-            else if (words[0] == "endtext")
+            case SCRIPTOP_ENDTEXT:
             {
                 graphics.textboxremove();
                 game.hascontrol = true;
                 game.advancetext = false;
+                break;
             }
-            else if (words[0] == "endtextfast")
+            case SCRIPTOP_ENDTEXTFAST:
             {
                 graphics.textboxremovefast();
                 game.hascontrol = true;
                 game.advancetext = false;
+                break;
             }
-            else if (words[0] == "do")
+            case SCRIPTOP_DO:
             {
                 //right, loop from this point
                 looppoint = position;
-                loopcount = ss_toi(words[1]);
+                loopcount = intarg(1);
+                break;
             }
-            else if (words[0] == "loop")
+            case SCRIPTOP_LOOP:
             {
                 //right, loop from this point
                 loopcount--;
@@ -738,8 +1521,9 @@ void scriptclass::run(void)
                 {
                     position = looppoint;
                 }
+                break;
             }
-            else if (words[0] == "vvvvvvman")
+            case SCRIPTOP_VVVVVVMAN:
             {
                 //Create the super VVVVVV combo!
                 i = obj.getplayer();
@@ -753,8 +1537,9 @@ void scriptclass::run(void)
                     obj.entities[i].cy = 12+80;// 2;
                     obj.entities[i].h = 126-80;// 21;
                 }
+                break;
             }
-            else if (words[0] == "undovvvvvvman")
+            case SCRIPTOP_UNDOVVVVVVMAN:
             {
                 //Create the super VVVVVV combo!
                 i = obj.getplayer();
@@ -767,8 +1552,9 @@ void scriptclass::run(void)
                     obj.entities[i].cy = 2;
                     obj.entities[i].h = 21;
                 }
+                break;
             }
-            else if (words[0] == "createentity")
+            case SCRIPTOP_CREATEENTITY:
             {
                 std::string word6 = words[6];
                 std::string word7 = words[7];
@@ -793,8 +1579,9 @@ void scriptclass::run(void)
                 words[7] = word7;
                 words[8] = word8;
                 words[9] = word9;
+                break;
             }
-            else if (words[0] == "createcrewman")
+            case SCRIPTOP_CREATECREWMAN:
             {
                 // Note: Do not change the "r" variable, it's used in custom levels
                 // to have glitchy textbox colors, where the game treats the value
@@ -840,13 +1627,14 @@ void scriptclass::run(void)
                 {
                     obj.createentity(ss_toi(words[1]), ss_toi(words[2]), 18, r, ss_toi(words[4]), ss_toi(words[5]));
                 }
+                break;
             }
-            else if (words[0] == "changemood")
+            case SCRIPTOP_CHANGEMOOD:
             {
                 int crewmate = getcrewmanfromname(words[1]);
                 if (crewmate != -1) i = crewmate; // Ensure AEM is kept
 
-                if (INBOUNDS_VEC(i, obj.entities) && ss_toi(words[2]) == 0)
+                if (INBOUNDS_VEC(i, obj.entities) && intarg(2) == 0)
                 {
                     obj.entities[i].tile = 0;
                 }
@@ -854,56 +1642,57 @@ void scriptclass::run(void)
                 {
                     obj.entities[i].tile = 144;
                 }
+                break;
             }
-            else if (words[0] == "changecustommood")
+            case SCRIPTOP_CHANGECUSTOMMOOD:
             {
                 if (words[1] == "player")
                 {
                     i=obj.getcustomcrewman(0);
-                    obj.customcrewmoods[0]=ss_toi(words[2]);
+                    obj.customcrewmoods[0]=intarg(2);
                 }
                 else if (words[1] == "cyan")
                 {
                     i=obj.getcustomcrewman(0);
-                    obj.customcrewmoods[0]=ss_toi(words[2]);
+                    obj.customcrewmoods[0]=intarg(2);
                 }
                 else if (words[1] == "customcyan")
                 {
                     i=obj.getcustomcrewman(0);
-                    obj.customcrewmoods[0]=ss_toi(words[2]);
+                    obj.customcrewmoods[0]=intarg(2);
                 }
                 else if (words[1] == "red")
                 {
                     i=obj.getcustomcrewman(3);
-                    obj.customcrewmoods[3]=ss_toi(words[2]);
+                    obj.customcrewmoods[3]=intarg(2);
                 }
                 else if (words[1] == "green")
                 {
                     i=obj.getcustomcrewman(4);
-                    obj.customcrewmoods[4]=ss_toi(words[2]);
+                    obj.customcrewmoods[4]=intarg(2);
                 }
                 else if (words[1] == "yellow")
                 {
                     i=obj.getcustomcrewman(2);
-                    obj.customcrewmoods[2]=ss_toi(words[2]);
+                    obj.customcrewmoods[2]=intarg(2);
                 }
                 else if (words[1] == "blue")
                 {
                     i=obj.getcustomcrewman(5);
-                    obj.customcrewmoods[5]=ss_toi(words[2]);
+                    obj.customcrewmoods[5]=intarg(2);
                 }
                 else if (words[1] == "purple")
                 {
                     i=obj.getcustomcrewman(1);
-                    obj.customcrewmoods[1]=ss_toi(words[2]);
+                    obj.customcrewmoods[1]=intarg(2);
                 }
                 else if (words[1] == "pink")
                 {
                     i=obj.getcustomcrewman(1);
-                    obj.customcrewmoods[1]=ss_toi(words[2]);
+                    obj.customcrewmoods[1]=intarg(2);
                 }
 
-                if (INBOUNDS_VEC(i, obj.entities) && ss_toi(words[2]) == 0)
+                if (INBOUNDS_VEC(i, obj.entities) && intarg(2) == 0)
                 {
                     obj.entities[i].tile = 0;
                 }
@@ -911,18 +1700,20 @@ void scriptclass::run(void)
                 {
                     obj.entities[i].tile = 144;
                 }
+                break;
             }
-            else if (words[0] == "changetile")
+            case SCRIPTOP_CHANGETILE:
             {
                 int crewmate = getcrewmanfromname(words[1]);
                 if (crewmate != -1) i = crewmate; // Ensure AEM is kept
 
                 if (INBOUNDS_VEC(i, obj.entities))
                 {
-                    obj.entities[i].tile = ss_toi(words[2]);
+                    obj.entities[i].tile = intarg(2);
                 }
+                break;
             }
-            else if (words[0] == "flipgravity")
+            case SCRIPTOP_FLIPGRAVITY:
             {
                 //not something I'll use a lot, I think. Doesn't need to be very robust!
                 if (words[1] == "player")
@@ -946,8 +1737,9 @@ void scriptclass::run(void)
                         obj.entities[i].tile = 6;
                     }
                 }
+                break;
             }
-            else if (words[0] == "changegravity")
+            case SCRIPTOP_CHANGEGRAVITY:
             {
                 //not something I'll use a lot, I think. Doesn't need to be very robust!
                 int crewmate = getcrewmanfromname(words[1]);
@@ -957,13 +1749,14 @@ void scriptclass::run(void)
                 {
                     obj.entities[i].tile +=12;
                 }
+                break;
             }
-            else if (words[0] == "changedir")
+            case SCRIPTOP_CHANGEDIR:
             {
                 int crewmate = getcrewmanfromname(words[1]);
                 if (crewmate != -1) i = crewmate; // Ensure AEM is kept
 
-                if (INBOUNDS_VEC(i, obj.entities) && ss_toi(words[2]) == 0)
+                if (INBOUNDS_VEC(i, obj.entities) && intarg(2) == 0)
                 {
                     obj.entities[i].dir = 0;
                 }
@@ -971,17 +1764,20 @@ void scriptclass::run(void)
                 {
                     obj.entities[i].dir = 1;
                 }
+                break;
             }
-            else if (words[0] == "alarmon")
+            case SCRIPTOP_ALARMON:
             {
                 game.alarmon = true;
                 game.alarmdelay = 0;
+                break;
             }
-            else if (words[0] == "alarmoff")
+            case SCRIPTOP_ALARMOFF:
             {
                 game.alarmon = false;
+                break;
             }
-            else if (words[0] == "changeai")
+            case SCRIPTOP_CHANGEAI:
             {
                 int crewmate = getcrewmanfromname(words[1]);
                 if (crewmate != -1) i = crewmate; // Ensure AEM is kept
@@ -1018,8 +1814,9 @@ void scriptclass::run(void)
                         obj.entities[i].dir=ss_toi(words[3]);
                     }
                 }
+                break;
             }
-            else if (words[0] == "activateteleporter")
+            case SCRIPTOP_ACTIVATETELEPORTER:
             {
                 i = obj.getteleporter();
                 if (INBOUNDS_VEC(i, obj.entities))
@@ -1027,8 +1824,9 @@ void scriptclass::run(void)
                     obj.entities[i].tile = 6;
                     obj.entities[i].colour = 102;
                 }
+                break;
             }
-            else if (words[0] == "changecolour")
+            case SCRIPTOP_CHANGECOLOUR:
             {
                 int crewmate = getcrewmanfromname(words[1]);
                 if (crewmate != -1) i = crewmate; // Ensure AEM is kept
@@ -1037,8 +1835,9 @@ void scriptclass::run(void)
                 {
                     obj.entities[i].colour = getcolorfromname(words[2]);
                 }
+                break;
             }
-            else if (words[0] == "squeak")
+            case SCRIPTOP_SQUEAK:
             {
                 if (words[1] == "player")
                 {
@@ -1076,16 +1875,19 @@ void scriptclass::run(void)
                 {
                     music.playef(20);
                 }
+                break;
             }
-            else if (words[0] == "blackout")
+            case SCRIPTOP_BLACKOUT:
             {
                 game.blackout = true;
+                break;
             }
-            else if (words[0] == "blackon")
+            case SCRIPTOP_BLACKON:
             {
                 game.blackout = false;
+                break;
             }
-            else if (words[0] == "setcheckpoint")
+            case SCRIPTOP_SETCHECKPOINT:
             {
                 i = obj.getplayer();
                 game.savepoint = 0;
@@ -1101,17 +1903,20 @@ void scriptclass::run(void)
                 {
                     game.savedir = obj.entities[i].dir;
                 }
+                break;
             }
-            else if (words[0] == "gamestate")
+            case SCRIPTOP_GAMESTATE:
             {
-                game.state = ss_toi(words[1]);
+                game.state = intarg(1);
                 game.statedelay = 0;
+                break;
             }
-            else if (words[0] == "textboxactive")
+            case SCRIPTOP_TEXTBOXACTIVE:
             {
                 graphics.textboxactive();
+                break;
             }
-            else if (words[0] == "gamemode")
+            case SCRIPTOP_GAMEMODE:
             {
                 if (words[1] == "teleporter")
                 {
@@ -1125,82 +1930,94 @@ void scriptclass::run(void)
                     graphics.resumegamemode = true;
                     game.prevgamestate = GAMEMODE;
                 }
+                break;
             }
-            else if (words[0] == "ifexplored")
+            case SCRIPTOP_IFEXPLORED:
             {
-                if (map.isexplored(ss_toi(words[1]), ss_toi(words[2])))
+                if (map.isexplored(intarg(1), intarg(2)))
                 {
                     load(words[3]);
                     position--;
                 }
+                break;
             }
-            else if (words[0] == "iflast")
+            case SCRIPTOP_IFLAST:
             {
-                if (game.lastsaved==ss_toi(words[1]))
+                if (game.lastsaved==intarg(1))
                 {
                     load(words[2]);
                     position--;
                 }
+                break;
             }
-            else if (words[0] == "ifskip")
+            case SCRIPTOP_IFSKIP:
             {
                 if (game.nocutscenes)
                 {
                     load(words[1]);
                     position--;
                 }
+                break;
             }
-            else if (words[0] == "ifflag")
+            case SCRIPTOP_IFFLAG:
             {
-                int flag = ss_toi(words[1]);
+                int flag = intarg(1);
                 if (INBOUNDS_ARR(flag, obj.flags) && obj.flags[flag])
                 {
                     load(words[2]);
                     position--;
                 }
+                break;
             }
-            else if (words[0] == "ifcrewlost")
+            case SCRIPTOP_IFCREWLOST:
             {
-                int crewmate = ss_toi(words[1]);
+                int crewmate = intarg(1);
                 if (INBOUNDS_ARR(crewmate, game.crewstats) && !game.crewstats[crewmate])
                 {
                     load(words[2]);
                     position--;
                 }
+                break;
             }
-            else if (words[0] == "iftrinkets")
+            case SCRIPTOP_IFTRINKETS:
             {
-                if (game.trinkets() >= ss_toi(words[1]))
+                if (game.trinkets() >= intarg(1))
                 {
                     load(words[2]);
                     position--;
                 }
+                break;
             }
-            else if (words[0] == "iftrinketsless")
+            case SCRIPTOP_IFTRINKETSLESS:
             {
-                if (game.stat_trinkets < ss_toi(words[1]))
+                if (game.stat_trinkets < intarg(1))
                 {
                     load(words[2]);
                     position--;
                 }
+                break;
             }
-            else if (words[0] == "hidecoordinates")
+            case SCRIPTOP_HIDECOORDINATES:
             {
-                map.setexplored(ss_toi(words[1]), ss_toi(words[2]), false);
+                map.setexplored(intarg(1), intarg(2), false);
+                break;
             }
-            else if (words[0] == "showcoordinates")
+            case SCRIPTOP_SHOWCOORDINATES:
             {
-                map.setexplored(ss_toi(words[1]), ss_toi(words[2]), true);
+                map.setexplored(intarg(1), intarg(2), true);
+                break;
             }
-            else if (words[0] == "hideship")
+            case SCRIPTOP_HIDESHIP:
             {
                 map.hideship();
+                break;
             }
-            else if (words[0] == "showship")
+            case SCRIPTOP_SHOWSHIP:
             {
                 map.showship();
+                break;
             }
-            else if (words[0] == "showsecretlab")
+            case SCRIPTOP_SHOWSECRETLAB:
             {
                 map.setexplored(16, 5, true);
                 map.setexplored(17, 5, true);
@@ -1210,8 +2027,9 @@ void scriptclass::run(void)
                 map.setexplored(19, 6, true);
                 map.setexplored(19, 7, true);
                 map.setexplored(19, 8, true);
+                break;
             }
-            else if (words[0] == "hidesecretlab")
+            case SCRIPTOP_HIDESECRETLAB:
             {
                 map.setexplored(16, 5, false);
                 map.setexplored(17, 5, false);
@@ -1221,99 +2039,119 @@ void scriptclass::run(void)
                 map.setexplored(19, 6, false);
                 map.setexplored(19, 7, false);
                 map.setexplored(19, 8, false);
+                break;
             }
-            else if (words[0] == "showteleporters")
+            case SCRIPTOP_SHOWTELEPORTERS:
             {
                 map.showteleporters = true;
+                break;
             }
-            else if (words[0] == "showtargets")
+            case SCRIPTOP_SHOWTARGETS:
             {
                 map.showtargets = true;
+                break;
             }
-            else if (words[0] == "showtrinkets")
+            case SCRIPTOP_SHOWTRINKETS:
             {
                 map.showtrinkets = true;
+                break;
             }
-            else if (words[0] == "hideteleporters")
+            case SCRIPTOP_HIDETELEPORTERS:
             {
                 map.showteleporters = false;
+                break;
             }
-            else if (words[0] == "hidetargets")
+            case SCRIPTOP_HIDETARGETS:
             {
                 map.showtargets = false;
+                break;
             }
-            else if (words[0] == "hidetrinkets")
+            case SCRIPTOP_HIDETRINKETS:
             {
                 map.showtrinkets = false;
+                break;
             }
-            else if (words[0] == "hideplayer")
+            case SCRIPTOP_HIDEPLAYER:
             {
                 int player = obj.getplayer();
                 if (INBOUNDS_VEC(player, obj.entities))
                 {
                     obj.entities[player].invis = true;
                 }
+                break;
             }
-            else if (words[0] == "showplayer")
+            case SCRIPTOP_SHOWPLAYER:
             {
                 int player = obj.getplayer();
                 if (INBOUNDS_VEC(player, obj.entities))
                 {
                     obj.entities[player].invis = false;
                 }
+                break;
             }
-            else if (words[0] == "teleportscript")
+            case SCRIPTOP_TELEPORTSCRIPT:
             {
                 game.teleportscript = words[1];
+                break;
             }
-            else if (words[0] == "clearteleportscript")
+            case SCRIPTOP_CLEARTELEPORTSCRIPT:
             {
                 game.teleportscript = "";
+                break;
             }
-            else if (words[0] == "nocontrol")
+            case SCRIPTOP_NOCONTROL:
             {
                 game.hascontrol = false;
+                break;
             }
-            else if (words[0] == "hascontrol")
+            case SCRIPTOP_HASCONTROL:
             {
                 game.hascontrol = true;
+                break;
             }
-            else if (words[0] == "companion")
+            case SCRIPTOP_COMPANION:
             {
-                game.companion = ss_toi(words[1]);
+                game.companion = intarg(1);
+                break;
             }
-            else if (words[0] == "befadein")
+            case SCRIPTOP_BEFADEIN:
             {
                 graphics.setfade(0);
                 graphics.fademode= 0;
+                break;
             }
-            else if (words[0] == "fadein")
+            case SCRIPTOP_FADEIN:
             {
                 graphics.fademode = 4;
+                break;
             }
-            else if (words[0] == "fadeout")
+            case SCRIPTOP_FADEOUT:
             {
                 graphics.fademode = 2;
+                break;
             }
-            else if (words[0] == "untilfade")
+            case SCRIPTOP_UNTILFADE:
             {
                 if (graphics.fademode>1)
                 {
                     scriptdelay = 1;
                     position--;
                 }
+                break;
             }
-            else if (words[0] == "entersecretlab")
+            case SCRIPTOP_ENTERSECRETLAB:
             {
                 game.unlocknum(8);
                 game.insecretlab = true;
                 SDL_memset(map.explored, true, sizeof(map.explored));
+                break;
             }
-            else if (words[0] == "leavesecretlab")
+            case SCRIPTOP_LEAVESECRETLAB:
             {
                 game.insecretlab = false;
+                break;
             }
-            else if (words[0] == "resetgame")
+            case SCRIPTOP_RESETGAME:
             {
                 map.resetnames();
                 map.resetmap();
@@ -1351,13 +2189,15 @@ void scriptclass::run(void)
                 map.final_mapcol = 0;
                 map.final_colorframe = 0;
                 map.finalstretch = false;
+                break;
             }
-            else if (words[0] == "loadscript")
+            case SCRIPTOP_LOADSCRIPT:
             {
                 load(words[1]);
                 position--;
+                break;
             }
-            else if (words[0] == "rollcredits")
+            case SCRIPTOP_ROLLCREDITS:
             {
 #if !defined(NO_CUSTOM_LEVELS) && !defined(NO_EDITOR)
                 if (map.custommode && !map.custommodeforreal)
@@ -1373,13 +2213,15 @@ void scriptclass::run(void)
                     graphics.fademode = 4;
                     game.creditposition = 0;
                 }
+                break;
             }
-            else if (words[0] == "finalmode")
+            case SCRIPTOP_FINALMODE:
             {
                 map.finalmode = true;
-                map.gotoroom(ss_toi(words[1]), ss_toi(words[2]));
+                map.gotoroom(intarg(1), intarg(2));
+                break;
             }
-            else if (words[0] == "rescued")
+            case SCRIPTOP_RESCUED:
             {
                 if (words[1] == "red")
                 {
@@ -1409,8 +2251,9 @@ void scriptclass::run(void)
                 {
                     game.crewstats[0] = true;
                 }
+                break;
             }
-            else if (words[0] == "missing")
+            case SCRIPTOP_MISSING:
             {
                 if (words[1] == "red")
                 {
@@ -1440,8 +2283,9 @@ void scriptclass::run(void)
                 {
                     game.crewstats[0] = false;
                 }
+                break;
             }
-            else if (words[0] == "face")
+            case SCRIPTOP_FACE:
             {
                 int crewmate = getcrewmanfromname(words[1]);
                 if (crewmate != -1) i = crewmate; // Ensure AEM is kept
@@ -1457,8 +2301,9 @@ void scriptclass::run(void)
                 {
                     obj.entities[i].dir = 0;
                 }
+                break;
             }
-            else if (words[0] == "jukebox")
+            case SCRIPTOP_JUKEBOX:
             {
                 for (j = 0; j < (int) obj.entities.size(); j++)
                 {
@@ -1467,7 +2312,7 @@ void scriptclass::run(void)
                         obj.entities[j].colour = 4;
                     }
                 }
-                if (ss_toi(words[1]) == 1)
+                if (intarg(1) == 1)
                 {
                     obj.createblock(5, 88 - 4, 80, 20, 16, 25);
                     for (j = 0; j < (int) obj.entities.size(); j++)
@@ -1478,7 +2323,7 @@ void scriptclass::run(void)
                         }
                     }
                 }
-                else if (ss_toi(words[1]) == 2)
+                else if (intarg(1) == 2)
                 {
                     obj.createblock(5, 128 - 4, 80, 20, 16, 26);
                     for (j = 0; j < (int) obj.entities.size(); j++)
@@ -1489,7 +2334,7 @@ void scriptclass::run(void)
                         }
                     }
                 }
-                else if (ss_toi(words[1]) == 3)
+                else if (intarg(1) == 3)
                 {
                     obj.createblock(5, 176 - 4, 80, 20, 16, 27);
                     for (j = 0; j < (int) obj.entities.size(); j++)
@@ -1500,7 +2345,7 @@ void scriptclass::run(void)
                         }
                     }
                 }
-                else if (ss_toi(words[1]) == 4)
+                else if (intarg(1) == 4)
                 {
                     obj.createblock(5, 216 - 4, 80, 20, 16, 28);
                     for (j = 0; j < (int) obj.entities.size(); j++)
@@ -1511,7 +2356,7 @@ void scriptclass::run(void)
                         }
                     }
                 }
-                else if (ss_toi(words[1]) == 5)
+                else if (intarg(1) == 5)
                 {
                     obj.createblock(5, 88 - 4, 128, 20, 16, 29);
                     for (j = 0; j < (int) obj.entities.size(); j++)
@@ -1522,7 +2367,7 @@ void scriptclass::run(void)
                         }
                     }
                 }
-                else if (ss_toi(words[1]) == 6)
+                else if (intarg(1) == 6)
                 {
                     obj.createblock(5, 176 - 4, 128, 20, 16, 30);
                     for (j = 0; j < (int) obj.entities.size(); j++)
@@ -1533,7 +2378,7 @@ void scriptclass::run(void)
                         }
                     }
                 }
-                else if (ss_toi(words[1]) == 7)
+                else if (intarg(1) == 7)
                 {
                     obj.createblock(5, 40 - 4, 40, 20, 16, 31);
                     for (j = 0; j < (int) obj.entities.size(); j++)
@@ -1544,7 +2389,7 @@ void scriptclass::run(void)
                         }
                     }
                 }
-                else if (ss_toi(words[1]) == 8)
+                else if (intarg(1) == 8)
                 {
                     obj.createblock(5, 216 - 4, 128, 20, 16, 32);
                     for (j = 0; j < (int) obj.entities.size(); j++)
@@ -1555,7 +2400,7 @@ void scriptclass::run(void)
                         }
                     }
                 }
-                else if (ss_toi(words[1]) == 9)
+                else if (intarg(1) == 9)
                 {
                     obj.createblock(5, 128 - 4, 128, 20, 16, 33);
                     for (j = 0; j < (int) obj.entities.size(); j++)
@@ -1566,7 +2411,7 @@ void scriptclass::run(void)
                         }
                     }
                 }
-                else if (ss_toi(words[1]) == 10)
+                else if (intarg(1) == 10)
                 {
                     obj.createblock(5, 264 - 4, 40, 20, 16, 34);
                     for (j = 0; j < (int) obj.entities.size(); j++)
@@ -1577,8 +2422,9 @@ void scriptclass::run(void)
                         }
                     }
                 }
+                break;
             }
-            else if (words[0] == "createactivityzone")
+            case SCRIPTOP_CREATEACTIVITYZONE:
             {
                 int crew_color = i; // stay consistent with past behavior!
                 if (words[1] == "red")
@@ -1616,20 +2462,23 @@ void scriptclass::run(void)
                 {
                     obj.createblock(5, obj.entities[crewman].xp - 32, 0, 96, 240, i, "", (i == 35));
                 }
+                break;
             }
-            else if (words[0] == "setactivitycolour")
+            case SCRIPTOP_SETACTIVITYCOLOUR:
             {
                 obj.customactivitycolour = words[1];
+                break;
             }
-            else if (words[0] == "setactivitytext")
+            case SCRIPTOP_SETACTIVITYTEXT:
             {
                 ++position;
                 if (INBOUNDS_VEC(position, commands))
                 {
                     obj.customactivitytext = commands[position];
                 }
+                break;
             }
-            else if (words[0] == "createrescuedcrew")
+            case SCRIPTOP_CREATERESCUEDCREW:
             {
                 //special for final level cutscene
                 //starting at 180, create the rescued crewmembers (ingoring violet, who's at 155)
@@ -1654,16 +2503,18 @@ void scriptclass::run(void)
                     obj.createentity(i, 153, 18, 16, 0, 17, 0);
                     i += 25;
                 }
+                break;
             }
-            else if (words[0] == "restoreplayercolour")
+            case SCRIPTOP_RESTOREPLAYERCOLOUR:
             {
                 i = obj.getplayer();
                 if (INBOUNDS_VEC(i, obj.entities))
                 {
                     obj.entities[i].colour = 0;
                 }
+                break;
             }
-            else if (words[0] == "changeplayercolour")
+            case SCRIPTOP_CHANGEPLAYERCOLOUR:
             {
                 i = obj.getplayer();
 
@@ -1671,29 +2522,33 @@ void scriptclass::run(void)
                 {
                     obj.entities[i].colour = getcolorfromname(words[1]);
                 }
+                break;
             }
-            else if (words[0] == "changerespawncolour")
+            case SCRIPTOP_CHANGERESPAWNCOLOUR:
             {
                 game.savecolour = getcolorfromname(words[1]);
+                break;
             }
-            else if (words[0] == "altstates")
+            case SCRIPTOP_ALTSTATES:
             {
-                obj.altstates = ss_toi(words[1]);
+                obj.altstates = intarg(1);
+                break;
             }
-            else if (words[0] == "activeteleporter")
+            case SCRIPTOP_ACTIVETELEPORTER:
             {
                 i = obj.getteleporter();
                 if (INBOUNDS_VEC(i, obj.entities))
                 {
                     obj.entities[i].colour = 101;
                 }
+                break;
             }
-            else if (words[0] == "foundtrinket")
+            case SCRIPTOP_FOUNDTRINKET:
             {
                 music.silencedasmusik();
                 music.playef(3);
 
-                size_t trinket = ss_toi(words[1]);
+                size_t trinket = intarg(1);
                 if (trinket < SDL_arraysize(obj.collect))
                 {
                     obj.collect[trinket] = true;
@@ -1729,8 +2584,9 @@ void scriptclass::run(void)
                         || key.isDown(KEYBOARD_UP) || key.isDown(KEYBOARD_DOWN)) game.jumpheld = true;
                 }
                 game.backgroundtext = false;
+                break;
             }
-            else if (words[0] == "foundlab")
+            case SCRIPTOP_FOUNDLAB:
             {
                 music.playef(3);
 
@@ -1751,8 +2607,9 @@ void scriptclass::run(void)
                         || key.isDown(KEYBOARD_UP) || key.isDown(KEYBOARD_DOWN)) game.jumpheld = true;
                 }
                 game.backgroundtext = false;
+                break;
             }
-            else if (words[0] == "foundlab2")
+            case SCRIPTOP_FOUNDLAB2:
             {
                 graphics.textboxremovefast();
 
@@ -1773,8 +2630,9 @@ void scriptclass::run(void)
                         || key.isDown(KEYBOARD_UP) || key.isDown(KEYBOARD_DOWN)) game.jumpheld = true;
                 }
                 game.backgroundtext = false;
+                break;
             }
-            else if (words[0] == "everybodysad")
+            case SCRIPTOP_EVERYBODYSAD:
             {
                 for (i = 0; i < (int) obj.entities.size(); i++)
                 {
@@ -1783,8 +2641,9 @@ void scriptclass::run(void)
                         obj.entities[i].tile = 144;
                     }
                 }
+                break;
             }
-            else if (words[0] == "startintermission2")
+            case SCRIPTOP_STARTINTERMISSION2:
             {
                 map.finalmode = true; //Enable final level mode
 
@@ -1798,12 +2657,14 @@ void scriptclass::run(void)
                 game.gravitycontrol = 0;
 
                 map.gotoroom(46, 54);
+                break;
             }
-            else if (words[0] == "telesave")
+            case SCRIPTOP_TELESAVE:
             {
                 if (!game.intimetrial && !game.nodeathmode && !game.inintermission) game.savetele();
+                break;
             }
-            else if (words[0] == "createlastrescued")
+            case SCRIPTOP_CREATELASTRESCUED:
             {
                 r = graphics.crewcolour(game.lastsaved);
                 if (r == 0 || r == PURPLE)
@@ -1817,10 +2678,11 @@ void scriptclass::run(void)
                 {
                     obj.entities[i].dir = 1;
                 }
+                break;
             }
-            else if (words[0] == "specialline")
+            case SCRIPTOP_SPECIALLINE:
             {
-                switch(ss_toi(words[1]))
+                switch(intarg(1))
                 {
                 case 1:
                     txt.resize(1);
@@ -1842,8 +2704,9 @@ void scriptclass::run(void)
                     }
                     break;
                 }
+                break;
             }
-            else if (words[0] == "trinketbluecontrol")
+            case SCRIPTOP_TRINKETBLUECONTROL:
             {
                 if (game.trinkets() == 20 && obj.flags[67])
                 {
@@ -1860,8 +2723,9 @@ void scriptclass::run(void)
                     load("talkblue_trinket4");
                     position--;
                 }
+                break;
             }
-            else if (words[0] == "trinketyellowcontrol")
+            case SCRIPTOP_TRINKETYELLOWCONTROL:
             {
                 if (game.trinkets() >= 19)
                 {
@@ -1873,8 +2737,9 @@ void scriptclass::run(void)
                     load("talkyellow_trinket2");
                     position--;
                 }
+                break;
             }
-            else if (words[0] == "redcontrol")
+            case SCRIPTOP_REDCONTROL:
             {
                 if (game.insecretlab)
                 {
@@ -1966,9 +2831,9 @@ void scriptclass::run(void)
                     load("talkred_1");
                     position--;
                 }
+                break;
             }
-            //TODO: Non Urgent fix compiler nesting errors without adding complexity
-            if (words[0] == "greencontrol")
+            case SCRIPTOP_GREENCONTROL:
             {
                 if (game.insecretlab)
                 {
@@ -2034,8 +2899,9 @@ void scriptclass::run(void)
                     load("talkgreen_1");
                     position--;
                 }
+                break;
             }
-            else if (words[0] == "bluecontrol")
+            case SCRIPTOP_BLUECONTROL:
             {
                 if (game.insecretlab)
                 {
@@ -2142,8 +3008,9 @@ void scriptclass::run(void)
                         position--;
                     }
                 }
+                break;
             }
-            else if (words[0] == "yellowcontrol")
+            case SCRIPTOP_YELLOWCONTROL:
             {
                 if (game.insecretlab)
                 {
@@ -2228,8 +3095,9 @@ void scriptclass::run(void)
                     position--;
                     obj.flags[23] = false;
                 }
+                break;
             }
-            else if (words[0] == "purplecontrol")
+            case SCRIPTOP_PURPLECONTROL:
             {
                 //Controls Purple's conversion
                 //Crew rescued:
@@ -2318,8 +3186,44 @@ void scriptclass::run(void)
                         position--;
                     }
                 }
+                break;
+            }
+            case SCRIPTOP_PREFETCHIMAGE:
+            {
+                //Starts loading an image a cutscene is about to show
+                int image = -1;
+                if (graphics.flipmode)
+                {
+                    image = graphics.grphx.findimage(("flip" + words[1]).c_str());
+                }
+                if (image == -1)
+                {
+                    image = graphics.grphx.findimage(words[1].c_str());
+                }
+                graphics.grphx.prefetchimage(image);
+                break;
+            }
             }
 
+            //Loading a custom script tokenizes all of its lines. When that
+            //leaves a command in words[0] that came further down the old
+            //chain of ifs, that command gets run as well.
+            if (retokenized && op != SCRIPTOP_NONE)
+            {
+                const int next = findscriptop(words[0].c_str());
+                retokenized = false;
+                if (next > op && scriptopchain[next] != scriptopchain[op])
+                {
+                    op = next;
+                    numlineints = 0;
+                    goto redispatch;
+                }
+            }
+
+#ifdef SCRIPT_PROFILER
+            profiler.endcommand(SDL_GetPerformanceCounter() - commandstart);
+#endif
+
             position++;
         }
         else
@@ -2339,6 +3243,23 @@ void scriptclass::run(void)
         }
     }
 
+    runticks += SDL_GetPerformanceCounter() - start;
+
+#ifdef SCRIPT_PROFILER
+    profiler.endtick(SDL_GetPerformanceCounter() - start);
+#endif
+    if (!running && runsteps > 0)
+    {
+        vlog_debug(
+            "Script %s: %i steps in %i us",
+            scriptname.c_str(),
+            runsteps,
+            (int) (runticks * 1000000 / SDL_GetPerformanceFrequency())
+        );
+        runsteps = 0;
+        runticks = 0;
+    }
+
     if(scriptdelay>0)
     {
         scriptdelay--;
@@ -2962,6 +3883,10 @@ void scriptclass::startgamemode( int t )
         VVV_exit(0);
         break;
     }
+
+#ifdef RECORD_INPUT
+    journal.beginrecording(t);
+#endif
 }
 
 void scriptclass::teleport(void)
@@ -3076,7 +4001,14 @@ void scriptclass::hardreset(void)
 {
     const bool version2_2 = GlitchrunnerMode_less_than_or_equal(Glitchrunner2_2);
 
-    xoshiro_seed(SDL_GetTicks());
+    const Uint32 seed = game.rngseed != 0 ? game.rngseed : SDL_GetTicks();
+    xoshiro_seed(seed);
+    xoshiro_logicseed(seed);
+    /* Only rendering takes from rand() now, but it may as well replay too */
+    srand(seed);
+#ifdef RECORD_INPUT
+    journal.seed = seed;
+#endif
 
     //Game:
     game.hascontrol = true;
@@ -3264,6 +4196,9 @@ void scriptclass::hardreset(void)
     //Script Stuff
     position = 0;
     commands.clear();
+    customcommands.clear();
+    compiled = false;
+    cachedscript = NULL;
     scriptdelay = 0;
     scriptname = "null";
     running = false;
@@ -3271,6 +4206,7 @@ void scriptclass::hardreset(void)
     {
         words[ii] = "";
     }
+    retokenized = true;
 
     obj.customactivitycolour = "";
     obj.customactivitytext = "";
@@ -3278,12 +4214,139 @@ void scriptclass::hardreset(void)
 
 void scriptclass::loadcustom(const std::string& t)
 {
-    //this magic function breaks down the custom script and turns into real scripting!
-    std::string cscriptname="";
-    for(size_t i=0; i<t.length(); i++){
-        if(i>=7) cscriptname+=t[i];
+    const std::string cscriptname = t.substr(7);
+
+    std::unordered_map<std::string, customscriptcache>::const_iterator cached =
+        customcache.find(cscriptname);
+    if (cached == customcache.end())
+    {
+        translatecustom(cscriptname);
+        return;
+    }
+
+    //Leave everything as if it had just been translated. Cache entries
+    //don't move, so the script can run straight out of this one.
+    const customscriptcache& entry = cached->second;
+    for (size_t ii = 0; ii < entry.commands.size(); ii++)
+    {
+        commands.push_back(entry.commands[ii].c_str());
+    }
+    cachedscript = &entry;
+    compiled = true;
+
+    for (size_t ii = 0; ii < entry.lastwords.size(); ii++)
+    {
+        words[ii] = entry.lastwords[ii];
+    }
+    if (entry.tokenized)
+    {
+        SDL_memcpy(argexists, entry.lastargexists, sizeof(argexists));
+        j = entry.lastj;
+        retokenized = true;
+    }
+}
+
+void scriptclass::compilecustom(void)
+{
+    //Translating goes through the same state a running script uses
+    std::vector<const char*> oldcommands;
+    std::vector<std::string> oldcustomcommands;
+    std::vector<scriptline> oldcompiledlines;
+    std::vector<const char*> oldcompiledwords;
+    std::vector<int> oldcompiledints;
+    std::string oldwords[NUM_SCRIPT_ARGS];
+    bool oldargexists[NUM_SCRIPT_ARGS];
+    const customscriptcache* oldcachedscript = cachedscript;
+    const bool oldcompiled = compiled;
+    const bool oldretokenized = retokenized;
+    const int oldj = j;
+
+    commands.swap(oldcommands);
+    customcommands.swap(oldcustomcommands);
+    compiledlines.swap(oldcompiledlines);
+    compiledwords.swap(oldcompiledwords);
+    compiledints.swap(oldcompiledints);
+    for (size_t ii = 0; ii < SDL_arraysize(words); ii++)
+    {
+        words[ii].swap(oldwords[ii]);
+    }
+    SDL_memcpy(oldargexists, argexists, sizeof(argexists));
+
+    const Uint64 start = SDL_GetPerformanceCounter();
+
+    for (size_t i = 0; i < customscripts.size(); i++)
+    {
+        if (customcache.find(customscripts[i].name) == customcache.end())
+        {
+            commands.clear();
+            customcommands.clear();
+            translatecustom(customscripts[i].name);
+        }
+    }
+
+    vlog_debug(
+        "Translated %i custom scripts in %i us",
+        (int) customcache.size(),
+        (int) ((SDL_GetPerformanceCounter() - start) * 1000000 / SDL_GetPerformanceFrequency())
+    );
+
+    commands.swap(oldcommands);
+    customcommands.swap(oldcustomcommands);
+    compiledlines.swap(oldcompiledlines);
+    compiledwords.swap(oldcompiledwords);
+    compiledints.swap(oldcompiledints);
+    for (size_t ii = 0; ii < SDL_arraysize(words); ii++)
+    {
+        words[ii].swap(oldwords[ii]);
+    }
+    SDL_memcpy(argexists, oldargexists, sizeof(argexists));
+    cachedscript = oldcachedscript;
+    compiled = oldcompiled;
+    retokenized = oldretokenized;
+    j = oldj;
+}
+
+void scriptclass::uncachecustom(const std::string& name)
+{
+    std::unordered_map<std::string, customscriptcache>::iterator cached =
+        customcache.find(name);
+    if (cached == customcache.end())
+    {
+        return;
+    }
+
+    if (cachedscript == &cached->second)
+    {
+        detachcustom();
+    }
+    customcache.erase(cached);
+}
+
+/* Gives the script that's loaded its own copy of the cached one it runs out
+ * of, before that gets thrown away */
+void scriptclass::detachcustom(void)
+{
+    if (cachedscript == NULL)
+    {
+        return;
     }
 
+    customcommands = cachedscript->commands;
+    commands.clear();
+    for (size_t ii = 0; ii < customcommands.size(); ii++)
+    {
+        commands.push_back(customcommands[ii].c_str());
+    }
+    compiledlines = cachedscript->lines;
+    compiledwords = cachedscript->words;
+    compiledints = cachedscript->ints;
+    cachedscript = NULL;
+    numlineints = 0;
+}
+
+void scriptclass::translatecustom(const std::string& cscriptname)
+{
+    //this magic function breaks down the custom script and turns into real scripting!
     std::string tstring;
 
     std::vector<std::string>* contents = NULL;
@@ -3302,12 +4365,27 @@ void scriptclass::loadcustom(const std::string& t)
     std::vector<std::string>& lines = *contents;
 
     //Ok, we've got the relavent script segment, we do a pass to assess it, then run it!
+    //This pass leaves words alone, the next one overwrites them anyway.
+    //A line without words checks the last line that had any, like before.
     int customcutscenemode=0;
+    static scripttokens tokens;
+    constexpr Uint32 sayhash = scripthash("say");
+    constexpr Uint32 replyhash = scripthash("reply");
+    const char* word0line = NULL;
+    scripttoken word0;
     for(size_t i=0; i<lines.size(); i++){
-        tokenize(lines[i]);
-        if(words[0] == "say"){
+        tokenizescriptline(lines[i].c_str(), lines[i].length(), tokens);
+        if(tokens.numwords > 0){
+            word0line = lines[i].c_str();
+            word0 = tokens.words[0];
+        }
+        if(word0line == NULL){
+            if(words[0] == "say" || words[0] == "reply"){
+                customcutscenemode=1;
+            }
+        }else if(scripttokenequals(word0line, word0, "say", sayhash)){
             customcutscenemode=1;
-        }else if(words[0] == "reply"){
+        }else if(scripttokenequals(word0line, word0, "reply", replyhash)){
             customcutscenemode=1;
         }
     }
@@ -3319,11 +4397,13 @@ void scriptclass::loadcustom(const std::string& t)
     int customtextmode=0;
     int speakermode=0; //0, terminal, numbers for crew
     int squeakmode=0;//default on
+    int numlastwords=0;
     //Now run the script
     for(size_t i=0; i<lines.size(); i++){
         words[0]="nothing"; //Default!
         words[1]="1"; //Default!
         tokenize(lines[i]);
+        numlastwords = SDL_max(numlastwords, SDL_max(2, j < NUM_SCRIPT_ARGS && argexists[j] ? j + 1 : j));
         for (size_t ii = 0; ii < words[0].length(); ii++)
         {
             words[0][ii] = SDL_tolower(words[0][ii]);
@@ -3555,4 +4635,32 @@ void scriptclass::loadcustom(const std::string& t)
         add("endcutscene()");
         add("untilbars()");
     }
+
+    //customcommands won't change anymore, so it's safe to point at it
+    for (size_t ii = 0; ii < customcommands.size(); ii++)
+    {
+        commands.push_back(customcommands[ii].c_str());
+    }
+
+    //Without a single word to go on, the first pass looked at whatever was
+    //left in words, so this can't be reused
+    if (word0line == NULL && !lines.empty())
+    {
+        return;
+    }
+
+    compile();
+
+    //Swapping vectors doesn't move their strings, so commands still points
+    //at the right ones once they're in the cache
+    customscriptcache& entry = customcache[cscriptname];
+    entry.commands.swap(customcommands);
+    entry.lines.swap(compiledlines);
+    entry.words.swap(compiledwords);
+    entry.ints.swap(compiledints);
+    cachedscript = &entry;
+    entry.lastwords.assign(words, words + numlastwords);
+    entry.tokenized = !lines.empty();
+    SDL_memcpy(entry.lastargexists, argexists, sizeof(argexists));
+    entry.lastj = j;
 }
@@ -2,12 +2,35 @@
 #define SCRIPT_H
 
 #include <string>
+#include <unordered_map>
 #include <vector>
 
 #include <SDL2/SDL.h>
 
-#define filllines(lines) commands.insert(commands.end(), lines, lines + SDL_arraysize(lines))
+#include "StringPool.h"
+#include "UtilityClass.h"
 
+#ifdef SCRIPT_PROFILER
+#include "ScriptProfiler.h"
+#endif
+
+/* A script built into the game, see Scripts.cpp and TerminalScripts.cpp */
+struct builtinscript
+{
+    const char* name;
+    const char* const* lines;
+    size_t numlines;
+};
+
+#define BUILTIN_SCRIPT(name) {#name, lines_##name, SDL_arraysize(lines_##name)}
+
+const builtinscript* findbuiltinscript(const builtinscript* scripts, size_t numscripts, const char* name);
+
+#ifdef SCRIPT_BENCHMARK
+/* Every script in Scripts.cpp and TerminalScripts.cpp, for ScriptBenchmark.cpp */
+const builtinscript* builtinscripts(size_t* numscripts);
+const builtinscript* builtinterminalscripts(size_t* numscripts);
+#endif
 
 struct Script
 {
@@ -17,6 +40,67 @@ struct Script
 
 #define NUM_SCRIPT_ARGS 40
 
+/* The name of a command run() knows, or NULL */
+const char* scriptopname(int op);
+
+/* FNV-1a, so that keywords can be hashed at compile time */
+constexpr Uint32 scripthash(const char* str, Uint32 hash = 2166136261u)
+{
+    return *str == '\0' ? hash : scripthash(str + 1, (hash ^ (Uint8) *str) * 16777619u);
+}
+
+/* A word of a command: the characters from start up to end, without any
+ * spaces, lowercased unless it's the last word of the line. hash is
+ * scripthash() of the word as it would end up in scriptclass::words. */
+struct scripttoken
+{
+    size_t start;
+    size_t end;
+    bool lowercase;
+    Uint32 hash;
+};
+
+struct scripttokens
+{
+    int j;
+    int numwords;
+    bool argexists[NUM_SCRIPT_ARGS];
+    scripttoken words[NUM_SCRIPT_ARGS];
+};
+
+void tokenizescriptline(const char* t, size_t length, scripttokens& tokens);
+
+/* hash is scripthash(word), which call sites work out at compile time */
+bool scripttokenequals(const char* t, const scripttoken& token, const char* word, Uint32 hash);
+
+void scripttokencopy(const char* t, const scripttoken& token, std::string& out);
+
+/* A command already split into words, see scriptclass::compile(). Lines
+ * that are the text of a textbox don't get split up, numwords is -1. */
+struct scriptline
+{
+    int op;
+    int j;
+    Uint64 argexists;
+    size_t firstword;
+    int numwords;
+};
+
+/* A custom script already translated into internal commands, along with
+ * what loadcustom() leaves behind in words */
+struct customscriptcache
+{
+    std::vector<std::string> commands;
+    std::vector<scriptline> lines;
+    std::vector<const char*> words;
+    std::vector<int> ints;
+
+    std::vector<std::string> lastwords;
+    bool tokenized;
+    bool lastargexists[NUM_SCRIPT_ARGS];
+    int lastj;
+};
+
 class scriptclass
 {
 public:
@@ -28,15 +112,20 @@ public:
     void loadother(const char* t);
     void loadcustom(const std::string& t);
 
+    void compilecustom(void);
+    void uncachecustom(const std::string& name);
+
     void inline add(const std::string& t)
     {
-        commands.push_back(t);
+        customcommands.push_back(t);
     }
 
     void clearcustom(void);
 
     void tokenize(const std::string& t);
 
+    void compile(void);
+
     void run(void);
 
     void resetgametomenu(void);
@@ -47,8 +136,10 @@ public:
 
     void hardreset(void);
 
-    //Script contents
-    std::vector<std::string> commands;
+    //Script contents, either the lines of a built-in script as they are,
+    //or pointers into customcommands or a cached custom script
+    std::vector<const char*> commands;
+    std::vector<std::string> customcommands;
     std::string words[NUM_SCRIPT_ARGS];
     std::vector<std::string> txt;
     std::string scriptname;
@@ -69,6 +160,59 @@ public:
 
     //Custom level stuff
     std::vector<Script> customscripts;
+
+#ifdef SCRIPT_PROFILER
+    scriptprofilerclass profiler;
+#endif
+
+#ifdef SCRIPT_BENCHMARK
+    //Tokenizes every command as it runs and looks it up by name, the way
+    //run() used to, see ScriptBenchmark.cpp
+    bool olddispatch;
+    //Commands run so far
+    Uint32 benchmarksteps;
+#endif
+
+private:
+    void compileline(const char* t, scriptline& line);
+
+    void translatecustom(const std::string& cscriptname);
+    void detachcustom(void);
+
+    //Translated custom scripts by name, see compilecustom()
+    std::unordered_map<std::string, customscriptcache> customcache;
+
+    //commands, tokenized once when the script is loaded
+    std::vector<scriptline> compiledlines;
+    std::vector<const char*> compiledwords;
+    //ss_toi() of every word in compiledwords
+    std::vector<int> compiledints;
+    //Set when commands points into a cached custom script, run() then goes
+    //by its lines and words instead of compiledlines and compiledwords
+    const customscriptcache* cachedscript;
+    stringpoolclass scriptwords;
+    bool compiled;
+
+    //Set whenever words gets overwritten outside of run()
+    bool retokenized;
+
+    //The words of the command that's running, already parsed as numbers
+    const int* lineints;
+    int numlineints;
+
+    //ss_toi(words[n]), without parsing it again if the compiled line has it
+    int inline intarg(const int n)
+    {
+        if (n < numlineints && !retokenized)
+        {
+            return lineints[n];
+        }
+        return ss_toi(words[n]);
+    }
+
+    //For benchmarking the script engine
+    int runsteps;
+    Uint64 runticks;
 };
 
 #ifndef SCRIPT_DEFINITION
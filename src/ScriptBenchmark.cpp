@@ -0,0 +1,433 @@
+#include "ScriptBenchmark.h"
+
+#include <SDL2/SDL.h>
+#include <string>
+#include <vector>
+
+#include "Entity.h"
+#include "Game.h"
+#include "Graphics.h"
+#include "Map.h"
+#include "Music.h"
+#include "RAM.h"
+#include "Script.h"
+#include "Vlogging.h"
+#include "Xoshiro.h"
+
+/* How many times the lines are gone over for timing */
+#define BENCHMARK_PASSES 20
+
+/* How long a script gets to run, most are done well before */
+#define DISPATCH_TICKS 3000
+#define DISPATCH_SEED 1
+
+/* What a tokenizer leaves behind, the way scriptclass keeps it */
+struct tokenizedline
+{
+    std::string words[NUM_SCRIPT_ARGS];
+    bool argexists[NUM_SCRIPT_ARGS];
+    int j;
+};
+
+/* scriptclass::tokenize() as it was before tokenizescriptline() */
+static void oldtokenize(const std::string& t, tokenizedline& out)
+{
+    std::string* words = out.words;
+    int& j = out.j;
+    j = 0;
+    std::string tempword;
+    char currentletter;
+
+    SDL_zeroa(out.argexists);
+
+    for (size_t i = 0; i < t.length(); i++)
+    {
+        currentletter = t[i];
+        if (currentletter == '(' || currentletter == ')' || currentletter == ',')
+        {
+            words[j] = tempword;
+            out.argexists[j] = words[j] != "";
+            for (size_t ii = 0; ii < words[j].length(); ii++)
+            {
+                words[j][ii] = SDL_tolower(words[j][ii]);
+            }
+            j++;
+            tempword = "";
+        }
+        else if (currentletter == ' ')
+        {
+            //don't do anything - i.e. strip out spaces.
+        }
+        else
+        {
+            tempword += currentletter;
+        }
+        if (j >= NUM_SCRIPT_ARGS)
+        {
+            break;
+        }
+    }
+
+    if (j < NUM_SCRIPT_ARGS)
+    {
+        const bool lastargexists = tempword != "";
+        if (lastargexists)
+        {
+            words[j] = tempword;
+        }
+        out.argexists[j] = lastargexists;
+    }
+}
+
+/* What scriptclass::tokenize() does now */
+static void newtokenize(const char* t, const size_t length, tokenizedline& out)
+{
+    static scripttokens tokens;
+
+    tokenizescriptline(t, length, tokens);
+    for (int ii = 0; ii < tokens.numwords; ii++)
+    {
+        scripttokencopy(t, tokens.words[ii], out.words[ii]);
+    }
+    SDL_memcpy(out.argexists, tokens.argexists, sizeof(out.argexists));
+    out.j = tokens.j;
+}
+
+static bool sametokens(const tokenizedline& a, const tokenizedline& b)
+{
+    if (a.j != b.j)
+    {
+        return false;
+    }
+    for (int ii = 0; ii < NUM_SCRIPT_ARGS; ii++)
+    {
+        if (a.words[ii] != b.words[ii] || a.argexists[ii] != b.argexists[ii])
+        {
+            return false;
+        }
+    }
+    return true;
+}
+
+static void addlines(std::vector<std::string>& lines, const builtinscript* scripts, const size_t numscripts)
+{
+    for (size_t i = 0; i < numscripts; i++)
+    {
+        lines.insert(lines.end(), scripts[i].lines, scripts[i].lines + scripts[i].numlines);
+    }
+}
+
+static double nsperline(const Uint64 ticks, const size_t numlines)
+{
+    return (double) ticks * 1000000000.0 / SDL_GetPerformanceFrequency() / (numlines * BENCHMARK_PASSES);
+}
+
+bool SCRIPTBENCH_tokenizer(void)
+{
+    std::vector<std::string> lines;
+    size_t numscripts;
+    const builtinscript* scripts;
+
+    scripts = builtinscripts(&numscripts);
+    addlines(lines, scripts, numscripts);
+    scripts = builtinterminalscripts(&numscripts);
+    addlines(lines, scripts, numscripts);
+
+    /* Words a line doesn't set are left over from the one before, so both
+     * go through the lines in order with state of their own */
+    static tokenizedline oldstate;
+    static tokenizedline newstate;
+    int mismatches = 0;
+    for (size_t i = 0; i < lines.size(); i++)
+    {
+        oldtokenize(lines[i], oldstate);
+        newtokenize(lines[i].c_str(), lines[i].length(), newstate);
+        if (!sametokens(oldstate, newstate))
+        {
+            if (mismatches == 0)
+            {
+                vlog_error("BENCH | Tokenizers disagree on \"%s\"", lines[i].c_str());
+            }
+            mismatches++;
+        }
+    }
+
+    Uint64 start;
+    unsigned int allocations;
+    static scripttokens tokens;
+
+    start = SDL_GetPerformanceCounter();
+    allocations = RAM_allocationCount();
+    for (int pass = 0; pass < BENCHMARK_PASSES; pass++)
+    {
+        for (size_t i = 0; i < lines.size(); i++)
+        {
+            oldtokenize(lines[i], oldstate);
+        }
+    }
+    const Uint64 oldticks = SDL_GetPerformanceCounter() - start;
+    const unsigned int oldallocations = (RAM_allocationCount() - allocations) / BENCHMARK_PASSES;
+
+    start = SDL_GetPerformanceCounter();
+    allocations = RAM_allocationCount();
+    for (int pass = 0; pass < BENCHMARK_PASSES; pass++)
+    {
+        for (size_t i = 0; i < lines.size(); i++)
+        {
+            tokenizescriptline(lines[i].c_str(), lines[i].length(), tokens);
+        }
+    }
+    const Uint64 spanticks = SDL_GetPerformanceCounter() - start;
+    const unsigned int spanallocations = (RAM_allocationCount() - allocations) / BENCHMARK_PASSES;
+
+    start = SDL_GetPerformanceCounter();
+    allocations = RAM_allocationCount();
+    for (int pass = 0; pass < BENCHMARK_PASSES; pass++)
+    {
+        for (size_t i = 0; i < lines.size(); i++)
+        {
+            newtokenize(lines[i].c_str(), lines[i].length(), newstate);
+        }
+    }
+    const Uint64 shimticks = SDL_GetPerformanceCounter() - start;
+    const unsigned int shimallocations = (RAM_allocationCount() - allocations) / BENCHMARK_PASSES;
+
+    if (mismatches > 0)
+    {
+        vlog_error("BENCH | %i of %i lines tokenized differently", mismatches, (int) lines.size());
+    }
+    else
+    {
+        vlog_info("BENCH | All %i lines tokenized the same", (int) lines.size());
+    }
+
+    /* Allocation counts are 0 without RAM_TRACKING */
+    vlog_info(
+        "BENCH | Old tokenizer: %.1f ns a line, %u allocations a pass",
+        nsperline(oldticks, lines.size()),
+        oldallocations
+    );
+    vlog_info(
+        "BENCH | tokenizescriptline(): %.1f ns a line, %u allocations a pass",
+        nsperline(spanticks, lines.size()),
+        spanallocations
+    );
+    vlog_info(
+        "BENCH | tokenize() on top of it: %.1f ns a line, %u allocations a pass",
+        nsperline(shimticks, lines.size()),
+        shimallocations
+    );
+
+    return mismatches == 0;
+}
+
+/* FNV-1a over everything a script can change */
+static void hashbytes(Uint32& hash, const void* data, const size_t length)
+{
+    const Uint8* bytes = (const Uint8*) data;
+    for (size_t i = 0; i < length; i++)
+    {
+        hash = (hash ^ bytes[i]) * 16777619u;
+    }
+}
+
+static void hashint(Uint32& hash, const int value)
+{
+    hashbytes(hash, &value, sizeof(value));
+}
+
+static void hashstring(Uint32& hash, const std::string& str)
+{
+    hashbytes(hash, str.c_str(), str.length() + 1);
+}
+
+static Uint32 statehash(void)
+{
+    Uint32 hash = 2166136261u;
+
+    hashint(hash, script.position);
+    hashint(hash, script.running);
+    hashint(hash, script.scriptdelay);
+    hashint(hash, script.looppoint);
+    hashint(hash, script.loopcount);
+    hashint(hash, script.i);
+    hashint(hash, script.j);
+    hashint(hash, script.k);
+    hashint(hash, script.r);
+    hashint(hash, script.g);
+    hashint(hash, script.b);
+    hashint(hash, script.textx);
+    hashint(hash, script.texty);
+    hashint(hash, script.textflipme);
+    hashstring(hash, script.scriptname);
+    for (int i = 0; i < NUM_SCRIPT_ARGS; i++)
+    {
+        hashstring(hash, script.words[i]);
+    }
+    for (size_t i = 0; i < script.txt.size(); i++)
+    {
+        hashstring(hash, script.txt[i]);
+    }
+
+    hashint(hash, game.gamestate);
+    hashint(hash, game.state);
+    hashint(hash, game.statedelay);
+    hashint(hash, game.roomx);
+    hashint(hash, game.roomy);
+    hashint(hash, game.hascontrol);
+    hashint(hash, game.advancetext);
+    hashint(hash, game.gravitycontrol);
+    hashint(hash, game.companion);
+    hashint(hash, game.savepoint);
+    hashint(hash, game.lastsaved);
+    hashint(hash, game.screenshake);
+    hashint(hash, game.flashlight);
+    hashstring(hash, game.teleportscript);
+    hashbytes(hash, game.crewstats, sizeof(game.crewstats));
+
+    hashbytes(hash, obj.flags, sizeof(obj.flags));
+    hashbytes(hash, obj.collect, sizeof(obj.collect));
+    hashint(hash, obj.entities.size());
+    for (size_t i = 0; i < obj.entities.size(); i++)
+    {
+        const entclass& entity = obj.entities[i];
+        hashint(hash, entity.invis);
+        hashint(hash, entity.type);
+        hashint(hash, entity.size);
+        hashint(hash, entity.tile);
+        hashint(hash, entity.rule);
+        hashint(hash, entity.state);
+        hashint(hash, entity.statedelay);
+        hashint(hash, entity.behave);
+        hashbytes(hash, &entity.para, sizeof(entity.para));
+        hashint(hash, entity.life);
+        hashint(hash, entity.colour);
+        hashint(hash, entity.xp);
+        hashint(hash, entity.yp);
+        hashint(hash, entity.w);
+        hashint(hash, entity.h);
+        hashint(hash, entity.dir);
+    }
+
+    hashint(hash, graphics.textboxes.size());
+    for (size_t i = 0; i < graphics.textboxes.size(); i++)
+    {
+        const textboxclass& textbox = graphics.textboxes[i];
+        hashint(hash, textbox.xp);
+        hashint(hash, textbox.yp);
+        for (size_t ii = 0; ii < textbox.lines.size(); ii++)
+        {
+            hashstring(hash, textbox.lines[ii]);
+        }
+    }
+    hashint(hash, graphics.showcutscenebars);
+    hashint(hash, graphics.fademode);
+
+    hashint(hash, map.showteleporters);
+    hashint(hash, map.showtargets);
+    hashint(hash, map.showtrinkets);
+
+    hashint(hash, music.currentsong);
+
+    return hash;
+}
+
+/* Runs a script from the start of a new game until it stops, skipping
+ * through text, cutscene bars and fades as soon as they come up */
+static Uint32 runscript(const char* name, const bool olddispatch, Uint64& ticks, Uint32& steps)
+{
+    script.startgamemode(0);
+    xoshiro_seed(DISPATCH_SEED);
+    xoshiro_logicseed(DISPATCH_SEED);
+    srand(DISPATCH_SEED);
+
+    script.olddispatch = olddispatch;
+    script.load(name);
+
+    const Uint32 firststep = script.benchmarksteps;
+    for (int tick = 0; tick < DISPATCH_TICKS && script.running; tick++)
+    {
+        if (game.pausescript)
+        {
+            game.pausescript = false;
+            game.hascontrol = true;
+        }
+        graphics.cutscenebarspos = graphics.showcutscenebars ? 360 : 0;
+        graphics.fademode = 0;
+
+        const Uint64 start = SDL_GetPerformanceCounter();
+        script.run();
+        ticks += SDL_GetPerformanceCounter() - start;
+    }
+    steps += script.benchmarksteps - firststep;
+
+    script.olddispatch = false;
+    return statehash();
+}
+
+static void addnames(std::vector<const char*>& names, const builtinscript* scripts, const size_t numscripts)
+{
+    for (size_t i = 0; i < numscripts; i++)
+    {
+        names.push_back(scripts[i].name);
+    }
+}
+
+static double stepspersecond(const Uint32 steps, const Uint64 ticks)
+{
+    return ticks == 0 ? 0.0 : (double) steps * SDL_GetPerformanceFrequency() / ticks;
+}
+
+bool SCRIPTBENCH_dispatch(void)
+{
+    std::vector<const char*> names;
+    size_t numscripts;
+    const builtinscript* scripts;
+
+    scripts = builtinscripts(&numscripts);
+    addnames(names, scripts, numscripts);
+    scripts = builtinterminalscripts(&numscripts);
+    addnames(names, scripts, numscripts);
+
+    Uint64 oldticks = 0;
+    Uint64 newticks = 0;
+    Uint32 oldsteps = 0;
+    Uint32 newsteps = 0;
+    int mismatches = 0;
+    for (size_t i = 0; i < names.size(); i++)
+    {
+        const Uint32 oldhash = runscript(names[i], true, oldticks, oldsteps);
+        const Uint32 newhash = runscript(names[i], false, newticks, newsteps);
+        if (oldhash != newhash)
+        {
+            vlog_error("BENCH | Script %s ends up differently with the old dispatch", names[i]);
+            mismatches++;
+        }
+    }
+
+    if (mismatches > 0)
+    {
+        vlog_error("BENCH | %i of %i scripts ran differently", mismatches, (int) names.size());
+    }
+    else
+    {
+        vlog_info("BENCH | All %i scripts ran the same", (int) names.size());
+    }
+    if (oldsteps != newsteps)
+    {
+        vlog_error("BENCH | The old dispatch ran %u commands, the new one %u", oldsteps, newsteps);
+    }
+
+    vlog_info(
+        "BENCH | Old dispatch: %u commands, %.0f a second",
+        oldsteps,
+        stepspersecond(oldsteps, oldticks)
+    );
+    vlog_info(
+        "BENCH | New dispatch: %u commands, %.0f a second",
+        newsteps,
+        stepspersecond(newsteps, newticks)
+    );
+
+    return mismatches == 0 && oldsteps == newsteps;
+}
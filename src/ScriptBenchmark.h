@@ -0,0 +1,15 @@
+#ifndef SCRIPTBENCHMARK_H
+#define SCRIPTBENCHMARK_H
+
+/* Splits every line of the built-in scripts up with the tokenizer run()
+ * used to have and with tokenizescriptline(), logs how long each one takes.
+ * Returns false if they disagree anywhere. Only built with SCRIPT_BENCHMARK. */
+bool SCRIPTBENCH_tokenizer(void);
+
+/* Runs every built-in script from the start of a new game, once the way
+ * run() used to go about it and once compiled, and logs how many commands a
+ * second each one gets through. Returns false if any of them leaves the
+ * game in a different state. */
+bool SCRIPTBENCH_dispatch(void);
+
+#endif /* SCRIPTBENCHMARK_H */
@@ -0,0 +1,200 @@
+#include "ScriptProfiler.h"
+
+#include <string>
+
+#include "FileSystemUtils.h"
+#include "Script.h"
+#include "Vlogging.h"
+
+scriptprofilerclass::scriptprofilerclass(void)
+{
+    clear();
+}
+
+void scriptprofilerclass::clear(void)
+{
+    scripts.clear();
+    ops.clear();
+    current = -1;
+
+    SDL_zeroa(trace);
+    tracecount = 0;
+    tick = 0;
+}
+
+void scriptprofilerclass::loadscript(const char* name)
+{
+    const char* interned = names.intern(name);
+
+    for (size_t i = 0; i < scripts.size(); i++)
+    {
+        if (scripts[i].name == interned)
+        {
+            current = i;
+            scripts[i].loads++;
+            return;
+        }
+    }
+
+    statsclass stats;
+    SDL_zero(stats);
+    stats.name = interned;
+    stats.loads = 1;
+
+    current = scripts.size();
+    scripts.push_back(stats);
+}
+
+void scriptprofilerclass::begintick(void)
+{
+    tick++;
+}
+
+void scriptprofilerclass::endtick(Uint64 ticks)
+{
+    /* A tick that loads another script counts towards the new one */
+    if (current >= 0 && ticks > scripts[current].worsttick)
+    {
+        scripts[current].worsttick = ticks;
+    }
+}
+
+void scriptprofilerclass::begincommand(int op, const char* command)
+{
+    traceclass& entry = trace[tracecount % trace_size];
+    entry.tick = tick;
+    entry.script = current >= 0 ? scripts[current].name : NULL;
+    entry.op = op;
+    entry.ticks = 0;
+    SDL_strlcpy(entry.command, command, sizeof(entry.command));
+
+    /* SCRIPTOP_NONE is -1 */
+    if (op + 1 >= (int) ops.size())
+    {
+        statsclass stats;
+        SDL_zero(stats);
+        ops.resize(op + 2, stats);
+    }
+    ops[op + 1].count++;
+}
+
+void scriptprofilerclass::endcommand(Uint64 ticks)
+{
+    traceclass& entry = trace[tracecount % trace_size];
+    entry.ticks = ticks;
+    tracecount++;
+
+    if (entry.op + 1 < (int) ops.size())
+    {
+        ops[entry.op + 1].ticks += ticks;
+    }
+    if (current >= 0)
+    {
+        scripts[current].count++;
+        scripts[current].ticks += ticks;
+    }
+}
+
+/* Stats copied out to be sorted by time */
+struct sortedstats
+{
+    Uint64 ticks;
+    Uint64 worsttick;
+    const char* name;
+    Uint32 loads;
+    Uint32 count;
+};
+
+static int compareticks(const void* a, const void* b)
+{
+    const Uint64 ticks_a = ((const sortedstats*) a)->ticks;
+    const Uint64 ticks_b = ((const sortedstats*) b)->ticks;
+
+    if (ticks_a != ticks_b)
+    {
+        return ticks_a > ticks_b ? -1 : 1;
+    }
+    return 0;
+}
+
+static int tous(Uint64 ticks)
+{
+    return ticks * 1000000 / SDL_GetPerformanceFrequency();
+}
+
+bool scriptprofilerclass::dump(const char* filename)
+{
+    std::string out;
+    char line[160];
+    std::vector<sortedstats> sorted;
+
+    SDL_snprintf(line, sizeof(line), "%u ticks, %u commands\n\n", tick, tracecount);
+    out += line;
+
+    out += "script                          loads    steps    total us  worst tick us\n";
+    for (size_t i = 0; i < scripts.size(); i++)
+    {
+        const statsclass& stats = scripts[i];
+        const sortedstats s = {stats.ticks, stats.worsttick, stats.name, stats.loads, stats.count};
+        sorted.push_back(s);
+    }
+    SDL_qsort(sorted.data(), sorted.size(), sizeof(sortedstats), compareticks);
+    for (size_t i = 0; i < sorted.size(); i++)
+    {
+        const sortedstats& stats = sorted[i];
+        SDL_snprintf(line, sizeof(line), "%-30s %6u %8u %11i %14i\n",
+            stats.name,
+            stats.loads,
+            stats.count,
+            tous(stats.ticks),
+            tous(stats.worsttick)
+        );
+        out += line;
+    }
+
+    out += "\ncommand                         count    total us\n";
+    sorted.clear();
+    for (size_t i = 0; i < ops.size(); i++)
+    {
+        /* SCRIPTOP_NONE is -1 */
+        const char* name = scriptopname((int) i - 1);
+        if (ops[i].count > 0)
+        {
+            const sortedstats s = {ops[i].ticks, 0, name != NULL ? name : "(unknown)", 0, ops[i].count};
+            sorted.push_back(s);
+        }
+    }
+    SDL_qsort(sorted.data(), sorted.size(), sizeof(sortedstats), compareticks);
+    for (size_t i = 0; i < sorted.size(); i++)
+    {
+        SDL_snprintf(line, sizeof(line), "%-30s %6u %11i\n",
+            sorted[i].name,
+            sorted[i].count,
+            tous(sorted[i].ticks)
+        );
+        out += line;
+    }
+
+    out += "\ntick    script                          us  command\n";
+    const Uint32 first = tracecount > trace_size ? tracecount - trace_size : 0;
+    for (Uint32 i = first; i < tracecount; i++)
+    {
+        const traceclass& entry = trace[i % trace_size];
+        SDL_snprintf(line, sizeof(line), "%-7u %-30s %3i  %s\n",
+            entry.tick,
+            entry.script != NULL ? entry.script : "",
+            tous(entry.ticks),
+            entry.command
+        );
+        out += line;
+    }
+
+    if (!FILESYSTEM_saveFile(filename, out.c_str(), out.length()))
+    {
+        vlog_error("Unable to write script profile to %s", filename);
+        return false;
+    }
+
+    vlog_info("Wrote script profile to %s", filename);
+    return true;
+}
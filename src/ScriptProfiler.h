@@ -0,0 +1,63 @@
+#ifndef SCRIPTPROFILER_H
+#define SCRIPTPROFILER_H
+
+#include <SDL2/SDL.h>
+#include <vector>
+
+#include "StringPool.h"
+
+/* Counts how often every script and every command runs and how long they
+ * take, and keeps a trace of the last commands that ran, to track down
+ * scripts that make frames run late. Only built with SCRIPT_PROFILER.
+ * dump() writes it all out, as text, to the user directory. */
+class scriptprofilerclass
+{
+public:
+    scriptprofilerclass(void);
+
+    void clear(void);
+
+    void loadscript(const char* name);
+
+    void begintick(void);
+    void endtick(Uint64 ticks);
+
+    void begincommand(int op, const char* command);
+    void endcommand(Uint64 ticks);
+
+    bool dump(const char* filename);
+
+    static const int trace_size = 512;
+    static const int trace_text = 40;
+
+private:
+    struct statsclass
+    {
+        const char* name;
+        Uint32 loads;
+        Uint32 count;
+        Uint64 ticks;
+        Uint64 worsttick;
+    };
+
+    struct traceclass
+    {
+        Uint32 tick;
+        const char* script;
+        int op;
+        Uint32 ticks;
+        char command[trace_text];
+    };
+
+    /* Names are interned, so they can be compared by address */
+    std::vector<statsclass> scripts;
+    std::vector<statsclass> ops;
+    stringpoolclass names;
+    int current;
+
+    traceclass trace[trace_size];
+    Uint32 tracecount;
+    Uint32 tick;
+};
+
+#endif /* SCRIPTPROFILER_H */
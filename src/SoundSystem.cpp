@@ -2,40 +2,177 @@
 
 #include <SDL2/SDL.h>
 
+#include "Exit.h"
 #include "FileSystemUtils.h"
+#include "Maths.h"
+#include "RAM.h"
 #include "Vlogging.h"
 
-MusicTrack::MusicTrack(const char* fileName)
+static const int adpcm_index_table[16] = {
+    -1, -1, -1, -1, 2, 4, 6, 8,
+    -1, -1, -1, -1, 2, 4, 6, 8
+};
+
+static const Sint16 adpcm_step_table[89] = {
+    7, 8, 9, 10, 11, 12, 13, 14, 16, 17,
+    19, 21, 23, 25, 28, 31, 34, 37, 41, 45,
+    50, 55, 60, 66, 73, 80, 88, 97, 107, 118,
+    130, 143, 157, 173, 190, 209, 230, 253, 279, 307,
+    337, 371, 408, 449, 494, 544, 598, 658, 724, 796,
+    876, 963, 1060, 1166, 1282, 1411, 1552, 1707, 1878, 2066,
+    2272, 2499, 2749, 3024, 3327, 3660, 4026, 4428, 4871, 5358,
+    5894, 6484, 7132, 7845, 8630, 9493, 10442, 11487, 12635, 13899,
+    15289, 16818, 18500, 20350, 22385, 24623, 27086, 29794, 32767
+};
+
+/* Shared by the encoder and the decoder, so that they never drift apart */
+static Sint16 adpcmstep(Sint32* predictor, int* index, const int code)
+{
+    const int step = adpcm_step_table[*index];
+    int diff = step >> 3;
+
+    if (code & 4)
+    {
+        diff += step;
+    }
+    if (code & 2)
+    {
+        diff += step >> 1;
+    }
+    if (code & 1)
+    {
+        diff += step >> 2;
+    }
+
+    *predictor += code & 8 ? -diff : diff;
+    *predictor = clamp(*predictor, -32768, 32767);
+    *index = clamp(*index + adpcm_index_table[code], 0, 88);
+
+    return *predictor;
+}
+
+static int adpcmencode(Sint32* predictor, int* index, const Sint16 sample)
+{
+    int step = adpcm_step_table[*index];
+    int diff = sample - *predictor;
+    int code = 0;
+
+    if (diff < 0)
+    {
+        code = 8;
+        diff = -diff;
+    }
+    if (diff >= step)
+    {
+        code |= 4;
+        diff -= step;
+    }
+    step >>= 1;
+    if (diff >= step)
+    {
+        code |= 2;
+        diff -= step;
+    }
+    step >>= 1;
+    if (diff >= step)
+    {
+        code |= 1;
+    }
+
+    adpcmstep(predictor, index, code);
+    return code;
+}
+
+void ADPCM_start(adpcmdecoder* decoder, const adpcmsound* sound)
+{
+    SDL_zerop(decoder);
+    decoder->sound = *sound;
+}
+
+int ADPCM_decode(adpcmdecoder* decoder, Sint16* out, const int frames)
+{
+    const adpcmsound* sound = &decoder->sound;
+    const int channels = sound->channels;
+    const Uint32 end = sound->frames * channels;
+    int done = 0;
+
+    for (; done < frames && decoder->pos < end; done++)
+    {
+        for (int ch = 0; ch < channels; ch++)
+        {
+            const Uint8 byte = sound->data[decoder->pos >> 1];
+            const int code = decoder->pos & 1 ? byte >> 4 : byte & 0x0F;
+
+            out[done * 2 + ch] = adpcmstep(&decoder->predictor[ch], &decoder->index[ch], code);
+            decoder->pos++;
+        }
+
+        if (channels == 1)
+        {
+            out[done * 2 + 1] = out[done * 2];
+        }
+    }
+
+    return done;
+}
+
+/* Mix_LoadWAV_RW() turns mono into stereo, undo that where it can */
+static int countchannels(const Sint16* samples, const Uint32 frames)
 {
-    m_music = Mix_LoadMUS(fileName);
-    m_isValid = true;
-    if(m_music == NULL)
+    for (Uint32 i = 0; i < frames; i++)
     {
-        vlog_error("Unable to load Ogg Music file: %s", Mix_GetError());
-        m_isValid = false;
+        if (samples[i * 2] != samples[i * 2 + 1])
+        {
+            return 2;
+        }
     }
+    return 1;
 }
 
-MusicTrack::MusicTrack(SDL_RWops *rw)
+static void encodechunk(adpcmsound* sound, const Mix_Chunk* chunk)
 {
-    m_music = Mix_LoadMUS_RW(rw, 1);
-    m_isValid = true;
-    if(m_music == NULL)
+    const Sint16* samples = (const Sint16*) chunk->abuf;
+    const Uint32 frames = chunk->alen / (2 * sizeof(Sint16));
+    const int channels = countchannels(samples, frames);
+    const Uint32 nibbles = frames * channels;
+    Sint32 predictor[2] = {0, 0};
+    int index[2] = {0, 0};
+
+    sound->data = (Uint8*) RAM_mallocTagged((nibbles + 1) / 2, RAM_TAG_AUDIO);
+    if (sound->data == NULL)
+    {
+        VVV_exit(1);
+    }
+    SDL_memset(sound->data, 0, (nibbles + 1) / 2);
+    sound->frames = frames;
+    sound->channels = channels;
+
+    for (Uint32 i = 0; i < nibbles; i++)
     {
-        vlog_error("Unable to load Magic Binary Music file: %s", Mix_GetError());
-        m_isValid = false;
+        const int ch = i % channels;
+        const Uint32 frame = i / channels;
+        const int code = adpcmencode(&predictor[ch], &index[ch], samples[frame * 2 + ch]);
+
+        sound->data[i >> 1] |= i & 1 ? code << 4 : code;
     }
 }
 
-SoundTrack::SoundTrack(const char* fileName)
+SoundTrack::SoundTrack(const char* fileName_)
+{
+    fileName = fileName_;
+    SDL_zero(sound);
+    pcm = NULL;
+    plays = 0;
+    SDL_AtomicSet(&users, 0);
+}
+
+void SoundTrack::load(void)
 {
     unsigned char *mem;
     size_t length;
 
     vlog_info("MUSIC | SoundTrack %s", fileName);
 
-    sound = NULL;
-
     FILESYSTEM_loadAssetToMemory(fileName, &mem, &length, false);
     if (mem == NULL)
     {
@@ -44,25 +181,45 @@ SoundTrack::SoundTrack(const char* fileName)
         return;
     }
     SDL_RWops *fileIn = SDL_RWFromConstMem(mem, length);
-    sound = Mix_LoadWAV_RW(fileIn, 1);
+    Mix_Chunk* chunk = Mix_LoadWAV_RW(fileIn, 1);
     FILESYSTEM_freeMemory(&mem);
 
-    if (sound == NULL)
+    if (chunk == NULL)
     {
         vlog_error("Unable to load WAV file: %s", Mix_GetError());
+        return;
     }
+
+    /* Only the compressed copy stays around, it's decoded as it plays */
+    encodechunk(&sound, chunk);
+    Mix_FreeChunk(chunk);
+}
+
+void SoundTrack::clear(void)
+{
+    RAM_free(sound.data);
+    RAM_free(pcm);
+    SDL_zero(sound);
+    pcm = NULL;
+}
+
+Uint32 SoundTrack::pcmbytes(void)
+{
+    return sound.frames * 2 * sizeof(Sint16);
 }
 
 SoundSystem::SoundSystem(void)
 {
-    int audio_rate = 44100;
+#ifndef HEADLESS
+    int audio_rate = frequency;
     Uint16 audio_format = AUDIO_S16SYS;
     int audio_channels = 2;
-    int audio_buffers = 1024;
+    int audio_buffers = buffer_frames;
 
     if (Mix_OpenAudio(audio_rate, audio_format, audio_channels, audio_buffers) != 0)
     {
         vlog_error("Unable to initialize audio: %s", Mix_GetError());
         SDL_assert(0 && "Unable to initialize audio!");
     }
+#endif
 }
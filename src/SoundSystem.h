@@ -3,26 +3,57 @@
 
 #include <SDL2/SDL_mixer.h>
 
-class MusicTrack
+/* 4-bit IMA ADPCM, a quarter the size of 16-bit PCM. Channels are
+ * interleaved a nibble each, low nibble first. */
+struct adpcmsound
 {
-public:
-    MusicTrack(const char* fileName);
-    MusicTrack(SDL_RWops *rw);
-    Mix_Music *m_music;
-    bool m_isValid;
+    Uint8* data;
+    Uint32 frames;
+    int channels;
 };
 
+struct adpcmdecoder
+{
+    adpcmsound sound;
+    /* In nibbles */
+    Uint32 pos;
+    Sint32 predictor[2];
+    int index[2];
+};
+
+void ADPCM_start(adpcmdecoder* decoder, const adpcmsound* sound);
+
+/* Decodes up to frames of 16-bit stereo into out, returns how many */
+int ADPCM_decode(adpcmdecoder* decoder, Sint16* out, int frames);
+
 class SoundTrack
 {
 public:
     SoundTrack(const char* fileName);
-    Mix_Chunk *sound;
+    /* Safe to call from a job, see Jobs.h */
+    void load(void);
+    void clear(void);
+
+    /* What Mix_LoadWAV_RW() would have kept around */
+    Uint32 pcmbytes(void);
+
+    const char* fileName;
+    adpcmsound sound;
+    /* Decoded copy, for effects that are played a lot. NULL if not. */
+    Sint16* pcm;
+    int plays;
+    /* Voices playing pcm, it can't be let go of until that's 0 */
+    SDL_atomic_t users;
 };
 
 class SoundSystem
 {
 public:
     SoundSystem(void);
+
+    static const int frequency = 44100;
+    /* Per audio callback */
+    static const int buffer_frames = 1024;
 };
 
 #endif /* SOUNDSYSTEM_H */
@@ -2,18 +2,26 @@
 
 #include "Game.h"
 #include "Entity.h"
+#include "LevelPack.h"
 #include "MakeAndPlay.h"
+#include "Map.h"
 
-const short* spacestation2class::loadlevel(int rx, int ry)
+int spacestation2class::roomindex(int rx, int ry)
 {
-    int t;
     rx -= 100;
     ry -= 100;
 
     rx += 50 - 12;
     ry += 50 - 14;   //Space Station
 
-    t = rx + (ry * 100);
+    return rx + (ry * 100);
+}
+
+const short* spacestation2class::loadlevel(int rx, int ry)
+{
+    int t;
+
+    t = roomindex(rx, ry);
 
     const short* result;
     roomname = "Untitled room";
@@ -24,7 +32,7 @@ const short* spacestation2class::loadlevel(int rx, int ry)
     case rn(50,50):
     {
 
-        static const short contents[] = {
+        ROOM_CONTENTS(LEVELPACK_SPACESTATION2, t, 0, {
         492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,
         492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,
         492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,
@@ -55,7 +63,7 @@ const short* spacestation2class::loadlevel(int rx, int ry)
         0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,276,277,277,277,277,277,278,0,0,0,
         0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
         0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-        };
+        });
 
         obj.createentity(96, 40, 10, 0, 450500);  // (savepoint)
         if(game.intimetrial)
@@ -72,7 +80,7 @@ const short* spacestation2class::loadlevel(int rx, int ry)
     case rn(49,50):
     {
 
-        static const short contents[] = {
+        ROOM_CONTENTS(LEVELPACK_SPACESTATION2, t, 0, {
         295,295,295,295,295,295,417,698,698,698,698,415,295,295,295,295,295,295,295,295,295,295,295,295,295,295,295,295,295,295,295,295,295,295,295,295,295,295,295,295,
         295,295,295,295,295,295,417,698,698,698,698,415,295,295,295,295,295,295,295,295,295,295,295,295,295,295,295,295,295,295,295,295,295,295,295,295,295,295,295,295,
         295,295,295,295,295,295,417,698,698,698,698,415,295,295,295,295,295,295,295,295,295,295,295,295,295,295,295,295,295,295,295,295,295,295,295,295,295,295,295,295,
@@ -103,7 +111,7 @@ const short* spacestation2class::loadlevel(int rx, int ry)
         0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
         0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
         0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-        };
+        });
 
         roomname = "The Filter"; //If not yet in level, use "The Space Station"
         result = contents;
@@ -113,7 +121,7 @@ const short* spacestation2class::loadlevel(int rx, int ry)
     case rn(49,49):
     {
 
-        static const short contents[] = {
+        ROOM_CONTENTS(LEVELPACK_SPACESTATION2, t, 0, {
         107,107,107,107,107,107,229,689,689,689,689,227,107,107,229,689,689,689,689,689,227,107,107,107,107,107,107,107,107,107,107,108,268,268,268,268,268,268,268,268,
         107,107,107,107,107,107,229,689,689,689,689,227,107,107,229,689,689,689,689,689,227,107,107,107,107,107,107,107,107,107,107,229,0,0,0,0,0,0,0,0,
         107,107,107,107,107,107,229,850,850,691,689,227,107,107,229,689,689,689,689,689,227,107,107,107,107,107,107,107,107,107,107,229,689,811,0,0,0,0,0,0,
@@ -144,7 +152,7 @@ const short* spacestation2class::loadlevel(int rx, int ry)
         107,107,107,107,107,107,229,689,689,689,689,227,107,107,107,107,107,107,107,148,188,188,188,188,188,188,188,188,188,188,188,188,188,188,188,188,149,107,107,107,
         107,107,107,107,107,107,229,689,689,689,689,227,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,
         107,107,107,107,107,107,229,689,689,689,689,227,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,
-        };
+        });
 
         obj.createentity(128, 176, 10, 1, 449490);  // (savepoint)
         obj.createentity(160, 192, 3);  //Disappearing Platform
@@ -163,7 +171,7 @@ const short* spacestation2class::loadlevel(int rx, int ry)
     case rn(49,48):
     {
 
-        static const short contents[] = {
+        ROOM_CONTENTS(LEVELPACK_SPACESTATION2, t, 0, {
         289,289,289,289,289,289,411,0,0,800,680,409,289,289,411,680,680,680,680,680,409,289,289,289,289,289,289,289,289,289,289,411,0,0,0,0,409,289,289,289,
         289,289,289,289,289,289,411,0,0,800,680,409,289,289,411,680,680,680,680,680,409,289,289,289,289,289,289,289,289,289,289,411,0,0,0,0,409,289,289,289,
         289,289,289,289,289,289,411,0,0,800,680,409,289,289,411,680,680,680,680,680,409,289,289,289,289,289,289,289,289,289,289,411,0,0,0,0,409,289,289,289,
@@ -194,7 +202,7 @@ const short* spacestation2class::loadlevel(int rx, int ry)
         289,289,289,289,289,289,411,680,680,680,680,409,289,289,411,680,680,680,680,680,409,289,289,289,289,289,289,289,289,289,289,289,289,289,289,289,289,289,289,289,
         289,289,289,289,289,289,411,680,680,680,680,409,289,289,411,680,680,680,680,680,409,289,289,289,289,289,289,289,289,289,289,289,289,289,289,289,289,289,289,289,
         289,289,289,289,289,289,411,680,680,680,680,409,289,289,411,680,680,680,680,680,409,289,289,289,289,289,289,289,289,289,289,289,289,289,289,289,289,289,289,289,
-        };
+        });
 
         obj.createentity(192, 96, 9, 2);  // (shiny trinket)
         roomname = "One Way Room";
@@ -206,7 +214,7 @@ const short* spacestation2class::loadlevel(int rx, int ry)
     case rn(49,47):
     {
 
-        static const short contents[] = {
+        ROOM_CONTENTS(LEVELPACK_SPACESTATION2, t, 0, {
         92,92,92,92,92,92,92,92,92,92,92,92,92,92,92,92,92,92,92,92,92,92,92,92,92,92,92,92,92,92,92,92,92,92,92,92,92,92,92,92,
         92,92,92,92,92,92,92,92,92,92,92,92,92,92,92,92,92,92,92,92,92,92,92,92,92,92,92,92,92,92,92,92,92,92,93,253,253,253,253,253,
         92,92,92,92,92,92,93,253,253,253,253,253,253,253,253,253,253,253,253,253,253,253,253,253,253,253,253,253,253,253,253,253,253,253,254,9,9,9,9,9,
@@ -237,7 +245,7 @@ const short* spacestation2class::loadlevel(int rx, int ry)
         92,92,92,92,92,92,214,0,0,803,683,212,92,92,214,683,683,683,683,683,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,212,92,92,92,
         92,92,92,92,92,92,214,0,0,803,683,212,92,92,214,683,683,683,683,683,172,173,173,173,173,173,173,173,173,173,173,174,0,0,0,0,212,92,92,92,
         92,92,92,92,92,92,214,0,0,803,683,212,92,92,214,683,683,683,683,683,212,92,92,92,92,92,92,92,92,92,92,214,0,0,0,0,212,92,92,92,
-        };
+        });
 
         obj.createentity(56, 24, 2, 10, 4);  //Big Threadmill, >>>>>>
         obj.createentity(120, 24, 2, 10, 4);  //Big Threadmill, >>>>>>
@@ -266,7 +274,7 @@ const short* spacestation2class::loadlevel(int rx, int ry)
     case rn(50,47):
     {
 
-        static const short contents[] = {
+        ROOM_CONTENTS(LEVELPACK_SPACESTATION2, t, 0, {
         98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,
         259,259,259,259,259,259,259,259,259,259,259,259,100,98,98,98,98,98,98,98,98,98,98,98,98,98,98,99,259,259,259,259,259,259,259,259,100,98,98,98,
         9,9,9,9,9,9,9,9,9,9,9,9,258,259,259,259,259,259,259,259,259,259,259,259,259,259,259,260,7,7,7,7,7,7,7,7,218,98,98,98,
@@ -297,7 +305,7 @@ const short* spacestation2class::loadlevel(int rx, int ry)
         98,98,98,220,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,218,98,98,220,0,0,0,0,218,98,98,98,
         98,98,98,220,0,0,0,0,178,179,179,179,179,179,179,179,179,179,179,179,179,179,179,179,179,179,179,179,140,98,98,220,0,0,0,0,218,98,98,98,
         98,98,98,220,0,0,0,0,218,98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,220,0,0,0,0,218,98,98,98,
-        };
+        });
 
         obj.createentity(0, 72, 2, 10, 4);  //Big Threadmill, >>>>>>
         obj.createentity(96, 24, 2, 10, 4);  //Big Threadmill, >>>>>>
@@ -324,7 +332,7 @@ const short* spacestation2class::loadlevel(int rx, int ry)
     case rn(50,48):
     {
 
-        static const short contents[] = {
+        ROOM_CONTENTS(LEVELPACK_SPACESTATION2, t, 0, {
         292,292,292,414,0,0,0,0,412,292,292,292,292,292,292,292,292,292,292,292,292,292,292,292,292,292,292,292,292,292,292,414,0,0,0,0,412,292,292,292,
         292,292,292,414,0,0,0,0,412,292,292,292,292,292,292,292,292,292,292,292,292,292,292,292,292,292,292,292,292,292,292,414,0,0,0,0,412,292,292,292,
         292,292,292,414,0,0,0,0,452,453,453,453,453,453,294,292,292,292,292,292,292,292,292,292,292,293,453,453,453,453,453,454,0,0,0,0,412,292,292,292,
@@ -355,7 +363,7 @@ const short* spacestation2class::loadlevel(int rx, int ry)
         292,292,292,292,292,292,292,292,292,292,292,292,292,292,292,292,292,292,292,292,292,292,292,292,292,292,292,292,292,292,292,292,292,292,292,292,292,292,292,292,
         292,292,292,292,292,292,292,292,292,292,292,292,292,292,292,292,292,292,292,292,292,292,292,292,292,292,292,292,292,292,292,292,292,292,292,292,292,292,292,292,
         292,292,292,292,292,292,292,292,292,292,292,292,292,292,292,292,292,292,292,292,292,292,292,292,292,292,292,292,292,292,292,292,292,292,292,292,292,292,292,292,
-        };
+        });
 
         obj.platformtile = 119;
         obj.createentity(64, 72, 2, 0, 4, 64, 72, 256, 160);  // Platform, bounded
@@ -373,7 +381,7 @@ const short* spacestation2class::loadlevel(int rx, int ry)
     case rn(50,49):
     {
 
-        static const short contents[] = {
+        ROOM_CONTENTS(LEVELPACK_SPACESTATION2, t, 0, {
         274,274,274,274,274,274,274,274,274,274,274,274,115,113,113,113,113,113,113,113,113,113,113,113,113,113,113,114,274,274,274,274,274,274,274,274,274,274,274,274,
         0,0,0,0,0,0,0,0,0,0,0,0,273,115,113,113,113,113,113,113,113,113,113,113,113,113,114,275,0,0,0,0,0,0,0,0,0,0,0,0,
         0,0,0,0,0,0,0,0,0,0,0,0,9,233,113,113,113,113,113,113,113,113,113,113,113,113,235,9,0,0,0,0,0,0,0,0,0,0,0,0,
@@ -404,7 +412,7 @@ const short* spacestation2class::loadlevel(int rx, int ry)
         113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,235,8,8,8,8,233,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,
         113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,154,194,194,194,194,155,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,
         113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,
-        };
+        });
 
         obj.createentity(144, 200, 3, 51);  //Disappearing Platform
         obj.createentity(24, 16, 10, 0, 449500);  // (savepoint)
@@ -421,7 +429,7 @@ const short* spacestation2class::loadlevel(int rx, int ry)
     case rn(51,49):
     {
 
-        static const short contents[] = {
+        ROOM_CONTENTS(LEVELPACK_SPACESTATION2, t, 0, {
         244,244,244,244,244,244,244,244,244,244,244,244,244,244,244,244,244,244,244,244,244,244,244,244,85,83,83,83,83,83,83,83,83,83,83,83,83,83,83,83,
         0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,243,244,244,244,244,244,244,244,244,244,244,244,244,244,244,244,
         0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,800,680,680,680,680,680,7,7,7,7,7,7,7,7,7,7,7,1125,9,9,9,9,
@@ -452,7 +460,7 @@ const short* spacestation2class::loadlevel(int rx, int ry)
         83,83,83,124,164,164,164,164,164,164,164,164,164,164,164,164,164,164,164,164,164,164,164,164,125,83,83,83,83,83,83,83,83,83,83,83,83,83,83,83,
         83,83,83,83,83,83,83,83,83,83,83,83,83,83,83,83,83,83,83,83,83,83,83,83,83,83,83,83,83,83,83,83,83,83,83,83,83,83,83,83,
         83,83,83,83,83,83,83,83,83,83,83,83,83,83,83,83,83,83,83,83,83,83,83,83,83,83,83,83,83,83,83,83,83,83,83,83,83,83,83,83,
-        };
+        });
 
         obj.createentity(0, 8, 2, 11, 4);  //Big Threadmill, <<<<<<
         obj.createentity(64, 8, 2, 11, 4);  //Big Threadmill, <<<<<<
@@ -476,7 +484,7 @@ const short* spacestation2class::loadlevel(int rx, int ry)
     case rn(52,49):
     {
 
-        static const short contents[] = {
+        ROOM_CONTENTS(LEVELPACK_SPACESTATION2, t, 0, {
         283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,
         444,444,444,444,444,444,444,444,444,444,444,444,444,444,444,444,444,444,444,444,444,444,444,444,444,444,444,444,444,444,444,444,444,444,444,444,444,444,444,444,
         9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,
@@ -507,7 +515,7 @@ const short* spacestation2class::loadlevel(int rx, int ry)
         283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,
         283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,
         283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,
-        };
+        });
 
         obj.createentity(0, 104, 2, 11, 4);  //Big Threadmill, <<<<<<
         obj.createentity(128, 104, 2, 11, 4);  //Big Threadmill, <<<<<<
@@ -532,7 +540,7 @@ const short* spacestation2class::loadlevel(int rx, int ry)
     case rn(53,49):
     {
 
-        static const short contents[] = {
+        ROOM_CONTENTS(LEVELPACK_SPACESTATION2, t, 0, {
         107,107,107,107,107,107,107,107,229,0,0,0,0,809,689,689,227,107,107,107,107,107,107,229,689,689,811,0,0,0,0,227,107,107,107,107,107,107,107,107,
         268,268,268,268,268,268,268,268,269,0,0,0,0,809,689,689,227,107,107,107,107,107,107,229,689,689,811,0,0,0,0,267,268,268,268,268,268,268,268,268,
         9,9,9,9,9,9,9,9,9,0,0,0,0,809,689,689,227,107,107,107,107,107,107,229,689,689,811,0,0,0,0,9,9,9,9,9,9,9,9,9,
@@ -563,7 +571,7 @@ const short* spacestation2class::loadlevel(int rx, int ry)
         107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,
         107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,
         107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,
-        };
+        });
 
         obj.createentity(0, 104, 2, 11, 4);  //Big Threadmill, <<<<<<
         obj.createentity(64, 104, 2, 11, 4);  //Big Threadmill, <<<<<<
@@ -583,7 +591,7 @@ const short* spacestation2class::loadlevel(int rx, int ry)
     case rn(54,49):
     {
 
-        static const short contents[] = {
+        ROOM_CONTENTS(LEVELPACK_SPACESTATION2, t, 0, {
         92,92,92,92,92,92,92,92,92,92,92,92,92,92,92,92,92,92,92,92,92,92,92,92,92,92,92,214,0,0,0,0,0,0,0,0,212,92,92,92,
         253,253,253,253,253,253,253,253,253,253,253,253,253,253,253,253,253,253,253,253,253,253,253,253,253,253,253,254,0,0,0,0,0,0,0,0,212,92,92,92,
         9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,0,0,0,0,0,0,0,0,212,92,92,92,
@@ -614,7 +622,7 @@ const short* spacestation2class::loadlevel(int rx, int ry)
         92,92,92,92,92,92,92,92,92,92,92,92,92,92,92,92,92,92,92,92,92,92,92,92,92,92,92,92,92,92,92,92,92,92,92,92,92,92,92,92,
         92,92,92,92,92,92,92,92,92,92,92,92,92,92,92,92,92,92,92,92,92,92,92,92,92,92,92,92,92,92,92,92,92,92,92,92,92,92,92,92,
         92,92,92,92,92,92,92,92,92,92,92,92,92,92,92,92,92,92,92,92,92,92,92,92,92,92,92,92,92,92,92,92,92,92,92,92,92,92,92,92,
-        };
+        });
 
         obj.platformtile = 319;
         obj.createentity(0, 104, 2, 11, 4);  //Big Threadmill, <<<<<<
@@ -634,7 +642,7 @@ const short* spacestation2class::loadlevel(int rx, int ry)
     case rn(54,48):
     {
 
-        static const short contents[] = {
+        ROOM_CONTENTS(LEVELPACK_SPACESTATION2, t, 0, {
         483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,
         644,644,644,644,644,644,644,644,644,644,644,644,485,483,483,484,644,644,644,644,644,644,644,644,644,644,644,644,644,644,644,644,644,644,644,644,485,483,483,483,
         0,0,0,0,0,0,0,0,0,0,0,0,643,644,644,645,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,603,483,483,483,
@@ -665,7 +673,7 @@ const short* spacestation2class::loadlevel(int rx, int ry)
         483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,605,0,0,0,0,0,0,0,0,603,483,483,483,
         483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,605,0,0,0,0,0,0,0,0,603,483,483,483,
         483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,605,0,0,0,0,0,0,0,0,603,483,483,483,
-        };
+        });
 
         obj.platformtile = 10;
         obj.createentity(264, 128, 10, 0, 448540);  // (savepoint)
@@ -685,7 +693,7 @@ const short* spacestation2class::loadlevel(int rx, int ry)
     case rn(53,48):
     {
 
-        static const short contents[] = {
+        ROOM_CONTENTS(LEVELPACK_SPACESTATION2, t, 0, {
         510,510,510,510,510,510,510,510,510,510,510,510,510,510,510,510,510,510,510,510,510,510,510,510,510,510,510,510,510,510,510,510,510,510,510,510,510,510,510,510,
         671,671,671,671,671,671,671,671,671,671,512,511,671,671,671,671,671,671,671,671,671,671,671,671,671,671,512,511,671,671,671,671,671,671,671,671,671,671,671,671,
         9,9,9,9,9,9,9,9,9,9,630,632,9,9,9,9,9,9,9,9,9,9,9,9,9,9,630,632,9,9,9,9,0,0,0,0,0,0,0,0,
@@ -716,7 +724,7 @@ const short* spacestation2class::loadlevel(int rx, int ry)
         510,510,510,510,510,510,510,510,632,0,0,0,0,818,698,698,630,510,510,510,510,510,510,632,698,698,820,0,0,0,0,630,510,510,510,510,510,510,510,510,
         510,510,510,510,510,510,510,510,632,0,0,0,0,818,698,698,630,510,510,510,510,510,510,632,698,698,820,0,0,0,0,630,510,510,510,510,510,510,510,510,
         510,510,510,510,510,510,510,510,632,0,0,0,0,818,698,698,630,510,510,510,510,510,510,632,698,698,820,0,0,0,0,630,510,510,510,510,510,510,510,510,
-        };
+        });
 
         obj.platformtile = 279;
         obj.createentity(32, 168, 9, 3);  // (shiny trinket)
@@ -740,7 +748,7 @@ const short* spacestation2class::loadlevel(int rx, int ry)
     case rn(52,48):
     {
 
-        static const short contents[] = {
+        ROOM_CONTENTS(LEVELPACK_SPACESTATION2, t, 0, {
         289,289,289,289,289,289,289,289,289,289,289,289,289,289,289,289,289,289,289,289,289,289,289,289,289,289,289,289,289,289,289,289,289,289,289,289,289,289,289,289,
         450,450,450,450,291,289,289,289,290,450,450,450,450,450,450,450,450,450,291,289,289,290,450,450,450,450,450,450,450,450,450,291,289,289,289,290,450,450,450,450,
         9,9,9,9,409,289,289,289,411,7,7,7,7,7,7,7,7,7,409,289,289,411,7,7,7,7,7,7,7,7,7,409,289,289,289,411,9,9,9,9,
@@ -771,7 +779,7 @@ const short* spacestation2class::loadlevel(int rx, int ry)
         289,289,289,289,289,289,289,289,289,289,289,289,289,289,289,289,289,289,289,289,289,289,289,289,289,289,289,289,289,289,289,289,289,289,289,289,289,289,289,289,
         289,289,289,289,289,289,289,289,289,289,289,289,289,289,289,289,289,289,289,289,289,289,289,289,289,289,289,289,289,289,289,289,289,289,289,289,289,289,289,289,
         289,289,289,289,289,289,289,289,289,289,289,289,289,289,289,289,289,289,289,289,289,289,289,289,289,289,289,289,289,289,289,289,289,289,289,289,289,289,289,289,
-        };
+        });
 
         obj.platformtile = 359;
         obj.createentity(256, 104, 2, 10, 4);  //Big Threadmill, >>>>>>
@@ -793,7 +801,7 @@ const short* spacestation2class::loadlevel(int rx, int ry)
     case rn(51,48):
     {
 
-        static const short contents[] = {
+        ROOM_CONTENTS(LEVELPACK_SPACESTATION2, t, 0, {
         313,313,313,313,313,313,313,435,0,0,0,0,433,313,313,313,313,313,313,313,313,313,313,313,313,313,313,313,313,313,313,313,313,313,313,313,313,313,313,313,
         313,313,313,313,313,313,313,435,0,0,0,0,433,313,313,313,313,313,313,313,313,313,313,313,313,313,313,314,474,474,474,474,474,474,474,474,474,474,474,474,
         313,313,313,313,313,313,313,435,770,770,771,0,433,313,313,313,313,313,313,313,313,313,313,313,313,313,313,435,9,9,9,9,9,9,9,9,9,9,9,9,
@@ -824,7 +832,7 @@ const short* spacestation2class::loadlevel(int rx, int ry)
         313,313,313,313,313,313,313,313,313,313,313,313,313,313,313,313,313,313,313,313,313,313,313,313,313,313,313,313,313,313,313,313,313,313,313,313,313,313,313,313,
         313,313,313,313,313,313,313,313,313,313,313,313,313,313,313,313,313,313,313,313,313,313,313,313,313,313,313,313,313,313,313,313,313,313,313,313,313,313,313,313,
         313,313,313,313,313,313,313,313,313,313,313,313,313,313,313,313,313,313,313,313,313,313,313,313,313,313,313,313,313,313,313,313,313,313,313,313,313,313,313,313,
-        };
+        });
 
         obj.createentity(256, 112, 2, 11, 4);  //Big Threadmill, <<<<<<
         obj.createentity(192, 112, 2, 11, 4);  //Big Threadmill, <<<<<<
@@ -849,7 +857,7 @@ const short* spacestation2class::loadlevel(int rx, int ry)
     case rn(51,47):
     {
 
-        static const short contents[] = {
+        ROOM_CONTENTS(LEVELPACK_SPACESTATION2, t, 0, {
         283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,405,0,0,0,0,403,283,283,283,283,283,283,283,283,283,283,283,283,283,283,
         283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,405,0,0,0,0,403,283,283,283,283,283,283,283,283,283,283,283,283,283,283,
         283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,405,0,0,0,0,403,283,283,283,283,283,283,283,283,283,283,283,283,283,283,
@@ -880,7 +888,7 @@ const short* spacestation2class::loadlevel(int rx, int ry)
         283,283,283,283,283,283,283,405,0,0,0,0,363,364,364,364,325,283,283,283,283,283,283,283,283,283,283,283,283,324,364,364,364,364,364,364,364,364,364,364,
         283,283,283,283,283,283,283,405,0,0,0,0,403,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,
         283,283,283,283,283,283,283,405,0,0,0,0,403,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,
-        };
+        });
 
         obj.createentity(72, 184, 10, 0, 447510);  // (savepoint)
         obj.createentity(80, 128, 2, 10, 4);  //Big Threadmill, >>>>>>
@@ -902,7 +910,7 @@ const short* spacestation2class::loadlevel(int rx, int ry)
     case rn(52,47):
     {
 
-        static const short contents[] = {
+        ROOM_CONTENTS(LEVELPACK_SPACESTATION2, t, 0, {
         310,311,471,471,471,471,471,471,471,471,471,471,471,471,471,471,471,471,471,471,312,310,310,310,310,310,310,432,0,0,0,0,430,432,0,0,0,0,0,0,
         310,432,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,430,310,310,310,310,310,310,432,0,0,0,0,430,432,0,0,0,0,0,0,
         310,432,0,0,0,0,0,0,772,773,773,773,773,773,773,773,773,773,773,773,430,310,310,310,310,310,310,432,0,0,0,0,430,432,0,0,0,0,0,0,
@@ -933,7 +941,7 @@ const short* spacestation2class::loadlevel(int rx, int ry)
         391,391,391,391,391,391,391,391,391,391,352,351,391,391,391,391,391,391,391,391,352,310,310,351,391,391,391,391,391,391,391,391,391,391,391,391,391,391,391,391,
         310,310,310,310,310,310,310,310,310,310,310,310,310,310,310,310,310,310,310,310,310,310,310,310,310,310,310,310,310,310,310,310,310,310,310,310,310,310,310,310,
         310,310,310,310,310,310,310,310,310,310,310,310,310,310,310,310,310,310,310,310,310,310,310,310,310,310,310,310,310,310,310,310,310,310,310,310,310,310,310,310,
-        };
+        });
 
         obj.createentity(8, 200, 10, 1, 447520);  // (savepoint)
         obj.createentity(200, 192, 9, 4);  // (shiny trinket)
@@ -953,7 +961,7 @@ const short* spacestation2class::loadlevel(int rx, int ry)
     case rn(51,46):
     {
 
-        static const short contents[] = {
+        ROOM_CONTENTS(LEVELPACK_SPACESTATION2, t, 0, {
         110,110,110,110,110,110,232,686,686,686,686,686,230,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,
         110,110,110,110,111,271,272,686,686,686,686,686,230,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,
         110,110,110,110,232,686,686,686,686,686,686,686,230,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,
@@ -984,7 +992,7 @@ const short* spacestation2class::loadlevel(int rx, int ry)
         110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,232,0,0,0,0,230,110,110,110,110,110,110,110,110,110,110,110,110,110,110,
         110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,232,0,0,0,0,230,110,110,110,110,110,110,110,110,110,110,110,110,110,110,
         110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,232,0,0,0,0,230,110,110,110,110,110,110,110,110,110,110,110,110,110,110,
-        };
+        });
 
         obj.createentity(176, 104, 10, 0, 446510);  // (savepoint)
 
@@ -1000,7 +1008,7 @@ const short* spacestation2class::loadlevel(int rx, int ry)
     case rn(51,45):
     {
 
-        static const short contents[] = {
+        ROOM_CONTENTS(LEVELPACK_SPACESTATION2, t, 0, {
         92,92,92,92,92,92,214,683,683,683,683,683,252,253,94,92,92,92,92,92,214,0,0,0,0,212,92,92,92,92,92,92,92,92,92,92,92,92,92,92,
         92,92,92,92,92,92,214,683,683,683,683,683,683,683,212,92,92,92,92,92,214,0,0,0,0,212,92,92,92,92,92,92,92,92,92,92,92,92,92,92,
         92,92,92,92,92,92,214,683,683,683,683,683,683,683,212,92,92,92,92,92,214,0,0,0,0,212,92,92,92,92,92,92,92,92,92,92,92,92,92,92,
@@ -1031,7 +1039,7 @@ const short* spacestation2class::loadlevel(int rx, int ry)
         92,92,92,92,92,92,214,683,683,683,683,683,172,173,134,92,92,92,92,92,92,92,92,92,92,92,92,92,92,92,92,92,92,92,92,92,92,92,92,92,
         92,92,92,92,92,92,214,683,683,683,683,683,212,92,92,92,92,92,92,92,92,92,92,92,92,92,92,92,92,92,92,92,92,92,92,92,92,92,92,92,
         92,92,92,92,92,92,214,683,683,683,683,683,212,92,92,92,92,92,92,92,92,92,92,92,92,92,92,92,92,92,92,92,92,92,92,92,92,92,92,92,
-        };
+        });
 
         obj.createentity(96, 168, 10, 0, 445510);  // (savepoint)
 
@@ -1050,7 +1058,7 @@ const short* spacestation2class::loadlevel(int rx, int ry)
     case rn(51,44):
     {
 
-        static const short contents[] = {
+        ROOM_CONTENTS(LEVELPACK_SPACESTATION2, t, 0, {
         292,292,292,292,292,292,292,292,292,292,292,292,292,292,292,292,292,292,292,292,292,292,292,292,292,292,292,292,292,292,292,292,292,292,292,292,292,292,292,292,
         292,292,292,292,292,292,292,292,292,292,292,292,292,292,292,292,292,292,292,292,292,292,292,292,292,292,292,292,292,293,453,453,453,453,453,453,453,294,292,292,
         292,292,292,292,292,292,292,292,292,292,292,292,292,292,292,292,292,292,292,292,292,292,292,292,292,292,292,292,293,454,0,0,0,0,0,0,0,412,292,292,
@@ -1081,7 +1089,7 @@ const short* spacestation2class::loadlevel(int rx, int ry)
         292,292,292,292,333,373,374,701,701,701,701,701,412,292,292,292,292,292,292,292,414,0,0,0,0,372,373,373,373,373,373,373,373,373,373,373,373,334,292,292,
         292,292,292,292,292,292,414,701,701,701,701,701,412,292,292,292,292,292,292,292,414,0,0,0,0,412,292,292,292,292,292,292,292,292,292,292,292,292,292,292,
         292,292,292,292,292,292,414,701,701,701,701,701,412,292,292,292,292,292,292,292,414,0,0,0,0,412,292,292,292,292,292,292,292,292,292,292,292,292,292,292,
-        };
+        });
 
         obj.createentity(224, 200, 10, 1, 444510);  // (savepoint)
 
@@ -1106,7 +1114,7 @@ const short* spacestation2class::loadlevel(int rx, int ry)
     case rn(52,45):
     {
 
-        static const short contents[] = {
+        ROOM_CONTENTS(LEVELPACK_SPACESTATION2, t, 0, {
         286,286,286,286,408,0,0,0,0,0,806,686,686,686,686,686,686,686,686,686,808,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
         286,286,286,286,408,0,0,0,0,0,806,686,686,686,686,686,686,686,686,686,808,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
         286,286,286,286,408,0,0,0,0,0,806,686,686,686,686,686,686,686,686,686,808,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
@@ -1137,7 +1145,7 @@ const short* spacestation2class::loadlevel(int rx, int ry)
         286,286,286,286,286,286,286,286,286,286,286,286,286,286,286,286,286,286,286,286,286,286,286,286,286,286,286,286,286,286,286,286,286,286,286,286,286,286,286,286,
         286,286,286,286,286,286,286,286,286,286,286,286,286,286,286,286,286,286,286,286,286,286,286,286,286,286,286,286,286,286,286,286,286,286,286,286,286,286,286,286,
         286,286,286,286,286,286,286,286,286,286,286,286,286,286,286,286,286,286,286,286,286,286,286,286,286,286,286,286,286,286,286,286,286,286,286,286,286,286,286,286,
-        };
+        });
         roomname = "Green Grotto";
         result = contents;
         break;
@@ -1146,7 +1154,7 @@ const short* spacestation2class::loadlevel(int rx, int ry)
     case rn(52,44):
     {
 
-        static const short contents[] = {
+        ROOM_CONTENTS(LEVELPACK_SPACESTATION2, t, 0, {
         98,98,98,98,220,0,0,0,0,0,800,680,218,98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,220,0,0,0,0,0,0,218,98,98,98,98,
         98,98,98,98,220,0,0,0,0,0,800,680,258,259,259,259,259,259,259,259,259,259,259,259,259,259,259,259,260,0,0,0,0,0,0,218,98,98,98,98,
         98,98,98,98,220,0,0,0,0,0,800,680,680,680,680,680,680,680,680,680,680,680,680,680,680,680,680,802,0,0,0,0,0,0,0,218,98,99,259,259,
@@ -1177,7 +1185,7 @@ const short* spacestation2class::loadlevel(int rx, int ry)
         98,98,98,98,220,0,0,0,0,0,800,680,680,680,680,680,680,680,680,680,802,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
         98,98,98,98,220,0,0,0,0,0,800,680,680,680,680,680,680,680,680,680,802,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
         98,98,98,98,220,0,0,0,0,0,800,680,680,680,680,680,680,680,680,680,802,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-        };
+        });
 
         obj.createentity(248 - 4, 160 - 48, 1, 1, 0);  // Enemy
         obj.createentity(124, 120, 20, 1);  // (terminal)
@@ -1194,7 +1202,7 @@ const short* spacestation2class::loadlevel(int rx, int ry)
     case rn(53,45):
     {
 
-        static const short contents[] = {
+        ROOM_CONTENTS(LEVELPACK_SPACESTATION2, t, 0, {
         0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
         0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
         0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
@@ -1225,7 +1233,7 @@ const short* spacestation2class::loadlevel(int rx, int ry)
         289,289,289,289,289,289,289,289,289,289,289,289,289,289,289,330,370,371,0,0,0,0,369,370,331,289,289,289,289,289,289,289,289,289,289,289,289,289,289,289,
         289,289,289,289,289,289,289,289,289,289,289,289,289,289,289,289,289,411,0,0,0,0,409,289,289,289,289,289,289,289,289,289,289,289,289,289,289,289,289,289,
         289,289,289,289,289,289,289,289,289,289,289,289,289,289,289,289,289,411,0,0,0,0,409,289,289,289,289,289,289,289,289,289,289,289,289,289,289,289,289,289,
-        };
+        });
 
         obj.createentity(152, 120, 10, 0, 445530);  // (savepoint)
         roomname = "doomS";
@@ -1236,7 +1244,7 @@ const short* spacestation2class::loadlevel(int rx, int ry)
     case rn(53,47):
     {
 
-        static const short contents[] = {
+        ROOM_CONTENTS(LEVELPACK_SPACESTATION2, t, 0, {
         0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
         0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
         0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
@@ -1267,7 +1275,7 @@ const short* spacestation2class::loadlevel(int rx, int ry)
         170,170,170,170,170,170,131,89,89,130,170,170,170,170,170,170,170,170,131,89,89,130,170,170,170,170,170,170,170,170,131,89,89,130,170,170,170,170,170,170,
         89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,
         89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,
-        };
+        });
 
         obj.createentity(24-60-8, 144-8, 1, 10, 0);  // Enemy
         //LIES Emitter, manually positioned
@@ -1284,7 +1292,7 @@ const short* spacestation2class::loadlevel(int rx, int ry)
     case rn(53,46):
     {
 
-        static const short contents[] = {
+        ROOM_CONTENTS(LEVELPACK_SPACESTATION2, t, 0, {
         289,289,289,289,289,289,289,289,289,289,289,289,289,289,289,289,289,411,0,0,0,0,409,289,289,289,289,289,289,289,289,289,289,289,289,289,289,289,289,289,
         289,289,289,289,289,289,289,289,289,289,289,289,289,289,289,290,450,451,0,0,0,0,449,450,291,289,289,289,289,289,289,289,289,289,289,289,289,289,289,289,
         450,450,450,450,450,450,450,450,450,450,450,450,450,450,450,451,0,0,0,0,0,0,0,0,449,450,450,450,450,450,450,450,450,450,450,450,450,450,450,450,
@@ -1315,7 +1323,7 @@ const short* spacestation2class::loadlevel(int rx, int ry)
         0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
         0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
         0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-        };
+        });
 
         obj.createentity(152, 96, 10, 1, 446530);  // (savepoint)
         roomname = "Swoop";
@@ -1326,7 +1334,7 @@ const short* spacestation2class::loadlevel(int rx, int ry)
     case rn(52,46):
     {
 
-        static const short contents[] = {
+        ROOM_CONTENTS(LEVELPACK_SPACESTATION2, t, 0, {
         107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,
         107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,
         107,107,108,268,268,268,268,268,268,268,268,268,268,268,268,268,268,268,268,268,268,268,268,268,268,268,268,268,268,268,268,268,268,268,268,268,268,268,268,268,
@@ -1357,7 +1365,7 @@ const short* spacestation2class::loadlevel(int rx, int ry)
         107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,229,0,0,0,0,227,229,0,0,0,0,0,0,
         107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,229,0,0,0,0,227,229,0,0,0,0,0,0,
         107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,229,0,0,0,0,227,229,0,0,0,0,0,0,
-        };
+        });
 
         obj.createentity(64, 40, 10, 1, 446520);  // (savepoint)
         obj.createentity(208, 88, 3, 827);  //Disappearing Platform
@@ -1373,7 +1381,7 @@ const short* spacestation2class::loadlevel(int rx, int ry)
     case rn(53,44):
     {
 
-        static const short contents[] = {
+        ROOM_CONTENTS(LEVELPACK_SPACESTATION2, t, 0, {
         89,89,89,89,89,89,89,89,89,89,89,89,89,89,211,0,0,0,0,0,0,0,0,0,0,209,89,89,89,89,89,89,89,89,89,89,89,89,89,89,
         89,89,89,89,89,89,89,89,89,89,89,89,89,89,211,0,0,0,0,0,0,0,0,0,0,209,89,89,89,89,89,89,89,89,89,89,89,89,89,89,
         250,250,250,250,250,250,250,250,250,250,250,250,91,89,211,0,0,0,0,0,0,0,0,0,0,209,89,90,250,250,250,250,250,250,250,250,250,250,250,250,
@@ -1404,7 +1412,7 @@ const short* spacestation2class::loadlevel(int rx, int ry)
         0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
         0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
         0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-        };
+        });
         roomname = "Sorrow";
         result = contents;
         break;
@@ -1414,7 +1422,7 @@ const short* spacestation2class::loadlevel(int rx, int ry)
     case rn(54,45):
     {
 
-        static const short contents[] = {
+        ROOM_CONTENTS(LEVELPACK_SPACESTATION2, t, 0, {
         0,0,0,0,0,433,313,435,0,0,809,689,473,474,474,474,474,474,474,315,313,313,313,313,313,313,313,313,313,435,689,689,811,0,0,433,313,313,313,313,
         0,0,0,0,0,433,313,435,0,0,809,689,689,689,689,689,689,689,689,433,313,313,313,313,313,313,313,313,313,435,689,689,811,0,0,433,313,313,313,313,
         0,0,0,0,0,433,313,435,0,0,809,689,689,689,689,689,689,689,689,473,474,474,474,474,474,474,474,315,313,435,689,689,811,0,0,433,313,313,313,313,
@@ -1445,7 +1453,7 @@ const short* spacestation2class::loadlevel(int rx, int ry)
         313,313,313,313,313,313,313,313,313,313,313,313,313,313,313,313,435,0,0,0,0,0,0,0,0,0,0,433,313,313,313,313,313,313,313,313,313,313,313,313,
         313,313,313,313,313,313,313,313,313,313,313,313,313,313,313,313,354,394,394,394,394,394,394,394,394,394,394,355,313,313,313,313,313,313,313,313,313,313,313,313,
         313,313,313,313,313,313,313,313,313,313,313,313,313,313,313,313,313,313,313,313,313,313,313,313,313,313,313,313,313,313,313,313,313,313,313,313,313,313,313,313,
-        };
+        });
 
         obj.createentity(144-4, 208, 1, 1, 6);  // Enemy
         obj.createentity(128+4, 8, 1, 0, 6);  // Enemy
@@ -1476,7 +1484,7 @@ const short* spacestation2class::loadlevel(int rx, int ry)
     case rn(54,44):
     {
 
-        static const short contents[] = {
+        ROOM_CONTENTS(LEVELPACK_SPACESTATION2, t, 0, {
         86,86,86,86,86,86,86,86,86,86,86,86,86,86,86,86,86,86,86,86,86,86,86,86,86,86,86,86,86,86,86,86,86,86,86,86,86,86,86,86,
         86,86,86,86,86,86,86,86,86,86,86,86,86,86,86,86,86,86,87,247,247,247,247,247,247,247,247,247,247,247,247,247,247,247,247,247,247,247,247,247,
         247,247,247,247,247,88,86,86,86,86,86,86,86,86,86,86,86,86,208,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
@@ -1507,7 +1515,7 @@ const short* spacestation2class::loadlevel(int rx, int ry)
         0,0,0,0,0,206,86,208,0,0,818,698,206,86,86,86,86,86,86,86,86,86,86,86,86,86,86,86,86,208,698,698,820,0,0,206,86,86,86,86,
         0,0,0,0,0,206,86,208,0,0,818,698,206,86,86,86,86,86,86,86,86,86,86,86,86,86,86,86,86,208,698,698,820,0,0,206,86,86,86,86,
         0,0,0,0,0,206,86,208,0,0,818,698,206,86,86,86,86,86,86,86,86,86,86,86,86,86,86,86,86,208,698,698,820,0,0,206,86,86,86,86,
-        };
+        });
 
         obj.createentity(184, 56, 2, 10, 4);  //Big Threadmill, >>>>>>
         obj.createentity(248, 56, 2, 10, 4);  //Big Threadmill, >>>>>>
@@ -1530,7 +1538,7 @@ const short* spacestation2class::loadlevel(int rx, int ry)
     case rn(54,47):
     {
 
-        static const short contents[] = {
+        ROOM_CONTENTS(LEVELPACK_SPACESTATION2, t, 0, {
         0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
         0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
         0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
@@ -1561,7 +1569,7 @@ const short* spacestation2class::loadlevel(int rx, int ry)
         167,167,167,167,128,86,86,86,86,86,86,86,86,86,86,86,86,86,86,86,86,86,86,86,86,86,86,86,86,86,86,86,86,86,86,86,86,86,86,86,
         86,86,86,86,86,86,86,86,86,86,86,86,86,86,86,86,86,86,86,86,86,86,86,86,86,86,86,86,86,86,86,86,86,86,86,86,86,86,86,86,
         86,86,86,86,86,86,86,86,86,86,86,86,86,86,86,86,86,86,86,86,86,86,86,86,86,86,86,86,86,86,86,86,86,86,86,86,86,86,86,86,
-        };
+        });
 
         obj.createentity(96, 80, 10, 1, 447540);  // (savepoint)
         obj.createentity(64, 184, 2, 10, 4);  //Big Threadmill, >>>>>>
@@ -1590,7 +1598,7 @@ const short* spacestation2class::loadlevel(int rx, int ry)
     case rn(54,46):
     {
 
-        static const short contents[] = {
+        ROOM_CONTENTS(LEVELPACK_SPACESTATION2, t, 0, {
         495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,
         495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,
         656,656,656,656,656,656,656,656,656,656,656,497,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,
@@ -1621,7 +1629,7 @@ const short* spacestation2class::loadlevel(int rx, int ry)
         0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
         0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
         0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-        };
+        });
 
         obj.createentity(64, 152, 10, 1, 446540);  // (savepoint)
         obj.createentity(120, 72, 3, 707);  //Disappearing Platform
@@ -1635,7 +1643,7 @@ const short* spacestation2class::loadlevel(int rx, int ry)
     case rn(55,47):
     {
 
-        static const short contents[] = {
+        ROOM_CONTENTS(LEVELPACK_SPACESTATION2, t, 0, {
         0,0,0,0,0,0,0,815,695,695,695,695,695,695,695,209,89,211,695,695,695,695,695,695,695,817,0,0,0,0,0,209,89,89,89,89,89,89,89,89,
         0,0,0,0,0,0,0,815,695,695,695,695,695,695,695,209,89,211,695,695,695,695,695,695,695,817,0,0,0,0,0,209,89,89,89,89,89,89,89,89,
         0,0,0,0,0,0,0,815,695,695,695,695,695,695,695,209,89,211,695,695,695,695,695,695,695,817,0,0,0,0,0,209,89,89,89,89,89,89,89,89,
@@ -1666,7 +1674,7 @@ const short* spacestation2class::loadlevel(int rx, int ry)
         89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,
         89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,
         89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,
-        };
+        });
 
         obj.createentity(0, 128, 2, 10, 4);  //Big Threadmill, >>>>>>
         obj.createentity(64, 128, 2, 10, 4);  //Big Threadmill, >>>>>>
@@ -1689,7 +1697,7 @@ const short* spacestation2class::loadlevel(int rx, int ry)
     case rn(55,46):
     {
 
-        static const short contents[] = {
+        ROOM_CONTENTS(LEVELPACK_SPACESTATION2, t, 0, {
         504,504,504,504,504,504,504,504,504,504,504,504,504,504,504,504,504,626,683,683,683,683,624,504,504,504,504,504,504,504,504,504,504,504,504,504,504,504,504,504,
         504,504,504,504,504,504,504,504,504,504,504,504,504,504,504,504,504,626,683,683,683,683,664,506,504,504,504,504,504,504,504,504,504,504,504,504,504,504,504,504,
         504,504,504,504,504,504,504,504,504,504,504,504,504,504,504,504,504,626,683,683,683,683,683,624,504,504,504,504,504,504,504,504,504,504,504,504,504,504,504,504,
@@ -1720,7 +1728,7 @@ const short* spacestation2class::loadlevel(int rx, int ry)
         0,0,0,0,0,0,0,803,683,683,683,683,683,683,683,624,504,626,683,683,683,683,683,683,683,805,0,0,0,0,0,624,504,504,504,504,504,504,504,504,
         0,0,0,0,0,0,0,803,683,683,683,683,683,683,683,624,504,626,683,683,683,683,683,683,683,805,0,0,0,0,0,624,504,504,504,504,504,504,504,504,
         0,0,0,0,0,0,0,803,683,683,683,683,683,683,683,624,504,626,683,683,683,683,683,683,683,805,0,0,0,0,0,624,504,504,504,504,504,504,504,504,
-        };
+        });
 
         obj.createentity(40, 72, 3, 787);  //Disappearing Platform
         roomname = "If You Fall Up";
@@ -1731,7 +1739,7 @@ const short* spacestation2class::loadlevel(int rx, int ry)
     case rn(55,45):
     {
 
-        static const short contents[] = {
+        ROOM_CONTENTS(LEVELPACK_SPACESTATION2, t, 0, {
         498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,620,0,0,0,0,618,498,
         498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,499,659,659,659,659,659,500,498,499,659,659,659,659,659,500,498,498,620,0,0,0,0,618,498,
         498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,620,0,0,0,0,0,618,498,620,0,0,0,0,0,618,498,498,620,0,0,0,0,618,498,
@@ -1762,7 +1770,7 @@ const short* spacestation2class::loadlevel(int rx, int ry)
         498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,620,695,695,695,695,618,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,
         498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,620,695,695,695,695,618,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,
         498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,620,695,695,695,695,618,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,
-        };
+        });
 
         obj.platformtile = 159;
         obj.createentity(24, 80, 2, 3, 6);  // Platform
@@ -1777,7 +1785,7 @@ const short* spacestation2class::loadlevel(int rx, int ry)
     case rn(55,44):
     {
 
-        static const short contents[] = {
+        ROOM_CONTENTS(LEVELPACK_SPACESTATION2, t, 0, {
         286,286,286,286,286,286,286,286,286,286,286,286,286,286,286,286,286,286,286,286,286,286,286,286,286,286,286,286,286,286,286,286,286,286,286,286,286,286,286,286,
         447,447,447,447,447,447,447,447,447,447,447,447,447,447,447,447,447,447,447,447,447,447,447,447,447,447,447,447,447,447,447,447,447,447,447,447,447,447,447,447,
         0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
@@ -1808,7 +1816,7 @@ const short* spacestation2class::loadlevel(int rx, int ry)
         286,286,286,286,286,286,286,286,286,286,286,286,286,286,286,286,286,286,286,286,286,286,286,286,286,286,286,286,286,286,286,286,286,408,0,0,0,0,406,286,
         286,286,286,286,286,286,286,286,286,286,286,286,286,286,286,286,286,286,286,286,286,286,286,286,286,286,286,286,286,286,286,286,286,408,0,0,0,0,406,286,
         286,286,286,286,286,286,286,286,286,286,286,286,286,286,286,286,286,286,286,286,286,286,286,286,286,286,286,286,286,286,286,286,286,408,0,0,0,0,406,286,
-        };
+        });
 
         obj.createentity(32, 40, 10, 1, 444560);  // (savepoint)
         obj.createentity(56, 24, 10, 0, 444551);  // (savepoint)
@@ -1850,7 +1858,7 @@ const short* spacestation2class::loadlevel(int rx, int ry)
     case rn(56,44):
     {
 
-        static const short contents[] = {
+        ROOM_CONTENTS(LEVELPACK_SPACESTATION2, t, 0, {
         298,298,298,298,298,298,298,420,0,0,0,0,418,298,298,298,298,298,298,298,298,298,298,298,298,298,298,298,298,298,298,298,298,298,298,298,298,298,298,298,
         459,459,459,459,459,459,459,460,0,0,0,0,418,298,298,298,298,298,298,298,298,299,459,459,459,459,300,298,298,298,298,298,298,298,298,298,298,298,298,298,
         0,0,0,0,0,0,0,0,0,0,0,0,418,298,298,298,298,298,298,298,298,420,9,9,9,9,418,298,298,298,298,298,298,298,298,298,298,298,298,298,
@@ -1881,7 +1889,7 @@ const short* spacestation2class::loadlevel(int rx, int ry)
         420,49,0,0,0,0,50,418,298,420,0,0,0,0,0,0,0,0,0,0,50,418,298,298,298,298,420,49,0,0,0,0,0,0,0,0,0,0,418,298,
         420,49,0,0,0,0,50,418,298,420,0,0,0,0,0,0,0,0,0,0,50,418,298,298,298,298,420,49,0,0,0,0,0,0,0,0,0,0,418,298,
         420,49,0,0,0,0,50,418,298,420,0,0,0,0,0,0,0,0,0,0,50,418,298,298,298,298,420,49,0,0,0,0,0,0,0,0,0,0,418,298,
-        };
+        });
 
         obj.createentity(176, 80, 3, 55);  //Disappearing Platform
         obj.createentity(0, 56, 2, 8, 4);  //Threadmill, >>>
@@ -1900,7 +1908,7 @@ const short* spacestation2class::loadlevel(int rx, int ry)
     case rn(56,45):
     {
 
-        static const short contents[] = {
+        ROOM_CONTENTS(LEVELPACK_SPACESTATION2, t, 0, {
         614,49,0,0,0,0,50,612,614,0,0,0,0,0,0,0,0,0,0,0,50,612,492,492,492,492,614,49,0,0,0,0,0,0,0,0,0,0,612,492,
         614,49,0,0,0,0,50,612,614,0,0,0,0,0,0,0,0,0,0,0,50,612,492,492,492,492,614,49,0,0,0,0,0,0,0,0,0,0,612,492,
         614,49,0,0,0,0,50,612,614,0,0,0,0,0,0,0,0,0,0,0,50,612,492,492,492,492,614,49,0,0,0,0,0,0,0,0,0,0,612,492,
@@ -1931,7 +1939,7 @@ const short* spacestation2class::loadlevel(int rx, int ry)
         614,49,0,0,0,0,50,612,492,492,492,492,492,492,492,492,492,492,492,492,492,533,574,49,0,0,0,0,0,0,0,0,50,612,492,492,492,492,492,492,
         614,49,0,0,0,0,50,612,492,492,492,492,492,492,492,492,492,492,492,492,492,492,614,49,0,0,0,0,0,0,0,0,50,612,492,492,492,492,492,492,
         614,49,0,0,0,0,50,612,492,492,492,492,492,492,492,492,492,492,492,492,492,492,614,49,0,0,0,0,0,0,0,0,50,612,492,492,492,492,492,492,
-        };
+        });
 
         roomname = "Your Bitter Tears... Delicious";
         result = contents;
@@ -1941,7 +1949,7 @@ const short* spacestation2class::loadlevel(int rx, int ry)
     case rn(56,46):
     {
 
-        static const short contents[] = {
+        ROOM_CONTENTS(LEVELPACK_SPACESTATION2, t, 0, {
         208,49,0,0,0,0,50,206,86,86,86,86,86,86,86,86,86,86,86,86,86,87,248,49,0,0,0,0,0,0,0,0,50,206,86,86,86,86,86,86,
         208,49,0,0,0,0,50,206,86,86,86,86,86,86,86,86,86,86,86,86,87,248,9,0,0,0,0,0,0,0,0,0,50,206,86,86,86,86,86,86,
         208,49,0,0,0,0,50,206,86,86,86,86,86,86,86,86,86,86,86,87,248,9,0,0,0,0,0,0,0,0,0,0,50,206,86,86,86,86,86,86,
@@ -1972,7 +1980,7 @@ const short* spacestation2class::loadlevel(int rx, int ry)
         208,49,0,0,0,0,50,206,86,86,86,86,86,86,86,86,86,208,0,0,0,0,50,206,86,86,208,0,0,0,0,206,86,86,86,86,86,86,86,86,
         208,49,0,0,0,0,50,206,86,86,86,86,86,86,86,86,86,208,0,0,0,0,50,206,86,86,208,0,0,0,0,206,86,86,86,86,86,86,86,86,
         208,49,0,0,0,0,50,206,86,86,86,86,86,86,86,86,86,208,0,0,0,0,50,206,86,86,208,0,0,0,0,206,86,86,86,86,86,86,86,86,
-        };
+        });
 
         roomname = "Easy Mode Unlocked";
         result = contents;
@@ -1982,7 +1990,7 @@ const short* spacestation2class::loadlevel(int rx, int ry)
     case rn(56,47):
     {
 
-        static const short contents[] = {
+        ROOM_CONTENTS(LEVELPACK_SPACESTATION2, t, 0, {
         217,49,0,0,0,0,50,215,95,95,95,95,95,95,95,95,95,217,0,0,0,0,50,215,95,95,217,0,0,0,0,215,95,95,95,95,95,95,95,95,
         217,49,0,0,0,0,50,215,95,95,95,95,95,95,95,95,95,217,0,0,0,0,50,215,95,95,217,0,0,0,0,215,95,95,95,95,95,95,95,95,
         217,49,0,0,0,0,50,215,95,95,95,95,95,95,95,95,95,217,0,0,0,0,50,215,95,95,217,0,0,0,0,215,95,95,95,95,95,95,95,95,
@@ -2013,7 +2021,7 @@ const short* spacestation2class::loadlevel(int rx, int ry)
         217,49,0,0,0,0,50,215,95,95,95,95,95,95,95,95,95,217,49,0,0,0,0,215,95,95,95,95,95,95,95,95,95,95,95,95,95,95,95,95,
         217,49,0,0,0,0,50,215,95,95,95,95,95,95,95,95,95,217,49,0,0,0,0,215,95,95,95,95,95,95,95,95,95,95,95,95,95,95,95,95,
         217,49,0,0,0,0,50,215,95,95,95,95,95,95,95,95,95,217,49,0,0,0,0,215,95,95,95,95,95,95,95,95,95,95,95,95,95,95,95,95,
-        };
+        });
 
         roomname = "Vici!";
         result = contents;
@@ -2023,7 +2031,7 @@ const short* spacestation2class::loadlevel(int rx, int ry)
     case rn(56,48):
     {
 
-        static const short contents[] = {
+        ROOM_CONTENTS(LEVELPACK_SPACESTATION2, t, 0, {
         432,49,0,0,0,0,50,430,310,310,310,310,310,310,310,310,310,432,49,0,0,0,0,430,310,310,310,310,310,310,310,310,310,310,310,310,310,310,310,310,
         432,49,0,0,0,0,50,430,310,310,310,310,310,310,310,310,310,432,49,0,0,0,0,430,310,310,310,310,310,310,310,310,310,310,310,310,310,310,310,310,
         432,49,0,0,0,0,50,430,310,310,310,310,310,310,310,310,310,432,49,0,0,0,0,470,312,310,310,310,310,310,310,310,310,310,310,310,310,310,310,310,
@@ -2054,7 +2062,7 @@ const short* spacestation2class::loadlevel(int rx, int ry)
         432,49,0,0,0,0,50,430,310,310,310,310,310,310,310,310,310,310,310,310,310,310,310,310,310,310,310,310,310,310,310,432,0,0,0,0,50,430,310,310,
         432,49,0,0,0,0,50,430,310,310,310,310,310,310,310,310,310,310,310,310,310,310,310,310,310,310,310,310,310,310,310,432,0,0,0,0,50,430,310,310,
         432,49,0,0,0,0,50,430,310,310,310,310,310,310,310,310,310,310,310,310,310,310,310,310,310,310,310,310,310,310,310,432,0,0,0,0,50,430,310,310,
-        };
+        });
 
         roomname = "Vidi";
         result = contents;
@@ -2064,7 +2072,7 @@ const short* spacestation2class::loadlevel(int rx, int ry)
     case rn(56,49):
     {
 
-        static const short contents[] = {
+        ROOM_CONTENTS(LEVELPACK_SPACESTATION2, t, 0, {
         220,49,0,0,0,0,50,218,98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,220,0,0,0,0,50,218,98,98,
         220,49,0,0,0,0,50,218,98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,220,0,0,0,0,50,218,98,98,
         220,49,0,0,0,0,50,218,98,98,98,98,98,98,98,98,98,98,98,98,98,98,99,259,259,259,259,259,259,259,259,260,0,0,0,0,50,218,98,98,
@@ -2095,7 +2103,7 @@ const short* spacestation2class::loadlevel(int rx, int ry)
         220,49,0,0,0,0,50,218,98,98,98,98,98,98,98,98,220,49,0,0,0,0,0,0,0,0,0,0,0,0,0,50,218,98,98,98,98,98,98,98,
         220,49,0,0,0,0,50,218,98,98,98,98,98,98,98,98,220,49,0,0,0,0,0,0,0,0,0,0,0,0,0,50,218,98,98,98,98,98,98,98,
         220,49,0,0,0,0,50,218,98,98,98,98,98,98,98,98,220,49,0,0,0,0,0,0,0,0,0,0,0,0,0,50,218,98,98,98,98,98,98,98,
-        };
+        });
 
         roomname="Veni";
         result = contents;
@@ -2105,7 +2113,7 @@ const short* spacestation2class::loadlevel(int rx, int ry)
     case rn(56,50):
     {
 
-        static const short contents[] = {
+        ROOM_CONTENTS(LEVELPACK_SPACESTATION2, t, 0, {
         211,49,0,0,0,0,50,209,89,89,89,89,89,89,89,89,211,49,0,0,0,0,0,0,0,0,0,0,0,0,0,50,209,89,89,89,89,89,89,89,
         211,49,0,0,0,0,50,209,89,89,89,89,89,89,89,89,211,49,0,0,0,0,0,0,0,0,0,0,0,0,0,50,209,89,89,89,89,89,89,89,
         211,49,0,0,0,0,50,209,89,89,89,89,89,89,89,89,211,49,0,0,0,0,0,0,0,0,0,0,0,0,0,50,209,89,89,89,89,89,89,89,
@@ -2136,7 +2144,7 @@ const short* spacestation2class::loadlevel(int rx, int ry)
         89,89,89,89,89,89,211,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,169,170,170,170,170,170,170,170,131,89,89,
         89,89,89,89,89,89,130,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,131,89,89,89,89,89,89,89,89,89,89,
         89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,
-        };
+        });
 
         obj.createentity(224, 144, 9, 5);  // (shiny trinket)
         obj.createentity(96, 152, 10, 1, 450560);  // (savepoint)
@@ -2153,7 +2161,7 @@ const short* spacestation2class::loadlevel(int rx, int ry)
     case rn(53,43):
     {
 
-        static const short contents[] = {
+        ROOM_CONTENTS(LEVELPACK_SPACESTATION2, t, 0, {
         495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,617,0,0,0,0,615,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,
         495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,617,0,0,0,0,615,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,
         495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,617,761,761,761,761,615,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,
@@ -2184,7 +2192,7 @@ const short* spacestation2class::loadlevel(int rx, int ry)
         495,495,495,495,495,495,495,495,495,495,495,495,495,495,617,0,0,0,0,0,0,0,0,0,0,615,495,495,495,495,495,495,495,495,495,495,495,495,495,495,
         495,495,495,495,495,495,495,495,495,495,495,495,495,495,617,0,0,0,0,0,0,0,0,0,0,615,495,495,495,495,495,495,495,495,495,495,495,495,495,495,
         495,495,495,495,495,495,495,495,495,495,495,495,495,495,617,0,0,0,0,0,0,0,0,0,0,615,495,495,495,495,495,495,495,495,495,495,495,495,495,495,
-        };
+        });
 
         obj.platformtile = 707;
         obj.createentity(272, 40, 2, 14, 2);  // Platform
@@ -2202,7 +2210,7 @@ const short* spacestation2class::loadlevel(int rx, int ry)
     case rn(56,43):
     {
 
-        static const short contents[] = {
+        ROOM_CONTENTS(LEVELPACK_SPACESTATION2, t, 0, {
         301,301,301,301,301,301,301,301,301,301,301,301,301,301,301,301,301,301,301,301,301,301,301,301,301,301,301,301,301,301,301,301,301,301,301,301,301,301,301,301,
         301,301,301,301,301,301,301,301,301,301,301,301,301,301,301,301,301,301,301,301,301,301,301,301,301,301,301,301,301,301,301,301,301,301,301,301,301,301,301,301,
         462,462,462,462,303,301,301,301,301,301,301,301,301,301,301,301,301,301,301,301,301,301,301,301,301,301,301,301,301,301,301,301,301,301,301,301,301,301,301,301,
@@ -2233,7 +2241,7 @@ const short* spacestation2class::loadlevel(int rx, int ry)
         301,301,301,301,301,301,301,423,0,0,0,0,421,301,301,301,301,301,301,301,301,301,301,301,301,301,301,301,301,301,301,301,301,301,301,301,301,301,301,301,
         301,301,301,301,301,301,301,423,0,0,0,0,421,301,301,301,301,301,301,301,301,301,301,301,301,301,301,301,301,301,301,301,301,301,301,301,301,301,301,301,
         301,301,301,301,301,301,301,423,0,0,0,0,421,301,301,301,301,301,301,301,301,301,301,301,301,301,301,301,301,301,301,301,301,301,301,301,301,301,301,301,
-        };
+        });
 
         obj.createentity(0, 168, 2, 11, 4);  //Big Threadmill, <<<<<<
         obj.createentity(64, 168, 2, 9, 4);  //Threadmill, <<<
@@ -2269,7 +2277,7 @@ const short* spacestation2class::loadlevel(int rx, int ry)
     case rn(55,43):
     {
 
-        static const short contents[] = {
+        ROOM_CONTENTS(LEVELPACK_SPACESTATION2, t, 0, {
         86,86,86,86,86,86,86,86,86,86,86,86,86,86,86,86,86,86,86,86,86,86,86,86,86,86,86,86,86,86,86,86,86,86,86,86,86,86,86,86,
         86,86,86,86,86,86,86,86,86,86,86,86,86,86,86,86,86,86,86,86,86,86,86,86,86,86,86,86,86,86,86,86,86,86,86,86,86,86,86,86,
         247,247,247,88,86,86,86,87,247,247,247,247,247,247,247,88,86,86,86,86,86,86,86,86,87,247,247,247,247,247,247,247,88,86,86,86,87,247,247,247,
@@ -2300,7 +2308,7 @@ const short* spacestation2class::loadlevel(int rx, int ry)
         86,86,86,86,86,86,86,86,86,86,86,86,86,86,86,86,86,86,86,86,86,86,86,86,86,86,86,86,86,86,86,86,86,86,86,86,86,86,86,86,
         86,86,86,86,86,86,86,86,86,86,86,86,86,86,86,86,86,86,86,86,86,86,86,86,86,86,86,86,86,86,86,86,86,86,86,86,86,86,86,86,
         86,86,86,86,86,86,86,86,86,86,86,86,86,86,86,86,86,86,86,86,86,86,86,86,86,86,86,86,86,86,86,86,86,86,86,86,86,86,86,86,
-        };
+        });
 
         obj.createentity(0, 168, 2, 11, 4);  //Big Threadmill, <<<<<<
         obj.createentity(63, 64-16, 1, 3, 4, 64, 0, 256, 204);  // Enemy, bounded
@@ -2320,7 +2328,7 @@ const short* spacestation2class::loadlevel(int rx, int ry)
     case rn(54,43):
     {
 
-        static const short contents[] = {
+        ROOM_CONTENTS(LEVELPACK_SPACESTATION2, t, 0, {
         507,507,507,507,507,507,507,507,507,507,507,507,507,507,507,629,0,0,0,0,0,0,627,507,507,507,507,507,507,507,507,507,507,507,507,507,507,507,507,507,
         507,507,507,507,507,507,507,507,507,507,507,507,507,507,507,629,0,0,0,0,0,0,627,507,507,507,507,507,507,507,507,507,507,507,507,507,507,507,507,507,
         507,507,507,507,507,507,507,507,507,507,507,507,507,507,507,629,0,0,0,0,0,0,667,668,509,507,507,507,507,508,668,668,668,668,668,668,668,668,668,668,
@@ -2351,7 +2359,7 @@ const short* spacestation2class::loadlevel(int rx, int ry)
         507,507,507,507,507,507,507,507,507,507,507,507,507,507,507,507,507,507,507,507,507,507,507,507,507,507,507,507,507,507,507,507,507,507,507,507,507,507,507,507,
         507,507,507,507,507,507,507,507,507,507,507,507,507,507,507,507,507,507,507,507,507,507,507,507,507,507,507,507,507,507,507,507,507,507,507,507,507,507,507,507,
         507,507,507,507,507,507,507,507,507,507,507,507,507,507,507,507,507,507,507,507,507,507,507,507,507,507,507,507,507,507,507,507,507,507,507,507,507,507,507,507,
-        };
+        });
 
         obj.createentity(64, 168, 2, 11, 4);  //Big Threadmill, <<<<<<
         obj.createentity(128, 168, 2, 11, 4);  //Big Threadmill, <<<<<<
@@ -2369,7 +2377,7 @@ const short* spacestation2class::loadlevel(int rx, int ry)
     case rn(52,43):
     {
 
-        static const short contents[] = {
+        ROOM_CONTENTS(LEVELPACK_SPACESTATION2, t, 0, {
         310,310,310,310,310,310,310,310,310,310,310,310,310,310,310,432,0,0,812,692,692,692,692,692,430,310,310,310,310,310,310,310,310,310,310,310,310,310,310,310,
         310,310,310,310,310,310,310,310,310,310,310,310,310,310,310,432,0,0,812,692,692,692,692,692,430,310,310,310,310,310,310,310,310,310,310,310,310,310,310,310,
         471,471,471,471,471,471,471,471,471,471,471,471,471,471,471,472,0,0,812,692,692,692,692,692,430,310,310,310,310,310,310,310,310,310,310,310,310,310,310,310,
@@ -2400,7 +2408,7 @@ const short* spacestation2class::loadlevel(int rx, int ry)
         310,310,310,310,432,0,0,0,0,0,812,692,430,310,310,310,310,310,310,310,310,310,310,310,310,310,310,310,432,0,0,0,0,0,0,430,310,310,310,310,
         310,310,310,310,432,0,0,0,0,0,812,692,430,310,310,310,310,310,310,310,310,310,310,310,310,310,310,310,432,0,0,0,0,0,0,430,310,310,310,310,
         310,310,310,310,432,0,0,0,0,0,812,692,430,310,310,310,310,310,310,310,310,310,310,310,310,310,310,310,432,0,0,0,0,0,0,430,310,310,310,310,
-        };
+        });
 
         obj.createentity(56, 144, 10, 0, 443520);  // (savepoint)
         obj.createentity(152, 80, 10, 1, 443521);  // (savepoint)
@@ -2412,7 +2420,7 @@ const short* spacestation2class::loadlevel(int rx, int ry)
     case rn(51,43):
     {
 
-        static const short contents[] = {
+        ROOM_CONTENTS(LEVELPACK_SPACESTATION2, t, 0, {
         89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,
         89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,
         250,250,250,250,250,250,250,250,250,250,250,250,250,250,250,250,250,250,250,250,250,250,250,250,250,250,250,250,250,250,250,250,250,250,250,250,250,250,250,250,
@@ -2443,7 +2451,7 @@ const short* spacestation2class::loadlevel(int rx, int ry)
         89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,
         89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,
         89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,
-        };
+        });
 
         obj.createentity(0, -200, 1, 16, 6, -64, -500, 320 + 64, 340);
         roomname = "B-B-B-Busted";
@@ -2455,7 +2463,7 @@ const short* spacestation2class::loadlevel(int rx, int ry)
     case rn(50,43):
     {
 
-        static const short contents[] = {
+        ROOM_CONTENTS(LEVELPACK_SPACESTATION2, t, 0, {
         286,286,286,286,286,408,689,689,811,0,0,0,406,286,286,286,286,286,286,286,286,286,286,286,286,286,286,286,286,286,286,286,286,286,286,286,286,286,286,286,
         286,286,286,286,286,408,689,689,811,0,0,0,406,287,447,447,447,447,288,286,286,286,286,286,286,287,447,447,447,447,288,286,286,286,286,286,286,286,286,286,
         286,286,286,286,286,408,689,689,811,0,0,0,446,448,9,9,9,9,446,447,447,447,447,447,447,448,9,9,9,9,446,447,447,447,447,447,447,447,447,447,
@@ -2486,7 +2494,7 @@ const short* spacestation2class::loadlevel(int rx, int ry)
         286,286,286,327,367,367,367,367,328,286,286,327,367,367,367,367,328,286,286,327,367,367,367,367,328,286,286,327,367,367,367,367,328,286,286,286,286,286,286,286,
         286,286,286,286,286,286,286,286,286,286,286,286,286,286,286,286,286,286,286,286,286,286,286,286,286,286,286,286,286,286,286,286,286,286,286,286,286,286,286,286,
         286,286,286,286,286,286,286,286,286,286,286,286,286,286,286,286,286,286,286,286,286,286,286,286,286,286,286,286,286,286,286,286,286,286,286,286,286,286,286,286,
-        };
+        });
 
         obj.createentity(280, 192, 10, 1, 443500);  // (savepoint)
         obj.createentity(64, 80, 10, 1, 443501);  // (savepoint)
@@ -2568,7 +2576,7 @@ const short* spacestation2class::loadlevel(int rx, int ry)
     case rn(48,43):
     {
 
-        static const short contents[] = {
+        ROOM_CONTENTS(LEVELPACK_SPACESTATION2, t, 0, {
         89,89,211,695,695,695,695,209,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,
         89,89,211,695,695,695,695,209,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,
         89,89,211,695,695,695,695,249,250,250,250,250,250,250,250,250,250,250,250,250,250,250,250,250,250,250,250,250,250,250,250,250,250,250,250,250,250,91,89,89,
@@ -2599,7 +2607,7 @@ const short* spacestation2class::loadlevel(int rx, int ry)
         89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,
         89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,
         89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,
-        };
+        });
 
         obj.createentity(152, 32, 10, 1, 443480);  // (savepoint)
         obj.createentity(152, 184, 10, 0, 443481);  // (savepoint)
@@ -2619,7 +2627,7 @@ const short* spacestation2class::loadlevel(int rx, int ry)
     case rn(48,42):
     {
 
-        static const short contents[] = {
+        ROOM_CONTENTS(LEVELPACK_SPACESTATION2, t, 0, {
         310,310,310,310,310,310,310,310,310,310,310,310,310,310,310,310,310,310,310,310,310,310,310,310,310,310,310,310,310,310,310,310,310,310,310,310,310,310,310,310,
         310,310,310,310,310,310,310,310,311,471,471,471,471,471,471,312,310,310,310,310,311,471,471,471,471,471,471,312,310,310,310,310,310,310,310,310,310,310,310,310,
         310,310,310,310,310,310,310,310,432,9,9,9,9,9,9,430,310,310,310,310,432,9,9,9,9,9,9,430,310,310,310,310,311,471,471,471,471,471,471,471,
@@ -2650,7 +2658,7 @@ const short* spacestation2class::loadlevel(int rx, int ry)
         310,310,432,692,692,692,692,430,310,310,310,310,310,310,351,391,391,391,391,391,391,352,310,310,310,310,351,391,391,391,391,391,391,391,391,352,310,310,310,310,
         310,310,432,692,692,692,692,430,310,310,310,310,310,310,310,310,310,310,310,310,310,310,310,310,310,310,310,310,310,310,310,310,310,310,310,310,310,310,310,310,
         310,310,432,692,692,692,692,430,310,310,310,310,310,310,310,310,310,310,310,310,310,310,310,310,310,310,310,310,310,310,310,310,310,310,310,310,310,310,310,310,
-        };
+        });
 
         obj.platformtile = 239;
         obj.createentity(88, 112, 2, 0, 4, 88, 64, 264, 168);  // Platform, bounded
@@ -2668,7 +2676,7 @@ const short* spacestation2class::loadlevel(int rx, int ry)
     case rn(49,42):
     {
 
-        static const short contents[] = {
+        ROOM_CONTENTS(LEVELPACK_SPACESTATION2, t, 0, {
         295,295,295,295,295,295,295,295,295,295,295,295,295,295,295,295,295,295,295,295,295,295,295,295,295,295,295,417,0,0,0,818,698,698,415,295,295,295,295,295,
         295,295,295,295,295,295,295,295,295,295,295,295,295,295,295,295,295,295,295,295,295,295,295,295,295,295,295,417,0,0,0,818,698,698,415,295,295,295,295,295,
         456,456,456,456,456,456,456,456,456,456,456,456,456,456,456,456,456,456,456,456,456,297,295,295,295,295,295,417,0,0,0,818,698,698,415,295,295,295,295,295,
@@ -2699,7 +2707,7 @@ const short* spacestation2class::loadlevel(int rx, int ry)
         295,417,779,779,779,779,415,295,295,295,295,295,295,295,295,295,295,295,295,295,295,295,295,295,295,295,295,417,698,698,698,820,0,0,415,295,295,295,295,295,
         295,417,698,698,698,698,415,295,295,295,295,295,295,295,295,295,295,295,295,295,295,295,295,295,295,295,295,417,698,698,698,820,0,0,415,295,295,295,295,295,
         295,417,698,698,698,698,415,295,295,295,295,295,295,295,295,295,295,295,295,295,295,295,295,295,295,295,295,417,698,698,698,820,0,0,415,295,295,295,295,295,
-        };
+        });
 
         obj.createentity(16, 104, 2, 10, 4);  //Big Threadmill, >>>>>>
         obj.createentity(104, 184, 2, 11, 4);  //Big Threadmill, <<<<<<
@@ -2713,7 +2721,7 @@ const short* spacestation2class::loadlevel(int rx, int ry)
     case rn(49,41):
     {
 
-        static const short contents[] = {
+        ROOM_CONTENTS(LEVELPACK_SPACESTATION2, t, 0, {
         489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,
         489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,
         489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,
@@ -2744,7 +2752,7 @@ const short* spacestation2class::loadlevel(int rx, int ry)
         489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,611,0,0,0,809,689,689,609,489,489,489,489,489,
         489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,611,0,0,0,809,689,689,609,489,489,489,489,489,
         489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,611,0,0,0,809,689,689,609,489,489,489,489,489,
-        };
+        });
 
         obj.createentity(192, 88, 10, 0, 441490);  // (savepoint)
 
@@ -2764,7 +2772,7 @@ const short* spacestation2class::loadlevel(int rx, int ry)
     case rn(48,41):
     {
 
-        static const short contents[] = {
+        ROOM_CONTENTS(LEVELPACK_SPACESTATION2, t, 0, {
         298,298,298,298,298,298,298,298,298,298,298,298,298,298,298,298,298,298,298,298,298,298,298,298,298,298,298,298,298,298,298,298,298,298,298,298,298,298,298,298,
         298,298,298,298,298,298,298,298,298,298,298,298,298,298,298,298,298,298,298,298,298,298,298,298,298,298,298,298,298,298,298,298,298,298,298,298,298,298,298,298,
         298,298,298,298,298,298,298,298,298,298,298,298,298,298,298,298,298,298,298,298,298,298,298,298,298,298,298,298,298,298,298,298,298,298,298,298,298,298,298,298,
@@ -2795,7 +2803,7 @@ const short* spacestation2class::loadlevel(int rx, int ry)
         298,298,298,298,298,298,298,298,298,298,298,298,298,298,298,298,298,298,298,298,298,298,298,298,298,298,298,298,298,298,298,298,298,298,298,298,298,298,298,298,
         298,298,298,298,298,298,298,298,298,298,298,298,298,298,298,298,298,298,298,298,298,298,298,298,298,298,298,298,298,298,298,298,298,298,298,298,298,298,298,298,
         298,298,298,298,298,298,298,298,298,298,298,298,298,298,298,298,298,298,298,298,298,298,298,298,298,298,298,298,298,298,298,298,298,298,298,298,298,298,298,298,
-        };
+        });
 
         obj.createentity((5 * 8) - 4, (8 * 8) + 4, 14); //Teleporter!
 
@@ -2811,7 +2819,7 @@ const short* spacestation2class::loadlevel(int rx, int ry)
     case rn(53,42):
     {
 
-        static const short contents[] = {
+        ROOM_CONTENTS(LEVELPACK_SPACESTATION2, t, 0, {
         292,292,292,292,292,292,292,292,292,292,292,292,292,292,292,292,292,292,292,292,292,292,292,292,292,292,292,292,292,292,292,292,292,292,292,292,292,292,292,292,
         292,292,292,292,292,292,292,292,292,292,292,292,292,292,292,292,292,292,292,292,292,292,292,292,292,292,292,292,292,292,292,292,292,292,292,292,292,292,292,292,
         453,453,453,453,453,453,453,453,453,453,453,453,453,453,453,453,453,453,453,453,453,453,453,453,453,453,453,453,453,453,453,453,453,453,453,453,453,453,453,453,
@@ -2842,7 +2850,7 @@ const short* spacestation2class::loadlevel(int rx, int ry)
         292,292,292,292,292,292,292,292,292,292,292,292,292,292,292,292,292,414,0,0,0,0,412,292,292,292,292,292,292,292,292,292,292,292,292,292,292,292,292,292,
         292,292,292,292,292,292,292,292,292,292,292,292,292,292,292,292,292,414,0,0,0,0,412,292,292,292,292,292,292,292,292,292,292,292,292,292,292,292,292,292,
         292,292,292,292,292,292,292,292,292,292,292,292,292,292,292,292,292,414,0,0,0,0,412,292,292,292,292,292,292,292,292,292,292,292,292,292,292,292,292,292,
-        };
+        });
 
         obj.createentity(40, 24, 10, 0, 442530);  // (savepoint)
         obj.createentity(264, 24, 10, 0, 442531);  // (savepoint)
@@ -2855,7 +2863,7 @@ const short* spacestation2class::loadlevel(int rx, int ry)
     case rn(54,42):
     {
 
-        static const short contents[] = {
+        ROOM_CONTENTS(LEVELPACK_SPACESTATION2, t, 0, {
         92,92,92,92,92,92,92,92,92,92,92,92,92,92,92,92,92,92,92,92,92,92,92,92,92,92,92,92,92,92,92,92,92,92,92,92,92,92,92,92,
         92,92,92,92,92,92,92,92,92,92,92,92,92,92,92,92,92,92,92,92,93,253,253,253,253,253,253,253,94,92,92,92,92,92,92,92,92,92,92,92,
         253,253,253,253,253,253,253,253,253,253,253,253,253,253,253,253,253,253,253,253,254,9,9,9,9,9,9,9,212,92,92,92,92,92,92,92,92,92,92,92,
@@ -2886,7 +2894,7 @@ const short* spacestation2class::loadlevel(int rx, int ry)
         92,92,92,92,92,92,92,92,92,92,92,92,92,92,92,214,0,0,0,0,0,0,172,173,134,92,92,92,92,92,92,92,92,92,92,92,92,92,92,92,
         92,92,92,92,92,92,92,92,92,92,92,92,92,92,92,214,0,0,0,0,0,0,212,92,92,92,92,92,92,92,92,92,92,92,92,92,92,92,92,92,
         92,92,92,92,92,92,92,92,92,92,92,92,92,92,92,214,0,0,0,0,0,0,212,92,92,92,92,92,92,92,92,92,92,92,92,92,92,92,92,92,
-        };
+        });
 
         obj.createentity(128, 80, 3, 867);  //Disappearing Platform
         obj.createentity(160, 80, 3, 867);  //Disappearing Platform
@@ -2923,7 +2931,7 @@ const short* spacestation2class::loadlevel(int rx, int ry)
     case rn(52,42):
     {
 
-        static const short contents[] = {
+        ROOM_CONTENTS(LEVELPACK_SPACESTATION2, t, 0, {
         95,95,95,95,95,95,95,95,95,95,95,95,95,95,95,95,95,95,95,95,95,95,95,95,95,95,95,95,95,95,95,95,95,95,95,95,95,95,95,95,
         95,95,95,95,95,95,95,95,95,95,95,95,95,95,95,95,95,95,95,95,95,95,95,95,95,95,95,95,95,95,95,95,95,95,95,95,95,95,95,95,
         95,95,95,95,95,95,95,95,95,95,95,95,95,95,95,96,256,256,256,256,256,256,256,256,256,256,256,256,256,256,256,256,256,256,256,256,256,256,256,256,
@@ -2954,7 +2962,7 @@ const short* spacestation2class::loadlevel(int rx, int ry)
         95,95,95,95,95,95,95,95,95,95,95,95,95,95,95,217,0,0,809,689,689,689,689,689,215,95,95,95,95,95,95,95,95,95,95,95,95,95,95,95,
         95,95,95,95,95,95,95,95,95,95,95,95,95,95,95,217,0,0,809,689,689,689,689,689,215,95,95,95,95,95,95,95,95,95,95,95,95,95,95,95,
         95,95,95,95,95,95,95,95,95,95,95,95,95,95,95,217,0,0,809,689,689,689,689,689,215,95,95,95,95,95,95,95,95,95,95,95,95,95,95,95,
-        };
+        });
 
         obj.createentity(144, 40, 3);  //Disappearing Platform
         obj.createentity(200, 128, 3);  //Disappearing Platform
@@ -2966,7 +2974,7 @@ const short* spacestation2class::loadlevel(int rx, int ry)
     case rn(50,42):
     {
 
-        static const short contents[] = {
+        ROOM_CONTENTS(LEVELPACK_SPACESTATION2, t, 0, {
         495,495,495,495,495,617,680,680,680,680,680,680,615,495,496,656,656,656,656,656,656,656,656,656,656,656,656,656,656,656,656,656,656,656,656,497,495,495,495,495,
         495,495,495,495,495,617,680,680,680,680,680,680,615,495,617,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,615,495,495,495,495,
         495,495,495,495,495,617,680,680,680,680,680,680,615,495,617,680,680,680,680,680,680,680,680,680,680,680,680,680,680,680,680,680,680,680,680,615,495,495,495,495,
@@ -2997,7 +3005,7 @@ const short* spacestation2class::loadlevel(int rx, int ry)
         495,495,495,495,495,617,0,0,0,0,0,0,615,495,617,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,615,495,495,495,495,
         495,495,495,495,495,617,0,0,0,0,0,0,615,495,536,576,576,576,576,576,576,576,576,576,576,576,576,576,576,576,576,576,576,576,576,537,495,495,495,495,
         495,495,495,495,495,617,0,0,0,0,0,0,615,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,
-        };
+        });
 
         obj.createentity(288, 160, 10, 1, 442500);  // (savepoint)
 
@@ -3013,7 +3021,7 @@ const short* spacestation2class::loadlevel(int rx, int ry)
     case rn(51,42):
     {
 
-        static const short contents[] = {
+        ROOM_CONTENTS(LEVELPACK_SPACESTATION2, t, 0, {
         86,86,86,86,86,86,86,86,86,86,86,86,86,86,86,86,86,86,86,86,86,86,86,86,86,86,86,86,86,86,86,86,86,86,86,86,86,86,86,86,
         86,86,86,86,86,86,86,86,86,86,86,86,86,86,86,86,86,86,86,86,86,86,86,86,86,86,86,86,86,86,86,86,86,86,86,86,86,86,86,86,
         86,86,86,86,86,86,86,87,247,247,247,247,247,247,247,247,247,88,87,247,247,247,247,247,247,247,88,87,247,247,247,247,247,247,247,247,247,88,86,86,
@@ -3044,7 +3052,7 @@ const short* spacestation2class::loadlevel(int rx, int ry)
         86,86,86,86,86,86,86,86,86,86,86,86,127,167,167,167,128,86,86,86,127,167,167,167,128,86,86,86,127,167,167,167,128,86,86,86,86,86,86,86,
         86,86,86,86,86,86,86,86,86,86,86,86,86,86,86,86,86,86,86,86,86,86,86,86,86,86,86,86,86,86,86,86,86,86,86,86,86,86,86,86,
         86,86,86,86,86,86,86,86,86,86,86,86,86,86,86,86,86,86,86,86,86,86,86,86,86,86,86,86,86,86,86,86,86,86,86,86,86,86,86,86,
-        };
+        });
 
         obj.platformtile = 207;
         obj.createentity(112-4, 200-4, 1, 1, 6, 104, 144, 264, 240);  // Enemy, bounded
@@ -3066,7 +3074,7 @@ const short* spacestation2class::loadlevel(int rx, int ry)
     case rn(50,41):
     {
 
-        static const short contents[] = {
+        ROOM_CONTENTS(LEVELPACK_SPACESTATION2, t, 0, {
         92,92,92,92,92,214,0,0,0,0,0,0,212,92,93,253,253,253,94,92,92,92,92,92,92,92,92,92,92,92,92,92,93,253,253,253,94,92,92,92,
         92,92,92,92,92,214,0,0,0,0,0,0,212,92,214,0,0,0,212,92,92,92,92,92,92,92,92,92,92,92,92,92,214,0,0,0,212,92,92,92,
         92,92,92,92,92,214,0,0,0,0,0,0,212,92,214,0,0,0,212,92,92,92,92,92,92,92,92,92,92,92,92,92,214,0,0,0,212,92,92,92,
@@ -3097,7 +3105,7 @@ const short* spacestation2class::loadlevel(int rx, int ry)
         92,92,92,92,92,214,683,683,683,683,683,683,212,92,214,683,683,683,212,92,92,92,92,92,92,92,92,92,92,92,92,92,92,92,92,92,92,92,92,92,
         92,92,92,92,92,214,683,683,683,683,683,683,212,92,133,173,173,173,134,92,92,92,92,92,92,92,92,92,92,92,92,92,92,92,92,92,92,92,92,92,
         92,92,92,92,92,214,683,683,683,683,683,683,212,92,92,92,92,92,92,92,92,92,92,92,92,92,92,92,92,92,92,92,92,92,92,92,92,92,92,92,
-        };
+        });
 
         obj.createentity(120+2, 8, 1, 0, 3);  // Enemy
         obj.createentity(264+2, 8, 1, 0, 3);  // Enemy
@@ -3116,7 +3124,7 @@ const short* spacestation2class::loadlevel(int rx, int ry)
     case rn(50,40):
     {
 
-        static const short contents[] = {
+        ROOM_CONTENTS(LEVELPACK_SPACESTATION2, t, 0, {
         283,283,283,283,283,405,0,0,0,0,0,0,403,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,
         283,283,283,283,283,405,0,0,0,0,0,0,403,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,
         283,283,283,283,283,405,0,0,0,0,0,0,403,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,
@@ -3147,7 +3155,7 @@ const short* spacestation2class::loadlevel(int rx, int ry)
         283,283,283,283,283,405,0,0,0,0,0,0,403,283,324,364,364,364,364,364,364,364,364,364,364,364,364,364,364,364,364,325,283,283,283,283,283,283,283,283,
         283,283,283,283,283,405,0,0,0,0,0,0,403,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,
         283,283,283,283,283,405,0,0,0,0,0,0,403,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,
-        };
+        });
 
         obj.platformtile = 10;
         obj.createentity(136-32, 64, 3, 10);  //Disappearing Platform
@@ -3165,7 +3173,7 @@ const short* spacestation2class::loadlevel(int rx, int ry)
     case rn(51,40):
     {
 
-        static const short contents[] = {
+        ROOM_CONTENTS(LEVELPACK_SPACESTATION2, t, 0, {
         495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,
         495,495,495,495,495,495,495,496,656,656,656,656,656,656,656,656,656,656,656,656,656,656,656,656,656,656,656,656,656,656,656,656,656,656,656,497,495,495,495,495,
         495,495,495,495,495,495,495,617,680,680,680,680,680,680,680,680,680,680,680,680,680,680,680,680,680,680,680,680,680,680,680,680,680,680,680,615,495,495,495,495,
@@ -3196,7 +3204,7 @@ const short* spacestation2class::loadlevel(int rx, int ry)
         495,495,495,495,495,495,495,495,495,617,680,680,680,680,680,680,680,680,680,615,495,495,495,495,617,680,680,680,680,680,680,680,680,680,680,615,495,495,495,495,
         495,495,495,495,495,495,495,495,495,536,576,576,576,576,576,576,576,576,576,537,495,495,495,495,536,576,576,576,576,576,576,576,576,576,576,537,495,495,495,495,
         495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,
-        };
+        });
 
         obj.createentity(88, 104, 21, 1);  // (savepoint)
         obj.createentity(112, 104, 21, 1, 440511);  // (savepoint)
@@ -3219,7 +3227,7 @@ const short* spacestation2class::loadlevel(int rx, int ry)
     case rn(50,39):
     {
 
-        static const short contents[] = {
+        ROOM_CONTENTS(LEVELPACK_SPACESTATION2, t, 0, {
         292,292,292,292,292,292,292,292,292,292,292,292,292,292,292,292,292,292,292,292,292,292,292,292,292,292,292,292,292,292,292,292,292,292,292,292,292,292,292,292,
         292,292,292,292,292,292,292,292,292,292,292,292,292,292,292,292,292,292,292,292,292,292,292,292,292,292,292,292,292,292,292,292,292,292,292,292,292,292,292,292,
         292,292,292,292,292,292,292,292,292,292,292,292,292,292,292,292,292,293,453,453,453,453,453,453,453,453,453,453,453,453,453,453,453,453,453,453,453,453,453,294,
@@ -3250,7 +3258,7 @@ const short* spacestation2class::loadlevel(int rx, int ry)
         292,292,292,292,292,414,0,0,0,0,0,0,412,292,292,292,292,292,292,292,292,292,292,292,292,292,292,292,292,292,292,292,292,292,292,292,292,292,292,292,
         292,292,292,292,292,414,0,0,0,0,0,0,412,292,292,292,292,292,292,292,292,292,292,292,292,292,292,292,292,292,292,292,292,292,292,292,292,292,292,292,
         292,292,292,292,292,414,0,0,0,0,0,0,412,292,292,292,292,292,292,292,292,292,292,292,292,292,292,292,292,292,292,292,292,292,292,292,292,292,292,292,
-        };
+        });
 
         obj.createentity(200, 32, 1, 0, 8);  // Enemy
         obj.createentity(168, 104, 10, 1, 439500);  // (savepoint)
@@ -3263,7 +3271,7 @@ const short* spacestation2class::loadlevel(int rx, int ry)
     case rn(51,39):
     {
 
-        static const short contents[] = {
+        ROOM_CONTENTS(LEVELPACK_SPACESTATION2, t, 0, {
         95,95,95,95,95,95,95,95,95,95,95,95,95,95,95,95,95,95,95,95,95,95,95,95,95,95,95,95,95,95,95,95,95,95,95,95,95,95,95,95,
         95,95,96,256,256,256,256,256,256,256,256,256,97,95,95,95,95,95,95,95,95,95,95,95,95,95,95,95,95,95,95,95,95,95,95,95,95,95,95,95,
         95,95,217,0,0,0,0,0,0,0,0,0,215,95,95,95,95,95,95,95,95,95,95,95,95,95,95,95,95,95,95,95,95,95,95,95,95,95,95,95,
@@ -3294,7 +3302,7 @@ const short* spacestation2class::loadlevel(int rx, int ry)
         95,95,95,95,95,95,95,95,95,95,95,95,95,95,95,95,95,95,95,95,95,95,95,95,95,95,95,136,176,176,176,176,176,176,176,176,176,137,95,95,
         95,95,95,95,95,95,95,95,95,95,95,95,95,95,95,95,95,95,95,95,95,95,95,95,95,95,95,95,95,95,95,95,95,95,95,95,95,95,95,95,
         95,95,95,95,95,95,95,95,95,95,95,95,95,95,95,95,95,95,95,95,95,95,95,95,95,95,95,95,95,95,95,95,95,95,95,95,95,95,95,95,
-        };
+        });
 
         obj.createentity(24, 168, 10, 1, 439510);  // (savepoint)
         obj.createentity(280, 48, 10, 0, 439511);  // (savepoint)
@@ -3311,7 +3319,7 @@ const short* spacestation2class::loadlevel(int rx, int ry)
     case rn(52,39):
     {
 
-        static const short contents[] = {
+        ROOM_CONTENTS(LEVELPACK_SPACESTATION2, t, 0, {
         289,289,289,289,289,289,289,289,289,289,289,289,289,289,289,289,289,289,289,289,289,289,289,289,289,289,289,289,289,289,289,289,289,289,289,289,289,289,289,289,
         289,289,289,289,289,289,289,289,289,289,289,289,289,289,289,289,289,289,289,289,289,289,289,289,289,289,289,289,289,289,289,289,289,289,289,289,289,289,289,289,
         289,289,289,289,289,289,289,289,289,290,450,450,450,450,450,450,450,450,450,450,450,450,450,291,289,289,289,289,289,289,289,289,289,289,289,289,289,289,289,289,
@@ -3342,7 +3350,7 @@ const short* spacestation2class::loadlevel(int rx, int ry)
         289,289,289,289,289,289,289,289,289,289,289,289,289,289,289,289,289,289,289,289,289,289,289,289,289,411,0,0,0,0,409,289,289,289,289,289,289,289,289,289,
         289,289,289,289,289,289,289,289,289,289,289,289,289,289,289,289,289,289,289,289,289,289,289,289,289,411,0,0,0,0,409,289,289,289,289,289,289,289,289,289,
         289,289,289,289,289,289,289,289,289,289,289,289,289,289,289,289,289,289,289,289,289,289,289,289,289,411,0,0,0,0,409,289,289,289,289,289,289,289,289,289,
-        };
+        });
 
         obj.createentity(192, 48, 10, 0, 439520);  // (savepoint)
         obj.createentity(112, 160, 10, 1, 439521);  // (savepoint)
@@ -3354,7 +3362,7 @@ const short* spacestation2class::loadlevel(int rx, int ry)
     case rn(53,39):
     {
 
-        static const short contents[] = {
+        ROOM_CONTENTS(LEVELPACK_SPACESTATION2, t, 0, {
         483,483,483,483,483,483,483,483,483,483,483,483,483,483,484,644,644,644,644,485,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,
         483,483,483,483,483,483,483,483,483,483,483,483,483,483,605,695,695,695,695,603,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,
         483,483,483,483,483,483,483,483,483,483,483,483,483,483,605,695,695,695,695,603,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,
@@ -3385,7 +3393,7 @@ const short* spacestation2class::loadlevel(int rx, int ry)
         483,483,605,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,603,483,483,
         483,483,605,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,603,483,483,
         483,483,605,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,603,483,483,
-        };
+        });
 
         roomname = "Traffic Jam";
 
@@ -3401,7 +3409,7 @@ const short* spacestation2class::loadlevel(int rx, int ry)
     case rn(53,40):
     {
 
-        static const short contents[] = {
+        ROOM_CONTENTS(LEVELPACK_SPACESTATION2, t, 0, {
         310,310,432,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,430,310,310,
         310,310,432,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,430,310,310,
         310,310,432,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,430,310,310,
@@ -3432,7 +3440,7 @@ const short* spacestation2class::loadlevel(int rx, int ry)
         310,310,432,692,692,692,692,692,692,814,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,812,692,692,692,692,692,692,692,692,692,430,310,310,
         310,310,432,692,692,692,692,692,692,814,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,812,692,692,692,692,692,692,692,692,692,430,310,310,
         310,310,432,692,692,692,692,692,692,814,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,812,692,692,692,692,692,692,692,692,692,430,310,310,
-        };
+        });
         roomname = "Leap of Faith";
         result = contents;
         break;
@@ -3441,7 +3449,7 @@ const short* spacestation2class::loadlevel(int rx, int ry)
     case rn(53,41):
     {
 
-        static const short contents[] = {
+        ROOM_CONTENTS(LEVELPACK_SPACESTATION2, t, 0, {
         286,286,408,686,686,686,686,686,686,808,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,806,686,686,686,686,686,686,686,686,686,406,286,286,
         286,286,408,686,686,686,686,686,686,808,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,806,686,686,686,686,686,686,686,686,686,406,286,286,
         286,286,408,686,686,686,686,686,686,808,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,806,686,686,686,686,686,686,686,686,686,406,286,286,
@@ -3472,7 +3480,7 @@ const short* spacestation2class::loadlevel(int rx, int ry)
         286,286,286,286,286,286,286,286,286,286,286,286,286,286,286,286,286,286,286,286,286,286,286,286,286,286,286,286,286,286,286,286,286,286,286,286,286,286,286,286,
         286,286,286,286,286,286,286,286,286,286,286,286,286,286,286,286,286,286,286,286,286,286,286,286,286,286,286,286,286,286,286,286,286,286,286,286,286,286,286,286,
         286,286,286,286,286,286,286,286,286,286,286,286,286,286,286,286,286,286,286,286,286,286,286,286,286,286,286,286,286,286,286,286,286,286,286,286,286,286,286,286,
-        };
+        });
 
         obj.createentity(152, 168, 10, 1, 441530);  // (savepoint)
 
@@ -3489,7 +3497,7 @@ const short* spacestation2class::loadlevel(int rx, int ry)
     case rn(52,41):
     {
 
-        static const short contents[] = {
+        ROOM_CONTENTS(LEVELPACK_SPACESTATION2, t, 0, {
         83,83,83,83,83,83,83,83,83,83,83,83,83,83,83,83,83,83,83,83,83,83,83,83,83,83,83,83,83,83,83,83,83,83,83,83,83,83,83,83,
         83,83,83,83,83,83,83,83,83,83,83,83,83,83,83,83,83,83,83,83,83,83,83,83,83,83,83,83,83,83,83,83,83,83,83,83,83,83,83,83,
         83,83,83,83,83,83,83,83,83,83,83,83,83,83,83,83,83,83,83,83,83,83,83,83,83,83,83,83,83,83,83,83,83,83,83,83,83,83,83,83,
@@ -3520,7 +3528,7 @@ const short* spacestation2class::loadlevel(int rx, int ry)
         83,83,83,83,83,83,83,83,83,83,83,83,83,83,83,83,83,83,83,83,83,83,83,83,83,83,83,83,83,83,83,83,83,83,83,83,83,83,83,83,
         83,83,83,83,83,83,83,83,83,83,83,83,83,83,83,83,83,83,83,83,83,83,83,83,83,83,83,83,83,83,83,83,83,83,83,83,83,83,83,83,
         83,83,83,83,83,83,83,83,83,83,83,83,83,83,83,83,83,83,83,83,83,83,83,83,83,83,83,83,83,83,83,83,83,83,83,83,83,83,83,83,
-        };
+        });
 
         roomname = "Conundrum";
 
@@ -3536,7 +3544,7 @@ const short* spacestation2class::loadlevel(int rx, int ry)
     case rn(51,41):
     {
 
-        static const short contents[] = {
+        ROOM_CONTENTS(LEVELPACK_SPACESTATION2, t, 0, {
         86,86,86,86,86,86,86,86,86,86,86,86,86,86,86,86,86,86,86,86,86,86,86,86,86,86,86,86,86,86,86,86,86,86,86,86,86,86,86,86,
         86,86,86,86,86,86,86,86,86,86,86,86,86,86,86,86,86,86,86,86,86,86,86,86,86,86,86,86,86,86,86,86,86,86,86,86,86,86,86,86,
         87,247,247,247,247,247,247,247,247,247,247,247,247,247,247,247,247,247,247,247,247,247,247,247,247,247,88,86,86,86,86,86,86,86,86,86,86,86,86,86,
@@ -3567,7 +3575,7 @@ const short* spacestation2class::loadlevel(int rx, int ry)
         86,86,86,86,86,86,86,86,86,86,86,86,86,86,86,86,86,86,86,86,86,86,86,86,86,86,86,86,86,86,86,86,86,86,86,86,86,86,86,86,
         86,86,86,86,86,86,86,86,86,86,86,86,86,86,86,86,86,86,86,86,86,86,86,86,86,86,86,86,86,86,86,86,86,86,86,86,86,86,86,86,
         86,86,86,86,86,86,86,86,86,86,86,86,86,86,86,86,86,86,86,86,86,86,86,86,86,86,86,86,86,86,86,86,86,86,86,86,86,86,86,86,
-        };
+        });
 
         roomname = "Welcome Aboard";
         result = contents;
@@ -3577,7 +3585,7 @@ const short* spacestation2class::loadlevel(int rx, int ry)
     case rn(52,40):
     {
 
-        static const short contents[] = {
+        ROOM_CONTENTS(LEVELPACK_SPACESTATION2, t, 0, {
         89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,211,0,0,0,0,209,89,89,89,89,89,89,89,89,89,
         89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,211,0,0,0,0,209,89,89,89,89,89,89,89,89,89,
         89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,211,0,0,0,0,209,89,89,89,89,89,89,89,89,89,
@@ -3608,7 +3616,7 @@ const short* spacestation2class::loadlevel(int rx, int ry)
         89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,
         89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,
         89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,
-        };
+        });
 
         obj.createentity(216, 144, 10, 1, 440520);  // (savepoint)
         obj.createentity(16, 136, 9, 0);  // (shiny trinket)
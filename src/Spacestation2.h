@@ -5,6 +5,8 @@ class spacestation2class
 {
 public:
     const short* loadlevel(int rx, int ry);
+
+    static int roomindex(int rx, int ry);
     const char* roomname;
 };
 
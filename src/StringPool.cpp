@@ -0,0 +1,95 @@
+#include "StringPool.h"
+
+#include <SDL2/SDL.h>
+
+#include "Exit.h"
+#include "RAM.h"
+
+stringpoolclass::~stringpoolclass(void)
+{
+    clear();
+}
+
+void stringpoolclass::clear(void)
+{
+    for (size_t i = 0; i < strings.size(); ++i)
+    {
+        RAM_free(strings[i]);
+    }
+    strings.clear();
+}
+
+/* strcmp() of prefix and str joined together against other */
+static int joinedcmp(const char* prefix, const char* str, const char* other)
+{
+    while (*prefix != '\0')
+    {
+        if (*prefix != *other)
+        {
+            return (unsigned char) *prefix - (unsigned char) *other;
+        }
+        ++prefix;
+        ++other;
+    }
+
+    return SDL_strcmp(str, other);
+}
+
+size_t stringpoolclass::find(const char* prefix, const char* str, bool* found)
+{
+    size_t lo = 0;
+    size_t hi = strings.size();
+
+    while (lo < hi)
+    {
+        const size_t mid = lo + (hi - lo) / 2;
+        const int cmp = joinedcmp(prefix, str, strings[mid]);
+
+        if (cmp == 0)
+        {
+            *found = true;
+            return mid;
+        }
+        else if (cmp > 0)
+        {
+            lo = mid + 1;
+        }
+        else
+        {
+            hi = mid;
+        }
+    }
+
+    *found = false;
+    return lo;
+}
+
+const char* stringpoolclass::intern(const char* str)
+{
+    return intern("", str);
+}
+
+const char* stringpoolclass::intern(const char* prefix, const char* str)
+{
+    bool found;
+    const size_t idx = find(prefix, str, &found);
+
+    if (found)
+    {
+        return strings[idx];
+    }
+
+    const size_t prefix_len = SDL_strlen(prefix);
+    const size_t str_len = SDL_strlen(str);
+    char* copy = (char*) RAM_mallocTagged(prefix_len + str_len + 1, RAM_TAG_SCRIPT);
+    if (copy == NULL)
+    {
+        VVV_exit(1);
+    }
+
+    SDL_memcpy(copy, prefix, prefix_len);
+    SDL_memcpy(&copy[prefix_len], str, str_len + 1);
+
+    strings.insert(strings.begin() + idx, copy);
+    return copy;
+}
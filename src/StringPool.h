@@ -0,0 +1,30 @@
+#ifndef STRINGPOOL_H
+#define STRINGPOOL_H
+
+#include <stddef.h>
+#include <vector>
+
+/* Keeps a single copy of every string handed to it, so that the same name
+ * always comes back as the same pointer and can be compared by address.
+ * Looking up a string that's already in the pool doesn't allocate. Strings
+ * stay around until the pool is destroyed. */
+class stringpoolclass
+{
+public:
+    ~stringpoolclass(void);
+
+    void clear(void);
+
+    const char* intern(const char* str);
+
+    /* Same as intern() on prefix and str joined together */
+    const char* intern(const char* prefix, const char* str);
+
+private:
+    size_t find(const char* prefix, const char* str, bool* found);
+
+    /* Sorted by strcmp */
+    std::vector<char*> strings;
+};
+
+#endif /* STRINGPOOL_H */
@@ -6,12 +6,12 @@
 
 void* lodepng_malloc(size_t size)
 {
-    return RAM_malloc(size);
+    return RAM_mallocTagged(size, RAM_TAG_GRAPHICS);
 }
 
 void* lodepng_realloc(void* ptr, size_t new_size)
 {
-    return RAM_realloc(ptr, new_size);
+    return RAM_reallocTagged(ptr, new_size, RAM_TAG_GRAPHICS);
 }
 
 void lodepng_free(void* ptr)
@@ -0,0 +1,277 @@
+#include "TileStore.h"
+
+#include "Exit.h"
+#include "RAM.h"
+
+tilestoreclass::tilestoreclass(int _width, int _height, int _numslots)
+{
+    SDL_assert(_width % chunk_width == 0);
+
+    width = _width;
+    height = _height;
+    chunkcols = width / chunk_width;
+    chunkrows = (height + chunk_height - 1) / chunk_height;
+
+    chunks = (chunkclass*) RAM_callocTagged(chunkcols * chunkrows, sizeof(chunkclass), RAM_TAG_LEVEL);
+    if (chunks == NULL)
+    {
+        VVV_exit(1);
+    }
+
+    numslots = _numslots;
+    slots = (slotclass*) RAM_callocTagged(numslots, sizeof(slotclass), RAM_TAG_LEVEL);
+    if (slots == NULL)
+    {
+        VVV_exit(1);
+    }
+    slotcells = NULL;
+
+    clear();
+}
+
+tilestoreclass::~tilestoreclass(void)
+{
+    clear();
+    RAM_free(chunks);
+    RAM_free(slots);
+}
+
+void tilestoreclass::clear(void)
+{
+    for (int i = 0; i < chunkcols * chunkrows; ++i)
+    {
+        RAM_free(chunks[i].data);
+        chunks[i].data = NULL;
+        chunks[i].length = 0;
+    }
+
+    /* The decoded cells are only allocated once something is read */
+    RAM_free(slotcells);
+    slotcells = NULL;
+
+    for (int i = 0; i < numslots; ++i)
+    {
+        slots[i].chunk = -1;
+        slots[i].dirty = false;
+        slots[i].lastused = 0;
+        slots[i].cells = NULL;
+    }
+    lastslot = NULL;
+    clock = 0;
+}
+
+void tilestoreclass::load(const short* tiles, size_t count)
+{
+    static Uint16 cells[chunk_width * chunk_height];
+
+    clear();
+
+    for (int cy = 0; cy < chunkrows; ++cy)
+    {
+        for (int cx = 0; cx < chunkcols; ++cx)
+        {
+            const int chunk = cx + cy * chunkcols;
+
+            SDL_zeroa(cells);
+            for (int y = 0; y < chunkheight(chunk); ++y)
+            {
+                for (int x = 0; x < chunk_width; ++x)
+                {
+                    const size_t idx = (cx * chunk_width + x) + (cy * chunk_height + y) * width;
+                    if (idx < count)
+                    {
+                        cells[x + y * chunk_width] = tiles[idx];
+                    }
+                }
+            }
+
+            encode(chunk, cells);
+        }
+    }
+}
+
+int tilestoreclass::get(int x, int y)
+{
+    if (x < 0 || y < 0 || x >= width || y >= height)
+    {
+        return 0;
+    }
+
+    const slotclass* slot = getslot((x / chunk_width) + (y / chunk_height) * chunkcols);
+    return slot->cells[(x % chunk_width) + (y % chunk_height) * chunk_width];
+}
+
+void tilestoreclass::set(int x, int y, int t)
+{
+    if (x < 0 || y < 0 || x >= width || y >= height)
+    {
+        return;
+    }
+
+    slotclass* slot = getslot((x / chunk_width) + (y / chunk_height) * chunkcols);
+    slot->cells[(x % chunk_width) + (y % chunk_height) * chunk_width] = t;
+    slot->dirty = true;
+}
+
+size_t tilestoreclass::numcells(void)
+{
+    return width * height;
+}
+
+size_t tilestoreclass::compressedsize(void)
+{
+    size_t size = chunkcols * chunkrows * sizeof(chunkclass);
+
+    for (int i = 0; i < numslots; ++i)
+    {
+        if (slots[i].dirty)
+        {
+            /* Make sure edits count towards the total */
+            flushslot(&slots[i]);
+        }
+    }
+
+    for (int i = 0; i < chunkcols * chunkrows; ++i)
+    {
+        size += chunks[i].length * sizeof(Uint16);
+    }
+
+    if (slotcells != NULL)
+    {
+        size += numslots * chunk_width * chunk_height * sizeof(Uint16);
+    }
+
+    return size;
+}
+
+tilestoreclass::slotclass* tilestoreclass::getslot(int chunk)
+{
+    ++clock;
+
+    if (lastslot != NULL && lastslot->chunk == chunk)
+    {
+        lastslot->lastused = clock;
+        return lastslot;
+    }
+
+    if (slotcells == NULL)
+    {
+        slotcells = (Uint16*) RAM_mallocTagged(numslots * chunk_width * chunk_height * sizeof(Uint16), RAM_TAG_LEVEL);
+        if (slotcells == NULL)
+        {
+            VVV_exit(1);
+        }
+        for (int i = 0; i < numslots; ++i)
+        {
+            slots[i].cells = &slotcells[i * chunk_width * chunk_height];
+        }
+    }
+
+    slotclass* victim = &slots[0];
+    for (int i = 0; i < numslots; ++i)
+    {
+        if (slots[i].chunk == chunk)
+        {
+            slots[i].lastused = clock;
+            lastslot = &slots[i];
+            return lastslot;
+        }
+
+        if (slots[i].lastused < victim->lastused)
+        {
+            victim = &slots[i];
+        }
+    }
+
+    /* Evict the least recently used chunk, writing it back if it changed */
+    flushslot(victim);
+    victim->chunk = chunk;
+    victim->lastused = clock;
+    decode(chunk, victim->cells);
+
+    lastslot = victim;
+    return victim;
+}
+
+void tilestoreclass::flushslot(slotclass* slot)
+{
+    if (slot->chunk >= 0 && slot->dirty)
+    {
+        encode(slot->chunk, slot->cells);
+    }
+    slot->dirty = false;
+}
+
+int tilestoreclass::chunkheight(int chunk)
+{
+    const int y = (chunk / chunkcols) * chunk_height;
+    return SDL_min(chunk_height, height - y);
+}
+
+void tilestoreclass::decode(int chunk, Uint16* cells)
+{
+    const chunkclass* src = &chunks[chunk];
+    int pos = 0;
+
+    SDL_memset(cells, 0, chunk_width * chunk_height * sizeof(Uint16));
+
+    for (int i = 0; i + 1 < src->length; i += 2)
+    {
+        const Uint16 run = src->data[i];
+        const Uint16 tile = src->data[i + 1];
+
+        for (Uint16 j = 0; j < run && pos < chunk_width * chunk_height; ++j)
+        {
+            cells[pos++] = tile;
+        }
+    }
+}
+
+void tilestoreclass::encode(int chunk, const Uint16* cells)
+{
+    /* Worst case, every tile is a run of its own */
+    static Uint16 buffer[chunk_width * chunk_height * 2];
+    chunkclass* dest = &chunks[chunk];
+    int length = 0;
+    bool empty = true;
+
+    for (int y = 0; y < chunkheight(chunk); ++y)
+    {
+        const Uint16* row = &cells[y * chunk_width];
+        int x = 0;
+
+        while (x < chunk_width)
+        {
+            Uint16 run = 1;
+            while (x + run < chunk_width && row[x + run] == row[x])
+            {
+                ++run;
+            }
+
+            buffer[length++] = run;
+            buffer[length++] = row[x];
+            if (row[x] != 0)
+            {
+                empty = false;
+            }
+            x += run;
+        }
+    }
+
+    if (empty)
+    {
+        RAM_free(dest->data);
+        dest->data = NULL;
+        dest->length = 0;
+        return;
+    }
+
+    Uint16* data = (Uint16*) RAM_reallocTagged(dest->data, length * sizeof(Uint16), RAM_TAG_LEVEL);
+    if (data == NULL)
+    {
+        VVV_exit(1);
+    }
+    SDL_memcpy(data, buffer, length * sizeof(Uint16));
+    dest->data = data;
+    dest->length = length;
+}
@@ -0,0 +1,69 @@
+#ifndef TILESTORE_H
+#define TILESTORE_H
+
+#include <SDL2/SDL.h>
+#include <stddef.h>
+
+/* A grid of tiles kept run-length encoded in chunks of one room (40x30)
+ * each, every 40 wide row encoded on its own as (run, tile) pairs. Only a
+ * handful of chunks are decoded into 16-bit cells at any time, for the
+ * room or tower section that's currently being played. Chunks that are
+ * entirely empty take up no memory at all. */
+class tilestoreclass
+{
+public:
+    tilestoreclass(int width, int height, int numslots);
+    ~tilestoreclass(void);
+
+    void clear(void);
+
+    void load(const short* tiles, size_t count);
+
+    int get(int x, int y);
+
+    void set(int x, int y, int t);
+
+    size_t numcells(void);
+
+    size_t compressedsize(void);
+
+    static const int chunk_width = 40;
+    static const int chunk_height = 30;
+
+private:
+    struct chunkclass
+    {
+        Uint16* data;
+        Uint16 length;
+    };
+
+    struct slotclass
+    {
+        int chunk;
+        bool dirty;
+        Uint32 lastused;
+        Uint16* cells;
+    };
+
+    slotclass* getslot(int chunk);
+    void flushslot(slotclass* slot);
+    int chunkheight(int chunk);
+    void decode(int chunk, Uint16* cells);
+    void encode(int chunk, const Uint16* cells);
+
+    int width, height;
+    int chunkcols, chunkrows;
+    chunkclass* chunks;
+
+    int numslots;
+    slotclass* slots;
+    Uint16* slotcells;
+    slotclass* lastslot;
+    Uint32 clock;
+
+    /* Disallow copying */
+    tilestoreclass(const tilestoreclass&);
+    tilestoreclass& operator=(const tilestoreclass&);
+};
+
+#endif /* TILESTORE_H */
@@ -4,19 +4,25 @@
 #include <stddef.h>
 
 #include "Constants.h"
+#include "LevelPack.h"
 #include "MakeAndPlay.h"
+#include "Map.h"
 #include "UtilityClass.h"
 
-towerclass::towerclass(void)
+/* Only the rows around the camera are ever looked at, so a few decoded
+ * chunks are plenty. The map starts out blank. */
+towerclass::towerclass(void) :
+    back(40, 120, 3),
+    contents(40, 700, 3),
+    minitower(40, 100, 3)
 {
     minitowermode = false;
-    //We create a blank map
-    SDL_memset(contents, 0, sizeof(contents));
-    SDL_memset(back, 0, sizeof(back));
-    SDL_memset(minitower, 0, sizeof(minitower));
 
+#ifndef LEVEL_PACK
+    /* Otherwise the level pack isn't mounted yet, see main() */
     loadbackground();
     loadmap();
+#endif
 }
 
 int towerclass::backat(int xp, int yp, int yoff)
@@ -26,7 +32,7 @@ int towerclass::backat(int xp, int yp, int yoff)
     if (xp >= 0 && xp < 40)
     {
         yp = POS_MOD(yp, 120);
-        return back[TILE_IDX(xp, yp)];
+        return back.get(xp, yp);
     }
     return 0;
 }
@@ -44,15 +50,15 @@ int towerclass::at(int xp, int yp, int yoff)
         yp = POS_MOD(yp, 700);
         if (xp >= 0 && xp < 40)
         {
-            return contents[TILE_IDX(xp, yp)];
+            return contents.get(xp, yp);
         }
         else if (xp == -1)
         {
-            return contents[TILE_IDX(0, yp)];
+            return contents.get(0, yp);
         }
         else if (xp == 40)
         {
-            return contents[TILE_IDX(39, yp)];
+            return contents.get(39, yp);
         }
         return 0;
     }
@@ -65,15 +71,15 @@ int towerclass::miniat(int xp, int yp, int yoff)
     yp = POS_MOD(yp, 100);
     if (xp >= 0 && xp < 40)
     {
-        return minitower[TILE_IDX(xp, yp)];
+        return minitower.get(xp, yp);
     }
     else if (xp == -1)
     {
-        return minitower[TILE_IDX(0, yp)];
+        return minitower.get(0, yp);
     }
     else if (xp == 40)
     {
-        return minitower[TILE_IDX(39, yp)];
+        return minitower.get(39, yp);
     }
     return 0;
 }
@@ -82,7 +88,7 @@ void towerclass::loadminitower1(void)
 {
     //Loads the first minitower into the array.
 #if !defined(MAKEANDPLAY)
-    static const short tmap[] = {
+    TOWER_CONTENTS(LEVELPACK_TOWER_MINITOWER1, minitower, {
     12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,
     12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,
     12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,
@@ -183,16 +189,14 @@ void towerclass::loadminitower1(void)
     12,12,12,12,12,12,12,12,21,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,20,15,18,18,18,18,
     12,12,12,12,12,12,12,12,21,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,20,12,12,12,12,12,
     12,12,12,12,12,12,12,12,21,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,20,12,12,12,12,12,
-    };
-
-    SDL_memcpy(minitower, tmap, sizeof(minitower));
+    });
 #endif
 }
 
 void towerclass::loadminitower2(void)
 {
 #if !defined(MAKEANDPLAY)
-    static const short tmap[] = {
+    TOWER_CONTENTS(LEVELPACK_TOWER_MINITOWER2, minitower, {
     12,12,21,10,0,0,0,0,0,0,0,0,0,0,0,0,11,20,21,10,0,20,21,28,28,20,21,28,28,20,12,12,12,12,12,12,12,12,12,12,
     12,12,21,10,0,0,0,0,0,0,0,0,0,0,0,0,11,20,21,10,0,20,21,28,28,20,21,28,28,20,12,12,12,12,12,12,12,12,12,12,
     12,12,21,10,0,0,0,0,0,0,0,0,0,0,0,0,11,20,21,10,0,20,21,28,28,20,21,28,28,20,12,12,12,12,12,12,12,12,12,12,
@@ -293,9 +297,7 @@ void towerclass::loadminitower2(void)
     12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,21,28,28,0,0,0,0,0,0,0,0,0,20,12,12,12,12,12,
     12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,21,28,28,0,0,0,0,0,0,0,0,0,20,12,12,12,12,12,
     12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,21,28,28,0,0,0,0,0,0,0,0,0,20,12,12,12,12,12,
-    };
-
-    SDL_memcpy(minitower, tmap, sizeof(minitower));
+    });
 #endif
 }
 
@@ -303,7 +305,7 @@ void towerclass::loadminitower2(void)
 void towerclass::loadbackground(void)
 {
     //Loads the background into the array.
-    static const short tmap[] = {
+    TOWER_CONTENTS(LEVELPACK_TOWER_BACKGROUND, back, {
     1,2,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,5,1,2,0,0,0,0,0,0,0,0,0,0,0,0,5,4,0,0,
     2,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,5,1,2,0,0,0,0,0,0,0,0,0,0,0,0,5,1,1,4,0,
     0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,5,1,2,0,0,0,0,0,0,0,0,0,0,0,0,5,1,1,1,1,4,
@@ -424,15 +426,14 @@ void towerclass::loadbackground(void)
     1,1,1,1,2,0,0,0,3,2,0,0,0,0,3,2,0,0,0,0,0,0,0,0,5,1,2,3,1,1,1,1,1,1,1,1,2,0,0,3,
     1,1,1,2,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,5,1,2,0,0,3,1,1,2,3,1,1,2,0,0,0,0,
     1,1,2,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,5,1,2,0,0,0,0,3,2,0,0,3,2,0,0,0,0,0,
-    };
-    SDL_memcpy(back, tmap, sizeof(back));
+    });
 }
 
 void towerclass::loadmap(void)
 {
     //Loads the map into the array.
 #if !defined(MAKEANDPLAY)
-    static const short tmap[] = {
+    TOWER_CONTENTS(LEVELPACK_TOWER_MAP, contents, {
     12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,
     12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,
     12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,
@@ -1133,8 +1134,6 @@ void towerclass::loadmap(void)
     12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,
     12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,
     12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,
-    };
-
-    SDL_memcpy(contents, tmap, sizeof(contents));
+    });
 #endif
 }
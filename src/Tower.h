@@ -1,6 +1,8 @@
 #ifndef TOWER_H
 #define TOWER_H
 
+#include "TileStore.h"
+
 class towerclass
 {
 public:
@@ -20,9 +22,9 @@ public:
 
     void loadmap(void);
 
-    short back[40 * 120];
-    short contents[40 * 700];
-    short minitower[40 * 100];
+    tilestoreclass back;
+    tilestoreclass contents;
+    tilestoreclass minitower;
 
     bool minitowermode;
 };
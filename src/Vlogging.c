@@ -1,3 +1,5 @@
+#include "Vlogging.h"
+
 #include "pspdebug.h"
 #include <SDL2/SDL.h>
 #include <stdarg.h>
@@ -27,13 +29,120 @@
 
 static int output_enabled = 1;
 static int color_enabled = 0;
-static int debug_enabled = 0;
+static int debug_enabled = VLOG_MIN_LEVEL <= VLOG_LEVEL_DEBUG;
 static int info_enabled = 1;
 static int warn_enabled = 1;
 static int error_enabled = 1;
 
+int __vlog_enabled[VLOG_NUM_LEVELS] = {VLOG_MIN_LEVEL <= VLOG_LEVEL_DEBUG, 1, 1, 1};
+
 static FILE *output_file = NULL;
 
+static const char* short_prefixes[VLOG_NUM_LEVELS] = {"[D]", "[I]", "[W]", "[E]"};
+static const char* long_prefixes[VLOG_NUM_LEVELS] = {"[DEBUG]", "[INFO]", "[WARNING]", "[ERROR]"};
+
+/* Longer lines get cut off */
+#define LINE_LENGTH 256
+/* Has to be a power of two */
+#define RING_SLOTS 128
+
+/* A bounded queue that any thread can log into without taking a lock. A
+ * slot's sequence says whose turn it is: it's equal to the position it's
+ * about to be written at while it's free, one past that once it's written,
+ * and it moves on a lap once the writer thread is done with it. */
+typedef struct LogSlot
+{
+    SDL_atomic_t sequence;
+    int level;
+    char text[LINE_LENGTH];
+} LogSlot;
+
+static LogSlot ring[RING_SLOTS];
+static SDL_atomic_t ring_tail;
+static SDL_atomic_t ring_head;
+static SDL_atomic_t dropped;
+static SDL_atomic_t quitting;
+
+static SDL_sem* pending = NULL;
+static SDL_Thread* writer = NULL;
+static int writer_running = 0;
+/* Held while draining, so that warnings and errors that don't fit can be
+ * written out right away */
+static SDL_mutex* draining = NULL;
+
+static void update_enabled(void)
+{
+    __vlog_enabled[VLOG_LEVEL_DEBUG] = output_enabled && debug_enabled;
+    __vlog_enabled[VLOG_LEVEL_INFO] = output_enabled && info_enabled;
+    __vlog_enabled[VLOG_LEVEL_WARN] = output_enabled && warn_enabled;
+    __vlog_enabled[VLOG_LEVEL_ERROR] = output_enabled && error_enabled;
+}
+
+static void write_line(const int level, const char* text)
+{
+    pspDebugScreenPrintf("%s %s\n", short_prefixes[level], text);
+    if (output_file != NULL)
+    {
+        fprintf(output_file, "%s %s\n", long_prefixes[level], text);
+    }
+}
+
+/* Only ever called with draining held, or once the writer's gone */
+static void drain(void)
+{
+    unsigned int head = (unsigned int) SDL_AtomicGet(&ring_head);
+    int wrote = 0;
+    int lost;
+
+    for (;;)
+    {
+        LogSlot* slot = &ring[head & (RING_SLOTS - 1)];
+
+        if ((unsigned int) SDL_AtomicGet(&slot->sequence) != head + 1)
+        {
+            break;
+        }
+
+        write_line(slot->level, slot->text);
+        SDL_AtomicSet(&slot->sequence, (int) (head + RING_SLOTS));
+        head++;
+        SDL_AtomicSet(&ring_head, (int) head);
+        wrote = 1;
+    }
+
+    lost = SDL_AtomicSet(&dropped, 0);
+    if (lost > 0)
+    {
+        char text[LINE_LENGTH];
+        SDL_snprintf(text, sizeof(text), "Log was full, %i lines were dropped", lost);
+        write_line(VLOG_LEVEL_WARN, text);
+        wrote = 1;
+    }
+
+    if (wrote && output_file != NULL)
+    {
+        fflush(output_file);
+    }
+}
+
+static int SDLCALL writer_thread(void* unused)
+{
+    (void) unused;
+
+    /* Only gets to run while the game's waiting anyway */
+    SDL_SetThreadPriority(SDL_THREAD_PRIORITY_LOW);
+
+    while (!SDL_AtomicGet(&quitting))
+    {
+        SDL_SemWait(pending);
+        SDL_LockMutex(draining);
+        drain();
+        SDL_UnlockMutex(draining);
+    }
+
+    return 0;
+}
+
 void vlog_init(void)
 {
 #ifdef _WIN32
@@ -42,6 +151,7 @@ void vlog_init(void)
     osvi.dwOSVersionInfoSize = sizeof(OSVERSIONINFO);
     GetVersionExW(&osvi);
 #endif
+    int i;
 
     if (STDOUT_IS_TTY
     && STDERR_IS_TTY
@@ -55,12 +165,72 @@ void vlog_init(void)
         color_enabled = 1;
     }
 
+    update_enabled();
+
     output_file = fopen("VVVVVV.log", "w");
+
+    for (i = 0; i < RING_SLOTS; i++)
+    {
+        SDL_AtomicSet(&ring[i].sequence, i);
+    }
+    SDL_AtomicSet(&ring_tail, 0);
+    SDL_AtomicSet(&ring_head, 0);
+    SDL_AtomicSet(&dropped, 0);
+    SDL_AtomicSet(&quitting, 0);
+
+    pending = SDL_CreateSemaphore(0);
+    draining = SDL_CreateMutex();
+    if (pending != NULL && draining != NULL)
+    {
+        writer = SDL_CreateThread(writer_thread, "Log", NULL);
+    }
+    if (writer == NULL)
+    {
+        /* Falls back to writing every line right away */
+        vlog_error("Unable to start the log thread: %s", SDL_GetError());
+        return;
+    }
+    writer_running = 1;
+}
+
+void vlog_quit(void)
+{
+    if (!writer_running)
+    {
+        return;
+    }
+
+    SDL_AtomicSet(&quitting, 1);
+    SDL_SemPost(pending);
+    SDL_WaitThread(writer, NULL);
+    writer = NULL;
+    writer_running = 0;
+
+    drain();
+    SDL_DestroySemaphore(pending);
+    pending = NULL;
+    SDL_DestroyMutex(draining);
+    draining = NULL;
+}
+
+void vlog_flush(void)
+{
+    if (!writer_running)
+    {
+        return;
+    }
+
+    SDL_SemPost(pending);
+    while (SDL_AtomicGet(&ring_head) != SDL_AtomicGet(&ring_tail))
+    {
+        SDL_Delay(1);
+    }
 }
 
 void vlog_toggle_output(const int enable_output)
 {
     output_enabled = enable_output;
+    update_enabled();
 }
 
 void vlog_toggle_color(const int enable_color)
@@ -71,126 +241,165 @@ void vlog_toggle_color(const int enable_color)
 void vlog_toggle_debug(const int enable_debug)
 {
     debug_enabled = enable_debug;
+    update_enabled();
 }
 
 void vlog_toggle_info(const int enable_info)
 {
     info_enabled = enable_info;
+    update_enabled();
 }
 
 void vlog_toggle_warn(const int enable_warn)
 {
     warn_enabled = enable_warn;
+    update_enabled();
 }
 
 void vlog_toggle_error(const int enable_error)
 {
     error_enabled = enable_error;
+    update_enabled();
 }
 
-void __vlog_common(const char *short_prefix, const char* long_prefix, const char *text)
+static LogSlot* reserve(unsigned int* position)
 {
-    pspDebugScreenPrintf("%s %s\n", short_prefix, text);
-    fprintf(output_file, "%s %s\n", long_prefix, text);
-    fflush(output_file);
-}
-
-#if 0
-
-SDL_PRINTF_VARARG_FUNC(1) int vlog_debug(const char* text, ...)
-{
-    va_list list;
-    int retval;
-
-    if (!output_enabled || !debug_enabled)
+    for (;;)
     {
-        return 0;
+        const unsigned int tail = (unsigned int) SDL_AtomicGet(&ring_tail);
+        LogSlot* slot = &ring[tail & (RING_SLOTS - 1)];
+        const int lap = (int) ((unsigned int) SDL_AtomicGet(&slot->sequence) - tail);
+
+        if (lap < 0)
+        {
+            /* The writer hasn't caught up yet */
+            return NULL;
+        }
+        if (lap == 0 && SDL_AtomicCAS(&ring_tail, (int) tail, (int) (tail + 1)))
+        {
+            *position = tail;
+            return slot;
+        }
+        /* Another thread got there first, try the next one */
     }
-
-    printf(Color_BOLD_GRAY);
-    printf("[DEBUG]");
-    printf(Color_RESET);
-    printf(" ");
-
-    va_start(list, text);
-    retval = vprintf(text, list);
-    va_end(list);
-
-    putchar('\n');
-
-    return retval;
 }
 
-SDL_PRINTF_VARARG_FUNC(1) int vlog_info(const char* text, ...)
+void __vlog_format(const int level, const char* text, ...)
 {
     va_list list;
-    int retval;
+    unsigned int position;
+    LogSlot* slot;
 
-    if (!output_enabled || !info_enabled)
+    if (!writer_running)
     {
-        return 0;
+        char str[1024];
+
+        va_start(list, text);
+        SDL_vsnprintf(str, sizeof(str), text, list);
+        va_end(list);
+
+        write_line(level, str);
+        if (output_file != NULL)
+        {
+            fflush(output_file);
+        }
+        return;
     }
 
-    printf(Color_BOLD);
-    printf("[INFO]");
-    printf(Color_RESET);
-    printf(" ");
-
-    va_start(list, text);
-    retval = vprintf(text, list);
-    va_end(list);
-
-    putchar('\n');
-
-    return retval;
-}
-
-SDL_PRINTF_VARARG_FUNC(1) int vlog_warn(const char* text, ...)
-{
-    va_list list;
-    int retval;
-
-    if (!output_enabled || !warn_enabled)
+    slot = reserve(&position);
+    if (slot == NULL && level >= VLOG_LEVEL_WARN)
     {
-        return 0;
+        /* Too important to drop, and startup can keep the writer from
+         * running for a long time. What's queued ahead of it goes first,
+         * up to a line another thread is still filling in. */
+        char str[LINE_LENGTH];
+
+        va_start(list, text);
+        SDL_vsnprintf(str, sizeof(str), text, list);
+        va_end(list);
+
+        SDL_LockMutex(draining);
+        drain();
+        write_line(level, str);
+        if (output_file != NULL)
+        {
+            fflush(output_file);
+        }
+        SDL_UnlockMutex(draining);
+        return;
+    }
+    if (slot == NULL)
+    {
+        SDL_AtomicIncRef(&dropped);
+        return;
     }
-
-    fprintf(stderr, Color_BOLD_YELLOW);
-    fprintf(stderr, "[WARN]");
-    fprintf(stderr, Color_RESET);
-    fprintf(stderr, " ");
 
     va_start(list, text);
-    retval = vfprintf(stderr, text, list);
+    SDL_vsnprintf(slot->text, sizeof(slot->text), text, list);
     va_end(list);
+    slot->level = level;
 
-    fputc('\n', stderr);
-
-    return retval;
+    SDL_AtomicSet(&slot->sequence, (int) (position + 1));
+    SDL_SemPost(pending);
 }
 
-SDL_PRINTF_VARARG_FUNC(1) int vlog_error(const char* text, ...)
+#ifdef VLOG_BENCHMARK
+
+#define BENCHMARK_LINES 10000
+
+static double benchmark_pass(const int debug, const int sync)
 {
-    va_list list;
-    int retval;
+    const Uint64 start = SDL_GetPerformanceCounter();
+    const int was_running = writer_running;
+    int i;
+
+    vlog_toggle_debug(debug);
+    writer_running = was_running && !sync;
 
-    if (!output_enabled || !error_enabled)
+    for (i = 0; i < BENCHMARK_LINES; i++)
     {
-        return 0;
+        vlog_debug("Benchmark line %i of %i, %s", i + 1, BENCHMARK_LINES, "logged and thrown away");
     }
 
-    fprintf(stderr, Color_BOLD_RED);
-    fprintf(stderr, "[ERROR]");
-    fprintf(stderr, Color_RESET);
-    fprintf(stderr, " ");
+    writer_running = was_running;
 
-    va_start(list, text);
-    retval = vfprintf(stderr, text, list);
-    va_end(list);
-
-    fputc('\n', stderr);
+    return (double) (SDL_GetPerformanceCounter() - start) * 1000.0 / SDL_GetPerformanceFrequency();
+}
 
-    return retval;
+void vlog_benchmark(void)
+{
+    const int was_debug = debug_enabled;
+    double off_ms;
+    double on_ms;
+    double sync_ms;
+    Uint64 start;
+    double flush_ms;
+    int lost;
+
+    off_ms = benchmark_pass(0, 0);
+
+    on_ms = benchmark_pass(1, 0);
+    /* The writer only gets to run once the game waits, so most of these
+     * won't have fit */
+    lost = SDL_AtomicGet(&dropped);
+    start = SDL_GetPerformanceCounter();
+    vlog_flush();
+    flush_ms = (double) (SDL_GetPerformanceCounter() - start) * 1000.0 / SDL_GetPerformanceFrequency();
+
+    sync_ms = benchmark_pass(1, 1);
+
+    vlog_toggle_debug(was_debug);
+
+    vlog_info(
+        "%i debug lines: %.2f ms with debug off, %.2f ms with it on (%i dropped, %.2f ms to write out the rest), %.2f ms written right away",
+        BENCHMARK_LINES,
+        off_ms,
+        on_ms,
+        lost,
+        flush_ms,
+        sync_ms
+    );
+    vlog_flush();
 }
 
-#endif
+#endif /* VLOG_BENCHMARK */
@@ -9,8 +9,27 @@ extern "C"
 #include <SDL2/SDL.h>
 #include <pspdebug.h>
 
+#define VLOG_LEVEL_DEBUG 0
+#define VLOG_LEVEL_INFO 1
+#define VLOG_LEVEL_WARN 2
+#define VLOG_LEVEL_ERROR 3
+#define VLOG_NUM_LEVELS 4
+
+/* Anything below this level isn't compiled in at all */
+#ifndef VLOG_MIN_LEVEL
+#define VLOG_MIN_LEVEL VLOG_LEVEL_DEBUG
+#endif
+
+/* Starts the thread that writes the log out. Anything logged before then, or
+ * after vlog_quit(), is written right away. */
 void vlog_init(void);
 
+/* Writes out whatever's left and stops the writer thread */
+void vlog_quit(void);
+
+/* Waits until everything logged so far has been written out */
+void vlog_flush(void);
+
 void vlog_toggle_output(int enable_output);
 
 void vlog_toggle_color(int enable_color);
@@ -23,45 +42,30 @@ void vlog_toggle_warn(int enable_warn);
 
 void vlog_toggle_error(int enable_error);
 
-#if 0
-
-SDL_PRINTF_VARARG_FUNC(1) int vlog_debug(const char* text, ...);
-
-SDL_PRINTF_VARARG_FUNC(1) int vlog_info(const char* text, ...);
-
-SDL_PRINTF_VARARG_FUNC(1) int vlog_warn(const char* text, ...);
-
-SDL_PRINTF_VARARG_FUNC(1) int vlog_error(const char* text, ...);
-
+#ifdef VLOG_BENCHMARK
+/* Logs how long 10000 debug lines take with debug off, on, and written out
+ * right away like the logger used to */
+void vlog_benchmark(void);
 #endif
 
-void __vlog_common(const char *short_prefix, const char* long_prefix, const char *text);
+/* Checked before anything gets formatted */
+extern int __vlog_enabled[VLOG_NUM_LEVELS];
 
-#define vlog_debug(...) \
-   do { \
-      char str[1024] = {0}; \
-      sprintf(str, __VA_ARGS__); \
-      __vlog_common("[D]", "[DEBUG]", str); \
-   } while (0)
-#define vlog_info(...) \
-   do { \
-      char str[1024] = {0}; \
-      sprintf(str, __VA_ARGS__); \
-      __vlog_common("[I]", "[INFO]", str); \
-   } while (0)
-#define vlog_warn(...) \
-   do { \
-      char str[1024] = {0}; \
-      sprintf(str, __VA_ARGS__); \
-      __vlog_common("[W]", "[WARNING]", str); \
-   } while (0)
-#define vlog_error(...) \
+SDL_PRINTF_VARARG_FUNC(2) void __vlog_format(int level, SDL_PRINTF_FORMAT_STRING const char* text, ...);
+
+#define __vlog(level, ...) \
    do { \
-      char str[1024] = {0}; \
-      sprintf(str, __VA_ARGS__); \
-      __vlog_common("[E]", "[ERROR]", str); \
+      if (level >= VLOG_MIN_LEVEL && __vlog_enabled[level]) \
+      { \
+         __vlog_format(level, __VA_ARGS__); \
+      } \
    } while (0)
 
+#define vlog_debug(...) __vlog(VLOG_LEVEL_DEBUG, __VA_ARGS__)
+#define vlog_info(...) __vlog(VLOG_LEVEL_INFO, __VA_ARGS__)
+#define vlog_warn(...) __vlog(VLOG_LEVEL_WARN, __VA_ARGS__)
+#define vlog_error(...) __vlog(VLOG_LEVEL_ERROR, __VA_ARGS__)
+
 #ifdef __cplusplus
 } /* extern "C" */
 #endif
@@ -2,18 +2,25 @@
 
 #include "Game.h"
 #include "Entity.h"
+#include "LevelPack.h"
 #include "MakeAndPlay.h"
+#include "Map.h"
 
-const short* warpclass::loadlevel(int rx, int ry)
+int warpclass::roomindex(int rx, int ry)
 {
-    int t;
-
     rx -= 100;
     ry -= 100;
     rx += 50 - 14;
     ry += 49;   //warp
 
-    t = rx + (ry * 100);
+    return rx + (ry * 100);
+}
+
+const short* warpclass::loadlevel(int rx, int ry)
+{
+    int t;
+
+    t = roomindex(rx, ry);
     const short* result;
     rcol = 0;
     warpx = false;
@@ -26,7 +33,7 @@ const short* warpclass::loadlevel(int rx, int ry)
 #if !defined(MAKEANDPLAY)
     case rn(50,50):
     {
-        static const short contents[] = {
+        ROOM_CONTENTS(LEVELPACK_WARP, t, 0, {
         120,120,120,120,120,120,120,120,120,120,120,120,120,200,80,202,0,0,0,0,0,0,0,0,200,80,202,120,120,120,120,120,120,120,120,120,120,120,120,120,
         120,120,120,120,120,120,120,120,120,120,120,120,120,200,80,202,0,0,0,0,0,0,0,0,200,80,202,120,120,120,120,120,120,120,120,120,120,120,120,120,
         120,120,120,120,120,120,120,120,120,120,120,120,120,200,80,202,0,0,0,0,0,0,0,0,200,80,202,120,120,120,120,120,120,120,120,120,120,120,120,120,
@@ -57,7 +64,7 @@ const short* warpclass::loadlevel(int rx, int ry)
         120,120,120,120,120,120,120,120,120,120,120,120,120,200,80,202,0,0,0,0,0,0,0,0,200,80,202,120,120,120,120,120,120,120,120,120,120,120,120,120,
         120,120,120,120,120,120,120,120,120,120,120,120,120,200,80,202,0,0,0,0,0,0,0,0,200,80,202,120,120,120,120,120,120,120,120,120,120,120,120,120,
         120,120,120,120,120,120,120,120,120,120,120,120,120,200,80,202,0,0,0,0,0,0,0,0,200,80,202,120,120,120,120,120,120,120,120,120,120,120,120,120,
-        };
+        });
 
         obj.createentity(288, 168, 10, 1, 50500);  // (savepoint)
 
@@ -76,7 +83,7 @@ const short* warpclass::loadlevel(int rx, int ry)
     case rn(51,50):
     {
 
-        static const short contents[] = {
+        ROOM_CONTENTS(LEVELPACK_WARP, t, 0, {
         247,247,247,247,247,247,247,247,247,247,247,247,247,247,247,248,206,86,208,246,247,247,247,247,247,247,247,247,247,247,247,247,247,247,247,247,247,247,247,247,
         0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,206,86,208,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
         0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,206,86,208,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
@@ -107,7 +114,7 @@ const short* warpclass::loadlevel(int rx, int ry)
         126,126,126,206,86,208,0,0,0,0,166,167,167,167,167,168,206,86,208,126,126,126,126,126,126,126,126,126,126,126,126,126,126,126,126,126,126,126,126,126,
         126,126,126,206,86,208,0,0,0,0,206,86,86,86,86,208,206,86,208,126,126,126,126,126,126,126,126,126,126,126,126,126,126,126,126,126,126,126,126,126,
         126,126,126,206,86,208,0,0,0,0,206,86,86,86,86,208,206,86,208,126,126,126,126,126,126,126,126,126,126,126,126,126,126,126,126,126,126,126,126,126,
-        };
+        });
         rcol = 2;
         warpx = true;
         roomname = "A Bisected Spiral";
@@ -119,7 +126,7 @@ const short* warpclass::loadlevel(int rx, int ry)
     case rn(51,51):
     {
 
-        static const short contents[] = {
+        ROOM_CONTENTS(LEVELPACK_WARP, t, 0, {
         83,83,83,83,83,205,0,0,0,0,203,83,83,83,83,83,83,205,0,0,0,0,203,83,83,83,83,83,83,205,0,0,0,0,203,83,83,83,83,83,
         83,83,83,83,83,205,0,0,0,0,203,83,83,83,83,83,83,205,0,0,0,0,203,83,83,83,83,83,83,205,0,0,0,0,203,83,83,83,83,83,
         244,244,244,244,244,245,0,0,0,0,243,244,244,244,244,244,244,245,0,0,0,0,243,244,244,244,244,244,244,245,0,0,0,0,243,244,244,244,244,244,
@@ -150,7 +157,7 @@ const short* warpclass::loadlevel(int rx, int ry)
         83,83,83,83,83,205,0,0,0,0,203,83,83,83,83,83,83,205,0,0,0,0,203,83,83,83,83,83,83,205,0,0,0,0,203,83,83,83,83,83,
         83,83,83,83,83,205,0,0,0,0,203,83,83,83,83,83,83,205,0,0,0,0,203,83,83,83,83,83,83,205,0,0,0,0,203,83,83,83,83,83,
         83,83,83,83,83,205,0,0,0,0,203,83,83,83,83,83,83,205,0,0,0,0,203,83,83,83,83,83,83,205,0,0,0,0,203,83,83,83,83,83,
-        };
+        });
 
         obj.createentity(248, 80, 10, 1, 51510);  // (savepoint)
         obj.createentity(136, 128, 1, 3, 3, 128, 120, 288, 152);  // Enemy, bounded
@@ -165,7 +172,7 @@ const short* warpclass::loadlevel(int rx, int ry)
     case rn(52,51):
     {
 
-        static const short contents[] = {
+        ROOM_CONTENTS(LEVELPACK_WARP, t, 0, {
         95,95,95,95,95,217,0,0,0,0,215,95,95,95,95,95,95,95,95,95,95,95,95,95,95,95,95,95,95,95,95,95,95,95,95,95,95,95,95,95,
         256,256,256,256,256,257,0,0,0,0,255,256,256,256,256,256,256,256,256,256,256,256,256,256,256,256,256,256,256,256,256,256,256,256,256,256,256,256,256,256,
         0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
@@ -196,7 +203,7 @@ const short* warpclass::loadlevel(int rx, int ry)
         135,135,135,135,135,135,135,135,135,135,215,95,217,215,95,95,95,95,95,95,95,95,95,217,215,95,217,135,135,135,135,135,135,135,135,135,135,135,135,135,
         135,135,135,135,135,135,135,135,135,135,215,95,217,215,95,95,95,95,95,95,95,95,95,217,215,95,217,135,135,135,135,135,135,135,135,135,135,135,135,135,
         135,135,135,135,135,135,135,135,135,135,215,95,217,215,95,95,95,95,95,95,95,95,95,217,215,95,217,135,135,135,135,135,135,135,135,135,135,135,135,135,
-        };
+        });
 
         obj.createentity(32, 24, 1, 3, 4, -56, -40, 384, 312);  // Enemy, bounded
         obj.createentity(96, 24, 1, 3, 4, -56, -40, 384, 312);  // Enemy, bounded
@@ -213,7 +220,7 @@ const short* warpclass::loadlevel(int rx, int ry)
     case rn(52,50):
     {
 
-        static const short contents[] = {
+        ROOM_CONTENTS(LEVELPACK_WARP, t, 0, {
         213,212,92,214,172,174,0,0,0,0,0,0,212,214,0,0,0,0,0,0,212,214,0,0,0,0,0,0,212,214,0,0,0,0,0,0,212,92,92,92,
         213,212,92,214,252,254,0,0,0,0,0,0,212,214,0,0,0,0,0,0,212,214,0,0,0,0,0,0,212,214,0,0,0,0,0,0,212,92,92,92,
         213,212,92,214,0,0,0,0,0,0,0,0,212,214,0,0,0,0,0,0,212,214,0,0,0,0,0,0,212,214,0,0,0,0,0,0,212,92,92,92,
@@ -244,7 +251,7 @@ const short* warpclass::loadlevel(int rx, int ry)
         213,212,92,214,172,174,0,0,0,0,0,0,212,214,0,0,0,0,0,0,212,214,0,0,0,0,0,0,212,214,0,0,0,0,0,0,212,92,92,92,
         213,212,92,214,212,214,0,0,0,0,0,0,212,214,0,0,0,0,0,0,212,214,0,0,0,0,0,0,212,214,0,0,0,0,0,0,212,92,92,92,
         213,212,92,214,252,254,0,0,0,0,0,0,212,214,0,0,0,0,0,0,212,214,0,0,0,0,0,0,212,214,0,0,0,0,0,0,212,92,92,92,
-        };
+        });
 
         obj.createentity(32, 16, 10, 0, 50520);  // (savepoint)
         rcol = 4;
@@ -258,7 +265,7 @@ const short* warpclass::loadlevel(int rx, int ry)
     case rn(53,50):
     {
 
-        static const short contents[] = {
+        ROOM_CONTENTS(LEVELPACK_WARP, t, 0, {
         250,250,250,250,250,250,251,0,0,0,209,211,249,250,250,250,250,250,250,250,250,250,250,250,250,250,250,250,250,250,250,250,250,250,250,250,250,250,250,250,
         0,0,0,0,0,0,0,0,0,0,209,211,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
         0,0,0,0,0,0,0,0,0,0,209,211,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
@@ -289,7 +296,7 @@ const short* warpclass::loadlevel(int rx, int ry)
         0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,209,211,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,209,211,0,0,0,0,0,
         170,170,170,170,170,170,170,170,170,170,170,170,170,170,171,209,211,169,170,170,170,170,170,170,170,170,170,170,170,170,170,170,171,209,211,169,170,170,170,170,
         89,89,89,89,89,89,89,89,89,89,89,89,89,89,211,209,211,209,89,89,89,89,89,89,89,89,89,89,89,89,89,89,211,209,211,209,89,89,89,89,
-        };
+        });
 
         obj.createentity(16, 120, 10, 1, 50530);  // (savepoint)
         rcol = 3;
@@ -302,7 +309,7 @@ const short* warpclass::loadlevel(int rx, int ry)
     case rn(53,49):
     {
 
-        static const short contents[] = {
+        ROOM_CONTENTS(LEVELPACK_WARP, t, 0, {
         126,126,126,126,206,86,208,0,0,0,206,86,208,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,206,86,
         126,126,126,126,206,86,208,0,0,0,246,247,248,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,246,247,
         126,126,126,126,206,86,208,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
@@ -333,7 +340,7 @@ const short* warpclass::loadlevel(int rx, int ry)
         126,126,126,126,206,86,208,0,0,0,166,167,168,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,166,167,
         126,126,126,126,206,86,208,0,0,0,206,86,208,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,206,86,
         126,126,126,126,206,86,208,0,0,0,206,86,208,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,206,86,
-        };
+        });
 
         obj.createentity(64, 152, 10, 0, 49530);  // (savepoint)
         rcol = 2;
@@ -346,7 +353,7 @@ const short* warpclass::loadlevel(int rx, int ry)
     case rn(54,49):
     {
 
-        static const short contents[] = {
+        ROOM_CONTENTS(LEVELPACK_WARP, t, 0, {
         80,80,80,202,200,202,200,80,80,80,80,80,80,80,80,80,80,80,80,80,80,80,80,80,80,80,80,80,80,80,80,80,80,80,80,202,200,202,200,80,
         241,241,241,242,200,202,240,241,241,241,241,241,241,241,241,241,241,241,241,241,241,241,241,241,241,241,241,241,241,241,241,241,241,241,241,242,200,202,240,241,
         0,0,0,0,200,202,7,7,7,7,7,7,160,161,161,162,7,7,7,7,7,7,7,160,161,161,162,7,7,7,7,7,7,7,7,7,200,202,0,0,
@@ -377,7 +384,7 @@ const short* warpclass::loadlevel(int rx, int ry)
         161,161,161,161,161,161,161,161,161,162,200,202,0,0,0,0,160,161,161,161,161,161,161,161,161,161,161,161,161,161,161,161,161,161,161,162,200,202,160,161,
         80,80,80,80,80,80,80,80,80,202,200,202,0,0,0,0,200,80,80,80,80,80,80,80,80,80,80,80,80,80,80,80,80,80,80,202,200,202,200,80,
         80,80,80,80,80,80,80,80,80,202,200,202,0,0,0,0,200,80,80,80,80,80,80,80,80,80,80,80,80,80,80,80,80,80,80,202,200,202,200,80,
-        };
+        });
 
         obj.createentity(296, 64, 10, 1, 49540);  // (savepoint)
         obj.createentity(152-4-15+8, 32, 1, 0, 6, 128, 32, 288, 200);  // Enemy, bounded
@@ -394,7 +401,7 @@ const short* warpclass::loadlevel(int rx, int ry)
     case rn(54,50):
     {
 
-        static const short contents[] = {
+        ROOM_CONTENTS(LEVELPACK_WARP, t, 0, {
         86,86,208,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,206,86,86,
         86,86,208,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,206,86,86,
         86,86,208,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,206,86,86,
@@ -425,7 +432,7 @@ const short* warpclass::loadlevel(int rx, int ry)
         86,86,208,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,206,86,86,
         86,86,208,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,206,86,86,
         86,86,208,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,206,86,86,
-        };
+        });
         if(!game.intimetrial)
         {
             obj.createentity((7 * 8) + 4, (6 * 8), 14); //Teleporter!
@@ -440,7 +447,7 @@ const short* warpclass::loadlevel(int rx, int ry)
     case rn(55,50):
     {
 
-        static const short contents[] = {
+        ROOM_CONTENTS(LEVELPACK_WARP, t, 0, {
         212,92,92,214,252,253,253,254,212,92,92,214,212,92,92,214,212,92,92,214,212,92,92,214,212,92,92,214,212,92,92,214,212,92,92,214,212,92,92,214,
         212,92,92,214,0,0,0,0,252,253,253,254,212,92,92,214,212,92,92,214,212,92,92,214,212,92,92,214,212,92,92,214,212,92,92,214,212,92,92,214,
         212,92,92,214,0,0,0,0,0,0,0,0,252,253,253,254,212,92,92,214,212,92,92,214,212,92,92,214,212,92,92,214,212,92,92,214,212,92,92,214,
@@ -471,7 +478,7 @@ const short* warpclass::loadlevel(int rx, int ry)
         212,92,92,214,212,92,92,214,172,173,173,174,0,0,0,0,0,0,0,0,212,92,92,214,212,92,92,214,212,92,92,214,212,92,92,214,212,92,92,214,
         212,92,92,214,212,92,92,214,212,92,92,214,172,173,173,174,0,0,0,0,212,92,92,214,212,92,92,214,212,92,92,214,212,92,92,214,212,92,92,214,
         212,92,92,214,212,92,92,214,212,92,92,214,212,92,92,214,0,0,0,0,212,92,92,214,212,92,92,214,212,92,92,214,212,92,92,214,212,92,92,214,
-        };
+        });
 
         obj.createentity(96, 72, 1, 3, 8, 64, 56, 256, 152);  // Enemy, bounded
         obj.createentity(240, 120, 1, 2, 8, 64, 56, 256, 152);  // Enemy, bounded
@@ -487,7 +494,7 @@ const short* warpclass::loadlevel(int rx, int ry)
     case rn(55,51):
     {
 
-        static const short contents[] = {
+        ROOM_CONTENTS(LEVELPACK_WARP, t, 0, {
         83,83,83,205,0,0,0,0,203,205,0,0,0,0,203,205,0,0,0,0,203,205,0,0,0,0,203,205,0,0,0,0,203,205,0,0,0,0,203,83,
         244,244,244,245,0,0,0,0,203,205,0,0,0,0,203,205,0,0,0,0,203,205,0,0,0,0,243,245,0,0,0,0,243,245,0,0,0,0,203,83,
         0,0,0,0,0,0,0,0,203,205,0,0,0,0,203,205,0,0,0,0,203,205,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,203,83,
@@ -518,7 +525,7 @@ const short* warpclass::loadlevel(int rx, int ry)
         83,83,83,205,0,0,0,0,203,205,0,0,0,0,203,205,0,0,0,0,163,165,0,0,0,0,163,165,0,0,0,0,203,205,0,0,0,0,203,83,
         83,83,83,205,0,0,0,0,203,205,0,0,0,0,203,205,0,0,0,0,203,205,0,0,0,0,203,205,0,0,0,0,203,205,0,0,0,0,203,83,
         83,83,83,205,0,0,0,0,203,205,0,0,0,0,203,205,0,0,0,0,203,205,0,0,0,0,203,205,0,0,0,0,203,205,0,0,0,0,203,83,
-        };
+        });
 
         obj.createentity(280, 24, 1, 2, 3, 128, 16, 304, 216);  // Enemy, bounded
         obj.createentity(136, 192, 1, 3, 3, 128, 16, 304, 216);  // Enemy, bounded
@@ -536,7 +543,7 @@ const short* warpclass::loadlevel(int rx, int ry)
     case rn(54,51):
     {
 
-        static const short contents[] = {
+        ROOM_CONTENTS(LEVELPACK_WARP, t, 0, {
         89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,211,209,89,89,211,209,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,
         250,250,250,250,250,250,250,250,250,250,250,250,250,250,250,250,250,251,249,250,250,251,249,250,250,250,250,250,250,250,250,250,250,250,250,250,250,250,250,250,
         0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
@@ -567,7 +574,7 @@ const short* warpclass::loadlevel(int rx, int ry)
         170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,171,169,170,170,171,169,170,170,170,170,170,170,170,170,171,0,0,0,0,169,170,170,170,
         89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,211,209,89,89,211,209,89,89,89,89,89,89,89,89,211,0,0,0,0,209,89,89,89,
         89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,211,209,89,89,211,209,89,89,89,89,89,89,89,89,211,0,0,0,0,209,89,89,89,
-        };
+        });
 
         obj.createentity(296, 32, 10, 1, 51540);  // (savepoint)
         obj.createentity(184, 192, 1, 18, 48, -800, -24, 4000, 264);  // Enemy, bounded
@@ -588,7 +595,7 @@ const short* warpclass::loadlevel(int rx, int ry)
     case rn(54,52):
     {
 
-        static const short contents[] = {
+        ROOM_CONTENTS(LEVELPACK_WARP, t, 0, {
         95,95,95,217,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,175,177,0,0,0,0,215,95,95,95,
         256,256,256,257,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,255,257,0,0,0,0,255,256,256,256,
         176,177,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,175,176,
@@ -619,7 +626,7 @@ const short* warpclass::loadlevel(int rx, int ry)
         176,176,176,177,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,175,177,0,0,0,0,175,176,176,176,
         95,95,95,217,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,215,217,0,0,0,0,215,95,95,95,
         95,95,95,217,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,255,257,0,0,0,0,215,95,95,95,
-        };
+        });
 
         obj.createentity(288, 200, 10, 1, 52540);  // (savepoint)
         obj.createentity(48, 16, 1, 1, 10, 0, -40, 320, 296);  // Enemy, bounded
@@ -643,7 +650,7 @@ const short* warpclass::loadlevel(int rx, int ry)
     case rn(53,52):
     {
 
-        static const short contents[] = {
+        ROOM_CONTENTS(LEVELPACK_WARP, t, 0, {
         207,207,207,207,207,207,207,207,207,207,207,207,207,206,86,208,206,208,0,0,0,0,206,208,206,86,208,207,207,207,207,206,86,208,246,247,247,248,206,86,
         207,207,207,207,207,207,207,207,207,207,207,207,207,206,86,208,206,208,0,0,0,0,206,208,206,86,208,207,207,207,207,206,86,208,0,0,0,0,206,86,
         167,167,167,167,167,167,167,167,167,167,167,167,167,128,86,208,206,208,0,0,0,0,206,208,206,86,127,167,167,167,167,128,86,208,0,0,0,0,206,86,
@@ -674,7 +681,7 @@ const short* warpclass::loadlevel(int rx, int ry)
         167,167,167,167,167,167,167,167,167,167,167,167,167,167,167,167,167,167,167,167,167,167,167,167,167,167,167,167,167,167,167,167,167,167,167,167,167,167,167,167,
         86,86,86,86,86,86,86,86,86,86,86,86,86,86,86,86,86,86,86,86,86,86,86,86,86,86,86,86,86,86,86,86,86,86,86,86,86,86,86,86,
         86,86,86,86,86,86,86,86,86,86,86,86,86,86,86,86,86,86,86,86,86,86,86,86,86,86,86,86,86,86,86,86,86,86,86,86,86,86,86,86,
-        };
+        });
 
         obj.createentity(152, 200, 10, 1, 52530);  // (savepoint)
         obj.createentity(248, 48, 1, 3, 5, -24, -24, 344, 256);  // Enemy, bounded
@@ -698,7 +705,7 @@ const short* warpclass::loadlevel(int rx, int ry)
     case rn(53,51):
     {
 
-        static const short contents[] = {
+        ROOM_CONTENTS(LEVELPACK_WARP, t, 0, {
         83,83,205,0,0,0,0,203,205,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,203,205,0,0,0,0,203,205,0,0,0,0,203,83,83,
         83,83,205,0,0,0,0,203,205,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,203,205,0,0,0,0,203,205,0,0,0,0,203,83,83,
         83,83,205,0,0,0,0,203,205,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,203,205,0,0,0,0,203,205,0,0,0,0,203,83,83,
@@ -729,7 +736,7 @@ const short* warpclass::loadlevel(int rx, int ry)
         83,83,205,0,0,0,0,203,205,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,203,205,0,0,0,0,203,205,0,0,0,0,203,83,83,
         83,83,205,0,0,0,0,203,205,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,203,205,0,0,0,0,203,205,0,0,0,0,203,83,83,
         83,83,205,0,0,0,0,203,205,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,203,205,0,0,0,0,203,205,0,0,0,0,203,83,83,
-        };
+        });
 
         obj.createentity(152, 112, 13);
         rcol = 1;
@@ -743,7 +750,7 @@ const short* warpclass::loadlevel(int rx, int ry)
     case rn(55,49):
     {
 
-        static const short contents[] = {
+        ROOM_CONTENTS(LEVELPACK_WARP, t, 0, {
         0,0,212,92,214,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,212,92,214,0,0,
         0,0,212,92,214,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,212,92,214,0,0,
         0,0,252,253,254,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,252,253,254,0,0,
@@ -774,7 +781,7 @@ const short* warpclass::loadlevel(int rx, int ry)
         0,0,212,92,214,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,212,92,214,0,0,
         0,0,212,92,214,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,212,92,214,0,0,
         0,0,212,92,214,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,212,92,214,0,0,
-        };
+        });
 
         obj.createentity(152, 112, 13);
         obj.createentity(152, 152, 10, 0, 49550);  // (savepoint)
@@ -789,7 +796,7 @@ const short* warpclass::loadlevel(int rx, int ry)
     case rn(55,52):
     {
 
-        static const short contents[] = {
+        ROOM_CONTENTS(LEVELPACK_WARP, t, 0, {
         0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
         0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
         0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
@@ -820,7 +827,7 @@ const short* warpclass::loadlevel(int rx, int ry)
         0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
         0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
         0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-        };
+        });
 
         obj.createentity(152, 112, 13);
         obj.createentity(136, 40, 10, 1, 52550);  // (savepoint)
@@ -835,7 +842,7 @@ const short* warpclass::loadlevel(int rx, int ry)
     case rn(52,52):
     {
 
-        static const short contents[] = {
+        ROOM_CONTENTS(LEVELPACK_WARP, t, 0, {
         0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,215,95,217,216,216,216,216,215,95,217,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
         0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,215,95,217,216,216,216,216,215,95,217,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
         0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,215,95,217,216,216,216,216,215,95,217,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
@@ -866,7 +873,7 @@ const short* warpclass::loadlevel(int rx, int ry)
         0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,215,95,217,216,216,216,216,215,95,217,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
         0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,215,95,217,216,216,216,216,215,95,217,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
         0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,215,95,217,216,216,216,216,215,95,217,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-        };
+        });
 
         obj.createentity(152, 112, 13);
         obj.createentity(288, 120, 10, 1, 52520);  // (savepoint)
@@ -881,7 +888,7 @@ const short* warpclass::loadlevel(int rx, int ry)
     case rn(50,51):
     {
 
-        static const short contents[] = {
+        ROOM_CONTENTS(LEVELPACK_WARP, t, 0, {
         83,83,83,83,83,83,83,83,83,83,83,83,83,205,203,83,83,83,83,83,83,83,83,83,83,205,0,0,0,0,203,83,83,83,83,83,83,83,83,83,
         83,83,83,83,83,83,83,83,83,83,83,83,83,205,203,83,83,83,83,83,83,83,83,83,83,205,0,0,0,0,203,83,83,83,83,83,83,83,83,83,
         83,83,83,83,83,83,83,83,83,83,83,83,83,205,243,244,244,244,244,244,244,244,244,244,244,245,0,0,0,0,203,83,83,83,83,83,83,83,83,83,
@@ -912,7 +919,7 @@ const short* warpclass::loadlevel(int rx, int ry)
         83,83,83,83,83,83,83,83,83,83,83,83,83,205,163,164,164,164,164,164,164,164,164,164,164,165,0,0,0,0,203,83,83,83,83,83,83,83,83,83,
         83,83,83,83,83,83,83,83,83,83,83,83,83,205,203,83,83,83,83,83,83,83,83,83,83,205,0,0,0,0,203,83,83,83,83,83,83,83,83,83,
         83,83,83,83,83,83,83,83,83,83,83,83,83,205,203,83,83,83,83,83,83,83,83,83,83,205,0,0,0,0,203,83,83,83,83,83,83,83,83,83,
-        };
+        });
 
         obj.createentity(152, 112, 13);
         obj.createentity(24, 128, 10, 1, 52510);  // (savepoint)
@@ -931,7 +938,7 @@ const short* warpclass::loadlevel(int rx, int ry)
     case rn(52,49):
     {
 
-        static const short contents[] = {
+        ROOM_CONTENTS(LEVELPACK_WARP, t, 0, {
         86,86,86,86,86,208,0,0,0,0,206,208,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,206,208,0,0,0,0,206,86,86,86,86,86,
         86,86,86,86,86,208,0,0,0,0,206,208,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,206,208,0,0,0,0,206,86,86,86,86,86,
         86,86,86,86,86,208,0,0,0,0,206,208,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,206,208,0,0,0,0,206,86,86,86,86,86,
@@ -962,7 +969,7 @@ const short* warpclass::loadlevel(int rx, int ry)
         86,86,86,86,86,208,0,0,0,0,206,208,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,206,208,0,0,0,0,206,86,86,86,86,86,
         86,86,86,86,86,208,0,0,0,0,206,208,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,206,208,0,0,0,0,206,86,86,86,86,86,
         86,86,86,86,86,208,0,0,0,0,206,208,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,206,208,0,0,0,0,206,86,86,86,86,86,
-        };
+        });
 
         obj.createentity(152, 112, 13);
         obj.createentity(248, 16, 1, 0, 10, -24, -24, 344, 256);  // Enemy, bounded
@@ -982,7 +989,7 @@ const short* warpclass::loadlevel(int rx, int ry)
     case rn(50,49):
     {
 
-        static const short contents[] = {
+        ROOM_CONTENTS(LEVELPACK_WARP, t, 0, {
         83,83,205,0,0,0,0,0,203,83,83,83,83,83,83,83,83,205,203,83,83,83,205,0,0,0,0,0,203,83,83,83,205,0,0,0,0,0,203,83,
         83,83,205,0,0,0,0,0,243,244,244,244,244,244,244,244,244,245,203,83,83,83,205,0,0,0,0,0,243,244,244,244,245,0,0,0,0,0,203,83,
         83,83,205,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,203,83,83,83,205,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,203,83,
@@ -1013,7 +1020,7 @@ const short* warpclass::loadlevel(int rx, int ry)
         83,83,205,0,0,0,0,0,203,83,83,83,205,163,164,164,164,164,164,164,164,164,165,0,0,0,0,0,203,83,83,83,205,0,0,0,0,0,203,83,
         83,83,205,0,0,0,0,0,203,83,83,83,205,203,83,83,83,83,83,83,83,83,205,0,0,0,0,0,203,83,83,83,205,0,0,0,0,0,203,83,
         83,83,205,0,0,0,0,0,203,83,83,83,205,203,83,83,83,83,83,83,83,83,205,0,0,0,0,0,203,83,83,83,205,0,0,0,0,0,203,83,
-        };
+        });
         rcol = 1;
         warpy = true;
         roomname = "Green Dudes Can't Flip";
@@ -1025,7 +1032,7 @@ const short* warpclass::loadlevel(int rx, int ry)
     case rn(51,49):
     {
 
-        static const short contents[] = {
+        ROOM_CONTENTS(LEVELPACK_WARP, t, 0, {
         0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
         0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
         0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
@@ -1056,7 +1063,7 @@ const short* warpclass::loadlevel(int rx, int ry)
         0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
         0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
         0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-        };
+        });
         warpx = true;
         warpy = true;
         rcol = 5;
@@ -1076,7 +1083,7 @@ const short* warpclass::loadlevel(int rx, int ry)
     case rn(49,49):
     {
 
-        static const short contents[] = {
+        ROOM_CONTENTS(LEVELPACK_WARP, t, 0, {
         80,80,80,80,80,80,80,80,80,80,80,80,80,80,80,202,0,0,0,0,0,0,0,200,80,202,201,201,201,201,201,201,201,201,201,201,201,201,201,201,
         80,80,80,80,80,80,80,80,80,80,80,80,80,80,80,202,0,0,0,0,0,0,0,200,80,202,201,201,201,201,201,201,201,201,201,201,201,201,201,201,
         80,80,80,80,80,80,80,80,80,80,80,80,80,80,80,202,0,0,0,0,0,0,0,200,80,202,201,201,201,201,201,201,201,201,201,201,201,201,201,201,
@@ -1107,7 +1114,7 @@ const short* warpclass::loadlevel(int rx, int ry)
         80,80,80,80,80,80,80,80,80,80,80,80,80,80,80,202,0,0,0,0,0,0,0,200,80,202,201,201,201,201,201,201,201,201,201,201,201,201,201,201,
         80,80,80,80,80,80,80,80,80,80,80,80,80,80,80,202,0,0,0,0,0,0,0,200,80,202,201,201,201,201,201,201,201,201,201,201,201,201,201,201,
         80,80,80,80,80,80,80,80,80,80,80,80,80,80,80,202,0,0,0,0,0,0,0,200,80,202,201,201,201,201,201,201,201,201,201,201,201,201,201,201,
-        };
+        });
         rcol = 0;
         warpy = true;
 
@@ -5,6 +5,8 @@ class warpclass
 {
 public:
     const short* loadlevel(int rx, int ry);
+
+    static int roomindex(int rx, int ry);
     const char* roomname;
     int rcol;
     bool warpx, warpy;
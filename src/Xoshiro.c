@@ -9,6 +9,10 @@ static uint32_t rotl(const uint32_t x, const int k)
 
 static uint32_t s[4];
 
+/* Game logic that used to take rand(), which rendering also takes from a
+ * varying number of times a step, gets its own so replays see the same */
+static uint32_t logic_s[4];
+
 static uint32_t splitmix32(uint32_t* x)
 {
     uint32_t z = (*x += 0x9e3779b9UL);
@@ -17,46 +21,54 @@ static uint32_t splitmix32(uint32_t* x)
     return z ^ (z >> 16);
 }
 
-static void seed(
-    const uint32_t s0,
-    const uint32_t s1,
-    const uint32_t s2,
-    const uint32_t s3
-) {
-    s[0] = s0;
-    s[1] = s1;
-    s[2] = s2;
-    s[3] = s3;
+static void seed(uint32_t* state, uint32_t x)
+{
+    state[0] = splitmix32(&x);
+    state[1] = splitmix32(&x);
+    state[2] = splitmix32(&x);
+    state[3] = splitmix32(&x);
 }
 
-uint32_t xoshiro_next(void)
+static uint32_t next(uint32_t* state)
 {
-    const uint32_t result = s[0] + s[3];
+    const uint32_t result = state[0] + state[3];
 
-    const uint32_t t = s[1] << 9;
+    const uint32_t t = state[1] << 9;
 
-    s[2] ^= s[0];
-    s[3] ^= s[1];
-    s[1] ^= s[2];
-    s[0] ^= s[3];
+    state[2] ^= state[0];
+    state[3] ^= state[1];
+    state[1] ^= state[2];
+    state[0] ^= state[3];
 
-    s[2] ^= t;
+    state[2] ^= t;
 
-    s[3] = rotl(s[3], 11);
+    state[3] = rotl(state[3], 11);
 
     return result;
 }
 
-void xoshiro_seed(uint32_t s)
+uint32_t xoshiro_next(void)
+{
+    return next(s);
+}
+
+void xoshiro_seed(uint32_t x)
 {
-    const uint32_t s0 = splitmix32(&s);
-    const uint32_t s1 = splitmix32(&s);
-    const uint32_t s2 = splitmix32(&s);
-    const uint32_t s3 = splitmix32(&s);
-    seed(s0, s1, s2, s3);
+    seed(s, x);
 }
 
 float xoshiro_rand(void)
 {
     return ((float) xoshiro_next()) / ((float) UINT32_MAX);
 }
+
+void xoshiro_logicseed(uint32_t x)
+{
+    /* Not the same numbers as xoshiro_rand() */
+    seed(logic_s, ~x);
+}
+
+float xoshiro_logicrand(void)
+{
+    return ((float) next(logic_s)) / ((float) UINT32_MAX);
+}
@@ -14,6 +14,10 @@ uint32_t xoshiro_next(void);
 
 float xoshiro_rand(void);
 
+void xoshiro_logicseed(uint32_t s);
+
+float xoshiro_logicrand(void);
+
 #ifdef __cplusplus
 } /* extern "C" */
 #endif
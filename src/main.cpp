@@ -13,22 +13,39 @@
 #include "Entity.h"
 #include "Exit.h"
 #include "FileSystemUtils.h"
+#include "FrameArena.h"
+#include "FrameProfiler.h"
 #include "Game.h"
 #include "Graphics.h"
 #include "Input.h"
+#include "InputJournal.h"
+#include "Jobs.h"
 #include "KeyPoll.h"
 #include "Logic.h"
 #include "Map.h"
+#ifdef MIXER_TEST
+#include "MixerTest.h"
+#endif
 #include "Music.h"
 #include "Network.h"
 #include "preloader.h"
+#include "RAM.h"
 #include "Render.h"
 #include "RenderFixed.h"
+#ifdef ROOM_SOAK
+#include "RoomSoak.h"
+#endif
 #include "Screen.h"
 #include "Script.h"
+#ifdef SCRIPT_BENCHMARK
+#include "ScriptBenchmark.h"
+#endif
 #include "SoundSystem.h"
 #include "UtilityClass.h"
 #include "Vlogging.h"
+#ifdef HEADLESS
+#include "Xoshiro.h"
+#endif
 
 #include <pspkernel.h>
 #include <pspctrl.h>
@@ -57,6 +74,12 @@ KeyPoll key;
 mapclass map;
 entityclass obj;
 Screen __attribute__((aligned(16))) gameScreen;
+#ifdef FRAME_PROFILER
+frameprofilerclass frameprofiler;
+#endif
+#if defined(RECORD_INPUT) || defined(REPLAY_INPUT)
+journalclass journal;
+#endif
 
 static bool startinplaytest = false;
 static bool savefileplaytest = false;
@@ -77,6 +100,8 @@ static volatile Uint32 accumulator = 0;
 #ifndef __EMSCRIPTEN__
 static volatile Uint32 f_time = 0;
 static volatile Uint32 f_timePrev = 0;
+/* How long the last room prefetch took */
+static Uint32 prefetchcost = 0;
 #endif
 
 enum FuncType
@@ -91,6 +116,8 @@ struct ImplFunc
 {
     enum FuncType type;
     void (*func)(void);
+    /* What the frame profiler calls it */
+    const char* name;
 };
 
 static void runscript(void)
@@ -133,71 +160,71 @@ static const inline struct ImplFunc* get_gamestate_funcs(
     case GAMESTATE: \
     { \
         static const struct ImplFunc implfuncs[] = { \
-            {Func_fixed, focused_begin},
+            {Func_fixed, focused_begin, "focused_begin"},
 
 #define FUNC_LIST_END \
-            {Func_fixed, focused_end} \
+            {Func_fixed, focused_end, "focused_end"} \
         }; \
         *num_implfuncs = SDL_arraysize(implfuncs); \
         return implfuncs; \
     }
 
     FUNC_LIST_BEGIN(GAMEMODE)
-        {Func_fixed, runscript},
-        {Func_fixed, gamerenderfixed},
-        {Func_delta, gamerender},
-        {Func_input, gameinput},
-        {Func_fixed, gamelogic},
+        {Func_fixed, runscript, "runscript"},
+        {Func_fixed, gamerenderfixed, "gamerenderfixed"},
+        {Func_delta, gamerender, "gamerender"},
+        {Func_input, gameinput, "gameinput"},
+        {Func_fixed, gamelogic, "gamelogic"},
     FUNC_LIST_END
 
     FUNC_LIST_BEGIN(TITLEMODE)
-        {Func_input, titleinput},
-        {Func_fixed, titlerenderfixed},
-        {Func_delta, titlerender},
-        {Func_fixed, titlelogic},
+        {Func_input, titleinput, "titleinput"},
+        {Func_fixed, titlerenderfixed, "titlerenderfixed"},
+        {Func_delta, titlerender, "titlerender"},
+        {Func_fixed, titlelogic, "titlelogic"},
     FUNC_LIST_END
 
     FUNC_LIST_BEGIN(MAPMODE)
-        {Func_fixed, maprenderfixed},
-        {Func_delta, maprender},
-        {Func_input, mapinput},
-        {Func_fixed, maplogic},
+        {Func_fixed, maprenderfixed, "maprenderfixed"},
+        {Func_delta, maprender, "maprender"},
+        {Func_input, mapinput, "mapinput"},
+        {Func_fixed, maplogic, "maplogic"},
     FUNC_LIST_END
 
     FUNC_LIST_BEGIN(TELEPORTERMODE)
-        {Func_fixed, teleporterrenderfixed},
-        {Func_delta, teleporterrender},
-        {Func_input, teleportermodeinput},
-        {Func_fixed, maplogic},
+        {Func_fixed, teleporterrenderfixed, "teleporterrenderfixed"},
+        {Func_delta, teleporterrender, "teleporterrender"},
+        {Func_input, teleportermodeinput, "teleportermodeinput"},
+        {Func_fixed, maplogic, "maplogic"},
     FUNC_LIST_END
 
     FUNC_LIST_BEGIN(GAMECOMPLETE)
-        {Func_fixed, gamecompleterenderfixed},
-        {Func_delta, gamecompleterender},
-        {Func_input, gamecompleteinput},
-        {Func_fixed, gamecompletelogic},
+        {Func_fixed, gamecompleterenderfixed, "gamecompleterenderfixed"},
+        {Func_delta, gamecompleterender, "gamecompleterender"},
+        {Func_input, gamecompleteinput, "gamecompleteinput"},
+        {Func_fixed, gamecompletelogic, "gamecompletelogic"},
     FUNC_LIST_END
 
     FUNC_LIST_BEGIN(GAMECOMPLETE2)
-        {Func_delta, gamecompleterender2},
-        {Func_input, gamecompleteinput2},
-        {Func_fixed, gamecompletelogic2},
+        {Func_delta, gamecompleterender2, "gamecompleterender2"},
+        {Func_input, gamecompleteinput2, "gamecompleteinput2"},
+        {Func_fixed, gamecompletelogic2, "gamecompletelogic2"},
     FUNC_LIST_END
 
 #if !defined(NO_CUSTOM_LEVELS) && !defined(NO_EDITOR)
     FUNC_LIST_BEGIN(EDITORMODE)
-        {Func_fixed, flipmodeoff},
-        {Func_input, editorinput},
-        {Func_fixed, editorrenderfixed},
-        {Func_delta, editorrender},
-        {Func_fixed, editorlogic},
+        {Func_fixed, flipmodeoff, "flipmodeoff"},
+        {Func_input, editorinput, "editorinput"},
+        {Func_fixed, editorrenderfixed, "editorrenderfixed"},
+        {Func_delta, editorrender, "editorrender"},
+        {Func_fixed, editorlogic, "editorlogic"},
     FUNC_LIST_END
 #endif
 
     FUNC_LIST_BEGIN(PRELOADER)
-        {Func_input, preloaderinput},
-        {Func_fixed, preloaderrenderfixed},
-        {Func_delta, preloaderrender},
+        {Func_input, preloaderinput, "preloaderinput"},
+        {Func_fixed, preloaderrenderfixed, "preloaderrenderfixed"},
+        {Func_delta, preloaderrender, "preloaderrender"},
     FUNC_LIST_END
 
 #undef FUNC_LIST_END
@@ -249,11 +276,13 @@ static void unfocused_run(void);
 static const struct ImplFunc unfocused_func_list[] = {
     {
         Func_input, /* we still need polling when unfocused */
-        NULL
+        NULL,
+        "poll"
     },
     {
         Func_delta,
-        unfocused_run
+        unfocused_run,
+        "unfocused_run"
     }
 };
 static const struct ImplFunc* unfocused_funcs = unfocused_func_list;
@@ -313,11 +342,13 @@ static enum LoopCode loop_run_active_funcs(void)
 
         if (implfunc->type == Func_input && !game.inputdelay)
         {
+            PROFILE_ZONE("key.Poll");
             key.Poll();
         }
 
         if (implfunc->type != Func_null && implfunc->func != NULL)
         {
+            PROFILE_ZONE(implfunc->name);
             implfunc->func();
         }
 
@@ -361,10 +392,141 @@ static void inline fixedloop(void)
     }
 }
 
+static void inline fixedstep(void)
+{
+    enum IndexCode index_code = increment_func_index();
+
+    if (index_code == Index_end)
+    {
+        loop_assign_active_funcs();
+    }
+
+    /* We are done rendering. */
+    graphics.renderfixedpost();
+
+    PROFILE_ZONE("fixedloop");
+    fixedloop();
+}
+
 static void inline deltaloop(void);
 
 static void cleanup(void);
 
+#ifdef HEADLESS
+static bool headlessdone(void)
+{
+#ifdef REPLAY_INPUT
+    if (journal.finished())
+    {
+        return true;
+    }
+#endif
+    /* The credits are as far as a run goes */
+    return game.gamestate == GAMECOMPLETE;
+}
+
+/* Steps the game up to ticks times, or until done() says so, as fast as it
+ * goes. Nothing is drawn, so there's no waiting for the screen either. */
+static void headlessloop(const Uint32 ticks, bool (*done)(void))
+{
+    const Uint32 start = SDL_GetTicks();
+    Uint32 tick = 0;
+    Uint32 played_ms = 0;
+
+    while (tick < ticks && !done())
+    {
+        played_ms += game.get_timestep();
+        fixedstep();
+        FRAME_end();
+        tick++;
+    }
+
+    const Uint32 took_ms = SDL_max(SDL_GetTicks() - start, 1);
+    vlog_info(
+        "HEADLESS | %u ticks (%u ms of play) took %u ms, %u ticks a second",
+        tick,
+        played_ms,
+        took_ms,
+        (Uint32) ((Uint64) tick * 1000 / took_ms)
+    );
+    vlog_info(
+        "HEADLESS | Ended in gamestate %i, room %i,%i, %i deaths",
+        game.gamestate,
+        game.roomx,
+        game.roomy,
+        game.deathcounts
+    );
+}
+#endif
+
+#ifdef DECODE_TRACK
+/* Writes one music track out as a WAV, without the audio device or the
+ * decoding thread getting involved, so it can be checked by ear or diffed.
+ * Before that, measures what every track's decoder takes up, and fails if
+ * the most of it doesn't fit in the music's memory budget. */
+static void decodetrack(const int track)
+{
+    /* Vorbis has allocated all it keeps by then, about 1.5 seconds in */
+    static const Uint32 measure_bytes = 256 * 1024;
+    char filename[32];
+    Uint32 largest = 0;
+    int largesttrack = -1;
+
+    if (track < 0
+    || (size_t) track >= music.musicTracks.size()
+    || music.musicTracks[track].file == NULL)
+    {
+        vlog_error("There's no music track %i to decode", track);
+        VVV_exit(1);
+    }
+
+    /* Nothing else may allocate while the decoder's being measured */
+    JOB_wait();
+
+    for (size_t i = 0; i < music.musicTracks.size(); i++)
+    {
+        if (music.musicTracks[i].file == NULL)
+        {
+            continue;
+        }
+
+        /* All of the track that's decoded, only the start of the others */
+        const Uint32 peak = musicstreamclass::measuredecoder(
+            music.musicTracks[i],
+            (int) i == track ? 0 : measure_bytes
+        );
+        vlog_info("MUSIC | Track %i's decoder takes up to %u KB", (int) i, (unsigned int) (peak / 1024));
+        if (peak > largest)
+        {
+            largest = peak;
+            largesttrack = i;
+        }
+    }
+
+    const Uint32 total = musicstreamclass::buffer_bytes() + largest;
+    const bool fits = total <= musicstreamclass::memory_budget;
+    vlog_info(
+        "MUSIC | At most %u KB of %u KB: %u KB of buffers, %u KB for track %i's decoder",
+        (unsigned int) (total / 1024),
+        (unsigned int) (musicstreamclass::memory_budget / 1024),
+        (unsigned int) (musicstreamclass::buffer_bytes() / 1024),
+        (unsigned int) (largest / 1024),
+        largesttrack
+    );
+    if (!fits)
+    {
+        vlog_error("Music doesn't fit in its memory budget");
+    }
+
+    SDL_snprintf(filename, sizeof(filename), "track%02i.wav", track);
+    if (!musicstreamclass::decodetowav(music.musicTracks[track], filename))
+    {
+        VVV_exit(1);
+    }
+    VVV_exit(fits ? 0 : 1);
+}
+#endif
+
 #ifdef __EMSCRIPTEN__
 static void emscriptenloop(void)
 {
@@ -401,9 +563,19 @@ int main(int argc, char *argv[])
     char* baseDir = NULL;
     char* assetsPath = NULL;
 
+    RAM_init();
     pspDebugScreenInit();
     vlog_init();
 
+#ifdef VLOG_BENCHMARK
+    vlog_benchmark();
+    VVV_exit(0);
+#endif
+
+#ifdef MIXER_TEST
+    VVV_exit(MIXERTEST_run() ? 0 : 1);
+#endif
+
     vlog_debug("Free mem: %.1f MB", (float)sceKernelTotalFreeMemSize() / (1024 * 1024));
 
     psp_setup_callbacks();
@@ -420,6 +592,18 @@ int main(int argc, char *argv[])
         VVV_exit(1);
     }
 
+    JOB_init();
+
+#ifdef LEVEL_PACK
+    if (!map.levelpack.load("levels.vvp"))
+    {
+        vlog_error("Unable to load the level pack!");
+        VVV_exit(1);
+    }
+    map.tower.loadbackground();
+    map.tower.loadmap();
+#endif
+
     // Sorry Terry, but noone is going to see Viridian anyways.
 #if 0
     pspDebugScreenClear();
@@ -461,9 +645,14 @@ int main(int argc, char *argv[])
     vlog_info("Initializing game state");
     game.init();
 
-    // This loads music too...
-    vlog_info("Reloading resources");
-    if (!graphics.reloadresources())
+    // This loads music too... The preloader shows the rest loading, it
+    // only needs the font.
+    vlog_info("Loading resources");
+    graphics.startresources();
+#ifdef DECODE_TRACK
+    decodetrack(DECODE_TRACK);
+#endif
+    if (!graphics.loadfont())
     {
         /* Something wrong with the default assets? We can't use them to
          * display the error message, and we have to bail. */
@@ -490,8 +679,16 @@ int main(int argc, char *argv[])
         // Prioritize unlock.vvv first (2.2 and below),
         // but settings have been migrated to settings.vvv (2.3 and up)
         ScreenSettings screen_settings;
+#ifndef HEADLESS
         game.loadstats(&screen_settings);
         game.loadsettings(&screen_settings);
+#else
+        /* Runs must go the same on every machine, whatever's saved on it */
+        game.rngseed = HEADLESS_SEED;
+        xoshiro_seed(game.rngseed);
+        xoshiro_logicseed(game.rngseed);
+        srand(game.rngseed);
+#endif
         gameScreen.init(screen_settings);
     }
     graphics.screenbuffer = &gameScreen;
@@ -501,8 +698,27 @@ int main(int argc, char *argv[])
     vlog_info("Creating screen buffers");
     graphics.create_buffers(gameScreen.GetFormat());
 
+#if defined(HEADLESS) || defined(REPLAY_INPUT)
+    /* Straight into the game, without the loading screen */
+    game.skipfakeload = true;
+#endif
     if (game.skipfakeload)
         game.gamestate = TITLEMODE;
+    if (game.gamestate != PRELOADER || startinplaytest)
+        preloaderfinish();
+#ifdef ROOM_SOAK
+    preloaderfinish();
+    ROOMSOAK_run(10);
+    VVV_exit(0);
+#endif
+#ifdef SCRIPT_BENCHMARK
+    preloaderfinish();
+    {
+        const bool tokenized = SCRIPTBENCH_tokenizer();
+        const bool dispatched = SCRIPTBENCH_dispatch();
+        VVV_exit(tokenized && dispatched ? 0 : 1);
+    }
+#endif
     if (game.slowdown == 0) game.slowdown = 30;
 
     //Check to see if you've already unlocked some achievements here from before the update
@@ -587,9 +803,28 @@ int main(int argc, char *argv[])
 
     key.isActive = true;
 
+#ifdef REPLAY_INPUT
+    if (!journal.beginreplay())
+    {
+        VVV_exit(1);
+    }
+    game.rngseed = journal.seed;
+    game.inputdelay = journal.inputdelay;
+    script.startgamemode(journal.startmode);
+#elif defined(HEADLESS)
+    /* A new game, so that there's something going on */
+    script.startgamemode(0);
+#endif
+
     gamestate_funcs = get_gamestate_funcs(game.gamestate, &num_gamestate_funcs);
     loop_assign_active_funcs();
 
+#ifdef HEADLESS
+    headlessloop(HEADLESS_TICKS, headlessdone);
+    RAM_logUsage();
+    VVV_exit(0);
+#endif
+
 #ifdef PSP_HANDICAP
     // Slow down there chief.
     scePowerSetClockFrequency(166, 166, 83);
@@ -599,7 +834,39 @@ int main(int argc, char *argv[])
     {
         f_time = SDL_GetTicks();
 
-        const Uint32 f_timetaken = f_time - f_timePrev;
+        Uint32 f_timetaken = f_time - f_timePrev;
+
+        /* Time to spare before the next frame at 30 FPS, or before the next
+         * game step is due when frames are interpolated */
+        Uint32 f_timeleft;
+        if (game.over30mode)
+        {
+            const Uint32 timestep = game.get_timestep();
+            const Uint32 sincestep = accumulator + (f_time - time_);
+            f_timeleft = sincestep < timestep ? timestep - sincestep : 0;
+        }
+        else
+        {
+            f_timeleft = f_timetaken < 34 ? 34 - f_timetaken : 0;
+        }
+
+        /* Get the next room ready with it, if the last one fit in that */
+        if (f_timeleft > prefetchcost)
+        {
+            const Uint32 prefetchstart = f_time;
+            if (map.prefetchroom())
+            {
+                f_time = SDL_GetTicks();
+                f_timetaken = f_time - f_timePrev;
+                prefetchcost = f_time - prefetchstart;
+            }
+        }
+        else if (prefetchcost > 0)
+        {
+            /* One slow room would otherwise stop prefetching for good, as
+             * there'd never be that much time left again */
+            prefetchcost--;
+        }
         if (!game.over30mode && f_timetaken < 34)
         {
             const volatile Uint32 f_delay = 34 - f_timetaken;
@@ -609,10 +876,44 @@ int main(int argc, char *argv[])
 
         f_timePrev = f_time;
 
+#ifdef SCRIPT_PROFILER
+        {
+            static bool dumpheld = false;
+            const bool dumpdown = key.isProfilerDown(SDL_CONTROLLER_BUTTON_Y);
+            if (dumpdown && !dumpheld)
+            {
+                script.profiler.dump("scriptprofile.txt");
+            }
+            dumpheld = dumpdown;
+        }
+#endif
+#ifdef FRAME_PROFILER
+        {
+            static bool overlayheld = false;
+            static bool dumpheld = false;
+            const bool overlaydown = key.isProfilerDown(SDL_CONTROLLER_BUTTON_X);
+            const bool dumpdown = key.isProfilerDown(SDL_CONTROLLER_BUTTON_B);
+            if (overlaydown && !overlayheld)
+            {
+                frameprofiler.overlay = !frameprofiler.overlay;
+            }
+            if (dumpdown && !dumpheld)
+            {
+                frameprofiler.dump("frameprofile.json");
+            }
+            overlayheld = overlaydown;
+            dumpheld = dumpdown;
+        }
+#endif
+
         timePrev = time_;
         time_ = SDL_GetTicks();
 
         deltaloop();
+
+#ifdef FRAME_PROFILER
+        frameprofiler.endframe();
+#endif
     }
 
 
@@ -626,7 +927,17 @@ static void cleanup(void)
     /* Order matters! */
     sceGuTerm(); // oh does it?
     game.savestatsandsettings();
+#ifdef RECORD_INPUT
+    journal.endrecording();
+#endif
+#ifdef SCRIPT_PROFILER
+    script.profiler.dump("scriptprofile.txt");
+#endif
+#ifdef FRAME_PROFILER
+    frameprofiler.dump("frameprofile.json");
+#endif
     gameScreen.destroy();
+    JOB_quit();
     graphics.grphx.destroy();
     graphics.destroy_buffers();
     graphics.destroy();
@@ -634,12 +945,23 @@ static void cleanup(void)
     NETWORK_shutdown();
     SDL_Quit();
     FILESYSTEM_deinit();
+
+    /* Global destructors haven't run yet, what they free shows up here too */
+    RAM_logUsage();
+    RAM_logLeaks();
+
+    vlog_quit();
 }
 
 SDL_NORETURN void VVV_exit(const int exit_code)
 {
     // Hopefully nothing too radioactive happens because of not deinitializing things.
     // cleanup();
+#ifdef RECORD_INPUT
+    journal.endrecording();
+#endif
+    // What's still queued would be lost otherwise.
+    vlog_quit();
     // And also hopefully nothing nuclear happens when we exit from the main thread.
     sceKernelExitGame();
     // ^ This function does not return but is not annotated as such, hence why clangd complains.
@@ -655,19 +977,9 @@ static void inline deltaloop(void)
 
     while (accumulator >= timesteplimit)
     {
-        enum IndexCode index_code = increment_func_index();
-
-        if (index_code == Index_end)
-        {
-            loop_assign_active_funcs();
-        }
-
         accumulator = SDL_fmodf(accumulator, timesteplimit);
 
-        /* We are done rendering. */
-        graphics.renderfixedpost();
-
-        fixedloop();
+        fixedstep();
     }
     const float alpha = game.over30mode ? static_cast<float>(accumulator) / timesteplimit : 1.0f;
     graphics.alpha = alpha;
@@ -687,7 +999,10 @@ static void inline deltaloop(void)
         if (implfunc->type == Func_delta && implfunc->func != NULL)
         {
             gpu::start();
-            implfunc->func();
+            {
+                PROFILE_ZONE(implfunc->name);
+                implfunc->func();
+            }
             gpu::end();
 
             gameScreen.FlipScreen(graphics.flipmode);
@@ -730,6 +1045,9 @@ static void unfocused_run(void)
 static void focused_begin(void)
 {
     map.nexttowercolour_set = false;
+
+    /* Contacts are only ever reused within a single logic tick */
+    obj.invalidatecontacts();
 }
 
 static void focused_end(void)
@@ -772,22 +1090,27 @@ static enum LoopCode loop_end(void)
         game.musicmutebutton--;
     }
 
+    /* The mixer only hears about these when they change */
     if (game.muted)
     {
-        Mix_VolumeMusic(0) ;
-        Mix_Volume(-1,0);
+        music.mixer.setmusicvolume(0, 0);
+        music.mixer.seteffectvolume(0);
     }
     else
     {
-        Mix_Volume(-1,MIX_MAX_VOLUME * music.user_sound_volume / USER_VOLUME_MAX);
+        music.mixer.seteffectvolume(MIX_MAX_VOLUME * music.user_sound_volume / USER_VOLUME_MAX);
 
         if (game.musicmuted)
         {
-            Mix_VolumeMusic(0);
+            music.mixer.setmusicvolume(0, 0);
         }
         else
         {
-            Mix_VolumeMusic(music.musicVolume * music.user_music_volume / USER_VOLUME_MAX);
+            /* Spread each step of a fade over the tick */
+            music.mixer.setmusicvolume(
+                music.musicVolume * music.user_music_volume / USER_VOLUME_MAX,
+                game.get_timestep()
+            );
         }
     }
 
@@ -796,5 +1119,9 @@ static enum LoopCode loop_end(void)
         key.resetWindow = false;
     }
 
+    /* Hands over prefetched images, and lets go of ones no longer drawn */
+    JOB_pump(0);
+    graphics.grphx.updateimages();
+
     return Loop_continue;
 }
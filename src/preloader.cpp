@@ -1,16 +1,56 @@
+#include "preloader.h"
+
+#include <pspdebug.h>
+
 #include "Enums.h"
+#include "Exit.h"
+#include "FileSystemUtils.h"
 #include "Game.h"
 #include "Graphics.h"
+#include "Jobs.h"
 #include "KeyPoll.h"
+#include "RAM.h"
 #include "UtilityClass.h"
+#include "Vlogging.h"
 
 static int pre_fakepercent=0, pre_transition=30;
 static bool pre_startgame=false;
+static bool pre_loaded=false;
+
+/* How long loading can hold up a frame, if there are no job threads */
+static const Uint32 pre_loadbudget = 20;
 static int pre_darkcol=0, pre_lightcol=0, pre_curcol=0, pre_coltimer=0, pre_offset=0;
 
 static int pre_frontrectx=30, pre_frontrecty=20, pre_frontrectw=260, pre_frontrecth=200;
 static int pre_temprectx=0, pre_temprecty=0, pre_temprectw=320, pre_temprecth=240;
 
+void preloaderfinish(void)
+{
+  if (pre_loaded) {
+    return;
+  }
+  pre_loaded = true;
+
+  if (!graphics.finishresources())
+  {
+    /* Something wrong with the default assets? We can't use them to
+     * display the error message, and we have to bail. */
+    pspDebugScreenInit();
+    vlog_error("%s: %s", graphics.error_title, graphics.error);
+
+    VVV_exit(1);
+  }
+
+  FILESYSTEM_logLoadTime();
+  vlog_info(
+    "Startup took %u ms, %i of %i images came from textures.v4t",
+    SDL_GetTicks(),
+    graphics.grphx.num_cooked,
+    graphics.grphx.num_images
+  );
+  RAM_logUsage();
+}
+
 void preloaderinput(void)
 {
   game.press_action = false;
@@ -21,6 +61,7 @@ void preloaderinput(void)
 
   if (game.press_action) {
     //Skip to TITLEMODE immediately
+    preloaderfinish();
     game.gamestate = TITLEMODE;
     game.jumpheld = true;
   }
@@ -30,9 +71,12 @@ void preloaderrenderfixed(void)
 {
   if (pre_transition < 30) pre_transition--;
   if(pre_transition>=30){
-    pre_fakepercent++;
+    //The bar follows the loading jobs
+    if (!pre_loaded && JOB_pump(pre_loadbudget)) {
+      preloaderfinish();
+    }
+    pre_fakepercent = pre_loaded ? 100 : SDL_min(JOB_percent(), 99);
     if (pre_fakepercent >= 100) {
-      pre_fakepercent = 100;
       pre_startgame = true;
     }
 
@@ -1,6 +1,9 @@
 #ifndef PRELOADER_H
 #define PRELOADER_H
 
+/* Finishes loading what main started, if it hasn't already */
+void preloaderfinish(void);
+
 void preloaderinput(void);
 
 void preloaderrender(void);
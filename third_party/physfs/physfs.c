@@ -1184,6 +1184,9 @@ static int initStaticArchivers(void)
     #if PHYSFS_SUPPORTS_VDF
         REGISTER_STATIC_ARCHIVER(VDF)
     #endif
+    #if PHYSFS_SUPPORTS_V4PSP
+        REGISTER_STATIC_ARCHIVER(V4PSP)
+    #endif
 
     #undef REGISTER_STATIC_ARCHIVER
 
@@ -0,0 +1,191 @@
+/*
+ * V4PSP support routines for PhysicsFS.
+ *
+ * This is the uncompressed data archive that VVVVVV's
+ *  scripts/repack_data.py makes out of data.zip. It looks like this:
+ *
+ *  "V4PSP" magic, a uint8 entry count and three bytes of padding, then for
+ *  every entry a uint32 name length, the name (not null-terminated) and a
+ *  uint32 file size. The files follow the table back to back, in the same
+ *  order. Everything is little endian. Names are relative paths, so the
+ *  directories are implied.
+ *
+ * Nothing is compressed, so reads go straight to the archive's Io, see
+ *  physfs_archiver_unpacked.c.
+ *
+ * Please see the file LICENSE.txt in the source's root directory.
+ */
+
+#define __PHYSICSFS_INTERNAL__
+#include "physfs_internal.h"
+
+#if PHYSFS_SUPPORTS_V4PSP
+
+#define V4PSP_HEADER_SIZE 9
+#define V4PSP_MAX_NAME 255
+
+/* Walks the entry table in buf. Returns the size of the table, or 0 if it
+ *  doesn't all fit in len bytes. If arc isn't NULL, the entries get added
+ *  to it, with their data starting at dataStart. */
+static PHYSFS_uint32 v4pspWalkEntries(const PHYSFS_uint8 *buf,
+                                      const PHYSFS_uint32 len,
+                                      const PHYSFS_uint32 count,
+                                      void *arc,
+                                      PHYSFS_uint64 dataStart,
+                                      int *corrupt)
+{
+    PHYSFS_uint32 pos = 0;
+    PHYSFS_uint32 i;
+
+    for (i = 0; i < count; i++)
+    {
+        char name[V4PSP_MAX_NAME + 1];
+        PHYSFS_uint32 namelen;
+        PHYSFS_uint32 size;
+        PHYSFS_uint32 j;
+
+        if (len - pos < 4)
+            return 0;
+        memcpy(&namelen, &buf[pos], 4);
+        namelen = PHYSFS_swapULE32(namelen);
+        pos += 4;
+
+        if (namelen == 0 || namelen > V4PSP_MAX_NAME)
+        {
+            *corrupt = 1;
+            return 0;
+        } /* if */
+
+        if (len - pos < namelen + 4)
+            return 0;
+
+        memcpy(&size, &buf[pos + namelen], 4);
+        size = PHYSFS_swapULE32(size);
+
+        if (arc != NULL)
+        {
+            memcpy(name, &buf[pos], namelen);
+            name[namelen] = '\0';
+
+            /* The repack script may have run on Windows */
+            for (j = 0; j < namelen; j++)
+            {
+                if (name[j] == '\\')
+                    name[j] = '/';
+            } /* for */
+
+            if (!UNPK_addEntry(arc, name, 0, -1, -1, dataStart, size))
+                return 0;
+            dataStart += size;
+        } /* if */
+
+        pos += namelen + 4;
+    } /* for */
+
+    return pos;
+} /* v4pspWalkEntries */
+
+
+static int v4pspLoadEntries(PHYSFS_Io *io, const PHYSFS_uint32 count,
+                            void *arc)
+{
+    const PHYSFS_sint64 filelen = io->length(io);
+    PHYSFS_uint32 guess = count * 64;
+    PHYSFS_uint8 *buf = NULL;
+    PHYSFS_uint32 tablelen = 0;
+    int corrupt = 0;
+
+    BAIL_IF_ERRPASS(filelen < 0, 0);
+    BAIL_IF(filelen < V4PSP_HEADER_SIZE, PHYSFS_ERR_CORRUPT, 0);
+    /* Nothing to find in it, and a guess of 0 would never grow */
+    BAIL_IF(count == 0, PHYSFS_ERR_CORRUPT, 0);
+    BAIL_IF(filelen == V4PSP_HEADER_SIZE, PHYSFS_ERR_CORRUPT, 0);
+
+    /* Read the whole table in one go, guessing its size, and read it again
+     *  with a bigger guess if it didn't fit */
+    while (tablelen == 0)
+    {
+        const PHYSFS_uint64 avail = filelen - V4PSP_HEADER_SIZE;
+        const PHYSFS_uint32 len = (avail < guess) ? (PHYSFS_uint32) avail : guess;
+        PHYSFS_uint8 *ptr = (PHYSFS_uint8 *) allocator.Realloc(buf, len);
+        GOTO_IF(!ptr, PHYSFS_ERR_OUT_OF_MEMORY, v4pspLoad_failed);
+        buf = ptr;
+
+        GOTO_IF_ERRPASS(!io->seek(io, V4PSP_HEADER_SIZE), v4pspLoad_failed);
+        GOTO_IF_ERRPASS(!__PHYSFS_readAll(io, buf, len), v4pspLoad_failed);
+
+        tablelen = v4pspWalkEntries(buf, len, count, NULL, 0, &corrupt);
+        GOTO_IF(corrupt, PHYSFS_ERR_CORRUPT, v4pspLoad_failed);
+        /* All of the file's been read, there's no bigger guess to try */
+        GOTO_IF(tablelen == 0 && len == avail, PHYSFS_ERR_CORRUPT, v4pspLoad_failed);
+
+        guess *= 2;
+    } /* while */
+
+    if (!v4pspWalkEntries(buf, tablelen, count, arc,
+                          V4PSP_HEADER_SIZE + tablelen, &corrupt))
+        goto v4pspLoad_failed;
+
+    allocator.Free(buf);
+    return 1;
+
+v4pspLoad_failed:
+    if (buf != NULL)
+        allocator.Free(buf);
+    return 0;
+} /* v4pspLoadEntries */
+
+
+static void *V4PSP_openArchive(PHYSFS_Io *io, const char *name,
+                               int forWriting, int *claimed)
+{
+    PHYSFS_uint8 header[V4PSP_HEADER_SIZE];
+    void *unpkarc = NULL;
+
+    assert(io != NULL);  /* shouldn't ever happen. */
+
+    BAIL_IF(forWriting, PHYSFS_ERR_READ_ONLY, NULL);
+
+    BAIL_IF_ERRPASS(!__PHYSFS_readAll(io, header, sizeof (header)), NULL);
+    if (memcmp(header, "V4PSP", 5) != 0)
+        BAIL(PHYSFS_ERR_UNSUPPORTED, NULL);
+
+    *claimed = 1;
+
+    unpkarc = UNPK_openArchive(io);
+    BAIL_IF_ERRPASS(!unpkarc, NULL);
+
+    if (!v4pspLoadEntries(io, header[5], unpkarc))
+    {
+        UNPK_abandonArchive(unpkarc);
+        return NULL;
+    } /* if */
+
+    return unpkarc;
+} /* V4PSP_openArchive */
+
+
+const PHYSFS_Archiver __PHYSFS_Archiver_V4PSP =
+{
+    CURRENT_PHYSFS_ARCHIVER_API_VERSION,
+    {
+        "PSP",
+        "VVVVVV uncompressed data archive",
+        "VVVVVV PSP port",
+        "",
+        0,  /* supportsSymlinks */
+    },
+    V4PSP_openArchive,
+    UNPK_enumerate,
+    UNPK_openRead,
+    UNPK_openWrite,
+    UNPK_openAppend,
+    UNPK_remove,
+    UNPK_mkdir,
+    UNPK_stat,
+    UNPK_closeArchive
+};
+
+#endif  /* defined PHYSFS_SUPPORTS_V4PSP */
+
+/* end of physfs_archiver_v4psp.c ... */
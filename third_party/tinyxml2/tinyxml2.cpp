@@ -188,7 +188,7 @@ void StrPair::TransferTo( StrPair* other )
 void StrPair::Reset()
 {
     if ( _flags & NEEDS_DELETE ) {
-        delete [] _start;
+        TIXML_FREE( _start );
     }
     _flags = 0;
     _start = 0;
@@ -202,7 +202,7 @@ void StrPair::SetStr( const char* str, int flags )
     Reset();
     size_t len = strlen( str );
     TIXMLASSERT( _start == 0 );
-    _start = new char[ len+1 ];
+    _start = TIXML_ALLOC( char, len+1 );
     memcpy( _start, str, len+1 );
     _end = _start + len;
     _flags = flags | NEEDS_DELETE;
@@ -2178,7 +2178,7 @@ void XMLDocument::Clear()
 #endif
     ClearError();
 
-    delete [] _charBuffer;
+    TIXML_FREE( _charBuffer );
     _charBuffer = 0;
 	_parsingDepth = 0;
 
@@ -2345,7 +2345,7 @@ XMLError XMLDocument::LoadFile( FILE* fp )
 
     const size_t size = static_cast<size_t>(filelength);
     TIXMLASSERT( _charBuffer == 0 );
-    _charBuffer = new char[size+1];
+    _charBuffer = TIXML_ALLOC( char, size+1 );
     const size_t read = fread( _charBuffer, 1, size, fp );
     if ( read != size ) {
         SetError( XML_ERROR_FILE_READ_ERROR, 0, 0 );
@@ -2401,7 +2401,7 @@ XMLError XMLDocument::Parse( const char* p, size_t len )
         len = strlen( p );
     }
     TIXMLASSERT( _charBuffer == 0 );
-    _charBuffer = new char[ len+1 ];
+    _charBuffer = TIXML_ALLOC( char, len+1 );
     memcpy( _charBuffer, p, len );
     _charBuffer[len] = 0;
 
@@ -2440,7 +2440,7 @@ void XMLDocument::SetError( XMLError error, int lineNum, const char* format, ...
 	_errorStr.Reset();
 
     const size_t BUFFER_SIZE = 1000;
-    char* buffer = new char[BUFFER_SIZE];
+    char* buffer = TIXML_ALLOC( char, BUFFER_SIZE );
 
     TIXMLASSERT(sizeof(error) <= sizeof(int));
     TIXML_SNPRINTF(buffer, BUFFER_SIZE, "Error=%s ErrorID=%d (0x%x) Line number=%d", ErrorIDToName(error), int(error), int(error), lineNum);
@@ -2456,7 +2456,7 @@ void XMLDocument::SetError( XMLError error, int lineNum, const char* format, ...
 		va_end(va);
 	}
 	_errorStr.SetStr(buffer);
-	delete[] buffer;
+	TIXML_FREE( buffer );
 }
 
 
@@ -42,6 +42,11 @@ distribution.
 #endif
 #include <stdint.h>
 
+// PSP: everything is allocated through RAM.c, so that it gets counted
+#include "RAM.h"
+#define TIXML_ALLOC( type, count )        static_cast<type*>( RAM_mallocTagged( sizeof( type ) * ( count ), RAM_TAG_XML ) )
+#define TIXML_FREE( ptr )                 RAM_free( ptr )
+
 /*
    TODO: intern strings instead of allocation.
 */
@@ -214,7 +219,7 @@ public:
 
     ~DynArray() {
         if ( _mem != _pool ) {
-            delete [] _mem;
+            TIXML_FREE( _mem );
         }
     }
 
@@ -304,11 +309,11 @@ private:
         if ( cap > _allocated ) {
             TIXMLASSERT( cap <= INT_MAX / 2 );
             const int newAllocated = cap * 2;
-            T* newMem = new T[newAllocated];
+            T* newMem = TIXML_ALLOC( T, newAllocated );
             TIXMLASSERT( newAllocated >= _size );
             memcpy( newMem, _mem, sizeof(T)*_size );	// warning: not using constructors, only works for PODs
             if ( _mem != _pool ) {
-                delete [] _mem;
+                TIXML_FREE( _mem );
             }
             _mem = newMem;
             _allocated = newAllocated;
@@ -355,7 +360,7 @@ public:
         // Delete the blocks.
         while( !_blockPtrs.Empty()) {
             Block* lastBlock = _blockPtrs.Pop();
-            delete lastBlock;
+            TIXML_FREE( lastBlock );
         }
         _root = 0;
         _currentAllocs = 0;
@@ -374,7 +379,7 @@ public:
     virtual void* Alloc() {
         if ( !_root ) {
             // Need a new block.
-            Block* block = new Block();
+            Block* block = TIXML_ALLOC( Block, 1 );
             _blockPtrs.Push( block );
 
             Item* blockItems = block->items;